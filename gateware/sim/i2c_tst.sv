@@ -0,0 +1,407 @@
+/*
+     __        __   __   ___ ___ ___  __
+    |__)  /\  |__) |__) |__   |   |  /  \
+    |    /~~\ |  \ |  \ |___  |   |  \__/
+
+    I2C command sequencer testbench
+    Written by Marco Groeneveld
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+*/
+
+`timescale 1ns / 1ps
+`default_nettype none
+
+module i2c_tst ();
+
+// Parameters
+localparam P_VENDOR = "AMD";            // Vendor
+localparam P_BEAT = 'd25;               // Beat value (100 MHz / 4 / 25 = 1 MHz bit rate)
+localparam P_SLV_ADR = 7'h09;           // Slave address
+localparam P_TIMEOUT = 5_000_000;       // Sequencer time out (ns)
+
+// Registers
+localparam P_REG_CTL = 0;
+localparam P_REG_STA = 1;
+localparam P_REG_BEAT = 2;
+localparam P_REG_SEQ_ADR = 5;
+localparam P_REG_SEQ_DAT = 6;
+
+// Control register
+localparam P_CTL_RUN = (1 << 0);
+localparam P_CTL_IE = (1 << 8);
+localparam P_CTL_SEQ = (1 << 9);
+
+// Status register
+localparam P_STA_BUS = (1 << 3);
+localparam P_STA_SEQ_BUSY = (1 << 4);
+localparam P_STA_SEQ_DONE = (1 << 5);
+localparam P_STA_SEQ_NACK = (1 << 6);
+
+// Sequencer commands
+localparam P_SEQ_END = 16'h0000;
+localparam P_SEQ_STR = 16'h1000;
+localparam P_SEQ_WR = 16'h2000;
+localparam P_SEQ_RD = 16'h3000;
+localparam P_SEQ_STP = 16'h4000;
+localparam P_SEQ_DLY = 16'h5000;
+localparam P_SEQ_ACK = 16'h0100;
+
+// Interfaces
+prt_dp_lb_if
+#(
+  .P_ADR_WIDTH  (16)
+)
+lb_if();
+
+// Signals
+logic sys_clk;
+logic sys_rst;
+wire irq_from_i2c;
+
+// I2C
+wire i2c_scl;
+wire i2c_sda;
+pullup (i2c_scl);
+pullup (i2c_sda);
+
+// Slave
+logic slv_sda;
+logic [7:0] slv_reg [0:511];
+logic [15:0] slv_ofs;
+
+// Test
+logic [31:0] dat;
+int err;
+
+// System clock 100 MHz
+initial
+begin
+    sys_clk <= 0;
+    forever
+        #5ns sys_clk <= ~sys_clk;
+end
+
+// Reset
+initial
+begin
+    sys_rst <= 1;
+    #500ns
+    sys_rst <= 0;
+end
+
+// I2C
+    prt_i2c
+    #(
+        .P_VENDOR           (P_VENDOR),
+        .P_SEQ              (1)             // Command sequencer
+    )
+    I2C_INST
+    (
+        // Reset and clock
+        .RST_IN             (sys_rst),
+        .CLK_IN             (sys_clk),
+
+        // Local bus interface
+        .LB_IF              (lb_if),
+
+        // Direct I2C Access
+        .DIA_RDY_OUT        (),
+        .DIA_DAT_IN         (32'h0),
+        .DIA_VLD_IN         (1'b0),
+
+        // Interrupt
+        .IRQ_OUT            (irq_from_i2c),
+
+        // I2C
+        .I2C_SCL_INOUT      (i2c_scl),      // SCL
+        .I2C_SDA_INOUT      (i2c_sda)       // SDA
+    );
+
+/*
+    Local bus
+*/
+
+// Write
+task lb_wr (input [3:0] adr, input [31:0] din);
+    @ (posedge sys_clk);
+    lb_if.adr <= adr;
+    lb_if.din <= din;
+    lb_if.wr <= 1;
+    @ (posedge sys_clk);
+    lb_if.wr <= 0;
+endtask
+
+// Read
+// The data is valid one clock after the read
+task lb_rd (input [3:0] adr, output [31:0] dout);
+    @ (posedge sys_clk);
+    lb_if.adr <= adr;
+    lb_if.rd <= 1;
+    @ (posedge sys_clk);
+    lb_if.rd <= 0;
+    @ (posedge sys_clk);
+    dout = lb_if.dout;
+endtask
+
+// Sequencer command
+task seq_add (input [15:0] cmd);
+    lb_wr (P_REG_SEQ_DAT, cmd);
+endtask
+
+// Sequencer run
+// Checks the busy flag and waits for the done interrupt
+task seq_run;
+    lb_wr (P_REG_CTL, P_CTL_RUN | P_CTL_IE | P_CTL_SEQ);
+    repeat (4)
+        @ (posedge sys_clk);
+    lb_rd (P_REG_STA, dat);
+    check ("busy", dat & (P_STA_SEQ_BUSY | P_STA_SEQ_DONE), P_STA_SEQ_BUSY);
+    fork
+        @ (posedge sys_clk iff irq_from_i2c);
+        begin
+            #P_TIMEOUT;
+            $display ("%t: sequencer time out", $time);
+            err++;
+        end
+    join_any
+    disable fork;
+    lb_rd (P_REG_STA, dat);
+    $display ("%t: sequencer done - status %h", $time, dat);
+    lb_wr (P_REG_STA, P_STA_SEQ_DONE);
+    repeat (2)
+        @ (posedge sys_clk);
+endtask
+
+// Check
+task check (input string name, input [31:0] val, input [31:0] exp);
+    if (val !== exp)
+    begin
+        $display ("%t: %s error - %h, expected %h", $time, name, val, exp);
+        err++;
+    end
+endtask
+
+/*
+    I2C slave
+    The slave has two offset bytes and a register file, like the Tentiva clock generator.
+    The offset increments after every data byte.
+*/
+assign i2c_sda = (slv_sda) ? 1'bz : 1'b0;
+
+// Bit
+// Returns the condition when a start (1) or stop (2) condition interrupts the transfer
+task automatic slv_bit (output logic b, output int cond);
+    @ (posedge i2c_scl);
+    b = i2c_sda;
+    cond = 0;
+    fork
+        @ (negedge i2c_scl);
+        begin
+            @ (i2c_sda);
+            cond = (i2c_sda) ? 2 : 1;
+        end
+    join_any
+    disable fork;
+endtask
+
+// Receive byte
+task automatic slv_rx (output logic [7:0] rx_dat, output int cond);
+    logic b;
+    rx_dat = 0;
+    for (int i = 0; i < 8; i++)
+    begin
+        slv_bit (b, cond);
+        if (cond != 0)
+            return;
+        rx_dat = {rx_dat[6:0], b};
+    end
+endtask
+
+// Acknowledge
+task automatic slv_ack (input logic ack);
+    slv_sda <= !ack;
+    @ (posedge i2c_scl);
+    @ (negedge i2c_scl);
+    slv_sda <= 1;
+endtask
+
+// Transmit byte
+// Returns the acknowledge of the master
+task automatic slv_tx (input logic [7:0] tx_dat, output logic ack);
+    for (int i = 7; i >= 0; i--)
+    begin
+        slv_sda <= tx_dat[i];
+        @ (posedge i2c_scl);
+        @ (negedge i2c_scl);
+    end
+    slv_sda <= 1;
+    @ (posedge i2c_scl);
+    ack = !i2c_sda;
+    @ (negedge i2c_scl);
+endtask
+
+// Transfer
+task automatic slv_trx;
+    logic [7:0] rx_dat;
+    logic ack;
+    int cond;
+    int idx;
+
+    forever
+    begin
+        // Slave address
+        slv_rx (rx_dat, cond);
+        if (cond == 2)
+            return;
+        else if (cond == 1)
+            continue;
+
+        // Not addressed
+        if (rx_dat[7:1] != P_SLV_ADR)
+        begin
+            slv_ack (0);
+            return;
+        end
+        slv_ack (1);
+
+        // Read
+        if (rx_dat[0])
+        begin
+            do
+            begin
+                slv_tx (slv_reg[slv_ofs[8:0]], ack);
+                slv_ofs++;
+            end while (ack);
+            return;
+        end
+
+        // Write
+        // The offset MSB and LSB and then the data
+        idx = 0;
+        forever
+        begin
+            slv_rx (rx_dat, cond);
+            if (cond != 0)
+                break;
+
+            if (idx == 0)
+                slv_ofs[15:8] = rx_dat;
+            else if (idx == 1)
+                slv_ofs[7:0] = rx_dat;
+            else
+            begin
+                slv_reg[slv_ofs[8:0]] = rx_dat;
+                slv_ofs++;
+            end
+            idx++;
+            slv_ack (1);
+        end
+
+        // Stop
+        if (cond == 2)
+            return;
+    end
+endtask
+
+// Start condition
+initial
+begin
+    slv_sda <= 1;
+    slv_ofs = 0;
+    forever
+    begin
+        @ (negedge i2c_sda);
+        if (i2c_scl === 1'b1)
+            slv_trx;
+    end
+end
+
+/*
+    Test
+*/
+initial
+begin
+    err = 0;
+    lb_if.adr <= 0;
+    lb_if.din <= 0;
+    lb_if.wr <= 0;
+    lb_if.rd <= 0;
+
+    @ (negedge sys_rst);
+    #100ns
+
+    // Beat
+    lb_wr (P_REG_BEAT, P_BEAT);
+
+    // Write list
+    // Four registers from offset 0x110 and a read back with repeated start
+    lb_wr (P_REG_SEQ_ADR, 0);
+    seq_add (P_SEQ_STR);
+    seq_add (P_SEQ_WR | (P_SLV_ADR << 1));
+    seq_add (P_SEQ_WR | 8'h01);
+    seq_add (P_SEQ_WR | 8'h10);
+    for (int i = 0; i < 4; i++)
+        seq_add (P_SEQ_WR | (8'ha0 + i));
+    seq_add (P_SEQ_STP);
+    seq_add (P_SEQ_DLY | 'd2);
+    seq_add (P_SEQ_STR);
+    seq_add (P_SEQ_WR | (P_SLV_ADR << 1));
+    seq_add (P_SEQ_WR | 8'h01);
+    seq_add (P_SEQ_WR | 8'h10);
+    seq_add (P_SEQ_STR);
+    seq_add (P_SEQ_WR | (P_SLV_ADR << 1) | 1);
+    for (int i = 0; i < 3; i++)
+        seq_add (P_SEQ_RD | P_SEQ_ACK);
+    seq_add (P_SEQ_RD);
+    seq_add (P_SEQ_STP);
+    seq_add (P_SEQ_END);
+
+    // Run
+    seq_run;
+    check ("status", dat & (P_STA_BUS | P_STA_SEQ_BUSY | P_STA_SEQ_DONE | P_STA_SEQ_NACK), P_STA_SEQ_DONE);
+    check ("interrupt", irq_from_i2c, 0);
+
+    // The done flag is cleared
+    lb_rd (P_REG_STA, dat);
+    check ("status clear", dat & (P_STA_SEQ_BUSY | P_STA_SEQ_DONE | P_STA_SEQ_NACK), 0);
+
+    for (int i = 0; i < 4; i++)
+        check ("slave register", slv_reg['h110 + i], 8'ha0 + i);
+
+    // Read buffer
+    lb_wr (P_REG_SEQ_ADR, 0);
+    for (int i = 0; i < 4; i++)
+    begin
+        lb_rd (P_REG_SEQ_DAT, dat);
+        check ("read buffer", dat, 8'ha0 + i);
+    end
+
+    // No acknowledge
+    // The list ends with a stop condition
+    lb_wr (P_REG_SEQ_ADR, 0);
+    seq_add (P_SEQ_STR);
+    seq_add (P_SEQ_WR | (7'h10 << 1));
+    seq_add (P_SEQ_WR | 8'h00);
+    seq_add (P_SEQ_STP);
+    seq_add (P_SEQ_END);
+
+    seq_run;
+    check ("status", dat & (P_STA_BUS | P_STA_SEQ_BUSY | P_STA_SEQ_DONE | P_STA_SEQ_NACK), P_STA_SEQ_DONE | P_STA_SEQ_NACK);
+    check ("scl", i2c_scl, 1);
+    check ("sda", i2c_sda, 1);
+
+    if (err == 0)
+        $display ("I2C sequencer test passed");
+    else
+        $display ("I2C sequencer test failed - %0d errors", err);
+
+    $stop;
+end
+
+endmodule
+
+`default_nettype wire
@@ -14,6 +14,10 @@
     v1.2 - Updated RISC-V processor
     v1.3 - Added misc interface
     v1.4 - Added second VTB interface (for MST application)
+    v1.5 - Added I2C interrupt
+    v1.6 - Added I2C command sequencer
+    v1.7 - Added interrupt pending register
+    v1.8 - Disabled I2C command sequencer until it has been simulated
 
     License
     =======
@@ -110,7 +114,7 @@ localparam P_RAM_SIZE_BYTES = P_RAM_SIZE * 1024;                      // RAM siz
 localparam P_RAM_ADR = $clog2(P_RAM_SIZE_BYTES);
 localparam P_UART_BEAT = P_SYS_FREQ / 115200; 
 localparam P_TMR_BEAT = P_SYS_FREQ / 1_000_000;
-localparam P_LB_MUX_PORTS = 11;
+localparam P_LB_MUX_PORTS = 12;
 
 // Interfaces
 prt_riscv_rom_if 
@@ -149,6 +153,13 @@ logic           clk_rst;
 // CPU
 wire            irq_to_cpu;
 
+// I2C
+wire            irq_from_i2c;
+
+// Interrupt pending
+logic [2:0]     clk_irq_pnd;
+logic           clk_irq_vld;
+
 // Aqua
 wire            rst_from_aqua;
 wire            rom_str_from_aqua;
@@ -199,7 +210,23 @@ wire [31:0]     dat_from_aqua;
     assign ram_if_cpu.rd_dat = (lb_to_mux.vld) ? lb_to_mux.dout : ram_if_ram.rd_dat;
 
     // Interrupt
-    assign irq_to_cpu = DPTX_IRQ_IN || DPRX_IRQ_IN;
+    assign irq_to_cpu = DPTX_IRQ_IN || DPRX_IRQ_IN || irq_from_i2c;
+
+// Interrupt pending register
+// The CPU reads the pending sources, so that only the handlers of these sources run.
+// Bit 0 - DPTX, bit 1 - DPRX, bit 2 - I2C
+    always_ff @ (posedge CLK_IN)
+    begin
+        // Read
+        if (lb_from_mux[11].rd)
+            clk_irq_pnd <= {irq_from_i2c, DPRX_IRQ_IN, DPTX_IRQ_IN};
+
+        // Valid
+        clk_irq_vld <= lb_from_mux[11].rd;
+    end
+
+    assign lb_from_mux[11].dout = {29'h0, clk_irq_pnd};
+    assign lb_from_mux[11].vld = clk_irq_vld;
 
     prt_riscv_rom
     #(
@@ -344,6 +371,10 @@ wire [31:0]     dat_from_aqua;
 
 // I2C
     prt_i2c
+    #(
+        .P_VENDOR           (P_VENDOR),
+        .P_SEQ              (0)             // The command sequencer is disabled
+    )
     I2C_INST
     (
         // Reset and clock
@@ -358,6 +389,9 @@ wire [31:0]     dat_from_aqua;
         .DIA_DAT_IN         (DIA_DAT_IN),
         .DIA_VLD_IN         (DIA_VLD_IN),
 
+        // Interrupt
+        .IRQ_OUT            (irq_from_i2c),
+
         // I2C
         .I2C_SCL_INOUT      (I2C_SCL_INOUT),      // SCL
         .I2C_SDA_INOUT      (I2C_SDA_INOUT)       // SDA
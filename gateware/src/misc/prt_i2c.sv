@@ -12,6 +12,9 @@
     v1.0 - Initial release
     v1.1 - Implemented clock stretching support for read cycle
     v1.2 - Added support for Tentiva System Controller in DIA mode
+    v1.3 - Added ready interrupt
+    v1.4 - Added command sequencer
+    v1.5 - Sequencer behind parameter P_SEQ
 
     License
     =======
@@ -31,6 +34,10 @@
 
 // Module
 module prt_i2c
+#(
+    parameter P_VENDOR = "none",    // Vendor - "AMD", "ALTERA" or "LSC"
+    parameter P_SEQ = 0             // Command sequencer - 0 - disabled / 1 - enabled
+)
 (
 	// Reset and clock
 	input wire 				RST_IN,
@@ -44,6 +51,9 @@ module prt_i2c
     input wire [31:0]       DIA_DAT_IN,
     input wire              DIA_VLD_IN,
 
+    // Interrupt
+    output wire             IRQ_OUT,
+
 	// I2C
  	inout wire 			    I2C_SCL_INOUT,		// SCL
  	inout wire 			    I2C_SDA_INOUT		// SDA
@@ -59,14 +69,32 @@ localparam P_CTL_RD         = 4;
 localparam P_CTL_ACK        = 5;
 localparam P_CTL_DIA        = 6;
 localparam P_CTL_TENTIVA    = 7;
-localparam P_CTL_WIDTH      = 8;
+localparam P_CTL_IE         = 8;
+localparam P_CTL_SEQ        = 9;
+localparam P_CTL_WIDTH      = 10;
 
 // Status register bit locations
 localparam P_STA_BUSY       = 0;
 localparam P_STA_RDY        = 1;
 localparam P_STA_ACK        = 2;
 localparam P_STA_BUS        = 3;
-localparam P_STA_WIDTH      = 4;
+localparam P_STA_SEQ_BUSY   = 4;
+localparam P_STA_SEQ_DONE   = 5;
+localparam P_STA_SEQ_NACK   = 6;
+localparam P_STA_WIDTH      = 7;
+
+// Sequencer
+localparam P_SEQ_ADR        = 10;       // Command memory address width (1024 commands)
+localparam P_SEQ_BUF_ADR    = 8;        // Read buffer address width (256 bytes)
+
+// Sequencer operations
+// A command is 16 bits. The operation is in bits [15:12].
+localparam P_SEQ_OP_END     = 0;        // End of list
+localparam P_SEQ_OP_STR     = 1;        // Start condition
+localparam P_SEQ_OP_WR      = 2;        // Write data in bits [7:0]
+localparam P_SEQ_OP_RD      = 3;        // Read data, bit 8 is the acknowledge
+localparam P_SEQ_OP_STP     = 4;        // Stop condition
+localparam P_SEQ_OP_DLY     = 5;        // Wait bits [11:0] times 16 beats
 
 // Typedef
 typedef enum {
@@ -86,6 +114,12 @@ typedef enum {
     dia_sm_stp, dia_sm_stp1
 } dia_sm_state;
 
+typedef enum {
+    seq_sm_idle,
+    seq_sm_fetch, seq_sm_exe, seq_sm_wait, seq_sm_dly,
+    seq_sm_err, seq_sm_err1, seq_sm_end
+} seq_sm_state;
+
 // Structure
 typedef struct {
     logic   [3:0]               adr;
@@ -94,6 +128,7 @@ typedef struct {
     logic   [31:0]              din;
     logic   [31:0]              dout;
     logic                       vld;
+    logic                       vld_re;
 } lb_struct;
 
 typedef struct {
@@ -107,6 +142,8 @@ typedef struct {
     logic                       ack;            // ACK
     logic                       dia;            // DIA enable
     logic                       tentiva;        // Tentiva - 0 - Rev. C / 1 - Rev. D
+    logic                       ie;             // Interrupt enable
+    logic                       seq;            // Sequencer start
 } ctl_struct;
 
 typedef struct {
@@ -138,6 +175,7 @@ typedef struct {
     logic                       stp;
     logic                       wr;
     logic                       rd;
+    logic                       ack;
     logic   [15:0]              beat_cnt;
     logic                       beat_cnt_end;
     logic                       beat;
@@ -170,6 +208,38 @@ typedef struct {
     logic   [7:0]               wr_dat;
 } dia_struct;
 
+typedef struct {
+    seq_sm_state                sm_cur;
+    seq_sm_state                sm_nxt;
+    logic                       adr_sel;        // Address register select
+    logic                       dat_sel;        // Data register select
+    logic   [P_SEQ_ADR-1:0]     adr;            // Address
+    logic                       cmd_wr;         // Command write
+    logic   [15:0]              cmd;            // Command
+    logic   [3:0]               op;             // Operation
+    logic   [P_SEQ_ADR-1:0]     pc;             // Program counter
+    logic                       pc_clr;
+    logic                       pc_inc;
+    logic                       str;
+    logic                       stp;
+    logic                       wr;
+    logic                       rd;
+    logic   [15:0]              dly;            // Delay counter
+    logic                       dly_ld;
+    logic                       dly_dec;
+    logic                       dly_end;
+    logic   [P_SEQ_BUF_ADR-1:0] buf_wp;         // Read buffer write pointer
+    logic                       buf_wp_clr;
+    logic                       buf_wr;
+    logic   [7:0]               buf_dout;       // Read buffer data
+    logic                       busy_set;
+    logic                       busy;
+    logic                       done_set;
+    logic                       done;
+    logic                       nack_set;
+    logic                       nack;
+} seq_struct;
+
 // Signals
 
 lb_struct           clk_lb;         // Local bus
@@ -180,6 +250,7 @@ reg_struct          clk_wr_dat;     // Write data register
 reg_struct          clk_rd_dat;     // Read data register
 i2c_struct		    clk_i2c;		// I2C
 dia_struct          clk_dia;        // Direct I2C Access
+seq_struct          clk_seq;        // Command sequencer
 
 // Logic
 
@@ -205,6 +276,8 @@ dia_struct          clk_dia;        // Direct I2C Access
         clk_beat.sel    = 0;
         clk_wr_dat.sel  = 0;
         clk_rd_dat.sel  = 0;
+        clk_seq.adr_sel = 0;
+        clk_seq.dat_sel = 0;
         
         case (clk_lb.adr)
             'd0  : clk_ctl.sel      = 1;
@@ -212,6 +285,8 @@ dia_struct          clk_dia;        // Direct I2C Access
             'd2  : clk_beat.sel     = 1;
             'd3  : clk_wr_dat.sel   = 1;
             'd4  : clk_rd_dat.sel   = 1;
+            'd5  : clk_seq.adr_sel  = (P_SEQ) ? 1 : 0;
+            'd6  : clk_seq.dat_sel  = (P_SEQ) ? 1 : 0;
             default : ;
         endcase
     end
@@ -231,6 +306,14 @@ dia_struct          clk_dia;        // Direct I2C Access
         else if (clk_sta.sel)
             clk_lb.dout[0+:$size(clk_sta.r)] = clk_sta.r;
 
+        // Sequencer address
+        else if (clk_seq.adr_sel)
+            clk_lb.dout[0+:$size(clk_seq.adr)] = clk_seq.adr;
+
+        // Sequencer read buffer
+        else if (clk_seq.dat_sel)
+            clk_lb.dout[0+:$size(clk_seq.buf_dout)] = clk_seq.buf_dout;
+
         // Read data
         else
             clk_lb.dout[0+:$size(clk_rd_dat.r)] = clk_rd_dat.r;
@@ -246,6 +329,18 @@ dia_struct          clk_dia;        // Direct I2C Access
             clk_lb.vld = 0;
     end
 
+// Valid rising edge
+// This is used for the sequencer read buffer
+    prt_dp_lib_edge
+    LB_VLD_EDGE_INST
+    (
+        .CLK_IN     (CLK_IN),           // Clock
+        .CKE_IN     (1'b1),             // Clock enable
+        .A_IN       (clk_lb.vld),       // Input
+        .RE_OUT     (clk_lb.vld_re),    // Rising edge
+        .FE_OUT     ()                  // Falling edge
+    );
+
 // Control register
     always_ff @ (posedge RST_IN, posedge CLK_IN)
     begin
@@ -258,13 +353,20 @@ dia_struct          clk_dia;        // Direct I2C Access
             if (clk_ctl.sel && clk_lb.wr)
                 clk_ctl.r <= clk_lb.din[0+:$size(clk_ctl.r)];
 
-            // The command bits are cleared when the state machine gets busy
-            else if (clk_sta.busy_set)
+            else
             begin
-                clk_ctl.r[P_CTL_STR]    <= 0;
-                clk_ctl.r[P_CTL_STP]    <= 0;
-                clk_ctl.r[P_CTL_WR]     <= 0;
-                clk_ctl.r[P_CTL_RD]     <= 0;
+                // The command bits are cleared when the state machine gets busy
+                if (clk_sta.busy_set)
+                begin
+                    clk_ctl.r[P_CTL_STR]    <= 0;
+                    clk_ctl.r[P_CTL_STP]    <= 0;
+                    clk_ctl.r[P_CTL_WR]     <= 0;
+                    clk_ctl.r[P_CTL_RD]     <= 0;
+                end
+
+                // The sequencer start bit is cleared when the sequencer gets busy
+                if (clk_seq.busy_set)
+                    clk_ctl.r[P_CTL_SEQ]    <= 0;
             end
         end
     end
@@ -278,12 +380,17 @@ dia_struct          clk_dia;        // Direct I2C Access
     assign clk_ctl.ack          = clk_ctl.r[P_CTL_ACK];     // I2C Ack
     assign clk_ctl.dia          = clk_ctl.r[P_CTL_DIA];     // DIA enable
     assign clk_ctl.tentiva      = clk_ctl.r[P_CTL_TENTIVA]; // Tentiva - 0 - Rev. C / 1 - Rev. D
+    assign clk_ctl.ie           = clk_ctl.r[P_CTL_IE];      // Interrupt enable
+    assign clk_ctl.seq          = clk_ctl.r[P_CTL_SEQ];     // Sequencer start
 
 // Status register
 	assign clk_sta.r[P_STA_BUSY]    = clk_sta.busy;
     assign clk_sta.r[P_STA_RDY]     = clk_sta.rdy;
     assign clk_sta.r[P_STA_ACK]     = clk_sta.ack;
     assign clk_sta.r[P_STA_BUS]     = clk_sta.bus;
+    assign clk_sta.r[P_STA_SEQ_BUSY]    = clk_seq.busy;
+    assign clk_sta.r[P_STA_SEQ_DONE]    = clk_seq.done;
+    assign clk_sta.r[P_STA_SEQ_NACK]    = clk_seq.nack;
 
 // Busy
     always_ff @ (posedge CLK_IN)
@@ -306,6 +413,7 @@ dia_struct          clk_dia;        // Direct I2C Access
     end
 
 // Ready
+// The sequencer commands don't set the ready flag
     always_ff @ (posedge CLK_IN)
     begin
         // Run
@@ -316,7 +424,7 @@ dia_struct          clk_dia;        // Direct I2C Access
                 clk_sta.rdy <= 0;
 
             // Set
-            else if (clk_sta.rdy_set)
+            else if (clk_sta.rdy_set && !clk_seq.busy)
                 clk_sta.rdy <= 1;
         end
 
@@ -332,7 +440,7 @@ dia_struct          clk_dia;        // Direct I2C Access
         if (clk_ctl.run)
         begin
             // Clear on any command
-            if (clk_ctl.str || clk_ctl.stp || clk_ctl.wr || clk_ctl.rd)
+            if (clk_i2c.str || clk_i2c.stp || clk_i2c.wr || clk_i2c.rd)
                 clk_sta.ack <= 0;
 
             // Set
@@ -355,11 +463,11 @@ dia_struct          clk_dia;        // Direct I2C Access
         if (clk_ctl.run && !clk_ctl.dia)
         begin
             // Clear on stop
-            if (clk_ctl.stp)
+            if (clk_i2c.stp)
                 clk_sta.bus <= 0;
 
             // Set on start
-            else if (clk_ctl.str)
+            else if (clk_i2c.str)
                 clk_sta.bus <= 1;
         end
 
@@ -433,16 +541,19 @@ dia_struct          clk_dia;        // Direct I2C Access
     );
 
 // Start
-    assign clk_i2c.str = clk_ctl.str || clk_dia.str;
+    assign clk_i2c.str = clk_ctl.str || clk_dia.str || clk_seq.str;
 
 // Stop
-    assign clk_i2c.stp = clk_ctl.stp || clk_dia.stp;
+    assign clk_i2c.stp = clk_ctl.stp || clk_dia.stp || clk_seq.stp;
 
 // Write
-    assign clk_i2c.wr = clk_ctl.wr || clk_dia.wr;
+    assign clk_i2c.wr = clk_ctl.wr || clk_dia.wr || clk_seq.wr;
 
 // Read
-    assign clk_i2c.rd = clk_ctl.rd;
+    assign clk_i2c.rd = clk_ctl.rd || clk_seq.rd;
+
+// Read acknowledge
+    assign clk_i2c.ack = (clk_seq.busy) ? clk_seq.cmd[8] : clk_ctl.ack;
 
 // State machine
 	always_ff @ (posedge RST_IN, posedge CLK_IN)
@@ -860,7 +971,7 @@ dia_struct          clk_dia;        // Direct I2C Access
                     // Have we shift out all bits?
                     if (clk_i2c.bit_cnt_end)
                     begin
-                        if (clk_ctl.ack)
+                        if (clk_i2c.ack)
                             clk_i2c.sda_out_clr = 1;
                         else                    
                             clk_i2c.sda_out_set = 1;
@@ -1007,6 +1118,8 @@ dia_struct          clk_dia;        // Direct I2C Access
         begin
             if (clk_ctl.dia)
                 clk_i2c.shft <= clk_dia.wr_dat;
+            else if (clk_seq.busy)
+                clk_i2c.shft <= clk_seq.cmd[7:0];
             else
                 clk_i2c.shft <= clk_wr_dat.r;
         end
@@ -1337,10 +1450,401 @@ dia_struct          clk_dia;        // Direct I2C Access
             clk_dia.rdy <= 0;
     end
 
+/*
+    Command sequencer
+    The sequencer executes a list of commands from the command memory.
+    Every command waits for the I2C state machine to be ready.
+    The read data is stored in the read buffer.
+    When the list has ended, the done flag is set.
+    A write that isn't acknowledged ends the list with a stop condition and sets the nack flag.
+    The sequencer is only built when P_SEQ is set.
+    Without it the address register doesn't read back, so the software keeps using the single transfers.
+*/
+generate
+    if (P_SEQ)
+    begin : gen_seq
+
+    // Address
+    // A series of data accesses fills or reads consecutive locations
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Load
+            if (clk_seq.adr_sel && clk_lb.wr)
+                clk_seq.adr <= clk_lb.din[0+:$size(clk_seq.adr)];
+
+            // Increment
+            else if (clk_seq.dat_sel && (clk_lb.wr || clk_lb.vld_re))
+                clk_seq.adr <= clk_seq.adr + 'd1;
+        end
+
+    // Command write
+        assign clk_seq.cmd_wr = clk_seq.dat_sel && clk_lb.wr;
+
+    // Command memory
+        prt_dp_lib_sdp_ram_sc
+        #(
+            .P_VENDOR       (P_VENDOR),
+            .P_RAM_STYLE    ("block"),          // "distributed", "block" or "ultra"
+            .P_ADR_WIDTH    (P_SEQ_ADR),
+            .P_DAT_WIDTH    (16)
+        )
+        SEQ_CMD_RAM_INST
+        (
+            // Clocks and reset
+            .RST_IN         (RST_IN),           // Reset
+            .CLK_IN         (CLK_IN),           // Clock
+
+            // Port A
+            .A_ADR_IN       (clk_seq.adr),      // Address
+            .A_WR_IN        (clk_seq.cmd_wr),   // Write in
+            .A_DAT_IN       (clk_lb.din[15:0]), // Write data
+
+            // Port B
+            .B_EN_IN        (1'b1),             // Enable
+            .B_ADR_IN       (clk_seq.pc),       // Program counter
+            .B_RD_IN        (1'b1),             // Read in
+            .B_DAT_OUT      (clk_seq.cmd),      // Command
+            .B_VLD_OUT      ()                  // Valid
+        );
+
+    // Operation
+        assign clk_seq.op = clk_seq.cmd[15:12];
+
+    // Read buffer
+    // The buffer is read through the data register
+        prt_dp_lib_sdp_ram_sc
+        #(
+            .P_VENDOR       (P_VENDOR),
+            .P_RAM_STYLE    ("distributed"),    // "distributed", "block" or "ultra"
+            .P_ADR_WIDTH    (P_SEQ_BUF_ADR),
+            .P_DAT_WIDTH    (8)
+        )
+        SEQ_BUF_RAM_INST
+        (
+            // Clocks and reset
+            .RST_IN         (RST_IN),           // Reset
+            .CLK_IN         (CLK_IN),           // Clock
+
+            // Port A
+            .A_ADR_IN       (clk_seq.buf_wp),   // Write pointer
+            .A_WR_IN        (clk_seq.buf_wr),   // Write in
+            .A_DAT_IN       (clk_i2c.shft),     // Read data
+
+            // Port B
+            .B_EN_IN        (1'b1),             // Enable
+            .B_ADR_IN       (clk_seq.adr[0+:P_SEQ_BUF_ADR]),    // Address
+            .B_RD_IN        (1'b1),             // Read in
+            .B_DAT_OUT      (clk_seq.buf_dout), // Data out
+            .B_VLD_OUT      ()                  // Valid
+        );
+
+    // Read buffer write pointer
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Clear
+            if (clk_seq.buf_wp_clr)
+                clk_seq.buf_wp <= 0;
+
+            // Increment
+            else if (clk_seq.buf_wr)
+                clk_seq.buf_wp <= clk_seq.buf_wp + 'd1;
+        end
+
+    // Program counter
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Clear
+            if (clk_seq.pc_clr)
+                clk_seq.pc <= 0;
+
+            // Increment
+            else if (clk_seq.pc_inc)
+                clk_seq.pc <= clk_seq.pc + 'd1;
+        end
+
+    // Delay counter
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Load
+            if (clk_seq.dly_ld)
+                clk_seq.dly <= {clk_seq.cmd[11:0], 4'h0};
+
+            // Decrement
+            else if (clk_seq.dly_dec)
+                clk_seq.dly <= clk_seq.dly - 'd1;
+        end
+
+    // Delay counter end
+        always_comb
+        begin
+            if (clk_seq.dly == 0)
+                clk_seq.dly_end = 1;
+            else
+                clk_seq.dly_end = 0;
+        end
+
+    // State machine
+        always_ff @ (posedge RST_IN, posedge CLK_IN)
+        begin
+            // Reset
+            if (RST_IN)
+                clk_seq.sm_cur <= seq_sm_idle;
+
+            else
+            begin
+                // Run
+                if (clk_ctl.run && !clk_ctl.dia)
+                    clk_seq.sm_cur <= clk_seq.sm_nxt;
+                else
+                    clk_seq.sm_cur <= seq_sm_idle;
+            end
+        end
+
+    // State machine decoder
+        always_comb
+        begin
+            // Default
+            clk_seq.sm_nxt = seq_sm_idle;
+            clk_seq.str = 0;
+            clk_seq.stp = 0;
+            clk_seq.wr = 0;
+            clk_seq.rd = 0;
+            clk_seq.pc_clr = 0;
+            clk_seq.pc_inc = 0;
+            clk_seq.dly_ld = 0;
+            clk_seq.dly_dec = 0;
+            clk_seq.buf_wp_clr = 0;
+            clk_seq.buf_wr = 0;
+            clk_seq.busy_set = 0;
+            clk_seq.done_set = 0;
+            clk_seq.nack_set = 0;
+
+            case (clk_seq.sm_cur)
+
+                // Idle
+                seq_sm_idle :
+                begin
+                    // Start
+                    if (clk_ctl.seq)
+                    begin
+                        clk_seq.busy_set = 1;
+                        clk_seq.pc_clr = 1;
+                        clk_seq.buf_wp_clr = 1;
+                        clk_seq.sm_nxt = seq_sm_fetch;
+                    end
+
+                    else
+                        clk_seq.sm_nxt = seq_sm_idle;
+                end
+
+                // Fetch
+                // The command memory has one clock read latency
+                seq_sm_fetch :
+                begin
+                    clk_seq.sm_nxt = seq_sm_exe;
+                end
+
+                // Execute
+                // The I2C state machine is idle, so it takes the command at once
+                seq_sm_exe :
+                begin
+                    case (clk_seq.op)
+                        P_SEQ_OP_STR :
+                        begin
+                            clk_seq.str = 1;
+                            clk_seq.sm_nxt = seq_sm_wait;
+                        end
+
+                        P_SEQ_OP_WR :
+                        begin
+                            clk_seq.wr = 1;
+                            clk_seq.sm_nxt = seq_sm_wait;
+                        end
+
+                        P_SEQ_OP_RD :
+                        begin
+                            clk_seq.rd = 1;
+                            clk_seq.sm_nxt = seq_sm_wait;
+                        end
+
+                        P_SEQ_OP_STP :
+                        begin
+                            clk_seq.stp = 1;
+                            clk_seq.sm_nxt = seq_sm_wait;
+                        end
+
+                        P_SEQ_OP_DLY :
+                        begin
+                            clk_seq.dly_ld = 1;
+                            clk_seq.sm_nxt = seq_sm_dly;
+                        end
+
+                        // End of list
+                        default :
+                            clk_seq.sm_nxt = seq_sm_end;
+                    endcase
+                end
+
+                // Wait for the I2C state machine
+                seq_sm_wait :
+                begin
+                    if (clk_sta.rdy_set)
+                    begin
+                        // Store read data
+                        if (clk_seq.op == P_SEQ_OP_RD)
+                            clk_seq.buf_wr = 1;
+
+                        // No acknowledge
+                        if ((clk_seq.op == P_SEQ_OP_WR) && !clk_sta.ack)
+                        begin
+                            clk_seq.nack_set = 1;
+                            clk_seq.sm_nxt = seq_sm_err;
+                        end
+
+                        // Next command
+                        else
+                        begin
+                            clk_seq.pc_inc = 1;
+                            clk_seq.sm_nxt = seq_sm_fetch;
+                        end
+                    end
+
+                    else
+                        clk_seq.sm_nxt = seq_sm_wait;
+                end
+
+                // Delay
+                seq_sm_dly :
+                begin
+                    if (clk_seq.dly_end)
+                    begin
+                        clk_seq.pc_inc = 1;
+                        clk_seq.sm_nxt = seq_sm_fetch;
+                    end
+
+                    else
+                    begin
+                        if (clk_i2c.beat)
+                            clk_seq.dly_dec = 1;
+                        clk_seq.sm_nxt = seq_sm_dly;
+                    end
+                end
+
+                // Error
+                // Release the bus
+                seq_sm_err :
+                begin
+                    clk_seq.stp = 1;
+                    clk_seq.sm_nxt = seq_sm_err1;
+                end
+
+                // Error
+                // Wait for the stop condition
+                seq_sm_err1 :
+                begin
+                    if (clk_sta.rdy_set)
+                        clk_seq.sm_nxt = seq_sm_end;
+                    else
+                        clk_seq.sm_nxt = seq_sm_err1;
+                end
+
+                // End
+                seq_sm_end :
+                begin
+                    clk_seq.done_set = 1;
+                    clk_seq.sm_nxt = seq_sm_idle;
+                end
+
+                default :
+                begin
+                    clk_seq.sm_nxt = seq_sm_idle;
+                end
+            endcase
+        end
+
+    // Busy
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Run
+            if (clk_ctl.run && !clk_ctl.dia)
+            begin
+                // Clear
+                if (clk_seq.done_set)
+                    clk_seq.busy <= 0;
+
+                // Set
+                else if (clk_seq.busy_set)
+                    clk_seq.busy <= 1;
+            end
+
+            // Idle
+            else
+                clk_seq.busy <= 0;
+        end
+
+    // Done
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Run
+            if (clk_ctl.run && !clk_ctl.dia)
+            begin
+                // Clear
+                if (clk_sta.sel && clk_lb.wr && clk_lb.din[P_STA_SEQ_DONE])
+                    clk_seq.done <= 0;
+
+                // Set
+                else if (clk_seq.done_set)
+                    clk_seq.done <= 1;
+            end
+
+            // Idle
+            else
+                clk_seq.done <= 0;
+        end
+
+    // No acknowledge
+        always_ff @ (posedge CLK_IN)
+        begin
+            // Run
+            if (clk_ctl.run && !clk_ctl.dia)
+            begin
+                // Clear on start
+                if (clk_seq.busy_set)
+                    clk_seq.nack <= 0;
+
+                // Set
+                else if (clk_seq.nack_set)
+                    clk_seq.nack <= 1;
+            end
+
+            // Idle
+            else
+                clk_seq.nack <= 0;
+        end
+
+    end
+
+    else
+    begin : gen_no_seq
+        assign clk_seq.adr = 0;
+        assign clk_seq.cmd = 0;
+        assign clk_seq.buf_dout = 0;
+        assign clk_seq.str = 0;
+        assign clk_seq.stp = 0;
+        assign clk_seq.wr = 0;
+        assign clk_seq.rd = 0;
+        assign clk_seq.busy_set = 0;
+        assign clk_seq.busy = 0;
+        assign clk_seq.done = 0;
+        assign clk_seq.nack = 0;
+    end
+endgenerate
+
 // Outputs
     assign LB_IF.dout       = clk_lb.dout;
     assign LB_IF.vld        = clk_lb.vld;
     assign DIA_RDY_OUT      = clk_dia.rdy;
+    assign IRQ_OUT          = clk_ctl.ie && (clk_sta.rdy || clk_seq.done);    // The interrupt is active as long as the ready or sequencer done flag is set
     assign I2C_SCL_INOUT    = (clk_i2c.scl_out) ? 1'bz : 0;
     assign I2C_SDA_INOUT    = (clk_i2c.sda_out) ? 1'bz : 0;
 
@@ -14,6 +14,7 @@
     v1.2 - Updated TX interfaces
     v1.3 - Added MST support
     v1.4 - Added 10-bits video support
+    v1.5 - Updated MST stream ports
 
     License
     =======
@@ -601,7 +602,10 @@ generate
             
             // Link
             .P_LANES            (P_LANES),              // Lanes
-            .P_SPL              (P_SPL)                 // Symbols per lane
+            .P_SPL              (P_SPL),                // Symbols per lane
+
+            // MST
+            .P_STREAMS          (P_MSA_MODS)            // Streams
         )
         MST_INST
         (
@@ -612,14 +616,10 @@ generate
             // Control
             .CTL_MST_EN_IN      (mst_en_from_ctl),      // MST enable
             .CTL_MST_ACT_IN     (mst_act_from_ctl),     // MST ACT
-            .CTL_VC0_TS_IN      (vc_ts_from_ctl[0]),    // VC0 time slots
-            .CTL_VC1_TS_IN      (vc_ts_from_ctl[1]),    // VC1 time slots
-
-            // Sink stream 0
-            .LNK0_SNK_IF        (lnk_from_msa[0]),      // Sink0
+            .CTL_VC_TS_IN       (vc_ts_from_ctl),       // VC time slots
 
-            // Sink stream 1
-            .LNK1_SNK_IF        (lnk_from_msa[1]),      // Sink1
+            // Sink streams
+            .LNK_SNK_IF         (lnk_from_msa),         // Sinks
 
             // Source 
             .LNK_SRC_IF         (lnk_from_mst)          // Source
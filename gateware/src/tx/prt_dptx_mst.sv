@@ -10,6 +10,7 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added stream parameter
 
     License
     =======
@@ -35,7 +36,10 @@ module prt_dptx_mst
 
     // Link
     parameter               P_LANES       = 4,      // Lanes
-    parameter               P_SPL         = 2       // Symbols per lane
+    parameter               P_SPL         = 2,      // Symbols per lane
+
+    // MST
+    parameter               P_STREAMS     = 2       // Streams (2 - 4)
 )
 (
     // Reset and clock
@@ -45,14 +49,10 @@ module prt_dptx_mst
     // Control
     input wire              CTL_MST_EN_IN,          // MST enable
     input wire              CTL_MST_ACT_IN,         // MST ACT
-    input wire [5:0]        CTL_VC0_TS_IN,          // Virtual channel0 time slots
-    input wire [5:0]        CTL_VC1_TS_IN,          // Virtual channel1 time slots
-
-    // Sink stream 0
-    prt_dp_tx_lnk_if.snk    LNK0_SNK_IF,            // Sink0
+    input wire [5:0]        CTL_VC_TS_IN[0:P_STREAMS-1],    // Virtual channel time slots
 
-    // Sink stream 1
-    prt_dp_tx_lnk_if.snk    LNK1_SNK_IF,            // Sink1
+    // Sink streams
+    prt_dp_tx_lnk_if.snk    LNK_SNK_IF[0:P_STREAMS-1],      // Sinks
 
     // Source 
     prt_dp_tx_lnk_if.src    LNK_SRC_IF              // Source
@@ -62,7 +62,7 @@ module prt_dptx_mst
 import prt_dp_pkg::*;
 
 // Parameters
-localparam P_VC = 2;        // Virtual channels
+localparam P_VC = P_STREAMS;    // Virtual channels
 localparam P_TS_END = (P_SPL == 4) ? 15 : 31;
 localparam P_VS_TS = (P_SPL == 4) ? 4 : 5;
 
@@ -115,6 +115,8 @@ typedef struct {
     logic                           act_ts;
     logic [1:0]                     act;
     logic                           vc_ts_ld;
+    logic [$clog2(P_VC)-1:0]        snk_sel;                        // Selected sink
+    logic                           snk_vld;                        // Selected sink valid
 } mst_struct;
 
 // Signals
@@ -123,7 +125,7 @@ snk_struct          clk_snk[0:P_VC-1];
 src_struct          clk_src;
 mst_struct          clk_mst;
 
-genvar i, j;
+genvar i, j, k;
 
 // Control Inputs
     always_ff @ (posedge CLK_IN)
@@ -142,16 +144,16 @@ genvar i, j;
             if (clk_mst.vc_ts_ld)
             begin
                 // The VC time slot is compensated for the symbols per lane
-                clk_ctl.vc_ts[0] <= (P_SPL == 4) ? CTL_VC0_TS_IN[2+:P_VS_TS] : CTL_VC0_TS_IN[1+:P_VS_TS];
-                clk_ctl.vc_ts[1] <= (P_SPL == 4) ? CTL_VC1_TS_IN[2+:P_VS_TS] : CTL_VC1_TS_IN[1+:P_VS_TS];
+                for (int i = 0; i < P_VC; i++)
+                    clk_ctl.vc_ts[i] <= (P_SPL == 4) ? CTL_VC_TS_IN[i][2+:P_VS_TS] : CTL_VC_TS_IN[i][1+:P_VS_TS];
             end
         end
 
         // Idle
         else
         begin
-            clk_ctl.vc_ts[0] <= 0;
-            clk_ctl.vc_ts[1] <= 0;
+            for (int i = 0; i < P_VC; i++)
+                clk_ctl.vc_ts[i] <= 0;
         end
     end
 
@@ -170,22 +172,19 @@ genvar i, j;
 // Link sink inputs
 // Must be combinatorial
 generate    
-    for (i = 0; i < P_LANES; i++)
-    begin
-        for (j = 0; j < P_SPL; j++)
+    for (k = 0; k < P_VC; k++)
+    begin : gen_snk
+        for (i = 0; i < P_LANES; i++)
         begin
-            // Sink 0
-            assign clk_snk[0].sym[i][j] = prt_dp_tx_lnk_sym'(LNK0_SNK_IF.sym[i][j]);
-            assign clk_snk[0].dat[i][j] = LNK0_SNK_IF.dat[i][j];
-            
-            // Sink 1
-            assign clk_snk[1].sym[i][j] = prt_dp_tx_lnk_sym'(LNK1_SNK_IF.sym[i][j]);
-            assign clk_snk[1].dat[i][j] = LNK1_SNK_IF.dat[i][j];
+            for (j = 0; j < P_SPL; j++)
+            begin
+                assign clk_snk[k].sym[i][j] = prt_dp_tx_lnk_sym'(LNK_SNK_IF[k].sym[i][j]);
+                assign clk_snk[k].dat[i][j] = LNK_SNK_IF[k].dat[i][j];
+            end
         end
+        assign clk_snk[k].vld = LNK_SNK_IF[k].vld;
     end
 endgenerate
-    assign clk_snk[0].vld = LNK0_SNK_IF.vld;
-    assign clk_snk[1].vld = LNK1_SNK_IF.vld;
 
 // Link sink read 
 generate
@@ -258,9 +257,17 @@ endgenerate
     assign clk_snk[0].rd_cnt_ld = clk_mst.snk_rd_str_cnt_end_re;
     assign clk_snk[0].rd_cnt_in = clk_ctl.vc_ts[0];
 
-// Read counter sink 1
-    assign clk_snk[1].rd_cnt_ld = clk_snk[0].rd_cnt_last;
-    assign clk_snk[1].rd_cnt_in = clk_ctl.vc_ts[1];
+// Read counter next sinks
+// The sinks are read one after the other, so the time slots of the virtual channels are packed.
+// A sink is loaded in the last read cycle of the previous sink.
+// A previous sink without time slots is skipped.
+generate
+    for (i = 1; i < P_VC; i++)
+    begin : gen_snk_rd_cnt_ld
+        assign clk_snk[i].rd_cnt_ld = (clk_ctl.vc_ts[i-1] == 0) ? clk_snk[i-1].rd_cnt_ld : clk_snk[i-1].rd_cnt_last;
+        assign clk_snk[i].rd_cnt_in = clk_ctl.vc_ts[i];
+    end
+endgenerate
 
 // Sink read start counter 
 // The sinks have a (long) read latency. 
@@ -543,6 +550,25 @@ endgenerate
             clk_mst.sr = 0;
     end
  
+// Sink select
+// Stream 0 has the highest priority
+// Must be combinatorial
+    always_comb
+    begin
+        // Default
+        clk_mst.snk_sel = 0;
+        clk_mst.snk_vld = 0;
+
+        for (int i = P_VC-1; i >= 0; i--)
+        begin
+            if (clk_snk[i].vld)
+            begin
+                clk_mst.snk_sel = i;
+                clk_mst.snk_vld = 1;
+            end
+        end
+    end
+
 // Link source
     always_ff @ (posedge CLK_IN)
     begin
@@ -601,28 +627,15 @@ endgenerate
                 end
             end
 
-            // Stream 0
-            if (clk_snk[0].vld)
+            // Streams
+            if (clk_mst.snk_vld)
             begin
                 for (int i = 0; i < P_LANES; i++)
                 begin
                     for (int j = 0; j < P_SPL; j++)
                     begin
-                        clk_src.sym[i][j] <= clk_snk[0].sym[i][j];
-                        clk_src.dat[i][j] <= clk_snk[0].dat[i][j];
-                    end
-                end
-            end
-
-            // Stream 1
-            else if (clk_snk[1].vld)
-            begin
-                for (int i = 0; i < P_LANES; i++)
-                begin
-                    for (int j = 0; j < P_SPL; j++)
-                    begin
-                        clk_src.sym[i][j] <= clk_snk[1].sym[i][j];
-                        clk_src.dat[i][j] <= clk_snk[1].dat[i][j];
+                        clk_src.sym[i][j] <= clk_snk[clk_mst.snk_sel].sym[i][j];
+                        clk_src.dat[i][j] <= clk_snk[clk_mst.snk_sel].dat[i][j];
                     end
                 end
             end
@@ -686,8 +699,12 @@ generate
 endgenerate
 
 // Outputs
-    assign LNK0_SNK_IF.rd = clk_snk[0].rd;
-    assign LNK1_SNK_IF.rd = clk_snk[1].rd;
+generate
+    for (k = 0; k < P_VC; k++)
+    begin : gen_snk_rd
+        assign LNK_SNK_IF[k].rd = clk_snk[k].rd;
+    end
+endgenerate
 
 generate
     for (i = 0; i < P_LANES; i++)
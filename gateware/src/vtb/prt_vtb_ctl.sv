@@ -10,6 +10,7 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added VPS address auto increment
 
     License
     =======
@@ -79,6 +80,7 @@ typedef struct {
 	logic [3:0]				ig;
 	logic [3:0]				og;
 	logic [3:0]				vps;
+	logic 					vps_ainc;
 } ctl_struct;
 
 typedef struct {
@@ -158,6 +160,11 @@ genvar i;
 			// Data
 			if (sclk_ctl.sel && sclk_lb.wr)
 				sclk_ctl.r <= sclk_lb.din[0+:$size(sclk_ctl.r)];
+
+			// VPS address auto increment
+			// A series of VPS data writes fills consecutive parameters
+			else if (sclk_vps.wr && sclk_ctl.vps_ainc)
+				sclk_ctl.r[16+:4] <= sclk_ctl.vps + 'd1;
 		end
 	end
 
@@ -165,6 +172,7 @@ genvar i;
 	assign sclk_ctl.ig 	= sclk_ctl.r[0+:4];		// Ingress port
 	assign sclk_ctl.og 	= sclk_ctl.r[8+:4];		// Outgress port
 	assign sclk_ctl.vps	= sclk_ctl.r[16+:4];	// Video parameters address
+	assign sclk_ctl.vps_ainc = sclk_ctl.r[20];	// Video parameters address auto increment
 
 // Register data out
 // Must be combinatorial
@@ -0,0 +1,156 @@
+print "\nDecode mailbox trace\n";
+print "This tool reads a UART log with the mailbox trace dump.\n";
+print "It writes a timeline of the DPTX and DPRX mailbox messages\n";
+print "(c) 2025 by Parretto B.V.\n";
+
+my $log_file;
+my $tokens_file = "../src/lib/prt_dp_tokens.h";
+my %token_name;
+my @entries;
+my %ovf;
+my %first;
+my @inst_name = ("DPTX", "DPRX");
+
+for my $arg (@ARGV)
+{
+	if ($arg =~ /^--log\s*=\s*(.+)/)
+	{
+		$log_file = $1;
+		print "Log file: $1\n";
+	}
+
+	if ($arg =~ /^--tokens\s*=\s*(.+)/)
+	{
+		$tokens_file = $1;
+		print "Tokens file: $1\n";
+	}
+}
+
+if (!$log_file)
+{
+	print "No log file.\n";
+	print "usage: perl dec_trc.pl --log=<uart log> [--tokens=<prt_dp_tokens.h>]\n";
+	die;
+}
+
+read_tokens();
+read_log();
+write_timeline();
+write_phases();
+
+###
+# Read the mailbox tokens
+###
+sub read_tokens
+{
+	open TOK, "<$tokens_file" or die "cannot open tokens file: $!";
+
+	while ($line = <TOK>)
+	{
+		if ($line =~ /#define\s+PRT_DP_MAIL_(\w+)\s+0x([0-9a-fA-F]+)/)
+		{
+			$token_name{hex($2)} = $1;
+		}
+	}
+	close (TOK);
+}
+
+###
+# Read the trace lines
+# trc <id> <dir> <timestamp> <payload>
+###
+sub read_log
+{
+	open LOG, "<$log_file" or die "cannot open log file: $!";
+
+	while ($line = <LOG>)
+	{
+		$line =~ s/\r//g;
+
+		if ($line =~ /^trc ([0-9a-f]+) ovf ([0-9a-f]+)/)
+		{
+			$ovf{hex($1)} = hex($2);
+		}
+
+		elsif ($line =~ /^trc ([0-9a-f]+) ([0-9a-f]+) ([0-9a-f]+)(.*)/)
+		{
+			my @dat = map { hex($_) } split(' ', $4);
+			push @entries, { id => hex($1), dir => hex($2), ts => hex($3), dat => \@dat };
+		}
+	}
+	close (LOG);
+
+	# Both instances share the timer, so sorting on the timestamp merges them
+	@entries = sort { $a->{ts} <=> $b->{ts} } @entries;
+
+	print "Entries: ", scalar(@entries), "\n";
+}
+
+###
+# Write timeline
+###
+sub write_timeline
+{
+	my $org;
+	my $prv;
+
+	return if (!@entries);
+
+	$org = $entries[0]->{ts};
+	$prv = $org;
+
+	printf("\n%12s %10s  %-4s %-3s %-16s %s\n", "time (us)", "delta", "dev", "dir", "token", "data");
+
+	foreach my $e (@entries)
+	{
+		my @dat = @{$e->{dat}};
+		my $tok = shift @dat;
+		my $name = defined($tok) && exists($token_name{$tok}) ? $token_name{$tok} : sprintf("0x%02x", $tok);
+
+		printf("%12d %10d  %-4s %-3s %-16s %s\n",
+			$e->{ts} - $org, $e->{ts} - $prv, $inst_name[$e->{id}], $e->{dir} ? "->" : "<-",
+			$name, join(" ", map { sprintf("%02x", $_) } @dat));
+
+		# First occurrence of every token per instance
+		$first{$e->{id}}{$name} = $e->{ts} if (!exists($first{$e->{id}}{$name}));
+
+		$prv = $e->{ts};
+	}
+
+	foreach my $id (sort keys %ovf)
+	{
+		printf("%s: %d entries overwritten\n", $inst_name[$id], $ovf{$id}) if ($ovf{$id});
+	}
+}
+
+###
+# Write phase latencies
+###
+sub write_phases
+{
+	my @phases = (
+		[0, "HPD_PLUG", 0, "TRN_PASS", "HPD -> training pass"],
+		[0, "TRN_PASS", 0, "LNK_UP", "Training pass -> link up"],
+		[0, "LNK_UP", 0, "VID_STR", "Link up -> video start"],
+		[1, "LNK_UP", 1, "VID_UP", "RX link up -> RX video up"],
+		[0, "HPD_PLUG", 1, "VID_UP", "HPD -> RX video up"],
+	);
+
+	print "\nPhases\n";
+
+	foreach my $p (@phases)
+	{
+		my ($sid, $str, $eid, $end, $desc) = @$p;
+
+		if (exists($first{$sid}{$str}) && exists($first{$eid}{$end}))
+		{
+			printf("%-28s %10d us\n", $desc, $first{$eid}{$end} - $first{$sid}{$str});
+		}
+		else
+		{
+			printf("%-28s %10s\n", $desc, "-");
+		}
+	}
+}
+
+print "\n\n";
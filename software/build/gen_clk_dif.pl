@@ -0,0 +1,126 @@
+print "\nGenerate clock configuration differences\n";
+print "This tool reads the Tentiva RC22504A register files.\n";
+print "It writes the registers that differ between every pair of configurations\n";
+print "(c) 2025 by Parretto B.V.\n";
+
+my @clk_files = ("../src/lib/tentiva_phy_clk.h", "../src/lib/tentiva_vid_clk.h");
+my $dif_file = "../src/lib/tentiva_clk_dif.h";
+my @out;
+
+for my $arg (@ARGV)
+{
+	if ($arg =~ /^--out\s*=\s*(.+)/)
+	{
+		$dif_file = $1;
+		print "Output file: $1\n";
+	}
+}
+
+foreach my $clk_file (@clk_files)
+{
+	read_clk($clk_file);
+}
+
+write_dif();
+
+###
+# Read register file
+# Every configuration is a table of {offset, value} pairs
+###
+sub read_clk
+{
+	my ($clk_file) = @_;
+	my %cfg;
+	my $name;
+	my $cur;
+
+	open CLK, "<$clk_file" or die "cannot open register file $clk_file: $!";
+
+	while ($line = <CLK>)
+	{
+		if ($line =~ /prt_rc22504a_reg_struct\s+(\w+)_cfg(\d+)_reg/)
+		{
+			$name = $1;
+			$cur = $2;
+			$cfg{$cur} = [];
+		}
+
+		elsif (defined($cur) && ($line =~ /\{\s*0x([0-9a-fA-F]+)\s*,\s*0x([0-9a-fA-F]+)\s*\}/))
+		{
+			push @{$cfg{$cur}}, [hex($1), hex($2)];
+		}
+	}
+	close (CLK);
+
+	print "$name: ", scalar(keys %cfg), " configurations\n";
+
+	foreach my $x (sort { $a <=> $b } keys %cfg)
+	{
+		foreach my $y (sort { $a <=> $b } keys %cfg)
+		{
+			next if ($y <= $x);
+			compare($name, $x, $cfg{$x}, $y, $cfg{$y});
+		}
+	}
+}
+
+###
+# Compare two configurations
+# The differences are stored as table indices, so they apply in both directions.
+###
+sub compare
+{
+	my ($name, $x, $cfg_x, $y, $cfg_y) = @_;
+	my @idx;
+
+	die "$name: configuration $x and $y have a different length" if (scalar(@$cfg_x) != scalar(@$cfg_y));
+
+	for (my $i = 0; $i < scalar(@$cfg_x); $i++)
+	{
+		die "$name: configuration $x and $y have a different offset at index $i" if ($cfg_x->[$i][0] != $cfg_y->[$i][0]);
+		push @idx, $i if ($cfg_x->[$i][1] != $cfg_y->[$i][1]);
+	}
+
+	printf("%s: configuration %d <-> %d: %d registers\n", $name, $x, $y, scalar(@idx));
+	push @out, { name => $name, x => $x, y => $y, idx => \@idx };
+}
+
+###
+# Write differences header
+###
+sub write_dif
+{
+	open DIF, ">$dif_file" or die "cannot open output file: $!";
+
+	print DIF "/*\n";
+	print DIF " * tentiva_clk_dif register differences\n";
+	print DIF " * for Renesas RC22504A clock synthesizer\n";
+	print DIF " * Generated by gen_clk_dif.pl from tentiva_phy_clk.h and tentiva_vid_clk.h\n";
+	print DIF " * (c) 2025 by Parretto B.V.\n";
+	print DIF " */\n\n";
+	print DIF "#pragma once\n";
+
+	foreach my $o (@out)
+	{
+		my $id = sprintf("%s_dif_%d_%d", $o->{name}, $o->{x}, $o->{y});
+		my @idx = @{$o->{idx}};
+
+		print DIF "\n// $o->{name} configuration $o->{x} <-> $o->{y}\n";
+		printf DIF ("#define %s_NUM_REGS %d\n", uc($id), scalar(@idx));
+		printf DIF ("const uint16_t %s[%s_NUM_REGS] = \n{\n", $id, uc($id));
+
+		for (my $i = 0; $i < scalar(@idx); $i += 8)
+		{
+			my $end = ($i + 8 < scalar(@idx)) ? $i + 8 : scalar(@idx);
+			print DIF "\t", join(", ", map { sprintf("0x%03X", $_) } @idx[$i .. $end - 1]);
+			print DIF "," if ($end < scalar(@idx));
+			print DIF "\n";
+		}
+		print DIF "};\n";
+	}
+	close (DIF);
+
+	print "Written $dif_file\n";
+}
+
+print "\n\n";
@@ -25,6 +25,7 @@ my $gen_ram = 0;
 my $gen_mem = 0;
 my $gen_mif = 0;
 my $gen_bin = 0;
+my $gen_hdr = 0;
 my $section;
 my $timestamp = localtime ();
 
@@ -66,6 +67,12 @@ for my $arg (@ARGV)
 		print "Generating binary file\n";
 	}
 
+	if ($arg =~ /^--gen_hdr/)
+	{
+		$gen_hdr = 1;
+		print "Generating header file\n";
+	}
+
 }
 
 if (!$verilog_path)
@@ -83,6 +90,8 @@ $mif_ram_file = sprintf("%s_ram.mif", $verilog_path);
 $ram_file =~ m/(\w+).sv/;
 $bin_rom_file = sprintf("%s_rom.bin", $verilog_path);
 $bin_ram_file = sprintf("%s_ram.bin", $verilog_path);
+$hdr_rom_file = sprintf("%s_rom.h", $verilog_path);
+$hdr_ram_file = sprintf("%s_ram.h", $verilog_path);
 $module_name = $1;
 print "Module name : $module_name\n";
 
@@ -109,6 +118,12 @@ if ($gen_bin)
 	write_bin();
 }
 
+if ($gen_hdr)
+{
+	write_hdr($hdr_rom_file, \@rom_buf, $rom_adr);
+	write_hdr($hdr_ram_file, \@ram_buf, $ram_adr);
+}
+
 
 ###
 # Read verilog input
@@ -301,4 +316,50 @@ sub write_bin
 	close (BIN);
 }
 
+###
+# Generate C header file
+# The data is packed into little endian 32-bit words,
+# so the host can copy it directly into the policy maker memory.
+###
+sub write_hdr
+{
+	my ($hdr_file, $buf, $len) = @_;
+	my $name;
+	my $wrds;
+
+	print "Generate header file\n";
+
+	# Array name
+	$hdr_file =~ m/(\w+).h$/;
+	$name = $1;
+
+	# Number of words
+	$wrds = int(($len + 3) / 4);
+
+	open HDR, ">$hdr_file" or die "cannot open HDR file: $!";
+
+	# Header
+	printf(HDR "// %s - packed 32-bit words\n", $name);
+	printf(HDR "const uint32_t %s[] = {\n", $name);
+
+	# Data
+	for ($i=0; $i<$wrds; $i++)
+	{
+		if (($i % 6) == 0) {
+			printf(HDR "  ");
+		}
+		printf(HDR "0x%02x%02x%02x%02x", $$buf[($i*4)+3], $$buf[($i*4)+2], $$buf[($i*4)+1], $$buf[$i*4]);
+		if ($i == ($wrds - 1)) {
+			printf(HDR "\n");
+		} elsif (($i % 6) == 5) {
+			printf(HDR ",\n");
+		} else {
+			printf(HDR ", ");
+		}
+	}
+	printf(HDR "};\n");
+	printf(HDR "const uint32_t %s_len = %d;\n", $name, $wrds);
+	close (HDR);
+}
+
 print "\n\n";
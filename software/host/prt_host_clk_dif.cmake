@@ -0,0 +1,23 @@
+# Clock difference header check
+# Runs gen_clk_dif.pl and compares its output with the checked-in header (ctest).
+# Arguments: PERL, BUILD_DIR, OUT and REF
+
+execute_process (
+    COMMAND ${PERL} gen_clk_dif.pl --out=${OUT}
+    WORKING_DIRECTORY ${BUILD_DIR}
+    RESULT_VARIABLE STA
+    OUTPUT_QUIET
+)
+
+if (NOT STA EQUAL 0)
+    message (FATAL_ERROR "gen_clk_dif.pl failed")
+endif ()
+
+execute_process (
+    COMMAND ${CMAKE_COMMAND} -E compare_files ${OUT} ${REF}
+    RESULT_VARIABLE STA
+)
+
+if (NOT STA EQUAL 0)
+    message (FATAL_ERROR "${REF} is out of date, run gen_clk_dif.pl in software/build")
+endif ()
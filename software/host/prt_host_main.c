@@ -0,0 +1,1222 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host benchmark
+    Runs the driver stack natively against the device models
+    and reports the time and the number of register accesses per operation.
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+    v1.1 - Added RC22504A configuration bus time
+    v1.2 - Added RC22504A configuration differences
+    v1.3 - Added I2C transaction queue
+    v1.4 - Added I2C command sequencer
+    v1.5 - Split the checks into one test per feature
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+// Includes
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prt_types.h"
+#include "prt_dp_tokens.h"
+#include "prt_uart.h"
+#include "prt_tmr.h"
+#include "prt_i2c.h"
+#include "prt_pio.h"
+#include "prt_tentiva.h"
+#include "prt_dp_drv.h"
+#include "prt_vtb.h"
+#include "prt_dp_app.h"
+#include "prt_dptx_pm_rom.h"
+#include "prt_dptx_pm_ram.h"
+#include "prt_host_reg.h"
+#include "prt_host_pm.h"
+#include "tentiva_vid_clk.h"
+#include "tentiva_clk_dif.h"
+
+// Iterations
+#define PRT_HOST_RUNS		1000
+
+// Clock generator slave address
+#define PRT_HOST_RC22504A_ADR	0x09
+
+// Global data
+prt_uart_ds_struct uart;
+prt_tmr_ds_struct tmr;
+prt_i2c_ds_struct i2c;
+prt_dp_ds_struct dptx;
+prt_dp_ds_struct dprx;
+prt_vtb_ds_struct vtb;
+prt_vtb_tel_struct vtb_tel;
+prt_host_pm_struct dptx_pm;
+prt_host_pm_struct dprx_pm;
+
+// VTB idle callbacks
+static prt_u32 vtb_idle_cnt;
+
+// Transaction callbacks
+static prt_u32 trx_cb_cnt;
+
+// HPD callbacks and their transaction status
+static prt_u32 hpd_cb_cnt;
+static prt_bool hpd_cb_sta;
+
+// Running test
+static struct {
+	const char	*name;
+	prt_bool	sta;
+} test;
+
+// Benchmark
+static struct {
+	const char	*name;
+	prt_u32		ts;
+} bench;
+
+/*
+	Device models
+*/
+
+// UART read
+// The transmitter is never full and the receiver is always empty
+static prt_u32 prt_host_uart_rd (prt_host_dev_struct *dev, prt_u8 reg)
+{
+	if (reg == 1)
+		return PRT_UART_STA_TX_EP | PRT_UART_STA_RX_EP;
+	else
+		return dev->reg[reg];
+}
+
+// UART write
+static void prt_host_uart_wr (prt_host_dev_struct *dev, prt_u8 reg, prt_u32 dat)
+{
+	if (reg == 2)
+		putchar (dat);
+	else
+		dev->reg[reg] = dat;
+}
+
+// I2C bus
+// The transfers to the clock generator are decoded into its register file.
+// The bus time counts nine clocks per byte and one clock per start and stop condition.
+static struct {
+	prt_u8 reg[512];	// Clock generator registers
+	prt_u16 offset;		// Register offset
+	prt_u8 idx;		// Byte index in the transfer
+	prt_bool sel;		// Clock generator selected
+	prt_bool hold;		// A slave holds the bus, the transfers don't complete
+	prt_u32 clks;		// Bus clocks
+	prt_u32 cbs;		// Transaction callbacks
+	prt_u16 seq[PRT_I2C_SEQ_MAX];		// Sequencer command memory
+	prt_u8 buf[PRT_I2C_SEQ_BUF_MAX];	// Sequencer read buffer
+	prt_u16 seq_adr;	// Sequencer address
+	prt_u32 seq_sta;	// Sequencer status bits
+} host_i2c;
+
+// I2C command
+// Returns the read data
+static prt_u8 prt_host_i2c_cmd (prt_u32 cmd, prt_u8 dat)
+{
+	// Start
+	if (cmd & PRT_I2C_CTL_STR)
+	{
+		host_i2c.idx = 0;
+		host_i2c.clks++;
+	}
+
+	// Stop
+	else if (cmd & PRT_I2C_CTL_STP)
+		host_i2c.clks++;
+
+	// Write
+	// The slave address, the offset MSB and LSB and then the data
+	else if (cmd & PRT_I2C_CTL_WR)
+	{
+		host_i2c.clks += 9;
+
+		if (host_i2c.idx == 0)
+			host_i2c.sel = ((dat >> 1) == PRT_HOST_RC22504A_ADR);
+		else if (host_i2c.idx == 1)
+			host_i2c.offset = dat << 8;
+		else if (host_i2c.idx == 2)
+			host_i2c.offset |= dat;
+		else if (host_i2c.sel)
+			host_i2c.reg[host_i2c.offset++ & 0x1ff] = dat;
+
+		if (host_i2c.idx < 3)
+			host_i2c.idx++;
+	}
+
+	// Read
+	else if (cmd & PRT_I2C_CTL_RD)
+	{
+		host_i2c.clks += 9;
+		if (host_i2c.sel)
+			return host_i2c.reg[host_i2c.offset++ & 0x1ff];
+	}
+
+	return 0;
+}
+
+// I2C sequencer
+// Executes the command list. A held bus doesn't complete the list.
+static void prt_host_i2c_seq (void)
+{
+	// Variables
+	prt_u16 cmd;
+	prt_u16 wp = 0;
+
+	if (host_i2c.hold)
+		return;
+
+	for (prt_u16 pc = 0; pc < PRT_I2C_SEQ_MAX; pc++)
+	{
+		cmd = host_i2c.seq[pc];
+
+		if ((cmd & 0xf000) == PRT_I2C_SEQ_STR)
+			prt_host_i2c_cmd (PRT_I2C_CTL_STR, 0);
+		else if ((cmd & 0xf000) == PRT_I2C_SEQ_STP)
+			prt_host_i2c_cmd (PRT_I2C_CTL_STP, 0);
+		else if ((cmd & 0xf000) == PRT_I2C_SEQ_WR)
+			prt_host_i2c_cmd (PRT_I2C_CTL_WR, cmd & 0xff);
+		else if ((cmd & 0xf000) == PRT_I2C_SEQ_RD)
+			host_i2c.buf[wp++ & (PRT_I2C_SEQ_BUF_MAX - 1)] = prt_host_i2c_cmd (PRT_I2C_CTL_RD, 0);
+		else if ((cmd & 0xf000) != PRT_I2C_SEQ_DLY)
+			break;
+	}
+
+	host_i2c.seq_sta = PRT_I2C_STA_SEQ_DONE;
+}
+
+// I2C read
+// Every transfer completes immediately and every slave acknowledges
+static prt_u32 prt_host_i2c_rd (prt_host_dev_struct *dev, prt_u8 reg)
+{
+	if (reg == 1)
+		return ((host_i2c.hold) ? 0 : (PRT_I2C_STA_RDY | PRT_I2C_STA_ACK)) | host_i2c.seq_sta;
+
+	// Sequencer address
+	else if (reg == 5)
+		return host_i2c.seq_adr;
+
+	// Sequencer read buffer
+	else if (reg == 6)
+		return host_i2c.buf[host_i2c.seq_adr++ & (PRT_I2C_SEQ_BUF_MAX - 1)];
+
+	else
+		return dev->reg[reg];
+}
+
+// I2C write
+static void prt_host_i2c_wr (prt_host_dev_struct *dev, prt_u8 reg, prt_u32 dat)
+{
+	// The command bits are taken at once
+	if (reg == 0)
+	{
+		dev->reg[reg] = dat & ~(PRT_I2C_CTL_STR | PRT_I2C_CTL_STP | PRT_I2C_CTL_WR | PRT_I2C_CTL_RD | PRT_I2C_CTL_SEQ);
+
+		// Sequencer
+		if (dat & PRT_I2C_CTL_SEQ)
+			prt_host_i2c_seq ();
+
+		// Read
+		else if (dat & PRT_I2C_CTL_RD)
+			dev->reg[4] = prt_host_i2c_cmd (dat, 0);
+
+		else
+			prt_host_i2c_cmd (dat, dev->reg[3] & 0xff);
+	}
+
+	// Clear sequencer done
+	else if (reg == 1)
+	{
+		if (dat & PRT_I2C_STA_SEQ_DONE)
+			host_i2c.seq_sta = 0;
+	}
+
+	// Sequencer address
+	else if (reg == 5)
+		host_i2c.seq_adr = dat & (PRT_I2C_SEQ_MAX - 1);
+
+	// Sequencer command
+	else if (reg == 6)
+		host_i2c.seq[host_i2c.seq_adr++ & (PRT_I2C_SEQ_MAX - 1)] = dat;
+
+	else
+		dev->reg[reg] = dat;
+}
+
+// I2C transaction callback
+static void prt_host_i2c_cb (prt_i2c_trx_struct *trx)
+{
+	host_i2c.cbs++;
+}
+
+// Transaction callback
+// Sends a status request
+static void prt_host_trx_cb (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl, prt_dp_trx_sta_type sta)
+{
+	trx_cb_cnt++;
+	prt_dp_sta (dp);
+}
+
+// HPD callback
+// Starts a transaction of its own
+static void prt_host_hpd_cb (prt_dp_ds_struct *dp)
+{
+	hpd_cb_cnt++;
+	hpd_cb_sta = prt_dp_ping (dp);
+}
+
+// VTB video parameters
+static prt_u16 host_vtb_vps[16];
+
+// VTB idle callback
+// The DP instances keep running during the clock recovery tuning
+static void prt_host_vtb_idle (void)
+{
+	vtb_idle_cnt++;
+	prt_dp_poll (&dptx);
+	prt_dp_poll (&dprx);
+}
+
+// VTB read
+// The outgress registers are kept per index.
+// The FIFO locks at once. The FIFO excursion grows with the distance of the gains to P 80 and I 6000.
+static prt_u32 prt_host_vtb_rd (prt_host_dev_struct *dev, prt_u8 reg)
+{
+	// Variables
+	prt_u32 og;
+	prt_s32 p;
+	prt_s32 i;
+	prt_u32 exc;
+
+	// Ingress
+	if (reg == 1)
+	{
+		if ((dev->reg[0] & 0xff) == PRT_VTB_IG_FIFO)
+		{
+			og = dev->reg[4 + PRT_VTB_OG_CR];
+			p = ((og >> PRT_VTB_OG_CR_P_GAIN_SHIFT) & 0xff) - 80;
+			i = ((og >> PRT_VTB_OG_CR_I_GAIN_SHIFT) & 0xffff) - 6000;
+			exc = (abs (p) >> 1) + (abs (i) >> 7);
+			if (exc > 500)
+				exc = 500;
+			return PRT_VTB_IG_FIFO_LOCK | ((512 + exc) << PRT_VTB_IG_FIFO_MAX_WRDS_SHIFT) | (512 << PRT_VTB_IG_FIFO_MIN_WRDS_SHIFT);
+		}
+		else
+			return 0;
+	}
+
+	// Outgress
+	else if (reg == 2)
+		return dev->reg[4 + ((dev->reg[0] >> PRT_VTB_DEV_CTL_OG_SHIFT) & 0x3)];
+
+	else
+		return dev->reg[reg];
+}
+
+// VTB write
+// The video parameters are written at the address in the control register.
+// The address increments after a write when auto increment is set.
+static void prt_host_vtb_wr (prt_host_dev_struct *dev, prt_u8 reg, prt_u32 dat)
+{
+	// Variables
+	prt_u8 adr;
+
+	if (reg == 2)
+		dev->reg[4 + ((dev->reg[0] >> PRT_VTB_DEV_CTL_OG_SHIFT) & 0x3)] = dat;
+
+	else if (reg == 3)
+	{
+		adr = (dev->reg[0] >> PRT_VTB_DEV_CTL_VPS_SHIFT) & 0xf;
+		host_vtb_vps[adr] = dat;
+
+		if (dev->reg[0] & PRT_VTB_DEV_CTL_VPS_AINC)
+			dev->reg[0] = (dev->reg[0] & ~(0xf << PRT_VTB_DEV_CTL_VPS_SHIFT)) | (((adr + 1) & 0xf) << PRT_VTB_DEV_CTL_VPS_SHIFT);
+	}
+
+	else
+		dev->reg[reg] = dat;
+}
+
+/*
+	Benchmark
+*/
+
+// Start
+static void prt_host_bench_str (const char *name)
+{
+	bench.name = name;
+	prt_host_reg_clr_cnt ();
+	bench.ts = prt_tmr_get_ts (&tmr);
+}
+
+// Stop
+// Prints the time and the register accesses per operation
+static void prt_host_bench_stp (prt_u32 ops)
+{
+	// Variables
+	prt_u32 us;
+	prt_u32 cnt;
+
+	us = prt_tmr_get_ts (&tmr) - bench.ts;
+	cnt = prt_host_reg_get_cnt ();
+
+	printf ("%-24s %8u ops %10.3f us/op %8.1f accesses/op\n", bench.name, ops, (double) us / ops, (double) cnt / ops);
+}
+/*
+	Tests
+*/
+
+// Check
+// Reports the failing check with the test name and the source line
+#define PRT_HOST_CHK(x)		prt_host_chk ((x), #x, __LINE__)
+
+static void prt_host_chk (prt_bool ok, const char *exp, int line)
+{
+	if (!ok)
+	{
+		printf ("%s: check failed at line %d: %s\n", test.name, line, exp);
+		test.sta = PRT_FALSE;
+	}
+}
+
+// Link up
+// The policy maker model reports the link
+static void prt_host_lnk_up (prt_u8 lanes, prt_u8 rate)
+{
+	// Variables
+	prt_u8 lnk[3];
+
+	lnk[0] = PRT_DP_MAIL_LNK_UP;
+	lnk[1] = lanes;
+	lnk[2] = rate;
+	prt_host_pm_put (&dptx_pm, lnk, sizeof (lnk));
+	prt_host_irq ();
+	prt_dp_poll (&dptx);
+}
+
+// Policy maker load
+// The load stops the policy maker, so the instance is initialized again
+static void prt_host_test_pm (void)
+{
+	prt_host_bench_str ("pm load");
+	prt_dp_rom_init (&dptx, prt_dptx_pm_rom_len, prt_dptx_pm_rom);
+	prt_dp_ram_init (&dptx, prt_dptx_pm_ram_len, prt_dptx_pm_ram);
+	prt_host_bench_stp (1);
+
+	PRT_HOST_CHK (dptx_pm.mem_wrds[0] == prt_dptx_pm_rom_len);
+	PRT_HOST_CHK (dptx_pm.mem_wrds[1] == prt_dptx_pm_ram_len);
+
+	prt_dp_init (&dptx, &tmr, PRT_DPTX_ID);
+}
+
+// Mailbox transaction
+static void prt_host_test_trx (void)
+{
+	// Variables
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("ping");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dp_ping (&dptx);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	// Without timer a transaction is not started, so a lost response can't block the wait
+	dptx.tmr = 0;
+	PRT_HOST_CHK (prt_dp_ping_req (&dptx, 0) == 0);
+	PRT_HOST_CHK (!prt_dp_ping (&dptx));
+	dptx.tmr = &tmr;
+
+	// The completion callback of the ping sends mail.
+	// It runs before the DPCD write is built, so the write is not overwritten.
+	trx_cb_cnt = 0;
+	PRT_HOST_CHK (prt_dp_ping_req (&dptx, prt_host_trx_cb) != 0);
+	PRT_HOST_CHK (prt_dptx_dpcd_wr (&dptx, 0x1ff, 0x5a));
+	PRT_HOST_CHK (dptx_pm.dpcd[0xff] == 0x5a);
+	PRT_HOST_CHK (trx_cb_cnt == 1);
+}
+
+// DPCD
+static void prt_host_test_dpcd (void)
+{
+	// Variables
+	prt_u8 dat[16];
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("dpcd wr");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dptx_dpcd_wr (&dptx, 0x100 + (i & 0xf), i & 0xf);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	prt_host_bench_str ("dpcd rd burst 16");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dptx_dpcd_rd_burst (&dptx, 0x100, sizeof (dat), dat);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	for (i = 0; i < sizeof (dat); i++)
+		PRT_HOST_CHK (dat[i] == i);
+}
+
+// EDID write
+static void prt_host_test_edid_wr (void)
+{
+	// Variables
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("edid wr 256");
+	for (i = 0; i < (PRT_HOST_RUNS / 10); i++)
+		ok &= prt_dprx_edid_wr (&dprx, 256);
+	prt_host_bench_stp (PRT_HOST_RUNS / 10);
+	PRT_HOST_CHK (ok);
+}
+
+// Event decode
+// The policy maker model injects a HPD plug event
+static void prt_host_test_hpd (void)
+{
+	// Variables
+	prt_u8 evt;
+	prt_u32 i;
+
+	evt = PRT_DP_MAIL_HPD_PLUG;
+	prt_host_bench_str ("hpd event");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+	{
+		prt_host_pm_put (&dptx_pm, &evt, 1);
+		prt_host_irq ();
+		prt_dp_poll (&dptx);
+	}
+	prt_host_bench_stp (PRT_HOST_RUNS);
+
+	PRT_HOST_CHK (prt_dp_is_hpd (&dptx));
+}
+
+// Callback during a transaction wait
+// The HPD event arrives before the ping response. The callback is held until the wait has ended,
+// so its own transaction doesn't end the wait of the ping.
+// Direct callbacks run from the interrupt handler, they are not held.
+static void prt_host_test_cb_wait (void)
+{
+	// Variables
+	prt_u8 evt;
+
+	#ifdef PRT_DP_CB_DIRECT
+		return;
+	#endif
+
+	hpd_cb_cnt = 0;
+	hpd_cb_sta = PRT_FALSE;
+	prt_dp_set_cb (&dptx, PRT_DP_CB_HPD, &prt_host_hpd_cb);
+
+	evt = PRT_DP_MAIL_HPD_PLUG;
+	prt_host_pm_put (&dptx_pm, &evt, 1);
+	PRT_HOST_CHK (prt_dp_ping (&dptx));
+	PRT_HOST_CHK (hpd_cb_cnt == 0);
+
+	prt_dp_poll (&dptx);
+	PRT_HOST_CHK (hpd_cb_cnt == 1);
+	PRT_HOST_CHK (hpd_cb_sta);
+
+	prt_dp_set_cb (&dptx, PRT_DP_CB_HPD, 0);
+}
+
+// Link planner
+// 720p50 needs 1.87 Gbps with the headroom, which fits one 2.7 Gbps lane.
+// The sink supports 8.1 Gbps and 4 lanes
+static void prt_host_test_lnk_plan (void)
+{
+	// Variables
+	prt_dp_tp_struct tp;
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	dptx_pm.dpcd[1] = PRT_DP_PHY_LINERATE_8100;
+	dptx_pm.dpcd[2] = 4;
+	tp.pclk = 74250;
+	tp.bpc = 8;
+	prt_host_bench_str ("lnk plan 720p50");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dptx_lnk_plan (&dptx, &tp, 0);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK (prt_dp_get_lnk_max_rate (&dptx) == PRT_DP_PHY_LINERATE_2700);
+	PRT_HOST_CHK (prt_dp_get_lnk_max_lanes (&dptx) == 1);
+
+	// 7680 x 4320p30 at 10 bpc doesn't fit
+	tp.pclk = 1188000;
+	tp.bpc = 10;
+	PRT_HOST_CHK (!prt_dptx_lnk_plan (&dptx, &tp, 0));
+}
+
+// Last known good training
+// The first hint misses. The link up stores the settings, so the second hint hits.
+// The hint is limited by the planned link, one 2.7 Gbps lane for 720p50.
+// Without PRT_DP_LKG_HINT the hit is counted, but the hint isn't sent.
+static void prt_host_test_lkg (void)
+{
+	// Variables
+	prt_dp_tp_struct tp;
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	dptx_pm.dpcd[1] = PRT_DP_PHY_LINERATE_8100;
+	dptx_pm.dpcd[2] = 4;
+	tp.pclk = 74250;
+	tp.bpc = 8;
+	PRT_HOST_CHK (prt_dptx_lnk_plan (&dptx, &tp, 0));
+
+	prt_host_bench_str ("lkg key");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dptx_lkg_key (&dptx);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK (!prt_dptx_lkg_hint (&dptx));
+	prt_host_lnk_up (1, PRT_DP_PHY_LINERATE_2700);
+	i = dptx.lkg.hit;
+	#ifdef PRT_DP_LKG_HINT
+	PRT_HOST_CHK (prt_dptx_lkg_hint (&dptx));
+	#else
+	PRT_HOST_CHK (!prt_dptx_lkg_hint (&dptx));
+	#endif
+	PRT_HOST_CHK (dptx.lkg.hit == i + 1);
+}
+
+// MST time slot allocation
+// On 4 lanes at 5.4 Gbps a time slot carries 40 PBN.
+// A 1080p60 stream has 532 PBN, which is 14 time slots or 16 in groups of four.
+// A 2160p60 stream has 2128 PBN, which is 54 time slots or 56 in groups of four.
+// The group size follows from the status of the policy maker, the test uses groups of four.
+static void prt_host_test_mst (void)
+{
+	// Variables
+	prt_dp_tp_struct mst_tp[2];
+	prt_u8 vid[3];
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	dptx.mst.spl = 4;
+	prt_host_lnk_up (4, PRT_DP_PHY_LINERATE_5400);
+
+	mst_tp[0].pclk = 148500;
+	mst_tp[0].bpc = 8;
+	mst_tp[1].pclk = 148500;
+	mst_tp[1].bpc = 8;
+	prt_host_bench_str ("mst alloc 2x1080p60");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dptx_mst_alloc (&dptx, mst_tp, 2);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK (prt_dptx_get_mst_pbn (&dptx, 0) == 532);
+	PRT_HOST_CHK (prt_dptx_get_mst_ts (&dptx, 0) == 16);
+	PRT_HOST_CHK (prt_dptx_get_mst_ts (&dptx, 1) == 16);
+
+	// Together the streams don't fit the 60 payload time slots, the 2160p60 stream uses the most
+	mst_tp[0].pclk = 594000;
+	PRT_HOST_CHK (!prt_dptx_mst_alloc (&dptx, mst_tp, 2));
+	PRT_HOST_CHK (prt_dptx_get_mst_ts (&dptx, 0) == 56);
+	PRT_HOST_CHK (prt_dptx_get_mst_ts (&dptx, 1) == 0);
+
+	// MST stream state
+	// The video state is kept while stream 0 still has video
+	for (i = 0; i < PRT_DP_MST_STREAMS; i++)
+	{
+		vid[0] = PRT_DP_MAIL_VID_UP;
+		vid[1] = i;
+		prt_host_pm_put (&dptx_pm, vid, 2);
+		prt_host_irq ();
+		prt_dp_poll (&dptx);
+	}
+
+	vid[0] = PRT_DP_MAIL_VID_DOWN;
+	vid[1] = 1;
+	vid[2] = 0;
+	prt_host_pm_put (&dptx_pm, vid, sizeof (vid));
+	prt_host_irq ();
+	prt_dp_poll (&dptx);
+	prt_dp_stat_rst (&dptx);
+
+	PRT_HOST_CHK (dptx.stat.state == PRT_DP_STAT_STATE_VID);
+
+	vid[1] = 0;
+	prt_host_pm_put (&dptx_pm, vid, sizeof (vid));
+	prt_host_irq ();
+	prt_dp_poll (&dptx);
+
+	PRT_HOST_CHK (dptx.stat.state == PRT_DP_STAT_STATE_LNK);
+}
+
+// Video start
+// The sink is connected and the link is up, so there is no wait
+static void prt_host_test_vid_str (void)
+{
+	// Variables
+	prt_u8 evt;
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	evt = PRT_DP_MAIL_HPD_PLUG;
+	prt_host_pm_put (&dptx_pm, &evt, 1);
+	prt_host_irq ();
+	prt_dp_poll (&dptx);
+	prt_host_lnk_up (4, PRT_DP_PHY_LINERATE_5400);
+
+	prt_host_bench_str ("vid str");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_dp_vid_str (&dptx, 0);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+}
+
+// EDID read
+// Every block counts up from the block address
+static void prt_host_test_edid_rd (void)
+{
+	// Variables
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("edid rd 256");
+	for (i = 0; i < PRT_HOST_RUNS / 10; i++)
+		ok &= prt_dptx_edid_rd (&dptx);
+	prt_host_bench_stp (PRT_HOST_RUNS / 10);
+	PRT_HOST_CHK (ok);
+
+	for (i = 0; i < 256; i++)
+		PRT_HOST_CHK (prt_dp_get_edid_dat (&dptx, i) == i);
+}
+
+// Video toolbox clock recovery
+static void prt_host_test_vtb_cr (void)
+{
+	// Variables
+	prt_u32 i;
+
+	prt_host_bench_str ("vtb cr");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		prt_vtb_cr (&vtb, NULL, VTB_PRESET_3840X2160P60);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+
+	// A mode switch only writes the changed video parameters, in bursts
+	prt_host_bench_str ("vtb cr mode switch");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		prt_vtb_cr (&vtb, NULL, (i & 1) ? VTB_PRESET_3840X2160P60 : VTB_PRESET_3840X2160P50);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+
+	PRT_HOST_CHK (vtb.vps_ainc == PRT_VTB_VPS_AINC_YES);
+	PRT_HOST_CHK (host_vtb_vps[PRT_VTB_VPS_HTOTAL] == VTB_3840X2160P60_HTOTAL);
+	PRT_HOST_CHK (host_vtb_vps[PRT_VTB_VPS_VSW] == VTB_3840X2160P60_VSW);
+	PRT_HOST_CHK (host_vtb_vps[PRT_VTB_VPS_REFCLK_LO] == 10000);
+}
+
+// CVT timing
+// The results match the VESA CVT 1.2 spreadsheet
+static void prt_host_test_vtb_cvt (void)
+{
+	// Variables
+	prt_vtb_tp_struct cvt_tp;
+	prt_vtb_tp_struct ref_tp;
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("vtb cvt 1080p60");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= prt_vtb_cvt (&cvt_tp, 1920, 1080, 60, VTB_CVT);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK ((cvt_tp.htotal == 2576) && (cvt_tp.hsw == 200) && (cvt_tp.hstart == 528));
+	PRT_HOST_CHK ((cvt_tp.vtotal == 1120) && (cvt_tp.vsw == 5) && (cvt_tp.vstart == 37));
+	PRT_HOST_CHK (cvt_tp.pclk == 173000);
+
+	PRT_HOST_CHK (prt_vtb_cvt (&cvt_tp, 1920, 1080, 60, VTB_CVT_RB));
+	PRT_HOST_CHK ((cvt_tp.htotal == 2080) && (cvt_tp.vtotal == 1111) && (cvt_tp.pclk == 138500));
+
+	PRT_HOST_CHK (prt_vtb_cvt (&cvt_tp, 7680, 4320, 30, VTB_CVT_RB2));
+	PRT_HOST_CHK ((cvt_tp.htotal == 7760) && (cvt_tp.vtotal == 4381) && (cvt_tp.pclk == 1019896));
+
+	// The source rounds the blanking differently, the classification allows for this
+	cvt_tp.htotal = 2080 + 4;
+	cvt_tp.hwidth = 1920;
+	cvt_tp.vtotal = 1111 - 1;
+	cvt_tp.vheight = 1080;
+	cvt_tp.pclk = 138600;
+	prt_host_bench_str ("vtb cvt classify");
+	for (i = 0; i < PRT_HOST_RUNS / 10; i++)
+		ok &= (prt_vtb_cvt_classify (&cvt_tp, &ref_tp) == VTB_CVT_RB);
+	prt_host_bench_stp (PRT_HOST_RUNS / 10);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK ((ref_tp.htotal == 2080) && (ref_tp.pclk == 138500));
+}
+
+// Preset lookup
+static void prt_host_test_vtb_preset (void)
+{
+	// Variables
+	prt_vtb_tp_struct cvt_tp;
+	prt_u32 pclk = 0;
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	prt_host_bench_str ("vtb find preset");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= (prt_vtb_find_preset (VTB_1920X1080P50_HTOTAL, VTB_1920X1080P50_VTOTAL, &pclk) == VTB_PRESET_1920X1080P50);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+
+	PRT_HOST_CHK (pclk == VTB_1920X1080P50_PCLK);
+
+	// Every preset is found, the 5120 x 2880p60 preset matches the CVT-RB2 timing
+	for (i = 1; i <= VTB_PRESETS; i++)
+	{
+		prt_vtb_set_tp (&vtb, NULL, i);
+		PRT_HOST_CHK (prt_vtb_find_preset (vtb.tp.htotal, vtb.tp.vtotal, &pclk) == i);
+	}
+
+	PRT_HOST_CHK (prt_vtb_cvt (&cvt_tp, 5120, 2880, 60, VTB_CVT_RB2));
+	prt_vtb_set_tp (&vtb, NULL, VTB_PRESET_5120X2880P60);
+	PRT_HOST_CHK ((cvt_tp.htotal == vtb.tp.htotal) && (cvt_tp.vtotal == vtb.tp.vtotal));
+	PRT_HOST_CHK ((cvt_tp.vstart == vtb.tp.vstart) && (cvt_tp.pclk == vtb.tp.pclk));
+
+	PRT_HOST_CHK (prt_vtb_find_preset (VTB_1920X1080P60_HTOTAL, VTB_1920X1080P50_VTOTAL + 1, &pclk) == 0);
+}
+
+// Clock recovery tuning
+// The search moves the gains towards the optimum of the model.
+// The second run hits the cache.
+static void prt_host_test_vtb_cr_tune (void)
+{
+	// Variables
+	prt_u32 ts;
+
+	prt_vtb_cr_set_p_gain (&vtb, 50);
+	prt_vtb_cr_set_i_gain (&vtb, 32000);
+	vtb_idle_cnt = 0;
+	ts = prt_tmr_get_ts (&tmr);
+	prt_host_bench_str ("vtb cr tune");
+	PRT_HOST_CHK (prt_vtb_cr_tune (&vtb, NULL, VTB_PRESET_1920X1080P60, PRT_FALSE));
+	prt_host_bench_stp (1);
+
+	// The DP instances run during the tuning and the tuning time is limited
+	PRT_HOST_CHK (vtb_idle_cnt != 0);
+	PRT_HOST_CHK ((prt_tmr_get_ts (&tmr) - ts) <= (VTB_CR_TUNE_TIME_MAX + 1000));
+
+	printf ("vtb cr tune: P %u, I %u, cost %u\n", prt_vtb_cr_get_p_gain (&vtb), prt_vtb_cr_get_i_gain (&vtb), vtb.cr_gain[VTB_PRESET_1920X1080P60].cost);
+
+	PRT_HOST_CHK (prt_vtb_cr_get_p_gain (&vtb) > 50);
+	PRT_HOST_CHK (prt_vtb_cr_get_i_gain (&vtb) < (32000 & VTB_CR_I_GAIN_MAX));
+
+	prt_vtb_cr_set_p_gain (&vtb, 50);
+	prt_host_bench_str ("vtb cr tune cached");
+	PRT_HOST_CHK (prt_vtb_cr_tune (&vtb, NULL, VTB_PRESET_1920X1080P60, PRT_FALSE));
+	prt_host_bench_stp (1);
+
+	PRT_HOST_CHK (prt_vtb_cr_get_p_gain (&vtb) == vtb.cr_gain[VTB_PRESET_1920X1080P60].p_gain);
+}
+
+// Clock recovery telemetry
+// The model FIFO is always locked
+static void prt_host_test_vtb_tel (void)
+{
+	// Variables
+	prt_u32 i;
+
+	prt_vtb_set_tel (&vtb, &vtb_tel);
+	prt_vtb_tel_str (&vtb, VTB_TEL_PERIOD);
+	prt_host_bench_str ("vtb tel smp");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		prt_vtb_tel_smp (&vtb);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+
+	PRT_HOST_CHK (vtb_tel.cnt == PRT_HOST_RUNS);
+	PRT_HOST_CHK (vtb_tel.lock_loss == 0);
+	PRT_HOST_CHK (vtb_tel.stat[VTB_TEL_SIG_CO].n == PRT_HOST_RUNS);
+
+	// The deviations from the first sample are 0, 8, 4 and 2
+	vtb_tel.stat[0].n = 0;
+	prt_vtb_tel_acc (&vtb_tel.stat[0], -3);
+	prt_vtb_tel_acc (&vtb_tel.stat[0], 5);
+	prt_vtb_tel_acc (&vtb_tel.stat[0], 1);
+	prt_vtb_tel_acc (&vtb_tel.stat[0], -1);
+
+	PRT_HOST_CHK ((vtb_tel.stat[0].sum == 14) && (vtb_tel.stat[0].sq == 84));
+	PRT_HOST_CHK ((vtb_tel.stat[0].min == -3) && (vtb_tel.stat[0].max == 5));
+}
+
+// I2C write
+static void prt_host_test_i2c_wr (void)
+{
+	// Variables
+	prt_u32 i;
+	prt_bool ok = PRT_TRUE;
+
+	i2c.slave = 0x09;
+	i2c.len = 16;
+	i2c.no_stop = PRT_FALSE;
+	for (i = 0; i < 16; i++)
+		i2c.dat[i] = i;
+	prt_host_bench_str ("i2c wr 16");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+		ok &= (prt_i2c_wr (&i2c) == PRT_STA_OK);
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	PRT_HOST_CHK (ok);
+}
+
+// Clock generator configuration
+// The single register writes are the reference for the burst writes.
+// The burst configuration also includes the APLL re-initialization.
+static void prt_host_test_rc22504a_cfg (void)
+{
+	// Variables
+	prt_u32 i;
+	prt_u32 clks;
+	prt_bool ok = PRT_TRUE;
+
+	host_i2c.clks = 0;
+	prt_host_bench_str ("rc22504a cfg single");
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		ok &= (prt_rc22504a_wr (&i2c, PRT_HOST_RC22504A_ADR, tentiva_vid_clk_cfg1_reg[i].offset, tentiva_vid_clk_cfg1_reg[i].value) == PRT_STA_OK);
+	prt_host_bench_stp (1);
+	PRT_HOST_CHK (ok);
+	clks = host_i2c.clks;
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] = 0;
+
+	host_i2c.clks = 0;
+	prt_host_bench_str ("rc22504a cfg burst");
+	PRT_HOST_CHK (prt_rc22504a_cfg (&i2c, PRT_HOST_RC22504A_ADR, TENTIVA_VID_CLK_CONFIG_NUM_REGS, &tentiva_vid_clk_cfg1_reg[0]) == PRT_STA_OK);
+	prt_host_bench_stp (1);
+
+	// Bus time at 400 kHz
+	printf ("rc22504a cfg bus time: single %u us, burst %u us\n", (clks * 5) >> 1, (host_i2c.clks * 5) >> 1);
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		PRT_HOST_CHK (host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] == tentiva_vid_clk_cfg1_reg[i].value);
+
+	PRT_HOST_CHK (host_i2c.clks < clks);
+}
+
+// Clock generator configuration differences
+// Configuration 1 is loaded. The differences switch to configuration 2 and then to configuration 0.
+// The DCO word is changed at run time and reloaded by the switch.
+static void prt_host_test_rc22504a_dif (void)
+{
+	// Variables
+	prt_u32 i;
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] = tentiva_vid_clk_cfg1_reg[i].value;
+
+	host_i2c.reg[PRT_RC22504A_MISC_WRITE_FREQ] = 0x5a;
+	host_i2c.clks = 0;
+	prt_host_bench_str ("rc22504a cfg dif 1-2");
+	PRT_HOST_CHK (prt_rc22504a_cfg_dif (&i2c, PRT_HOST_RC22504A_ADR, TENTIVA_VID_CLK_CONFIG_NUM_REGS, &tentiva_vid_clk_cfg2_reg[0], TENTIVA_VID_CLK_DIF_1_2_NUM_REGS, &tentiva_vid_clk_dif_1_2[0]) == PRT_STA_OK);
+	prt_host_bench_stp (1);
+	printf ("rc22504a cfg dif bus time: %u us\n", (host_i2c.clks * 5) >> 1);
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		PRT_HOST_CHK (host_i2c.reg[tentiva_vid_clk_cfg2_reg[i].offset] == tentiva_vid_clk_cfg2_reg[i].value);
+
+	PRT_HOST_CHK (prt_rc22504a_cfg_dif (&i2c, PRT_HOST_RC22504A_ADR, TENTIVA_VID_CLK_CONFIG_NUM_REGS, &tentiva_vid_clk_cfg0_reg[0], TENTIVA_VID_CLK_DIF_0_2_NUM_REGS, &tentiva_vid_clk_dif_0_2[0]) == PRT_STA_OK);
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		PRT_HOST_CHK (host_i2c.reg[tentiva_vid_clk_cfg0_reg[i].offset] == tentiva_vid_clk_cfg0_reg[i].value);
+}
+
+// I2C transaction queue
+// Without interrupt the queue is run by the poll.
+// A register write to the clock generator and a read back with repeated start.
+static void prt_host_test_i2c_queue (void)
+{
+	// Variables
+	prt_u8 dat[6];
+	prt_u32 i;
+	prt_i2c_trx_hndl hndl[2];
+	prt_i2c_trx_struct *trx;
+
+	dat[0] = 0x01;
+	dat[1] = 0x10;
+	for (i = 0; i < 4; i++)
+		dat[2 + i] = 0xa0 + i;
+	host_i2c.cbs = 0;
+	host_i2c.clks = 0;
+	hndl[0] = prt_i2c_req (&i2c, PRT_I2C_TRX_WR, PRT_HOST_RC22504A_ADR, dat, 6, 0, PRT_I2C_TRX_DEF_TIMEOUT, prt_host_i2c_cb, 0);
+	hndl[1] = prt_i2c_req (&i2c, PRT_I2C_TRX_WR_RD, PRT_HOST_RC22504A_ADR, dat, 2, 4, PRT_I2C_TRX_DEF_TIMEOUT, prt_host_i2c_cb, 0);
+
+	PRT_HOST_CHK ((hndl[0] != 0) && (hndl[1] != 0));
+	PRT_HOST_CHK (prt_i2c_wait (&i2c, hndl[1]) == PRT_I2C_TRX_OK);
+
+	trx = prt_i2c_get_trx (&i2c, hndl[1]);
+	PRT_HOST_CHK (trx != 0);
+	for (i = 0; (trx != 0) && (i < 4); i++)
+	{
+		PRT_HOST_CHK (trx->rd_dat[i] == (0xa0 + i));
+		PRT_HOST_CHK (host_i2c.reg[0x110 + i] == (0xa0 + i));
+	}
+
+	// Both transactions report once.
+	// The write takes 7 bytes, the read 8 bytes, with 5 start and stop conditions in total.
+	PRT_HOST_CHK (prt_i2c_get_sta (&i2c, hndl[0]) == PRT_I2C_TRX_OK);
+	PRT_HOST_CHK (host_i2c.cbs == 2);
+	PRT_HOST_CHK (host_i2c.clks == ((15 * 9) + 5));
+	PRT_HOST_CHK (!prt_i2c_is_busy (&i2c));
+
+	// The interrupt handler runs the queue
+	prt_i2c_set_irq (&i2c, PRT_TRUE);
+	prt_host_bench_str ("i2c queue wr rd 4");
+	for (i = 0; i < PRT_HOST_RUNS; i++)
+	{
+		hndl[0] = prt_i2c_req (&i2c, PRT_I2C_TRX_WR_RD, PRT_HOST_RC22504A_ADR, dat, 2, 4, PRT_I2C_TRX_DEF_TIMEOUT, 0, 0);
+		while (prt_i2c_is_busy (&i2c))
+			prt_i2c_irq_handler (&i2c);
+
+		// Release the slot
+		prt_i2c_poll (&i2c);
+	}
+	prt_host_bench_stp (PRT_HOST_RUNS);
+	prt_i2c_set_irq (&i2c, PRT_FALSE);
+
+	PRT_HOST_CHK (prt_i2c_get_sta (&i2c, hndl[0]) == PRT_I2C_TRX_OK);
+
+	// A held bus times out the transaction on the bus and the next transaction still runs.
+	// The time out starts when the transaction gets the bus.
+	// The queue is full when the completions have not been reported.
+	host_i2c.hold = PRT_TRUE;
+	hndl[0] = prt_i2c_req (&i2c, PRT_I2C_TRX_RD, PRT_HOST_RC22504A_ADR, 0, 0, 1, 100, 0, 0);
+	for (i = 1; i < PRT_I2C_Q_SIZE; i++)
+		hndl[1] = prt_i2c_req (&i2c, PRT_I2C_TRX_WR, PRT_HOST_RC22504A_ADR, dat, 2, 0, PRT_I2C_TRX_DEF_TIMEOUT, 0, 0);
+
+	PRT_HOST_CHK (prt_i2c_req (&i2c, PRT_I2C_TRX_WR, PRT_HOST_RC22504A_ADR, dat, 2, 0, PRT_I2C_TRX_DEF_TIMEOUT, 0, 0) == 0);
+	PRT_HOST_CHK (prt_i2c_wait (&i2c, hndl[0]) == PRT_I2C_TRX_TIMEOUT);
+
+	host_i2c.hold = PRT_FALSE;
+	PRT_HOST_CHK (prt_i2c_wait (&i2c, hndl[1]) == PRT_I2C_TRX_OK);
+
+	// DIA mode keeps the interrupt enable of the queue
+	prt_i2c_set_irq (&i2c, PRT_TRUE);
+	PRT_HOST_CHK (prt_i2c_dia (&i2c, true, true) == PRT_STA_OK);
+	PRT_HOST_CHK (i2c.ctl == (PRT_I2C_CTL_RUN | PRT_I2C_CTL_IE | PRT_I2C_CTL_DIA | PRT_I2C_CTL_TENTIVA));
+	PRT_HOST_CHK (prt_i2c_dia (&i2c, false, false) == PRT_STA_OK);
+	PRT_HOST_CHK (i2c.ctl == (PRT_I2C_CTL_RUN | PRT_I2C_CTL_IE));
+	prt_i2c_set_irq (&i2c, PRT_FALSE);
+}
+
+// I2C command sequencer
+// The burst writes are the reference for the sequencer load.
+// The sequencer load doesn't have the burst length limit, so it takes fewer start and stop conditions.
+static void prt_host_test_i2c_seq (void)
+{
+	// Variables
+	prt_u8 dat[4];
+	prt_u32 i;
+	prt_u32 clks;
+	prt_u32 acc;
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] = 0;
+
+	host_i2c.clks = 0;
+	prt_host_reg_clr_cnt ();
+	PRT_HOST_CHK (prt_rc22504a_load (&i2c, PRT_HOST_RC22504A_ADR, TENTIVA_VID_CLK_CONFIG_NUM_REGS, &tentiva_vid_clk_cfg1_reg[0]) == PRT_STA_OK);
+	acc = prt_host_reg_get_cnt ();
+	clks = host_i2c.clks;
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] = 0;
+
+	PRT_HOST_CHK (prt_i2c_set_seq (&i2c, PRT_TRUE) == PRT_STA_OK);
+
+	host_i2c.clks = 0;
+	prt_host_bench_str ("rc22504a load seq");
+	PRT_HOST_CHK (prt_rc22504a_load (&i2c, PRT_HOST_RC22504A_ADR, TENTIVA_VID_CLK_CONFIG_NUM_REGS, &tentiva_vid_clk_cfg1_reg[0]) == PRT_STA_OK);
+	prt_host_bench_stp (1);
+	printf ("rc22504a load accesses: burst %u, seq %u\n", acc, prt_host_reg_get_cnt ());
+	printf ("rc22504a load bus time: burst %u us, seq %u us\n", (clks * 5) >> 1, (host_i2c.clks * 5) >> 1);
+
+	for (i = 0; i < TENTIVA_VID_CLK_CONFIG_NUM_REGS; i++)
+		PRT_HOST_CHK (host_i2c.reg[tentiva_vid_clk_cfg1_reg[i].offset] == tentiva_vid_clk_cfg1_reg[i].value);
+
+	PRT_HOST_CHK (prt_host_reg_get_cnt () < (acc >> 2));
+	PRT_HOST_CHK (host_i2c.clks <= clks);
+
+	// Read back with repeated start
+	// The completion is handled by the interrupt handler.
+	prt_i2c_seq_clr (&i2c);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_STR);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_WR | (PRT_HOST_RC22504A_ADR << 1));
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_WR | 0x01);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_WR | 0x10);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_STR);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_WR | (PRT_HOST_RC22504A_ADR << 1) | 0x01);
+	for (i = 0; i < 3; i++)
+		prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_RD | PRT_I2C_SEQ_ACK);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_RD);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_STP);
+
+	prt_i2c_set_irq (&i2c, PRT_TRUE);
+	PRT_HOST_CHK (prt_i2c_seq_run (&i2c) == PRT_STA_OK);
+
+	while (prt_i2c_seq_is_busy (&i2c))
+		prt_i2c_irq_handler (&i2c);
+	prt_i2c_set_irq (&i2c, PRT_FALSE);
+
+	prt_i2c_seq_rd (&i2c, dat, 4);
+	for (i = 0; i < 4; i++)
+		PRT_HOST_CHK (dat[i] == host_i2c.reg[0x110 + i]);
+
+	PRT_HOST_CHK (i2c.seq.sta == PRT_I2C_TRX_OK);
+
+	// A held bus times out the sequencer.
+	// The queue doesn't take transactions while the sequencer has the bus.
+	host_i2c.hold = PRT_TRUE;
+	prt_i2c_seq_clr (&i2c);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_STR);
+	prt_i2c_seq_add (&i2c, PRT_I2C_SEQ_STP);
+	PRT_HOST_CHK (prt_i2c_seq_run (&i2c) == PRT_STA_OK);
+	PRT_HOST_CHK (prt_i2c_req (&i2c, PRT_I2C_TRX_WR, PRT_HOST_RC22504A_ADR, dat, 2, 0, PRT_I2C_TRX_DEF_TIMEOUT, 0, 0) == 0);
+	PRT_HOST_CHK (prt_i2c_seq_wait (&i2c) == PRT_I2C_TRX_TIMEOUT);
+	host_i2c.hold = PRT_FALSE;
+}
+
+// Test list
+// Every test is also registered with ctest (CMakeLists.txt)
+static const struct {
+	const char	*name;
+	void		(*run) (void);
+} tests[] = {
+	{"pm",			prt_host_test_pm},
+	{"trx",			prt_host_test_trx},
+	{"dpcd",		prt_host_test_dpcd},
+	{"edid_wr",		prt_host_test_edid_wr},
+	{"hpd",			prt_host_test_hpd},
+	{"cb_wait",		prt_host_test_cb_wait},
+	{"lnk_plan",		prt_host_test_lnk_plan},
+	{"lkg",			prt_host_test_lkg},
+	{"mst",			prt_host_test_mst},
+	{"vid_str",		prt_host_test_vid_str},
+	{"edid_rd",		prt_host_test_edid_rd},
+	{"vtb_cr",		prt_host_test_vtb_cr},
+	{"vtb_cvt",		prt_host_test_vtb_cvt},
+	{"vtb_preset",		prt_host_test_vtb_preset},
+	{"vtb_cr_tune",		prt_host_test_vtb_cr_tune},
+	{"vtb_tel",		prt_host_test_vtb_tel},
+	{"i2c_wr",		prt_host_test_i2c_wr},
+	{"rc22504a_cfg",	prt_host_test_rc22504a_cfg},
+	{"rc22504a_dif",	prt_host_test_rc22504a_dif},
+	{"i2c_queue",		prt_host_test_i2c_queue},
+	{"i2c_seq",		prt_host_test_i2c_seq},
+};
+
+#define PRT_HOST_TESTS		(sizeof (tests) / sizeof (tests[0]))
+
+// Main
+// Without argument all tests run, otherwise only the named test
+int main (int argc, char *argv[])
+{
+	// Variables
+	prt_u32 i;
+	prt_u32 runs = 0;
+	prt_u32 fails = 0;
+
+	// Register file
+	prt_host_reg_init ();
+	prt_host_reg_add ("pio", PRT_PIO_BASE, 0, 0, 0);
+	prt_host_reg_add ("uart", PRT_UART_BASE, prt_host_uart_rd, prt_host_uart_wr, 0);
+	prt_host_reg_add ("i2c", PRT_I2C_BASE, prt_host_i2c_rd, prt_host_i2c_wr, 0);
+	prt_host_reg_add ("vtb", PRT_VTB0_BASE, prt_host_vtb_rd, prt_host_vtb_wr, 0);
+	prt_host_pm_init (&dptx_pm, "dptx", PRT_DPTX_BASE, &dptx);
+	prt_host_pm_init (&dprx_pm, "dprx", PRT_DPRX_BASE, &dprx);
+
+	// Drivers
+	prt_uart_init (&uart, PRT_UART_BASE);
+	prt_tmr_init (&tmr, PRT_TMR_BASE);
+	prt_i2c_init (&i2c, PRT_I2C_BASE, 100);
+	prt_i2c_set_tmr (&i2c, &tmr);
+	prt_vtb_set_base (&vtb, PRT_VTB0_BASE);
+	prt_vtb_set_tmr (&vtb, &tmr);
+	prt_vtb_set_idle_cb (&vtb, &prt_host_vtb_idle);
+	prt_vtb_set_refclk (&vtb, 10000);
+	prt_vtb_set_vidclk (&vtb, 20000);
+
+	if (!prt_dp_set_base (&dptx, PRT_DPTX_BASE) || !prt_dp_set_base (&dprx, PRT_DPRX_BASE))
+	{
+		printf ("host: no DP peripheral\n");
+		return 1;
+	}
+
+	// Policy maker
+	prt_dp_rom_init (&dptx, prt_dptx_pm_rom_len, prt_dptx_pm_rom);
+	prt_dp_ram_init (&dptx, prt_dptx_pm_ram_len, prt_dptx_pm_ram);
+	prt_dp_init (&dptx, &tmr, PRT_DPTX_ID);
+	prt_dp_init (&dprx, &tmr, PRT_DPRX_ID);
+
+	printf ("\nDisplayPort host benchmark\n");
+	printf ("(c) 2025 by Parretto B.V.\n\n");
+
+	// Tests
+	for (i = 0; i < PRT_HOST_TESTS; i++)
+	{
+		if ((argc > 1) && strcmp (argv[1], tests[i].name))
+			continue;
+
+		test.name = tests[i].name;
+		test.sta = PRT_TRUE;
+		tests[i].run ();
+		runs++;
+
+		if (!test.sta)
+			fails++;
+	}
+
+	if (runs == 0)
+	{
+		printf ("host: unknown test %s\n", argv[1]);
+		return 1;
+	}
+
+	printf ("\nRequests: dptx %u, dprx %u\n", dptx_pm.reqs, dprx_pm.reqs);
+
+	if (fails == 0)
+	{
+		printf ("Result: ok\n");
+		return 0;
+	}
+	else
+	{
+		printf ("Result: %u of %u tests fail\n", fails, runs);
+		return 1;
+	}
+}
@@ -0,0 +1,340 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host policy maker model
+    Models the DP host interface registers. 
+    The policy maker is a script that answers every request token with response mails.
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+// Includes
+#include <stdint.h>
+#include <string.h>
+#include "prt_types.h"
+#include "prt_dp_tokens.h"
+#include "prt_dp_drv.h"
+#include "prt_host_reg.h"
+#include "prt_host_pm.h"
+
+// Registers
+#define PRT_HOST_PM_REG_ID			0
+#define PRT_HOST_PM_REG_CTL			1
+#define PRT_HOST_PM_REG_STA			2
+#define PRT_HOST_PM_REG_MAIL_OUT	3
+#define PRT_HOST_PM_REG_MAIL_IN		4
+#define PRT_HOST_PM_REG_AUX			5
+#define PRT_HOST_PM_REG_MEM			6
+
+// Models
+static prt_host_pm_struct *host_pm[PRT_HOST_PM_MAX];
+
+/*
+	Default script
+*/
+
+// Ok
+static void prt_host_pm_ok (prt_host_pm_struct *pm)
+{
+	// Variables
+	prt_u8 dat = PRT_DP_MAIL_OK;
+
+	prt_host_pm_put (pm, &dat, 1);
+}
+
+// Status
+static void prt_host_pm_sta (prt_host_pm_struct *pm)
+{
+	// Variables
+	// Hardware 1.0, software 1.0, hpd
+	const prt_u8 dat[] = {PRT_DP_MAIL_STA, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0};
+
+	prt_host_pm_put (pm, dat, sizeof (dat));
+}
+
+// DPCD write
+static void prt_host_pm_dpcd_wr (prt_host_pm_struct *pm)
+{
+	// Variables
+	prt_u8 adr = pm->req[3];
+
+	for (prt_u8 i = 0; i < pm->req[4]; i++)
+		pm->dpcd[(prt_u8) (adr + i)] = pm->req[5 + i];
+
+	prt_host_pm_ok (pm);
+}
+
+// DPCD read
+static void prt_host_pm_dpcd_rd (prt_host_pm_struct *pm)
+{
+	// Variables
+	prt_u8 dat[2 + 16];
+	prt_u8 adr = pm->req[3];
+	prt_u8 len = pm->req[4];
+
+	if (len > 16)
+		len = 16;
+
+	dat[0] = PRT_DP_MAIL_OK;
+	dat[1] = len;
+	for (prt_u8 i = 0; i < len; i++)
+		dat[2 + i] = pm->dpcd[(prt_u8) (adr + i)];
+
+	prt_host_pm_put (pm, dat, len + 2);
+}
+
+// EDID read
+// The EDID data mail follows the response
+static void prt_host_pm_edid_rd (prt_host_pm_struct *pm)
+{
+	// Variables
+	prt_u8 dat[1 + 16];
+
+	prt_host_pm_ok (pm);
+
+	dat[0] = PRT_DP_MAIL_EDID_DAT;
+	for (prt_u8 i = 0; i < 16; i++)
+		dat[1 + i] = pm->req[1] + i;
+
+	prt_host_pm_put (pm, dat, sizeof (dat));
+}
+
+static const prt_host_pm_script_struct prt_host_pm_script[] = {
+	{PRT_DP_MAIL_PING,			prt_host_pm_ok},
+	{PRT_DP_MAIL_LIC,			prt_host_pm_ok},
+	{PRT_DP_MAIL_CFG,			prt_host_pm_ok},
+	{PRT_DP_MAIL_RUN,			prt_host_pm_ok},
+	{PRT_DP_MAIL_STA,			prt_host_pm_sta},
+	{PRT_DP_MAIL_AUX_TST,		prt_host_pm_ok},
+	{PRT_DP_MAIL_PHY_TST,		prt_host_pm_ok},
+	{PRT_DP_MAIL_TRN_STR,		prt_host_pm_ok},
+	{PRT_DP_MAIL_LNK_REQ_OK,	prt_host_pm_ok},
+	{PRT_DP_MAIL_PHY_RST_ACK,	prt_host_pm_ok},
+	{PRT_DP_MAIL_MSA_DAT,		prt_host_pm_ok},
+	{PRT_DP_MAIL_VID_STR,		prt_host_pm_ok},
+	{PRT_DP_MAIL_VID_STP,		prt_host_pm_ok},
+	{PRT_DP_MAIL_DPCD_WR,		prt_host_pm_dpcd_wr},
+	{PRT_DP_MAIL_DPCD_RD,		prt_host_pm_dpcd_rd},
+	{PRT_DP_MAIL_EDID_RD,		prt_host_pm_edid_rd},
+	{PRT_DP_MAIL_EDID_DAT,		prt_host_pm_ok},
+	{PRT_DP_MAIL_MST_STR,		prt_host_pm_ok},
+	{PRT_DP_MAIL_MST_STP,		prt_host_pm_ok},
+};
+
+/*
+	Model
+*/
+
+// Request
+// Runs the script entry of the request token
+static void prt_host_pm_req (prt_host_pm_struct *pm)
+{
+	// Variables
+	prt_u8 dat = PRT_DP_MAIL_ERR;
+
+	pm->reqs++;
+
+	for (prt_u8 i = 0; i < pm->script_len; i++)
+	{
+		if (pm->script[i].req == pm->req[0])
+		{
+			pm->script[i].cb (pm);
+			return;
+		}
+	}
+
+	// Unknown request
+	prt_host_pm_put (pm, &dat, 1);
+}
+
+// Register read
+static prt_u32 prt_host_pm_rd (prt_host_dev_struct *dev, prt_u8 reg)
+{
+	// Variables
+	prt_host_pm_struct *pm = (prt_host_pm_struct *) dev->ctx;
+	prt_u32 dat;
+	prt_u16 wrds;
+
+	switch (reg)
+	{
+		case PRT_HOST_PM_REG_ID :
+			dat = 0x00004d47;
+			break;
+
+		case PRT_HOST_PM_REG_STA :
+			// The mail out and aux boxes are always empty
+			dat = PRT_DP_STA_MAIL_OUT_EP | PRT_DP_STA_AUX_EP;
+
+			if (pm->irq)
+				dat |= PRT_DP_STA_IRQ;
+
+			wrds = (pm->head - pm->tail) & (PRT_HOST_PM_FIFO_SIZE - 1);
+			if (wrds == 0)
+				dat |= PRT_DP_STA_MAIL_IN_EP;
+			if (wrds > 0x1f)
+				wrds = 0x1f;
+			dat |= wrds << PRT_DP_STA_MAIL_IN_WRDS_SHIFT;
+			break;
+
+		case PRT_HOST_PM_REG_MAIL_IN :
+			if (pm->head != pm->tail)
+			{
+				dat = pm->fifo[pm->tail];
+				pm->tail = (pm->tail + 1) & (PRT_HOST_PM_FIFO_SIZE - 1);
+			}
+			else
+				dat = 0;
+			break;
+
+		default :
+			dat = dev->reg[reg];
+			break;
+	}
+
+	return dat;
+}
+
+// Register write
+static void prt_host_pm_wr (prt_host_dev_struct *dev, prt_u8 reg, prt_u32 dat)
+{
+	// Variables
+	prt_host_pm_struct *pm = (prt_host_pm_struct *) dev->ctx;
+
+	switch (reg)
+	{
+		case PRT_HOST_PM_REG_CTL :
+			dev->reg[reg] = dat;
+
+			// Start memory initialization
+			if (dat & PRT_DP_CTL_MEM_STR)
+			{
+				pm->mem_sel = (dat & PRT_DP_CTL_MEM_SEL) ? 1 : 0;
+				pm->mem_wrds[pm->mem_sel] = 0;
+			}
+			break;
+
+		case PRT_HOST_PM_REG_STA :
+			// Clear interrupt
+			// The interrupt stays set while there are words left
+			if (dat & PRT_DP_STA_IRQ)
+				pm->irq = (pm->head != pm->tail) ? PRT_TRUE : PRT_FALSE;
+			break;
+
+		case PRT_HOST_PM_REG_MAIL_OUT :
+			dat &= 0x1ff;
+
+			// Start of mail
+			if (dat == PRT_DP_MAIL_SOM)
+				pm->req_len = 0;
+
+			// End of mail
+			else if (dat == PRT_DP_MAIL_EOM)
+			{
+				if (pm->req_len)
+					prt_host_pm_req (pm);
+			}
+
+			else if (pm->req_len < PRT_HOST_PM_MAIL_MAX)
+				pm->req[pm->req_len++] = dat;
+			break;
+
+		case PRT_HOST_PM_REG_MEM :
+			pm->mem_wrds[pm->mem_sel]++;
+			break;
+
+		default :
+			dev->reg[reg] = dat;
+			break;
+	}
+}
+
+// Initialize
+void prt_host_pm_init (prt_host_pm_struct *pm, const char *name, prt_u32 base, prt_dp_ds_struct *dp)
+{
+	memset (pm, 0, sizeof (prt_host_pm_struct));
+
+	pm->dp = dp;
+	pm->script = prt_host_pm_script;
+	pm->script_len = sizeof (prt_host_pm_script) / sizeof (prt_host_pm_script_struct);
+	pm->dev = prt_host_reg_add (name, base, prt_host_pm_rd, prt_host_pm_wr, pm);
+
+	// Register model
+	for (prt_u8 i = 0; i < PRT_HOST_PM_MAX; i++)
+	{
+		if (!host_pm[i])
+		{
+			host_pm[i] = pm;
+			break;
+		}
+	}
+}
+
+// Set script
+void prt_host_pm_set_script (prt_host_pm_struct *pm, const prt_host_pm_script_struct *script, prt_u8 len)
+{
+	pm->script = script;
+	pm->script_len = len;
+}
+
+// Put mail
+// Queues a mail for the host and raises the interrupt
+void prt_host_pm_put (prt_host_pm_struct *pm, const prt_u8 *dat, prt_u8 len)
+{
+	pm->fifo[pm->head] = PRT_DP_MAIL_SOM;
+	pm->head = (pm->head + 1) & (PRT_HOST_PM_FIFO_SIZE - 1);
+
+	for (prt_u8 i = 0; i < len; i++)
+	{
+		pm->fifo[pm->head] = dat[i];
+		pm->head = (pm->head + 1) & (PRT_HOST_PM_FIFO_SIZE - 1);
+	}
+
+	pm->fifo[pm->head] = PRT_DP_MAIL_EOM;
+	pm->head = (pm->head + 1) & (PRT_HOST_PM_FIFO_SIZE - 1);
+
+	pm->irq = PRT_TRUE;
+}
+
+// Interrupt
+// Runs the driver interrupt handler of every model with an enabled pending interrupt
+void prt_host_irq (void)
+{
+	// Variables
+	static prt_bool act = PRT_FALSE;
+	prt_host_pm_struct *pm;
+
+	// The interrupt handler itself reads the timer
+	if (act)
+		return;
+
+	act = PRT_TRUE;
+
+	for (prt_u8 i = 0; i < PRT_HOST_PM_MAX; i++)
+	{
+		pm = host_pm[i];
+
+		if (pm && pm->dp && pm->irq && (pm->dev->reg[PRT_HOST_PM_REG_CTL] & PRT_DP_CTL_IE))
+			prt_dp_irq_handler (pm->dp);
+	}
+
+	act = PRT_FALSE;
+}
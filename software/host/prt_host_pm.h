@@ -0,0 +1,68 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host policy maker model header
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+#pragma once
+
+#define PRT_HOST_PM_MAX			4		// Maximum number of models
+#define PRT_HOST_PM_FIFO_SIZE	256		// Mail in FIFO size. Must be a power of two.
+#define PRT_HOST_PM_MAIL_MAX	64		// Maximum request length
+
+typedef struct prt_host_pm_struct prt_host_pm_struct;
+
+// Script callback
+// Builds the response for the request in pm->req
+typedef void (*prt_host_pm_cb)(prt_host_pm_struct *pm);
+
+// Script entry
+typedef struct {
+	prt_u8				req;			// Request token
+	prt_host_pm_cb		cb;				// Response
+} prt_host_pm_script_struct;
+
+// Model structure
+struct prt_host_pm_struct {
+	prt_host_dev_struct					*dev;							// Register file
+	prt_dp_ds_struct					*dp;							// Driver instance that gets the interrupt
+	const prt_host_pm_script_struct		*script;						// Script
+	prt_u8								script_len;						// Script length
+	prt_u8								req[PRT_HOST_PM_MAIL_MAX];		// Request
+	prt_u8								req_len;						// Request length
+	prt_u16								fifo[PRT_HOST_PM_FIFO_SIZE];	// Mail in FIFO
+	prt_u16								head;							// FIFO head
+	prt_u16								tail;							// FIFO tail
+	prt_bool							irq;							// Interrupt
+	prt_u8								mem_sel;						// Memory select
+	prt_u32								mem_wrds[2];					// ROM and RAM words
+	prt_u8								dpcd[256];						// DPCD
+	prt_u32								reqs;							// Handled requests
+};
+
+// Prototypes
+void prt_host_pm_init (prt_host_pm_struct *pm, const char *name, prt_u32 base, prt_dp_ds_struct *dp);
+void prt_host_pm_set_script (prt_host_pm_struct *pm, const prt_host_pm_script_struct *script, prt_u8 len);
+void prt_host_pm_put (prt_host_pm_struct *pm, const prt_u8 *dat, prt_u8 len);
+void prt_host_irq (void);
@@ -0,0 +1,214 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host register file
+    The device address range is mapped without access rights. 
+    Every load or store faults, the access is routed to the device model 
+    and the instruction is single stepped with the range temporarily accessible.
+    This lets the unmodified drivers run natively on a x86-64 Linux host.
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+// Includes
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "prt_types.h"
+#include "prt_host_reg.h"
+
+// Trap flag
+#define PRT_HOST_REG_EFL_TF		(1 << 8)
+
+// Page fault error code write bit
+#define PRT_HOST_REG_ERR_WR		(1 << 1)
+
+// Data structure
+static struct {
+	prt_host_dev_struct		dev[PRT_HOST_REG_SLOTS];	// Devices
+	void					*page;						// Page of the access in flight
+	prt_host_dev_struct		*acc_dev;					// Device of the access in flight
+	prt_u8					acc_reg;					// Register of the access in flight
+	prt_bool				acc_wr;						// Write access in flight
+	volatile prt_u32		*acc_adr;					// Address of the access in flight
+	long					page_size;
+} host_reg;
+
+// Fatal error
+// Only async signal safe calls are used
+static void prt_host_reg_fatal (const char *msg)
+{
+	write (2, msg, strlen (msg));
+	_exit (1);
+}
+
+// Segmentation fault handler
+// Routes a read to the device model and arms the single step
+static void prt_host_reg_segv (int sig, siginfo_t *si, void *ctx)
+{
+	// Variables
+	ucontext_t *uc = (ucontext_t *) ctx;
+	uintptr_t adr = (uintptr_t) si->si_addr;
+	prt_host_dev_struct *dev;
+	prt_u32 slot;
+	prt_u32 ofs;
+
+	// Real segmentation fault
+	if ((adr < PRT_HOST_REG_BASE) || (adr >= (PRT_HOST_REG_BASE + (PRT_HOST_REG_SLOTS << PRT_HOST_REG_SLOT_SHIFT))))
+		prt_host_reg_fatal ("host: segmentation fault\n");
+
+	// Device
+	slot = (adr - PRT_HOST_REG_BASE) >> PRT_HOST_REG_SLOT_SHIFT;
+	ofs = (adr - PRT_HOST_REG_BASE) & ((1 << PRT_HOST_REG_SLOT_SHIFT) - 1);
+	dev = &host_reg.dev[slot];
+
+	if (!dev->name)
+		prt_host_reg_fatal ("host: access to unmapped device\n");
+
+	if ((ofs >> 2) >= PRT_HOST_REG_REGS)
+		prt_host_reg_fatal ("host: access to unmapped register\n");
+
+	// Open the page for the faulting instruction
+	host_reg.page = (void *) (adr & ~(host_reg.page_size - 1));
+	mprotect (host_reg.page, host_reg.page_size, PROT_READ | PROT_WRITE);
+
+	host_reg.acc_dev = dev;
+	host_reg.acc_reg = ofs >> 2;
+	host_reg.acc_adr = (volatile prt_u32 *) (adr & ~3);
+	host_reg.acc_wr = (uc->uc_mcontext.gregs[REG_ERR] & PRT_HOST_REG_ERR_WR) ? PRT_TRUE : PRT_FALSE;
+
+	// Read
+	// The value is placed in memory before the instruction is executed
+	if (!host_reg.acc_wr)
+	{
+		if (dev->rd)
+			*host_reg.acc_adr = dev->rd (dev, host_reg.acc_reg);
+		else
+			*host_reg.acc_adr = dev->reg[host_reg.acc_reg];
+		dev->rd_cnt++;
+	}
+
+	// Single step the instruction
+	uc->uc_mcontext.gregs[REG_EFL] |= PRT_HOST_REG_EFL_TF;
+}
+
+// Trap handler
+// Routes a write to the device model and closes the page again
+static void prt_host_reg_trap (int sig, siginfo_t *si, void *ctx)
+{
+	// Variables
+	ucontext_t *uc = (ucontext_t *) ctx;
+	prt_host_dev_struct *dev = host_reg.acc_dev;
+
+	// Write
+	if (host_reg.acc_wr)
+	{
+		if (dev->wr)
+			dev->wr (dev, host_reg.acc_reg, *host_reg.acc_adr);
+		else
+			dev->reg[host_reg.acc_reg] = *host_reg.acc_adr;
+		dev->wr_cnt++;
+	}
+
+	// Close page
+	mprotect (host_reg.page, host_reg.page_size, PROT_NONE);
+
+	// Stop single stepping
+	uc->uc_mcontext.gregs[REG_EFL] &= ~PRT_HOST_REG_EFL_TF;
+}
+
+// Initialize
+void prt_host_reg_init (void)
+{
+	// Variables
+	struct sigaction sa;
+	void *p;
+
+	host_reg.page_size = sysconf (_SC_PAGESIZE);
+
+	// Map the device range without access rights
+	p = mmap ((void *) PRT_HOST_REG_BASE, PRT_HOST_REG_SLOTS << PRT_HOST_REG_SLOT_SHIFT, PROT_NONE, 
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if (p != (void *) PRT_HOST_REG_BASE)
+	{
+		perror ("host: can't map the device range");
+		exit (1);
+	}
+
+	// Signal handlers
+	memset (&sa, 0, sizeof (sa));
+	sa.sa_flags = SA_SIGINFO;
+	sigemptyset (&sa.sa_mask);
+
+	sa.sa_sigaction = prt_host_reg_segv;
+	sigaction (SIGSEGV, &sa, NULL);
+
+	sa.sa_sigaction = prt_host_reg_trap;
+	sigaction (SIGTRAP, &sa, NULL);
+}
+
+// Add device
+prt_host_dev_struct *prt_host_reg_add (const char *name, prt_u32 base, prt_host_rd_cb rd, prt_host_wr_cb wr, void *ctx)
+{
+	// Variables
+	prt_host_dev_struct *dev;
+
+	dev = &host_reg.dev[(base - PRT_HOST_REG_BASE) >> PRT_HOST_REG_SLOT_SHIFT];
+	memset (dev, 0, sizeof (prt_host_dev_struct));
+	dev->name = name;
+	dev->base = base;
+	dev->rd = rd;
+	dev->wr = wr;
+	dev->ctx = ctx;
+
+	return dev;
+}
+
+// Clear access counters
+void prt_host_reg_clr_cnt (void)
+{
+	for (prt_u8 i = 0; i < PRT_HOST_REG_SLOTS; i++)
+	{
+		host_reg.dev[i].rd_cnt = 0;
+		host_reg.dev[i].wr_cnt = 0;
+	}
+}
+
+// Get access count
+// Returns the total number of register accesses
+prt_u32 prt_host_reg_get_cnt (void)
+{
+	// Variables
+	prt_u32 cnt = 0;
+
+	for (prt_u8 i = 0; i < PRT_HOST_REG_SLOTS; i++)
+		cnt += host_reg.dev[i].rd_cnt + host_reg.dev[i].wr_cnt;
+
+	return cnt;
+}
@@ -0,0 +1,59 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host register file header
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+#pragma once
+
+// The devices are mapped at the same addresses as on the target
+#define PRT_HOST_REG_BASE		0x80000000
+#define PRT_HOST_REG_SLOT_SHIFT	18						// Every device has a 256 KB slot
+#define PRT_HOST_REG_SLOTS		16
+#define PRT_HOST_REG_REGS		16						// Registers per device
+
+typedef struct prt_host_dev_struct prt_host_dev_struct;
+
+// Register callbacks
+// Without callbacks the device is a plain register file
+typedef prt_u32 (*prt_host_rd_cb)(prt_host_dev_struct *dev, prt_u8 reg);
+typedef void (*prt_host_wr_cb)(prt_host_dev_struct *dev, prt_u8 reg, prt_u32 dat);
+
+// Device structure
+struct prt_host_dev_struct {
+	const char			*name;						// Name
+	prt_u32				base;						// Base address
+	prt_host_rd_cb		rd;							// Read callback
+	prt_host_wr_cb		wr;							// Write callback
+	void				*ctx;						// Model context
+	prt_u32				reg[PRT_HOST_REG_REGS];		// Register file
+	prt_u32				rd_cnt;						// Read accesses
+	prt_u32				wr_cnt;						// Write accesses
+};
+
+// Prototypes
+void prt_host_reg_init (void);
+prt_host_dev_struct *prt_host_reg_add (const char *name, prt_u32 base, prt_host_rd_cb rd, prt_host_wr_cb wr, void *ctx);
+void prt_host_reg_clr_cnt (void);
+prt_u32 prt_host_reg_get_cnt (void);
@@ -0,0 +1,117 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Host timer
+    Replaces the timer peripheral driver with the host monotonic clock.
+    Reading the timestamp is the point where the device models deliver their interrupts,
+    as every driver wait loop reads the timer.
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+// Includes
+#include <stdint.h>
+#include <time.h>
+#include "prt_types.h"
+#include "prt_tmr.h"
+#include "prt_dp_drv.h"
+#include "prt_host_reg.h"
+#include "prt_host_pm.h"
+
+// Data structure
+static struct {
+	struct timespec org;		// Origin
+	prt_u32 alrm[2];			// Alarm timestamps
+} host_tmr;
+
+/*
+  Init
+*/
+void prt_tmr_init (prt_tmr_ds_struct *tmr, prt_u32 base)
+{
+  // There is no device
+  tmr->dev = 0;
+
+  // Origin
+  clock_gettime (CLOCK_MONOTONIC, &host_tmr.org);
+}
+
+/*
+  Sleep
+*/
+void prt_tmr_sleep (prt_tmr_ds_struct *tmr, prt_u8 alrm, prt_u32 us)
+{
+  // Set alarm 
+  prt_tmr_set_alrm (tmr, alrm, us);
+
+  // Wait for alarm 
+  while (!prt_tmr_is_alrm (tmr, alrm));
+}
+
+/*
+  Set alarm
+*/
+void prt_tmr_set_alrm (prt_tmr_ds_struct *tmr, prt_u8 alrm, prt_u32 us)
+{
+  host_tmr.alrm[alrm & 1] = prt_tmr_get_ts (tmr) + us;
+}
+
+/*
+  This function returns true when the alarm has been triggered
+*/
+prt_bool prt_tmr_is_alrm (prt_tmr_ds_struct *tmr, prt_u8 alrm)
+{
+  return prt_tmr_is_exp (tmr, host_tmr.alrm[alrm & 1]);
+}
+
+/*
+  Get timestamp
+  Pending device interrupts are delivered first
+*/
+prt_u32 prt_tmr_get_ts (prt_tmr_ds_struct *tmr)
+{
+  // Variables
+  struct timespec ts;
+
+  // Interrupts
+  prt_host_irq ();
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return (prt_u32) (((ts.tv_sec - host_tmr.org.tv_sec) * 1000000) + ((ts.tv_nsec - host_tmr.org.tv_nsec) / 1000));
+}
+
+/*
+  This function returns true when the timestamp has expired
+*/
+prt_bool prt_tmr_is_exp (prt_tmr_ds_struct *tmr, prt_u32 ts)
+{
+  // Variables
+  prt_s32 dif;
+
+  dif = (prt_s32) (prt_tmr_get_ts (tmr) - ts);
+
+  if (dif >= 0)
+    return PRT_TRUE;
+  else
+    return PRT_FALSE;
+}
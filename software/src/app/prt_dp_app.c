@@ -16,6 +16,25 @@
     v1.4 - Added training clock recovery callback and DPRX spread spectrum option
     v1.5 - Added support for Tentiva board with system controller
     v1.6 - Added PHY reset callback
+    v1.7 - Added mailbox transaction callback
+    v1.8 - Added DPCD read command
+    v1.9 - Added policy maker load time
+    v1.10 - Added boot profiler
+    v1.11 - Added mailbox trace
+    v1.12 - Added link and video statistics
+    v1.13 - Added interrupt dispatch table
+    v1.14 - Added pixel clock to MSA
+    v1.15 - Added link planner
+    v1.16 - Added last known good training
+    v1.17 - Added MST time slot allocation
+    v1.18 - Added event wait idle callback
+    v1.19 - Added CVT timing classification in pass-through
+    v1.20 - Added VTB clock recovery tuning
+    v1.21 - Added VTB clock recovery telemetry
+    v1.22 - Added Tentiva clock configuration time
+    v1.23 - Added Tentiva clock configuration differences
+    v1.24 - Added I2C interrupt
+    v1.25 - Added I2C command sequencer
     
     License
     =======
@@ -43,6 +62,7 @@
 #include "prt_pio.h"
 #include "prt_uart.h"
 #include "prt_tmr.h"
+#include "prt_prf.h"
 #include "prt_i2c.h"
 #include "prt_rc22504a.h"
 #include "prt_tentiva.h"
@@ -57,6 +77,7 @@
 #include "prt_dp_edid.h"
 #include "tentiva_phy_clk.h"
 #include "tentiva_vid_clk.h"
+#include "tentiva_clk_dif.h"
 
 // AMD ZCU102 board and Alinx AXAU15 board
 #if ((BOARD == BOARD_AMD_ZCU102) || (BOARD == BOARD_ALINX_AXAU15))
@@ -85,6 +106,9 @@ prt_uart_ds_struct uart;
 // Timer data structure
 prt_tmr_ds_struct tmr;
 
+// Profiler data structure
+prt_prf_ds_struct prf;
+
 // I2C data structure
 prt_i2c_ds_struct i2c;
 
@@ -94,6 +118,10 @@ prt_dp_ds_struct dptx;
 // DPRX data structure
 prt_dp_ds_struct dprx;
 
+// DP mailbox traces
+prt_dp_trc_struct dptx_trc;
+prt_dp_trc_struct dprx_trc;
+
 // PHY structures
 // AMD 
 #if (VENDOR == VENDOR_AMD)
@@ -114,6 +142,9 @@ prt_dp_ds_struct dprx;
 // VTB data structure
 prt_vtb_ds_struct vtb[2];
 
+// VTB clock recovery telemetry
+prt_vtb_tel_struct vtb_tel;
+
 // Tentiva data structure
 prt_tentiva_ds_struct tentiva;
 
@@ -135,18 +166,32 @@ int main (void)
      uint8_t cmd;
      uint32_t dat;
      uint16_t dpcd_adr;
-     uint8_t dpcd_dat;
+     uint8_t dpcd_dat[PRT_DP_AUX_MAX_LEN];
      uint8_t volt;
      uint8_t pre;
      uint8_t mst_sta;
+     uint32_t ts;
+     uint8_t prf_id;
 
      // Set application variables
      dp_app.tx.colorbar = false;
      dp_app.tx.mst = false;
+     dp_app.tx.lkg = false;
+     dp_app.tx.volt = 0xff;
+     dp_app.tx.pre = 0xff;
      dp_app.rx.pass = false;
      dp_app.vtb_cr_p_gain = 50;
      dp_app.vtb_cr_i_gain = 32000;
 
+     // Initialize timer
+     prt_tmr_init (&tmr, PRT_TMR_BASE);
+
+     // Initialize profiler
+     prt_prf_init (&prf, &tmr, SYS_CLK_FREQ);
+
+     // The first HPD marker is stopped by the DPTX HPD callback
+     dp_app.prf_hpd = prt_prf_str (&prf, "hpd");
+
      // Initialize log
      prt_log_init (&log);
      
@@ -154,7 +199,9 @@ int main (void)
      prt_pio_init (&pio, PRT_PIO_BASE);
 
      // Initialize uart
+     prf_id = prt_prf_str (&prf, "uart");
      prt_uart_init (&uart, PRT_UART_BASE);
+     prt_prf_stp (&prf, prf_id);
 
      // Print header
      prt_printf ("\n\n");
@@ -168,12 +215,14 @@ int main (void)
      prt_printf ("Date: '%s'\n", __DATE__);
      prt_printf ("Time: '%s'\n", __TIME__);
      prt_printf ("\n");
-    
-     // Initialize timer
-     prt_tmr_init (&tmr, PRT_TMR_BASE);
 
      // Initialize i2c
      prt_i2c_init (&i2c, PRT_I2C_BASE, I2C_BEAT);
+     prt_i2c_set_tmr (&i2c, &tmr);
+
+     // The clock configurations are loaded by the I2C sequencer, when it is available
+     if (prt_i2c_set_seq (&i2c, true) != PRT_STA_OK)
+          prt_printf ("I2C sequencer not available\n");
 
      // Assign DP TX base address
      prt_dp_set_base (&dptx, PRT_DPTX_BASE);
@@ -210,6 +259,9 @@ int main (void)
 
      // Assign VTB0 base address
      prt_vtb_set_base (&vtb[0], PRT_VTB0_BASE);
+     prt_vtb_set_tmr (&vtb[0], &tmr);
+     prt_vtb_set_tel (&vtb[0], &vtb_tel);
+     prt_vtb_set_idle_cb (&vtb[0], &vtb_idle_cb);
 
      // Assign VTB1 base address
      prt_vtb_set_base (&vtb[1], PRT_VTB1_BASE);
@@ -274,6 +326,7 @@ int main (void)
 #endif
 
      // Initialize Tentiva FMC
+     prf_id = prt_prf_str (&prf, "tentiva");
      prt_tentiva_init (&tentiva, &pio, &i2c, &tmr,
           PIO_IN_PHY_REFCLK_LOCK, PIO_IN_VID_REFCLK_LOCK, PIO_OUT_TENTIVA_CLK_SEL);
 
@@ -292,6 +345,13 @@ int main (void)
      // Set Video clock config 2
      prt_tentiva_set_clk_cfg (&tentiva, PRT_TENTIVA_VID_DEV, 2, &tentiva_vid_clk_cfg2_reg[0], TENTIVA_VID_CLK_CONFIG_NUM_REGS);
 
+     // Set clock configuration differences
+     // A switch between two configurations only loads the differing registers
+     prt_tentiva_set_clk_dif (&tentiva, PRT_TENTIVA_PHY_DEV, 0, 1, &tentiva_phy_clk_dif_0_1[0], TENTIVA_PHY_CLK_DIF_0_1_NUM_REGS);
+     prt_tentiva_set_clk_dif (&tentiva, PRT_TENTIVA_VID_DEV, 0, 1, &tentiva_vid_clk_dif_0_1[0], TENTIVA_VID_CLK_DIF_0_1_NUM_REGS);
+     prt_tentiva_set_clk_dif (&tentiva, PRT_TENTIVA_VID_DEV, 0, 2, &tentiva_vid_clk_dif_0_2[0], TENTIVA_VID_CLK_DIF_0_2_NUM_REGS);
+     prt_tentiva_set_clk_dif (&tentiva, PRT_TENTIVA_VID_DEV, 1, 2, &tentiva_vid_clk_dif_1_2[0], TENTIVA_VID_CLK_DIF_1_2_NUM_REGS);
+
      // Scan Tentiva
      prt_tentiva_scan (&tentiva);
 
@@ -301,6 +361,7 @@ int main (void)
      // Config
      prt_printf ("Tentiva config... ");
      sta = prt_tentiva_cfg (&tentiva, true);      // Fail on config error
+     prt_prf_stp (&prf, prf_id);
 
      if (sta == PRT_STA_OK)
           prt_printf ("ok\n");
@@ -310,6 +371,12 @@ int main (void)
           return -1;
      }
 
+     // Clock generator load time
+     // Only the Rev.C board has a clock generator
+     dat = prt_tentiva_get_clk_cfg_time (&tentiva);
+     if (dat)
+          prt_printf ("Tentiva: clock config %d us\n", dat);
+
      // Set the TX card select
      if (prt_tentiva_get_slot_id (&tentiva, 1) == PRT_TENTIVA_DP21TX_ID)
      {
@@ -359,17 +426,24 @@ int main (void)
      */
 
      // Initialize DPTX ROM
+     prf_id = prt_prf_str (&prf, "dptx pm");
      prt_printf ("Initialize DPTX ROM...");
+     ts = prt_tmr_get_ts (&tmr);
      prt_dp_rom_init (&dptx, prt_dptx_pm_rom_len, &prt_dptx_pm_rom[0]);
-     prt_printf ("done\n");
+     prt_printf ("done (%d us)\n", prt_tmr_get_ts (&tmr) - ts);
 
      // Initialize DPTX RAM
      prt_printf ("Initialize DPTX RAM...");
+     ts = prt_tmr_get_ts (&tmr);
      prt_dp_ram_init (&dptx, prt_dptx_pm_ram_len, &prt_dptx_pm_ram[0]);
-     prt_printf ("done\n");
+     prt_printf ("done (%d us)\n", prt_tmr_get_ts (&tmr) - ts);
+     prt_prf_stp (&prf, prf_id);
 
      // Initialize DP TX
-     prt_dp_init (&dptx, PRT_DPTX_ID);
+     prt_dp_init (&dptx, &tmr, PRT_DPTX_ID);
+
+     // Mailbox trace
+     prt_dp_set_trc (&dptx, &dptx_trc);
 
      
      // Register DPTX callbacks
@@ -398,23 +472,33 @@ int main (void)
      // Debug
      prt_dp_set_cb (&dptx, PRT_DP_CB_DBG, &dp_debug_cb);
 
+     // Idle
+     prt_dp_set_cb (&dptx, PRT_DP_CB_IDLE, &dptx_idle_cb);
+
       
      /*
           DPRX
      */
 
      // Initialize DPRX ROM
+     prf_id = prt_prf_str (&prf, "dprx pm");
      prt_printf ("Initialize DPRX ROM...");
+     ts = prt_tmr_get_ts (&tmr);
      prt_dp_rom_init (&dprx, prt_dprx_pm_rom_len, &prt_dprx_pm_rom[0]);
-     prt_printf ("done\n");
+     prt_printf ("done (%d us)\n", prt_tmr_get_ts (&tmr) - ts);
 
      // Initialize DPRX RAM
      prt_printf ("Initialize DPRX RAM...");
+     ts = prt_tmr_get_ts (&tmr);
      prt_dp_ram_init (&dprx, prt_dprx_pm_ram_len, &prt_dprx_pm_ram[0]);
-     prt_printf ("done\n");
+     prt_printf ("done (%d us)\n", prt_tmr_get_ts (&tmr) - ts);
+     prt_prf_stp (&prf, prf_id);
 
      // Initialize DP RX
-     prt_dp_init (&dprx, PRT_DPRX_ID);
+     prt_dp_init (&dprx, &tmr, PRT_DPRX_ID);
+
+     // Mailbox trace
+     prt_dp_set_trc (&dprx, &dprx_trc);
 
      // Register DPRX callbacks
 
@@ -442,6 +526,9 @@ int main (void)
      // Debug
      prt_dp_set_cb (&dprx, PRT_DP_CB_DBG, &dp_debug_cb);
 
+     // Idle
+     prt_dp_set_cb (&dprx, PRT_DP_CB_IDLE, &dprx_idle_cb);
+
 // Set TX and RX channel polarity
 #if (BOARD == BOARD_LSC_LFCPNX)
 
@@ -483,9 +570,20 @@ int main (void)
 
 #endif
 
+     // Register the DP instances in the interrupt dispatch table
+     prt_irq_reg (PRT_DPTX_ID, &dptx);
+     prt_irq_reg (PRT_DPRX_ID, &dprx);
+     prt_irq_reg_cb (I2C_IRQ_SRC, i2c_irq_handler);
+
+     // Only the pending sources are serviced
+     prt_irq_set_pnd (&irq_pnd_cb);
+
      // Initialize IRQ
      prt_irq_init ();
 
+     // The I2C transaction queue runs from the interrupt
+     prt_i2c_set_irq (&i2c, true);
+
      /*
           DPTX
      */
@@ -494,6 +592,7 @@ int main (void)
      prt_dp_lic (&dptx, dptx_lic);
 
      // Ping
+     prf_id = prt_prf_str (&prf, "dptx cfg");
      prt_printf ("\nDPTX: Ping...");
      if (prt_dp_ping (&dptx))
           prt_printf ("ok\n");
@@ -530,11 +629,16 @@ int main (void)
      // Set maximum lanes
      prt_dp_set_lnk_max_lanes (&dptx, 4);
 
+     // Platform limit for the link planner
+     prt_dptx_set_lnk_cap (&dptx, dat, 4);
+
      if (prt_dp_cfg (&dptx))
           prt_printf ("ok\n");
      else
           prt_printf ("error\n");
 
+     prt_prf_stp (&prf, prf_id);
+
      /*
           DPRX
      */
@@ -543,6 +647,7 @@ int main (void)
      prt_dp_lic (&dprx, dprx_lic);
 
      // Ping
+     prf_id = prt_prf_str (&prf, "dprx cfg");
      prt_printf ("\nDPRX: Ping...");
      if (prt_dp_ping (&dprx))
           prt_printf ("ok\n");
@@ -589,8 +694,12 @@ int main (void)
      else
           prt_printf ("error\n");
 
+     prt_prf_stp (&prf, prf_id);
+
      // Set edid
+     prf_id = prt_prf_str (&prf, "edid");
      set_edid (false);
+     prt_prf_stp (&prf, prf_id);
 
      // HPD plug
      prt_printf ("DPRX: HPD...");
@@ -609,6 +718,16 @@ int main (void)
           // Print log buffer
           prt_log_print (&log);
 
+          // Run DP callbacks and time out mailbox transactions
+          prt_dp_poll (&dptx);
+          prt_dp_poll (&dprx);
+
+          // Run I2C callbacks and time out queued transactions
+          prt_i2c_poll (&i2c);
+
+          // Sample the VTB clock recovery
+          prt_vtb_tel_poll (&vtb[0]);
+
           // Check for any UART input
           if (prt_uart_peek ())
           {
@@ -621,12 +740,11 @@ int main (void)
                     */
 
                     // Ping
+                    // The response is reported by the transaction callback
                     case 'q' :
-                         prt_printf ("DPTX: Ping...");
-                         if (prt_dp_ping (&dptx))
-                              prt_printf ("ok\n");
-                         else
-                              prt_printf ("error\n");
+                         prt_printf ("DPTX: Ping\n");
+                         if (!prt_dp_ping_req (&dptx, &dp_trx_cb))
+                              prt_printf ("DPTX: busy\n");
                          break;
 
                     // Status
@@ -662,6 +780,25 @@ int main (void)
                          prt_dptx_trn (&dptx);
                          break;
 
+                    // DPCD read
+                    case 'w' :
+                         prt_printf ("DPTX: DPCD read\n");
+                         prt_printf ("Address (hex): ");
+                         dpcd_adr = prt_uart_get_hex_val ();
+                         prt_printf ("\n");
+
+                         if (prt_dptx_dpcd_rd_burst (&dptx, dpcd_adr, PRT_DP_AUX_MAX_LEN, &dpcd_dat[0]))
+                         {
+                              prt_printf ("%x :", dpcd_adr);
+                              for (uint8_t i = 0; i < PRT_DP_AUX_MAX_LEN; i++)
+                                   prt_printf (" %x", dpcd_dat[i]);
+                              prt_printf ("\n");
+                         }
+
+                         else
+                              prt_printf ("DPTX: error\n");
+                         break;
+
                     // MST enable / disable
                     case 't' :
 
@@ -769,6 +906,41 @@ int main (void)
                          vtb_status ();
                          break;
 
+                    // Telemetry
+                    case 'j' :
+                         prt_printf ("VTB: Telemetry\n");
+                         prt_vtb_tel_dump (&vtb[0]);
+                         break;
+
+                    /* System */
+
+                    // Boot profile
+                    case 'p' :
+                         prt_printf ("\nBoot profile\n");
+                         prt_prf_dump (&prf);
+                         break;
+
+                    // Statistics
+                    case 's' :
+                         prt_printf ("\nStatistics\n");
+                         dp_stat (&dptx);
+                         dp_stat (&dprx);
+                         break;
+
+                    // Clear statistics
+                    case 'k' :
+                         prt_printf ("\nClear statistics\n");
+                         prt_dp_clr_stat (&dptx);
+                         prt_dp_clr_stat (&dprx);
+                         break;
+
+                    // Mailbox trace
+                    case 'o' :
+                         prt_printf ("\nMailbox trace\n");
+                         prt_dp_trc_dump (&dptx);
+                         prt_dp_trc_dump (&dprx);
+                         break;
+
                     /* Operation */
 
                     // Colorbar
@@ -795,6 +967,15 @@ int main (void)
                }
           }
 
+          // Last known good training
+          if (dp_app.tx.lkg == true)
+          {
+               // Clear flag
+               dp_app.tx.lkg = false;
+
+               dptx_lkg ();
+          }
+
           // Start colorbar
           if (dp_app.tx.colorbar == true)
           {
@@ -842,7 +1023,17 @@ int main (void)
 
           switch (prt_dp_hpd_get (dp))
           {
-               case PRT_DP_HPD_PLUG : prt_log_sprintf (&log, "HPD plug\n"); break;
+               case PRT_DP_HPD_PLUG : 
+                    prt_log_sprintf (&log, "HPD plug\n"); 
+
+                    // Boot profiler first HPD marker
+                    prt_prf_stp (&prf, dp_app.prf_hpd);
+
+                    // Look up the sink in the last known good cache
+                    #ifdef PRT_DP_LKG_HINT
+                    dp_app.tx.lkg = true;
+                    #endif
+                    break;
                case PRT_DP_HPD_IRQ : prt_log_sprintf (&log, "HPD pulse\n"); break;
                default : prt_log_sprintf (&log, "HPD unplug\n"); break;
           }
@@ -902,6 +1093,10 @@ int main (void)
           
           // Set linerate
           phy_set_tx_linerate (linerate);
+
+          // The voltage and pre-amble must be set again after a rate change
+          dp_app.tx.volt = 0xff;
+          dp_app.tx.pre = 0xff;
           
           // For debug only
           //phy_set_rx_linerate (linerate, 0);
@@ -938,7 +1133,13 @@ int main (void)
           pre = prt_dp_get_phy_pre (dp);
 
           // Set voltage and pre-amble
-          phy_set_tx_vap (volt, pre);
+          // A repeated request skips the PHY update
+          if ((volt != dp_app.tx.volt) || (pre != dp_app.tx.pre))
+          {
+               phy_set_tx_vap (volt, pre);
+               dp_app.tx.volt = volt;
+               dp_app.tx.pre = pre;
+          }
 
           // Send link request ok
           prt_dp_lnk_req_ok (dp);
@@ -1165,6 +1366,63 @@ int main (void)
           prt_log_sprintf (&log, "debug: %x\n", prt_dp_debug_get (dp));
      }
 
+     // DPTX idle callback
+     // While the DPTX waits for an event, the DPRX keeps running
+     void dptx_idle_cb (prt_dp_ds_struct *dp)
+     {
+          prt_dp_poll (&dprx);
+     }
+
+     // DPRX idle callback
+     // While the DPRX waits for a transaction, the DPTX keeps running
+     void dprx_idle_cb (prt_dp_ds_struct *dp)
+     {
+          prt_dp_poll (&dptx);
+     }
+
+     // VTB idle callback
+     // The DPTX and DPRX keep running during the clock recovery tuning
+     void vtb_idle_cb (void)
+     {
+          prt_dp_poll (&dptx);
+          prt_dp_poll (&dprx);
+     }
+
+     // Transaction callback
+     void dp_trx_cb (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl, prt_dp_trx_sta_type sta)
+     {
+          // Print prefix
+          if (dp->id == PRT_DPTX_ID)
+               prt_log_sprintf (&log, "DPTX: ");
+          else
+               prt_log_sprintf (&log, "DPRX: ");
+
+          switch (sta)
+          {
+               case PRT_DP_TRX_OK        : prt_log_sprintf (&log, "ok\n"); break;
+               case PRT_DP_TRX_NACK      : prt_log_sprintf (&log, "nack\n"); break;
+               case PRT_DP_TRX_TIMEOUT   : prt_log_sprintf (&log, "time out\n"); break;
+               default                   : prt_log_sprintf (&log, "error\n"); break;
+          }
+     }
+
+     // I2C interrupt handler
+     void i2c_irq_handler (void)
+     {
+          prt_i2c_irq_handler (&i2c);
+     }
+
+     // Interrupt pending callback
+     // The pending register has the DPTX, DPRX and I2C sources at the bits of their source number
+     prt_u32 irq_pnd_cb (void)
+     {
+          // Variables
+          volatile prt_u32 *pnd;
+
+          pnd = (prt_u32 *) PRT_IRQ_BASE;
+          return *pnd;
+     }
+
 /*
      Menu
 */
@@ -1177,6 +1435,7 @@ int main (void)
          prt_printf ("q - Ping\n");
          prt_printf ("e - Status\n");
          prt_printf ("r - Read EDID\n");
+         prt_printf ("w - DPCD read\n");
 
          prt_printf ("\n__DPRX__\n");
          prt_printf ("a - Ping\n");
@@ -1185,6 +1444,13 @@ int main (void)
 
          prt_printf ("\n__VTB__\n");
          prt_printf ("l - Status\n");
+         prt_printf ("j - Telemetry (CSV)\n");
+
+         prt_printf ("\n__System__\n");
+         prt_printf ("p - Boot profile\n");
+         prt_printf ("o - Mailbox trace\n");
+         prt_printf ("s - Statistics\n");
+         prt_printf ("k - Clear statistics\n");
      
          prt_printf ("\n__Operation__\n");
          prt_printf ("z - Colorbar\n");
@@ -1473,6 +1739,8 @@ void vtb_status (void)
      prt_printf ("\t\tmin words: %d\n", prt_vtb_get_fifo_min_wrds (&vtb[0]));
 
      prt_printf ("\tClock recovery\n"); 
+     prt_printf ("\t\tP gain: %d\n", prt_vtb_cr_get_p_gain (&vtb[0]));
+     prt_printf ("\t\tI gain: %d\n", prt_vtb_cr_get_i_gain (&vtb[0]));
      prt_printf ("\t\terror: ");
      signed_dat = prt_vtb_get_cr_cur_err (&vtb[0]);
 
@@ -1554,6 +1822,106 @@ void vtb_status (void)
      prt_printf ("\t\tvideo clock frequency: %d\n", prt_vtb_get_vid_ref_freq (&vtb[0]));
 }
 
+// Last known good training
+// Looks up the connected sink in the training cache.
+// On a hit the link is trained again starting at the cached settings.
+void dptx_lkg (void)
+{
+     // Read sink key
+     if (!prt_dptx_lkg_key (&dptx))
+     {
+          prt_printf ("DPTX: Sink key read error\n");
+          return;
+     }
+
+     // Offer the cached settings
+     // The policy maker requests the cached rate, voltage and pre-amble first
+     if (prt_dptx_lkg_hint (&dptx))
+     {
+          prt_printf ("DPTX: Fast training\n");
+          prt_dptx_trn (&dptx);
+     }
+}
+
+// Link plan
+// Selects the smallest link that carries the video and trains the link again when needed.
+// Streams is zero for SST, or the number of MST streams.
+prt_sta_type dptx_lnk_plan (prt_dp_tp_struct *tp, uint8_t streams)
+{
+     // Variables
+     uint32_t dl;
+
+     if (!prt_dptx_lnk_plan (&dptx, tp, streams))
+     {
+          prt_printf ("DPTX: video mode exceeds link capacity\n");
+          return PRT_STA_FAIL;
+     }
+
+     prt_printf ("DPTX: Link plan | lanes: %d | rate: %x\n", prt_dp_get_lnk_max_lanes (&dptx), prt_dp_get_lnk_max_rate (&dptx));
+
+     // The active link already matches
+     if (prt_dp_is_lnk_up (&dptx) 
+          && (prt_dp_get_lnk_act_lanes (&dptx) == prt_dp_get_lnk_max_lanes (&dptx)) 
+          && (prt_dp_get_lnk_act_rate (&dptx) == prt_dp_get_lnk_max_rate (&dptx)))
+          return PRT_STA_OK;
+
+     // Training would drop the MST allocation, so the plan is applied at the next training
+     if (streams != 0)
+          return PRT_STA_OK;
+
+     prt_printf ("DPTX: Training... ");
+     prt_dptx_trn (&dptx);
+
+     // Wait for link up with the planned configuration
+     dl = prt_tmr_get_ts (&tmr) + 1000000;
+
+     while (!(prt_dp_is_lnk_up (&dptx) 
+          && (prt_dp_get_lnk_act_lanes (&dptx) == prt_dp_get_lnk_max_lanes (&dptx)) 
+          && (prt_dp_get_lnk_act_rate (&dptx) == prt_dp_get_lnk_max_rate (&dptx))))
+     {
+          prt_dp_poll (&dptx);
+
+          // The DPRX keeps running
+          prt_dp_poll (&dprx);
+
+          if (prt_tmr_is_exp (&tmr, dl))
+          {
+               prt_printf ("timeout\n");
+               return PRT_STA_FAIL;
+          }
+     }
+
+     prt_printf ("ok\n");
+
+     // The link callback could have requested the colorbar
+     dp_app.tx.colorbar = false;
+
+     return PRT_STA_OK;
+}
+
+// MST time slot allocation
+prt_sta_type dptx_mst_alloc (prt_dp_tp_struct *tp, uint8_t streams)
+{
+     // Variables
+     uint8_t sta;
+
+     prt_printf ("DPTX: MST time slot allocation... ");
+     sta = prt_dptx_mst_alloc (&dptx, tp, streams);
+
+     if (sta)
+          prt_printf ("ok\n");
+     else
+          prt_printf ("streams don't fit\n");
+
+     for (uint8_t i = 0; i < streams; i++)
+          prt_printf (" stream %d - PBN: %d, time slots: %d\n", i, prt_dptx_get_mst_pbn (&dptx, i), prt_dptx_get_mst_ts (&dptx, i));
+
+     if (sta)
+          return PRT_STA_OK;
+     else
+          return PRT_STA_FAIL;
+}
+
 // Colorbar
 prt_sta_type vtb_colorbar (prt_bool force)
 {
@@ -1561,8 +1929,10 @@ prt_sta_type vtb_colorbar (prt_bool force)
      uint8_t cmd;
      prt_vtb_tp_struct vtb_tp;
      prt_dp_tp_struct dp_tp;
+     prt_dp_tp_struct mst_tp[2];
      uint8_t vtb_preset;
      uint32_t tentiva_clk;
+     uint32_t time;
      uint8_t bpc; 
 
      prt_printf ("\nStart colorbar\n");
@@ -1596,6 +1966,11 @@ prt_sta_type vtb_colorbar (prt_bool force)
           prt_printf ("Set video clock frequency: %d kHz\n", tentiva_clk);
           prt_tentiva_set_vid_freq (&tentiva, tentiva_clk);
 
+          // Clock generator load time
+          time = prt_tentiva_get_clk_cfg_time (&tentiva);
+          if (time)
+               prt_printf ("Tentiva: clock config %d us\n", time);
+
           for (uint8_t i = 0; i < 2; i++)
           {
                // Start test pattern
@@ -1624,6 +1999,26 @@ prt_sta_type vtb_colorbar (prt_bool force)
                dp_tp.vheight = vtb_tp.vheight;
                dp_tp.vstart = vtb_tp.vstart;
                dp_tp.vsw = vtb_tp.vsw;
+               dp_tp.pclk = vtb_tp.pclk;
+               dp_tp.bpc = 8;
+
+               // Plan link for both streams
+               if ((i == 0) && (dptx_lnk_plan (&dp_tp, 2) != PRT_STA_OK))
+                    return PRT_STA_FAIL;
+
+               // Allocate the time slots for both streams
+               // The allocator only uses the pixel clock and the bits per component
+               if (i == 0)
+               {
+                    for (uint8_t j = 0; j < 2; j++)
+                    {
+                         mst_tp[j].pclk = dp_tp.pclk;
+                         mst_tp[j].bpc = dp_tp.bpc;
+                    }
+
+                    if (dptx_mst_alloc (mst_tp, 2) != PRT_STA_OK)
+                         return PRT_STA_FAIL;
+               }
 
                // Set DPTX MSA
                prt_printf ("DPTX: Set MSA stream %d\n", i);
@@ -1751,6 +2146,8 @@ prt_sta_type vtb_colorbar (prt_bool force)
 
           // Start test pattern
           prt_printf ("VTB: Start test pattern\n");
+          // The clock recovery doesn't run with the test pattern generator
+          prt_vtb_tel_stp (&vtb[0]);
           prt_vtb_tpg (&vtb[0], NULL, vtb_preset, VTB_TPG_FMT_FULL);
 
           // Get video timing parameters
@@ -1766,6 +2163,11 @@ prt_sta_type vtb_colorbar (prt_bool force)
           prt_printf ("Set video clock frequency: %d kHz\n", tentiva_clk);
           prt_tentiva_set_vid_freq (&tentiva, tentiva_clk);
 
+          // Clock generator load time
+          time = prt_tentiva_get_clk_cfg_time (&tentiva);
+          if (time)
+               prt_printf ("Tentiva: clock config %d us\n", time);
+
           // Copy VTB timing parameters to DP   
           dp_tp.htotal = vtb_tp.htotal;
           dp_tp.hwidth = vtb_tp.hwidth;
@@ -1775,11 +2177,16 @@ prt_sta_type vtb_colorbar (prt_bool force)
           dp_tp.vheight = vtb_tp.vheight;
           dp_tp.vstart = vtb_tp.vstart;
           dp_tp.vsw = vtb_tp.vsw;
+          dp_tp.pclk = vtb_tp.pclk;
 
           // Set color depth
           dp_tp.bpc = bpc;           // Bits per component
           prt_printf ("DPTX: Color depth: %d\n", dp_tp.bpc);
 
+          // Plan link
+          if (dptx_lnk_plan (&dp_tp, 0) != PRT_STA_OK)
+               return PRT_STA_FAIL;
+
           prt_printf ("DPTX: Set MSA\n");
           prt_dptx_msa_set (&dptx, &dp_tp, 0);
 
@@ -1803,8 +2210,11 @@ prt_sta_type vtb_pass (void)
      uint8_t cmd;
      prt_dp_tp_struct dp_tp;
      prt_vtb_tp_struct vtb_tp;
+     prt_vtb_tp_struct cvt_tp;
      uint32_t tentiva_clk;
+     uint32_t time;
      uint8_t vtb_preset;
+     uint8_t cvt;
 
      // Check if DP sink is connected
      if (!prt_dp_is_hpd (&dptx))
@@ -1845,15 +2255,6 @@ prt_sta_type vtb_pass (void)
      // Get DPRX timing parameters
      dp_tp = prt_dprx_tp_get (&dprx);
 
-     // Find preset
-     vtb_preset = prt_vtb_find_preset (dp_tp.htotal, dp_tp.vtotal, &tentiva_clk);
-
-     if (vtb_preset == 0)
-     {
-          prt_printf ("VTB: video preset not supported\n");
-          return PRT_STA_FAIL;
-     } 
-     
      // Copy DP timing parameters to VTB
      vtb_tp.htotal = dp_tp.htotal;
      vtb_tp.hwidth = dp_tp.hwidth;
@@ -1864,6 +2265,39 @@ prt_sta_type vtb_pass (void)
      vtb_tp.vstart = dp_tp.vstart;
      vtb_tp.vsw = dp_tp.vsw;
 
+     // Find preset
+     vtb_preset = prt_vtb_find_preset (dp_tp.htotal, dp_tp.vtotal, &tentiva_clk);
+
+     // Classify the timing against the CVT formulas
+     if (vtb_preset == 0)
+     {
+          // The source pixel clock follows from the MSA Mvid and Nvid
+          if (dp_tp.nvid != 0)
+               vtb_tp.pclk = prt_vtb_div64 (prt_vtb_mul64 (dp_tp.mvid, prt_dp_get_lnk_act_rate (&dprx) * 27000), dp_tp.nvid);
+          else
+               vtb_tp.pclk = 0;
+
+          cvt = prt_vtb_cvt_classify (&vtb_tp, &cvt_tp);
+
+          if (cvt == VTB_CVT_NONE)
+          {
+               prt_printf ("VTB: video preset not supported\n");
+               return PRT_STA_FAIL;
+          }
+
+          prt_printf ("VTB: CVT%s timing %dx%d (%d kHz)\n", (cvt == VTB_CVT_RB2) ? "-RB2" : (cvt == VTB_CVT_RB) ? "-RB" : "", 
+               cvt_tp.hwidth, cvt_tp.vheight, cvt_tp.pclk);
+          tentiva_clk = cvt_tp.pclk;
+     } 
+     
+     // Pixel clock of the preset
+     vtb_tp.pclk = tentiva_clk;
+     dp_tp.pclk = tentiva_clk;
+
+     // Plan link
+     if (dptx_lnk_plan (&dp_tp, 0) != PRT_STA_OK)
+          return PRT_STA_FAIL;
+
      // Modify pixel clock based on pixels per clock
      if (dp_app.ppc == 4)
           tentiva_clk = tentiva_clk >> 2;
@@ -1871,8 +2305,18 @@ prt_sta_type vtb_pass (void)
           tentiva_clk = tentiva_clk >> 1;
 
      // Update tentiva video clock
+     // Without the video clock the clock recovery can't lock, so the pass-through stops here
      prt_printf ("Set video clock frequency: %d kHz\n", tentiva_clk);
-     prt_tentiva_set_vid_freq (&tentiva, tentiva_clk);
+     if (prt_tentiva_set_vid_freq (&tentiva, tentiva_clk) != PRT_STA_OK)
+     {
+          prt_printf ("Tentiva: video clock error\n");
+          return PRT_STA_FAIL;
+     }
+
+     // Clock generator load time
+     time = prt_tentiva_get_clk_cfg_time (&tentiva);
+     if (time)
+          prt_printf ("Tentiva: clock config %d us\n", time);
 
      // Enable direct I2C access mode
      prt_printf ("I2C: enable direct access mode\n");
@@ -1882,10 +2326,25 @@ prt_sta_type vtb_pass (void)
      prt_tentiva_sel_dev (&tentiva, PRT_TENTIVA_VID_DEV);
 
      // Recovery
+     // The tuning starts at the application gains. The tuned gains are cached per preset.
      prt_printf ("VTB: start clock recovery\n");
      prt_vtb_cr_set_p_gain (&vtb[0], dp_app.vtb_cr_p_gain);
      prt_vtb_cr_set_i_gain (&vtb[0], dp_app.vtb_cr_i_gain);
-     prt_vtb_cr (&vtb[0], NULL, vtb_preset);
+
+     if (prt_vtb_cr_tune (&vtb[0], &vtb_tp, vtb_preset, false))
+          prt_printf ("VTB: clock recovery gains P %d, I %d\n", prt_vtb_cr_get_p_gain (&vtb[0]), prt_vtb_cr_get_i_gain (&vtb[0]));
+
+     // No lock, run the application gains
+     else
+     {
+          prt_printf ("VTB: clock recovery tuning failed\n");
+          prt_vtb_cr_set_p_gain (&vtb[0], dp_app.vtb_cr_p_gain);
+          prt_vtb_cr_set_i_gain (&vtb[0], dp_app.vtb_cr_i_gain);
+          prt_vtb_cr (&vtb[0], &vtb_tp, vtb_preset);
+     }
+
+     // Start the telemetry, the time to lock is measured from here
+     prt_vtb_tel_str (&vtb[0], VTB_TEL_PERIOD);
 
      // If the video is already running, then stop the video
      if (prt_dp_is_vid_up (&dptx, 0))
@@ -1917,6 +2376,70 @@ prt_sta_type vtb_pass (void)
 }
 
 
+/*
+     Statistics
+*/
+
+// Show statistics
+void dp_stat (prt_dp_ds_struct *dp)
+{
+     // Variables
+     prt_dp_stat_struct stat;
+     static const char * const rate[PRT_DP_STAT_RATES] = {"1.62", "2.7", "5.4", "8.1"};
+     static const char * const lnk_down[PRT_DP_STAT_LNK_DOWN] = {"other", "phy", "clk", "cdr", "scrm", "trn", "hpd", "vid", "idle", "to"};
+     static const char * const vid_down[PRT_DP_STAT_VID_DOWN] = {"other", "clk", "idle", "lnk", "err"};
+     static const char * const lnk_hist[PRT_DP_STAT_LNK_HIST] = {"< 10 ms", "< 50 ms", "< 100 ms", "< 500 ms", "< 1 s", ">= 1 s"};
+     static const char * const state[PRT_DP_STAT_STATES] = {"down", "link", "video"};
+
+     // Get snapshot
+     prt_dp_get_stat (dp, &stat);
+
+     if (dp->id == PRT_DPTX_ID)
+          prt_printf ("DPTX statistics\n");
+     else
+          prt_printf ("DPRX statistics\n");
+
+     // Link
+     prt_printf ("\tlink up: %d\n", stat.lnk_up);
+     prt_printf ("\tlink down:");
+     for (uint8_t i = 0; i < PRT_DP_STAT_LNK_DOWN; i++)
+     {
+          if (stat.lnk_down[i])
+               prt_printf (" %s %d", lnk_down[i], stat.lnk_down[i]);
+     }
+     prt_printf ("\n");
+
+     // Training
+     prt_printf ("\ttraining pass/fail (1 / 2 / 4 lanes)\n");
+     for (uint8_t r = 0; r < PRT_DP_STAT_RATES; r++)
+     {
+          prt_printf ("\t\t%s:", rate[r]);
+          for (uint8_t l = 0; l < PRT_DP_STAT_LANES; l++)
+               prt_printf (" %d/%d", stat.trn_pass[r][l], stat.trn_fail[r][l]);
+          prt_printf ("\n");
+     }
+
+     // Time to link up
+     prt_printf ("\ttime to link up\n");
+     for (uint8_t i = 0; i < PRT_DP_STAT_LNK_HIST; i++)
+          prt_printf ("\t\t%s: %d\n", lnk_hist[i], stat.lnk_hist[i]);
+
+     // Video
+     prt_printf ("\tvideo down:");
+     for (uint8_t i = 0; i < PRT_DP_STAT_VID_DOWN; i++)
+     {
+          if (stat.vid_down[i])
+               prt_printf (" %s %d", vid_down[i], stat.vid_down[i]);
+     }
+     prt_printf ("\n");
+
+     // Time in state
+     prt_printf ("\ttime in state (s)\n");
+     for (uint8_t i = 0; i < PRT_DP_STAT_STATES; i++)
+          prt_printf ("\t\t%s: %d\n", state[i], stat.tis_s[i]);
+}
+
+
 /*
      EDID
 */
@@ -50,6 +50,10 @@
 #define DPTX_IRQ_HANDLER
 #define DPRX_IRQ_HANDLER
 
+// I2C interrupt source
+// The DPTX and DPRX use the sources of their ID
+#define I2C_IRQ_SRC                     2
+
 // MST
 //#define MST              
 
@@ -65,6 +69,7 @@
 #define PRT_VTB1_BASE               	PRT_DEV_BASE + (7 << 18)
 #define PRT_PHY_BASE               	PRT_DEV_BASE + (8 << 18)
 #define PRT_SCALER_BASE                 PRT_DEV_BASE + (9 << 18)
+#define PRT_IRQ_BASE                    PRT_DEV_BASE + (11 << 18)
 
 // PIO in
 #define PIO_IN_PPC              	     (1 << 0)            // Pixels per clock
@@ -87,6 +92,9 @@
 typedef struct {
      bool colorbar;
      bool mst;
+     bool lkg;           // Read the sink key for the last known good training
+     uint8_t volt;       // Applied PHY voltage swing
+     uint8_t pre;        // Applied PHY pre-emphasis
 } prt_dp_app_tx_struct;
 
 typedef struct {
@@ -102,6 +110,7 @@ typedef struct {
      uint16_t vtb_cr_i_gain;
      prt_bool tentiva_dp21tx;
      prt_bool tentiva_dp21rx;
+     uint8_t prf_hpd;
 } prt_dp_app_struct;
 
 // Prototypes
@@ -121,6 +130,12 @@ void dp_lnk_cb (prt_dp_ds_struct *dp);
 void dp_vid_cb (prt_dp_ds_struct *dp);
 void dprx_msa_cb (prt_dp_ds_struct *dp);
 void dp_debug_cb (prt_dp_ds_struct *dp);
+void dptx_idle_cb (prt_dp_ds_struct *dp);
+void dprx_idle_cb (prt_dp_ds_struct *dp);
+void vtb_idle_cb (void);
+void dp_trx_cb (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl, prt_dp_trx_sta_type sta);
+void i2c_irq_handler (void);
+prt_u32 irq_pnd_cb (void);
 
 // PHY
 void phy_set_tx_linerate (uint8_t linerate);
@@ -131,10 +146,16 @@ void phy_set_rx_linerate (uint8_t linerate, uint8_t ssc);
 void vtb_status (void);
 
 // Operation
+void dptx_lkg (void);
+prt_sta_type dptx_lnk_plan (prt_dp_tp_struct *tp, uint8_t streams);
+prt_sta_type dptx_mst_alloc (prt_dp_tp_struct *tp, uint8_t streams);
 prt_sta_type vtb_colorbar (prt_bool force);
 prt_sta_type vtb_pass (void);
 prt_sta_type scale (void);
 
+// Statistics
+void dp_stat (prt_dp_ds_struct *dp);
+
 // EDID
 void set_edid (prt_bool user);
 
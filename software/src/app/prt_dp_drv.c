@@ -14,6 +14,18 @@
 	v1.2 - Added 10-bits video support
 	v1.3 - Increased EDID size to 1024 bytes
 	v1.4 - Added training clock recovery signaling
+	v1.5 - Added mailbox transactions with time out
+	v1.6 - Added DPCD burst access
+	v1.7 - Added deferred event queue
+	v1.8 - Added inbound mail ring
+	v1.9 - Added packed memory initialization
+	v1.10 - Added mailbox trace
+	v1.11 - Added link and video statistics
+	v1.12 - Added Mvid and Nvid computation
+	v1.13 - Added link planner
+	v1.14 - Added last known good training cache
+	v1.15 - Added MST time slot allocator
+	v1.16 - Added event wait
 
     License
     =======
@@ -68,12 +80,13 @@ void prt_dp_set_cb (prt_dp_ds_struct *dp, prt_dp_cb_type cb_type, void *cb_handl
 		case PRT_DP_CB_VID 		: dp->cb.vid = (prt_dp_cb)cb_handler; break; 
 		case PRT_DP_CB_MSA 		: dp->cb.msa = (prt_dp_cb)cb_handler; break;
 		case PRT_DP_CB_DBG 		: dp->cb.dbg = (prt_dp_cb)cb_handler; break;
+		case PRT_DP_CB_IDLE 	: dp->cb.idle = (prt_dp_cb)cb_handler; break;
 		default : break;
 	}
 }
 
 // Initialize
-void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id)
+void prt_dp_init (prt_dp_ds_struct *dp, prt_tmr_ds_struct *tmr, uint8_t id)
 {
 	// Variables
 	uint32_t dat;
@@ -81,8 +94,12 @@ void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id)
 	// Set ID
 	dp->id = id;
 
+	// Timer
+	dp->tmr = tmr;
+
 	// Clear flags
 	dp->evt = 0;
+	dp->evt_lat = 0;
 	dp->cb.hpd = 0;
 	dp->cb.sta = 0;
 	dp->cb.trn = 0;
@@ -92,9 +109,21 @@ void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id)
 	dp->cb.lnk = 0;
 	dp->cb.vid = 0;
 	dp->cb.msa = 0;
-	dp->mail_in.err = PRT_FALSE;
-	dp->mail_in.ok = PRT_FALSE;
-	dp->mail_in.proc = PRT_FALSE;
+	dp->cb.idle = 0;
+	dp->mail_in.len = 0;
+	dp->mail_ring.head = 0;
+	dp->mail_ring.tail = 0;
+	dp->mail_ring.wr = 0;
+	dp->mail_ring.hwm = 0;
+	dp->mail_ring.ovf = 0;
+	dp->mail_ring.drop = PRT_FALSE;
+	dp->trx.sta = PRT_DP_TRX_IDLE;
+	dp->trx.hndl = 0;
+	dp->trx.cb = 0;
+	dp->trx.len = 0;
+	dp->trx.wait = PRT_FALSE;
+	dp->cb_busy = PRT_FALSE;
+	dp->trc = 0;
 	dp->trn.pass = PRT_FALSE;
 	dp->trn.fail = PRT_FALSE;
 	dp->trn.tps = 0;
@@ -103,12 +132,27 @@ void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id)
 	dp->lnk.phy_ssc = 0;
 	dp->lnk.up = PRT_FALSE;
 	dp->lnk.mst_cap = PRT_FALSE;
-	dp->vid[0].up = PRT_FALSE;
-	dp->vid[0].evt = PRT_FALSE;
-	dp->vid[1].up = PRT_FALSE;
-	dp->vid[1].evt = PRT_FALSE;
+	dp->lnk.cap_rate = PRT_DP_PHY_LINERATE_8100;
+	dp->lnk.cap_lanes = 4;
+	dp->lnk.headroom = PRT_DP_PLAN_HEADROOM;
+	for (uint8_t i = 0; i < PRT_DP_MST_STREAMS; i++)
+	{
+		dp->vid[i].up = PRT_FALSE;
+		dp->vid[i].evt = PRT_FALSE;
+		dp->mst.pbn[i] = 0;
+		dp->mst.ts[i] = 0;
+	}
+	dp->mst.spl = 4;		// Until the status is known. A group of four fits both MST logic variants.
+	dp->mst.streams = 0;
+	dp->mst.used = 0;
 	dp->debug.head = 0;
 	dp->debug.tail = 0;
+
+	// Clear statistics
+	prt_dp_stat_rst (dp);
+
+	// Clear last known good cache
+	prt_dptx_lkg_clr (dp);
 	
 	// Enable mail_out and mail_in boxes
 	// Enable interrupt and start policy maker
@@ -129,15 +173,30 @@ void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id)
 uint8_t prt_dp_ping (prt_dp_ds_struct *dp)
 {
 	// Variables
-	uint8_t sta;
+	prt_dp_trx_hndl hndl;
 
-	dp->mail_out.len = 0;
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_PING;	// Ping token
-	prt_dp_mail_send (dp);
+	// Wait for any transaction in flight
+	prt_dp_mail_new (dp);
+
+	// Send request
+	hndl = prt_dp_ping_req (dp, 0);
 
 	// Wait for response
-	sta = prt_dp_mail_resp (dp);
-	return sta;
+	return prt_dp_mail_resp (dp, hndl);
+}
+
+// Ping request
+// This function doesn't wait for the response.
+prt_dp_trx_hndl prt_dp_ping_req (prt_dp_ds_struct *dp, prt_dp_trx_cb cb)
+{
+	// Only one transaction can be in flight
+	if (!prt_dp_mail_rdy (dp))
+		return 0;
+
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_PING;	// Ping token
+
+	// Send mail
+	return prt_dp_trx_submit (dp, PRT_DP_TRX_DEF_TIMEOUT, cb);
 }
 
 // License key
@@ -146,18 +205,16 @@ uint8_t prt_dp_lic (prt_dp_ds_struct *dp, char *lic)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_LIC;	// License token
 	
 	// Copy license key
 	for (uint8_t i = 0; i < 8; i++)
 		dp->mail_out.dat[dp->mail_out.len++] = *(lic+i);
 	
-	// Send mail
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 	return sta;
 }
 
@@ -167,26 +224,8 @@ uint8_t prt_dp_cfg (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_MAX_RATE;		// Max line rate
-	dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.max_rate;		// Maximum link rate
-	prt_dp_mail_send (dp);
-
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
-
-	if (sta != PRT_TRUE)
-		return PRT_FALSE;
-
-	dp->mail_out.len = 0;
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_MAX_LANES;	// Max lanes
-	dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.max_lanes;		// Maximum lanes
-	prt_dp_mail_send (dp);
-
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Link
+	sta = prt_dp_cfg_lnk (dp);
 
 	if (sta != PRT_TRUE)
 		return PRT_FALSE;
@@ -195,14 +234,13 @@ uint8_t prt_dp_cfg (prt_dp_ds_struct *dp)
 	if (dp->id == PRT_DPRX_ID)
 	{
 		// MST capability
-		dp->mail_out.len = 0;
+		prt_dp_mail_new (dp);
 		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;		// Config
 		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_MST_CAP;	// MST
 		dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.mst_cap;		// Data
-		prt_dp_mail_send (dp);
 
-		// Wait for response
-		sta = prt_dp_mail_resp (dp);
+		// Send mail and wait for response
+		sta = prt_dp_mail_trx (dp);
 
 		if (sta != PRT_TRUE)
 			return PRT_FALSE;
@@ -218,6 +256,35 @@ uint8_t prt_dp_cfg (prt_dp_ds_struct *dp)
 	return sta;
 }
 
+// Config link
+// Sends the maximum link rate and lanes
+uint8_t prt_dp_cfg_lnk (prt_dp_ds_struct *dp)
+{
+	// Variables
+	uint8_t sta;
+
+	prt_dp_mail_new (dp);
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_MAX_RATE;		// Max line rate
+	dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.max_rate;		// Maximum link rate
+
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
+
+	if (sta != PRT_TRUE)
+		return PRT_FALSE;
+
+	prt_dp_mail_new (dp);
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_MAX_LANES;	// Max lanes
+	dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.max_lanes;		// Maximum lanes
+
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
+
+	return sta;
+}
+
 // Skip training
 // Only used in simulation
 #ifdef PRT_SIM
@@ -226,14 +293,13 @@ uint8_t prt_dprx_skip_trn (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
 	dp->mail_out.dat[dp->mail_out.len++] = 0xff;		// Skip training
 	dp->mail_out.dat[dp->mail_out.len++] = 0x47;	// Magic number
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	return sta;
 }
@@ -245,17 +311,15 @@ uint8_t prt_dptx_aux_test (prt_dp_ds_struct *dp, uint8_t run)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_AUX_TST;	// AUX test token
 	if (run == PRT_TRUE)
 		dp->mail_out.dat[dp->mail_out.len++] = 1;	// Enable test
 	else
 		dp->mail_out.dat[dp->mail_out.len++] = 0;	// Disable test
 
-	prt_dp_mail_send (dp);
-
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 	return sta;
 }
 
@@ -273,12 +337,11 @@ uint8_t prt_dp_run (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_RUN;	// Run
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	return sta;
 }
@@ -289,13 +352,12 @@ uint8_t prt_dptx_trn (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_TRN_STR;	// Token
 	dp->mail_out.dat[dp->mail_out.len++] = dp->lnk.max_rate;	// Maximum link rate
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 	return sta;
 }
 
@@ -305,15 +367,14 @@ uint8_t prt_dptx_phy_test (prt_dp_ds_struct *dp, uint8_t tps, uint8_t volt, uint
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_PHY_TST;	// Token
 	dp->mail_out.dat[dp->mail_out.len++] = tps;	// Training pattern
 	dp->mail_out.dat[dp->mail_out.len++] = volt;	// Voltage
 	dp->mail_out.dat[dp->mail_out.len++] = pre;	// Preamble
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 	return sta;
 }
 
@@ -347,12 +408,11 @@ uint8_t prt_dprx_hpd (prt_dp_ds_struct *dp, uint8_t hpd)
 		default : dat = PRT_DP_MAIL_HPD_UNPLUG; break;
 	}
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = dat;
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	return sta;
 }
@@ -361,9 +421,29 @@ uint8_t prt_dprx_hpd (prt_dp_ds_struct *dp, uint8_t hpd)
 uint8_t prt_dptx_msa_set (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t stream)
 {
 	// Variables
-	uint8_t sta;
+	prt_dp_trx_hndl hndl;
+
+	// Wait for any transaction in flight
+	prt_dp_mail_new (dp);
+
+	// Send request
+	hndl = prt_dptx_msa_set_req (dp, tp, stream, 0);
+
+	// Wait for response
+	return prt_dp_mail_resp (dp, hndl);
+}
+
+// Set MSA request
+// This function doesn't wait for the response.
+prt_dp_trx_hndl prt_dptx_msa_set_req (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t stream, prt_dp_trx_cb cb)
+{
+	// Variables
 	uint8_t dat;
 
+	// Only one transaction can be in flight
+	if (!prt_dp_mail_rdy (dp))
+		return 0;
+
 	// Copy timing parameters to DP structure
 	dp->vid[stream].tp.htotal 	= tp->htotal;
 	dp->vid[stream].tp.hwidth 	= tp->hwidth;
@@ -374,8 +454,12 @@ uint8_t prt_dptx_msa_set (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t st
 	dp->vid[stream].tp.vstart 	= tp->vstart;
 	dp->vid[stream].tp.vsw 		= tp->vsw;
 	dp->vid[stream].tp.bpc 		= tp->bpc;
+	dp->vid[stream].tp.pclk 	= tp->pclk;
+
+	// Mvid and Nvid
+	// The policy maker computes its own values, so these are not part of the mail.
+	prt_dptx_mvid_nvid (dp, stream);
 
-	dp->mail_out.len = 0;
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_MSA_DAT;					// MSA set
 	dp->mail_out.dat[dp->mail_out.len++] = stream;								// Stream
 	dp->mail_out.dat[dp->mail_out.len++] = (dp->vid[stream].tp.htotal >> 8);   	// Htotal upper
@@ -403,21 +487,152 @@ uint8_t prt_dptx_msa_set (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t st
 
 	dp->mail_out.dat[dp->mail_out.len++] = dat;  // Misc 0
 	dp->mail_out.dat[dp->mail_out.len++] = 0;  	// Misc 1
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail
+	return prt_dp_trx_submit (dp, PRT_DP_TRX_DEF_TIMEOUT, cb);
+}
 
-	return sta;
+// Mvid and Nvid
+// Mvid / Nvid is the ratio of the pixel clock to the link symbol clock.
+// The link symbol clock in kHz is the link rate code times 27 MHz.
+// The ratio is exact, as both clocks are reduced by their greatest common divisor.
+// Both values fit in the 24-bits MSA fields, as the clocks are below 16.7 GHz.
+void prt_dptx_mvid_nvid (prt_dp_ds_struct *dp, uint8_t stream)
+{
+	// Variables
+	uint32_t pclk;
+	uint32_t lclk;
+	uint32_t gcd;
+
+	pclk = dp->vid[stream].tp.pclk;
+
+	// Link symbol clock
+	lclk = dp->lnk.act_rate * 27000;
+
+	// Without pixel clock or link the values are unknown
+	if ((pclk == 0) || (lclk == 0))
+	{
+		dp->vid[stream].tp.mvid = 0;
+		dp->vid[stream].tp.nvid = 0;
+	}
+
+	else
+	{
+		gcd = prt_dp_gcd (pclk, lclk);
+		dp->vid[stream].tp.mvid = prt_dp_div (pclk, gcd);
+		dp->vid[stream].tp.nvid = prt_dp_div (lclk, gcd);
+	}
+}
+
+// Greatest common divisor
+// Binary algorithm, as the processor has no divider
+uint32_t prt_dp_gcd (uint32_t a, uint32_t b)
+{
+	// Variables
+	uint8_t shift = 0;
+	uint32_t tmp;
+
+	if (a == 0)
+		return b;
+
+	if (b == 0)
+		return a;
+
+	// Common factors of two
+	while (((a | b) & 1) == 0)
+	{
+		a >>= 1;
+		b >>= 1;
+		shift++;
+	}
+
+	while ((a & 1) == 0)
+		a >>= 1;
+
+	do
+	{
+		while ((b & 1) == 0)
+			b >>= 1;
+
+		// Keep a the smallest
+		if (a > b)
+		{
+			tmp = a;
+			a = b;
+			b = tmp;
+		}
+
+		b -= a;
+	} while (b != 0);
+
+	return a << shift;
+}
+
+// Divide
+// Shift and subtract, as the processor has no divider
+uint32_t prt_dp_div (uint32_t n, uint32_t d)
+{
+	// Variables
+	uint32_t q = 0;
+	uint32_t r = 0;
+
+	for (int8_t i = 31; i >= 0; i--)
+	{
+		r = (r << 1) | ((n >> i) & 1);
+
+		if (r >= d)
+		{
+			r -= d;
+			q |= ((uint32_t) 1 << i);
+		}
+	}
+
+	return q;
+}
+
+// Multiply
+// Shift and add, as the processor has no multiplier
+uint32_t prt_dp_mul (uint32_t a, uint32_t b)
+{
+	// Variables
+	uint32_t p = 0;
+
+	while (b != 0)
+	{
+		if (b & 1)
+			p += a;
+
+		a <<= 1;
+		b >>= 1;
+	}
+
+	return p;
 }
 
 // DPCD write 
 uint8_t prt_dptx_dpcd_wr (prt_dp_ds_struct *dp, uint32_t adr, uint8_t dat)
 {
 	// Variables
-	uint8_t sta;
+	prt_dp_trx_hndl hndl;
+
+	// Wait for any transaction in flight
+	prt_dp_mail_new (dp);
+
+	// Send request
+	hndl = prt_dptx_dpcd_wr_req (dp, adr, dat, 0);
+
+	// Wait for response
+	return prt_dp_mail_resp (dp, hndl);
+}
+
+// DPCD write request
+// This function doesn't wait for the response.
+prt_dp_trx_hndl prt_dptx_dpcd_wr_req (prt_dp_ds_struct *dp, uint32_t adr, uint8_t dat, prt_dp_trx_cb cb)
+{
+	// Only one transaction can be in flight
+	if (!prt_dp_mail_rdy (dp))
+		return 0;
 
-	dp->mail_out.len = 0;
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_DPCD_WR;	// DPCD write
 	dp->mail_out.dat[dp->mail_out.len++] = (adr >> 16) & 0xff;	// Address high
 	dp->mail_out.dat[dp->mail_out.len++] = (adr >> 8) & 0xff;	// Address mid
@@ -425,12 +640,8 @@ uint8_t prt_dptx_dpcd_wr (prt_dp_ds_struct *dp, uint32_t adr, uint8_t dat)
 	dp->mail_out.dat[dp->mail_out.len++] = 1;				// Length
 	dp->mail_out.dat[dp->mail_out.len++] = dat;				// Data
 
-	prt_dp_mail_send (dp);
-
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
-
-	return sta;
+	// Send mail
+	return prt_dp_trx_submit (dp, PRT_DP_TRX_DEF_TIMEOUT, cb);
 }
 
 // DPCD read 
@@ -438,21 +649,134 @@ uint8_t prt_dptx_dpcd_rd (prt_dp_ds_struct *dp, uint32_t adr, uint8_t *dat)
 {
 	// Variables
 	uint8_t sta;
+	prt_dp_trx_hndl hndl;
 
-	dp->mail_out.len = 0;
-	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_DPCD_RD;	// DPCD write
+	// Wait for any transaction in flight
+	prt_dp_mail_new (dp);
+
+	// Send request
+	hndl = prt_dptx_dpcd_rd_req (dp, adr, 0);
+
+	// Wait for response
+	sta = prt_dp_mail_resp (dp, hndl);
+
+	// Copy data
+	*dat = prt_dptx_get_dpcd_dat (dp);
+
+	return sta;
+}
+
+// DPCD read request
+// This function doesn't wait for the response.
+// On completion the data is available through prt_dptx_get_dpcd_dat.
+prt_dp_trx_hndl prt_dptx_dpcd_rd_req (prt_dp_ds_struct *dp, uint32_t adr, prt_dp_trx_cb cb)
+{
+	// Only one transaction can be in flight
+	if (!prt_dp_mail_rdy (dp))
+		return 0;
+
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_DPCD_RD;	// DPCD read
 	dp->mail_out.dat[dp->mail_out.len++] = (adr >> 16) & 0xff;	// Address high
 	dp->mail_out.dat[dp->mail_out.len++] = (adr >> 8) & 0xff;	// Address mid
 	dp->mail_out.dat[dp->mail_out.len++] = adr & 0xff;		// Address low
 	dp->mail_out.dat[dp->mail_out.len++] = 1;				// Length
 
-	prt_dp_mail_send (dp);
+	// Send mail
+	return prt_dp_trx_submit (dp, PRT_DP_TRX_DEF_TIMEOUT, cb);
+}
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+// Get DPCD read data
+uint8_t prt_dptx_get_dpcd_dat (prt_dp_ds_struct *dp)
+{
+	return dp->trx.dat[2];
+}
 
-	// Copy data
-	*dat = dp->mail_in.dat[2];
+// DPCD burst write
+// Ranges longer than the AUX maximum are split into multiple transactions.
+uint8_t prt_dptx_dpcd_wr_burst (prt_dp_ds_struct *dp, uint32_t adr, uint16_t len, uint8_t *dat)
+{
+	// Variables
+	uint8_t sta;
+	uint8_t blk;
+
+	sta = PRT_TRUE;
+
+	while ((len > 0) && (sta == PRT_TRUE))
+	{
+		// Block length
+		if (len > PRT_DP_AUX_MAX_LEN)
+			blk = PRT_DP_AUX_MAX_LEN;
+		else
+			blk = len;
+
+		prt_dp_mail_new (dp);
+		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_DPCD_WR;	// DPCD write
+		dp->mail_out.dat[dp->mail_out.len++] = (adr >> 16) & 0xff;	// Address high
+		dp->mail_out.dat[dp->mail_out.len++] = (adr >> 8) & 0xff;	// Address mid
+		dp->mail_out.dat[dp->mail_out.len++] = adr & 0xff;		// Address low
+		dp->mail_out.dat[dp->mail_out.len++] = blk;				// Length
+
+		for (uint8_t i = 0; i < blk; i++)
+			dp->mail_out.dat[dp->mail_out.len++] = *dat++;		// Data
+
+		// Send mail and wait for response
+		sta = prt_dp_mail_trx (dp);
+
+		// Next block
+		adr += blk;
+		len -= blk;
+	}
+
+	return sta;
+}
+
+// DPCD burst read
+// Ranges longer than the AUX maximum are split into multiple transactions.
+uint8_t prt_dptx_dpcd_rd_burst (prt_dp_ds_struct *dp, uint32_t adr, uint16_t len, uint8_t *dat)
+{
+	// Variables
+	uint8_t sta;
+	uint8_t blk;
+
+	sta = PRT_TRUE;
+
+	while ((len > 0) && (sta == PRT_TRUE))
+	{
+		// Block length
+		if (len > PRT_DP_AUX_MAX_LEN)
+			blk = PRT_DP_AUX_MAX_LEN;
+		else
+			blk = len;
+
+		prt_dp_mail_new (dp);
+		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_DPCD_RD;	// DPCD read
+		dp->mail_out.dat[dp->mail_out.len++] = (adr >> 16) & 0xff;	// Address high
+		dp->mail_out.dat[dp->mail_out.len++] = (adr >> 8) & 0xff;	// Address mid
+		dp->mail_out.dat[dp->mail_out.len++] = adr & 0xff;		// Address low
+		dp->mail_out.dat[dp->mail_out.len++] = blk;				// Length
+
+		// Send mail and wait for response
+		sta = prt_dp_mail_trx (dp);
+
+		if (sta == PRT_TRUE)
+		{
+			// The data starts at the third byte of the response.
+			// A short response means the sink returned less data than requested.
+			if (dp->trx.len < (blk + 2))
+				sta = PRT_FALSE;
+
+			else
+			{
+				// Copy data
+				for (uint8_t i = 0; i < blk; i++)
+					*dat++ = dp->trx.dat[2 + i];
+			}
+		}
+
+		// Next block
+		adr += blk;
+		len -= blk;
+	}
 
 	return sta;
 }
@@ -461,7 +785,6 @@ uint8_t prt_dptx_dpcd_rd (prt_dp_ds_struct *dp, uint32_t adr, uint8_t *dat)
 uint8_t prt_dp_vid_str (prt_dp_ds_struct *dp, uint8_t stream)
 {
 	// Variables
-	uint8_t tries = 0;
 	uint8_t sta = PRT_FALSE;
 
 	// If the video is already running, then stop the video
@@ -472,29 +795,26 @@ uint8_t prt_dp_vid_str (prt_dp_ds_struct *dp, uint8_t stream)
 	if (prt_dp_is_hpd (dp))
 	{
 		// When there is a sink, we need to check if the link is up
-		// The policy maker might be busy training the link, so we need to try a couple of times
-		do
-		{
-			if (prt_dp_is_lnk_up (dp))
-			{
-				dp->mail_out.len = 0;
-				dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_VID_STR;	// Video start
+		// The policy maker might be busy training the link, so we wait for the link event
+		prt_dp_clr_evt (dp, PRT_DP_EVT_LNK);
 
-				// Currently only DPTX supports MST
-				if (dp->id == PRT_DPTX_ID)
-				{
-					dp->mail_out.dat[dp->mail_out.len++] = stream;	// Stream
-				}
-				prt_dp_mail_send (dp);
+		if (!prt_dp_is_lnk_up (dp))
+			prt_dp_wait_evt (dp, PRT_DP_EVT_LNK, PRT_DP_LNK_TIMEOUT);
 
-				// Wait for response
-				sta = prt_dp_mail_resp (dp);
-			}
+		if (prt_dp_is_lnk_up (dp))
+		{
+			prt_dp_mail_new (dp);
+			dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_VID_STR;	// Video start
 
-			else
-				tries++;
+			// Currently only DPTX supports MST
+			if (dp->id == PRT_DPTX_ID)
+			{
+				dp->mail_out.dat[dp->mail_out.len++] = stream;	// Stream
+			}
 
-		} while ((sta == PRT_FALSE) && (tries < 10));
+			// Send mail and wait for response
+			sta = prt_dp_mail_trx (dp);
+		}
 	}
 
 	return sta;
@@ -505,7 +825,7 @@ uint8_t prt_dp_vid_stp (prt_dp_ds_struct *dp, uint8_t stream)
 {
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_VID_STP;	// Video stop
 	
 	// Currently only DPTX supports MST
@@ -514,10 +834,8 @@ uint8_t prt_dp_vid_stp (prt_dp_ds_struct *dp, uint8_t stream)
 		dp->mail_out.dat[dp->mail_out.len++] = stream;	// Stream
 	}
 
-	prt_dp_mail_send (dp);
-
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	return sta;
 }
@@ -548,179 +866,1278 @@ uint8_t prt_dp_is_lnk_up (prt_dp_ds_struct *dp)
 		return PRT_FALSE;
 }
 
-// Get active lanes
-uint8_t prt_dp_get_lnk_act_lanes (prt_dp_ds_struct *dp)
+// Get active lanes
+uint8_t prt_dp_get_lnk_act_lanes (prt_dp_ds_struct *dp)
+{
+	return dp->lnk.act_lanes;
+}
+
+// Get active rate
+uint8_t prt_dp_get_lnk_act_rate (prt_dp_ds_struct *dp)
+{
+	return dp->lnk.act_rate;
+}
+
+// Get maximum lanes
+uint8_t prt_dp_get_lnk_max_lanes (prt_dp_ds_struct *dp)
+{
+	return dp->lnk.max_lanes;
+}
+
+// Get maximum rate
+uint8_t prt_dp_get_lnk_max_rate (prt_dp_ds_struct *dp)
+{
+	return dp->lnk.max_rate;
+}
+
+// Get link down reason
+uint8_t prt_dp_get_lnk_reason (prt_dp_ds_struct *dp)
+{
+	return dp->lnk.reason;
+}
+
+// Set max lanes
+void prt_dp_set_lnk_max_lanes (prt_dp_ds_struct *dp, uint8_t lanes)
+{
+	dp->lnk.max_lanes = lanes;
+}
+
+// Set max rate
+void prt_dp_set_lnk_max_rate (prt_dp_ds_struct *dp, uint8_t rate)
+{
+	dp->lnk.max_rate = rate;
+}
+
+// Set MST capability
+void prt_dp_set_mst_cap (prt_dp_ds_struct *dp, uint8_t cap)
+{
+	dp->lnk.mst_cap = cap;
+}
+
+// Set platform link capability
+// The planner never exceeds these limits
+void prt_dptx_set_lnk_cap (prt_dp_ds_struct *dp, uint8_t rate, uint8_t lanes)
+{
+	dp->lnk.cap_rate = rate;
+	dp->lnk.cap_lanes = lanes;
+}
+
+// Set planner headroom
+void prt_dptx_set_lnk_headroom (prt_dp_ds_struct *dp, uint8_t headroom)
+{
+	dp->lnk.headroom = headroom;
+}
+
+// Link planner
+// Selects the smallest link configuration that carries the video stream(s) with the headroom.
+// Streams is zero for SST, or the number of identical MST streams.
+// The link is limited by the platform capability and the sink capability in the DPCD.
+// The selected configuration is sent to the policy maker, it applies at the next training.
+// This function returns PRT_FALSE when the mode doesn't fit.
+uint8_t prt_dptx_lnk_plan (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t streams)
+{
+	// Variables
+	static const uint8_t rates[] = {PRT_DP_PHY_LINERATE_1620, PRT_DP_PHY_LINERATE_2700, PRT_DP_PHY_LINERATE_5400, PRT_DP_PHY_LINERATE_8100};
+	uint8_t dpcd[2];
+	uint8_t max_rate;
+	uint8_t max_lanes;
+	uint32_t req;
+	uint32_t bw;
+	uint32_t cap;
+	uint32_t best_cap;
+	uint8_t best_rate;
+	uint8_t best_lanes;
+
+	// Sink capability
+	// DPCD 00001h max link rate, 00002h max lane count
+	if (prt_dptx_dpcd_rd_burst (dp, 0x00001, 2, dpcd) != PRT_TRUE)
+		return PRT_FALSE;
+
+	max_rate = dp->lnk.cap_rate;
+	if (dpcd[0] < max_rate)
+		max_rate = dpcd[0];
+
+	max_lanes = dp->lnk.cap_lanes;
+	if ((dpcd[1] & 0x1f) < max_lanes)
+		max_lanes = dpcd[1] & 0x1f;
+
+	// Stream bandwidth (kbps)
+	if (tp->bpc == 10)
+		bw = tp->pclk * 30;
+	else
+		bw = tp->pclk * 24;
+
+	// MST streams
+	if (streams > 1)
+		req = prt_dp_mul (bw, streams);
+	else
+		req = bw;
+
+	// Headroom
+	req += prt_dp_div (prt_dp_mul (req, dp->lnk.headroom), 100);
+
+	best_cap = 0;
+	best_rate = 0;
+	best_lanes = 0;
+
+	for (uint8_t r = 0; r < sizeof (rates); r++)
+	{
+		if (rates[r] > max_rate)
+			break;
+
+		for (uint8_t l = 1; l <= max_lanes; l <<= 1)
+		{
+			// Payload capacity (kbps)
+			// The symbol clock is the rate code times 27 MHz and a symbol carries 8 bits (8b/10b).
+			cap = rates[r] * 216000;
+			if (l == 2)
+				cap <<= 1;
+			else if (l == 4)
+				cap <<= 2;
+
+			// In MST the first time slot of every 64 slot MTP is the header
+			if (streams != 0)
+				cap -= cap >> 6;
+
+			// Smallest capacity that fits
+			// On a tie the lowest rate wins, as it trains more reliably
+			if ((cap >= req) && ((best_cap == 0) || (cap < best_cap)))
+			{
+				best_cap = cap;
+				best_rate = rates[r];
+				best_lanes = l;
+			}
+		}
+	}
+
+	// The mode doesn't fit
+	if (best_cap == 0)
+		return PRT_FALSE;
+
+	// Apply
+	prt_dp_set_lnk_max_rate (dp, best_rate);
+	prt_dp_set_lnk_max_lanes (dp, best_lanes);
+
+	return prt_dp_cfg_lnk (dp);
+}
+
+// MST payload bandwidth number
+// One PBN is 54/64 MBps, with a 0.6 % margin on the stream bandwidth.
+// PBN = stream bandwidth (kbps) * 1.006 / 6750
+uint16_t prt_dp_mst_pbn (prt_dp_tp_struct *tp)
+{
+	// Variables
+	uint32_t bw;
+
+	// Stream bandwidth (kbps)
+	if (tp->bpc == 10)
+		bw = tp->pclk * 30;
+	else
+		bw = tp->pclk * 24;
+
+	// Margin
+	bw += prt_dp_div ((bw * 6) + 999, 1000);
+
+	// Rounded up
+	return prt_dp_div (bw + 6749, 6750);
+}
+
+// MST time slot allocator
+// Computes the PBN and the time slots of every stream on the active link.
+// A time slot carries rate code * lanes / 2 PBN.
+// The MST logic packs the virtual channels in stream order and moves the time slots in groups of symbols per lane,
+// so the time slots are rounded up to the group and the last group holds the MTP header.
+// When not all streams fit, the set of streams that uses the most time slots is allocated.
+// The policy maker programs the time slots itself, so the allocation tells which streams fit.
+// This function returns PRT_TRUE when all streams are allocated.
+uint8_t prt_dptx_mst_alloc (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t streams)
+{
+	// Variables
+	uint32_t slot_pbn;
+	uint32_t slots;
+	uint16_t used;
+	uint8_t cnt;
+	uint8_t best_set;
+	uint16_t best_used;
+	uint8_t best_cnt;
+
+	if (streams > PRT_DP_MST_STREAMS)
+		streams = PRT_DP_MST_STREAMS;
+
+	dp->mst.streams = streams;
+	dp->mst.used = 0;
+	for (uint8_t i = 0; i < PRT_DP_MST_STREAMS; i++)
+	{
+		dp->mst.pbn[i] = 0;
+		dp->mst.ts[i] = 0;
+	}
+
+	// Double PBN per time slot
+	slot_pbn = dp->lnk.act_rate;
+	if (dp->lnk.act_lanes == 2)
+		slot_pbn <<= 1;
+	else if (dp->lnk.act_lanes == 4)
+		slot_pbn <<= 2;
+	else if (dp->lnk.act_lanes != 1)
+		slot_pbn = 0;
+
+	// The link is down
+	if (slot_pbn == 0)
+		return PRT_FALSE;
+
+	// Time slots
+	for (uint8_t i = 0; i < streams; i++)
+	{
+		dp->mst.pbn[i] = prt_dp_mst_pbn (&tp[i]);
+		slots = prt_dp_div ((dp->mst.pbn[i] << 1) + slot_pbn - 1, slot_pbn);
+
+		// A stream never has more time slots than the MTP
+		if (slots > PRT_DP_MST_MTP_SLOTS)
+			slots = PRT_DP_MST_MTP_SLOTS;
+
+		// Group
+		slots = (slots + dp->mst.spl - 1) & ~(dp->mst.spl - 1);
+		dp->mst.ts[i] = slots;
+	}
+
+	// Packing
+	// The most time slots win, on a tie the most streams.
+	best_set = 0;
+	best_used = 0;
+	best_cnt = 0;
+	for (uint8_t set = 1; set < (1 << streams); set++)
+	{
+		used = 0;
+		cnt = 0;
+		for (uint8_t i = 0; i < streams; i++)
+		{
+			if (set & (1 << i))
+			{
+				used += dp->mst.ts[i];
+				cnt++;
+			}
+		}
+
+		if ((used <= (PRT_DP_MST_MTP_SLOTS - dp->mst.spl)) && 
+			((used > best_used) || ((used == best_used) && (cnt > best_cnt))))
+		{
+			best_set = set;
+			best_used = used;
+			best_cnt = cnt;
+		}
+	}
+
+	// Drop the streams that are not allocated
+	for (uint8_t i = 0; i < streams; i++)
+	{
+		if (!(best_set & (1 << i)))
+			dp->mst.ts[i] = 0;
+	}
+	dp->mst.used = best_used;
+
+	if (best_cnt == streams)
+		return PRT_TRUE;
+	else
+		return PRT_FALSE;
+}
+
+// Get MST time slots
+uint8_t prt_dptx_get_mst_ts (prt_dp_ds_struct *dp, uint8_t stream)
+{
+	if (stream < PRT_DP_MST_STREAMS)
+		return dp->mst.ts[stream];
+	else
+		return 0;
+}
+
+// Get MST payload bandwidth number
+uint16_t prt_dptx_get_mst_pbn (prt_dp_ds_struct *dp, uint8_t stream)
+{
+	if (stream < PRT_DP_MST_STREAMS)
+		return dp->mst.pbn[stream];
+	else
+		return 0;
+}
+
+// Clear last known good cache
+void prt_dptx_lkg_clr (prt_dp_ds_struct *dp)
+{
+	for (uint8_t i = 0; i < PRT_DP_LKG_SIZE; i++)
+		dp->lkg.ent[i].key = 0;
+
+	dp->lkg.key = 0;
+	dp->lkg.nxt = 0;
+	dp->lkg.hint = PRT_FALSE;
+	dp->lkg.no_hint = PRT_FALSE;
+	dp->lkg.hit = 0;
+	dp->lkg.miss = 0;
+}
+
+// EDID hash
+// FNV-1a over the manufacturer, product code, serial number and date (bytes 8 - 17).
+// The multiplication by the FNV prime (2^24 + 403) is written as shifts and adds.
+uint32_t prt_dp_edid_hash (uint8_t *edid)
+{
+	// Variables
+	uint32_t hash = 2166136261;
+
+	for (uint8_t i = 8; i < 18; i++)
+	{
+		hash ^= edid[i];
+		hash += (hash << 1) + (hash << 4) + (hash << 7) + (hash << 8) + (hash << 24);
+	}
+
+	// Zero marks an empty entry
+	if (hash == 0)
+		hash = 1;
+
+	return hash;
+}
+
+// Last known good key
+// Reads the first EDID block of the sink and sets the cache key.
+// This function returns PRT_TRUE when the key was read.
+uint8_t prt_dptx_lkg_key (prt_dp_ds_struct *dp)
+{
+	dp->lkg.key = 0;
+
+	if (dp->tmr == 0)
+		return PRT_FALSE;
+
+	// Request the first block
+	dp->edid.adr = 0;
+	prt_dp_clr_evt (dp, PRT_DP_EVT_EDID);
+	prt_dp_mail_new (dp);
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_EDID_RD;	// Token
+	dp->mail_out.dat[dp->mail_out.len++] = 0;					// Base address
+
+	if (prt_dp_mail_trx (dp) != PRT_TRUE)
+		return PRT_FALSE;
+
+	// The data follows the response in a separate mail
+	if (!prt_dp_wait_evt (dp, PRT_DP_EVT_EDID, PRT_DP_EDID_TIMEOUT))
+		return PRT_FALSE;
+
+	dp->lkg.key = prt_dp_edid_hash (dp->edid.dat);
+
+	return PRT_TRUE;
+}
+
+// Last known good find
+// Returns the entry of the key, or zero when the key is not cached.
+prt_dp_lkg_ent_struct *prt_dp_lkg_find (prt_dp_ds_struct *dp, uint32_t key)
+{
+	for (uint8_t i = 0; i < PRT_DP_LKG_SIZE; i++)
+	{
+		if ((key != 0) && (dp->lkg.ent[i].key == key))
+			return &dp->lkg.ent[i];
+	}
+
+	return 0;
+}
+
+// Last known good hint
+// Offers the cached settings of the connected sink to the policy maker as the training start point.
+// A failed training drops the entry, so that the next training is a full training.
+// The hint is only sent when built with PRT_DP_LKG_HINT, as the policy maker must support the training hint.
+// This function returns PRT_TRUE when the hint was accepted.
+uint8_t prt_dptx_lkg_hint (prt_dp_ds_struct *dp)
+{
+	// Variables
+	prt_dp_lkg_ent_struct *ent;
+
+	dp->lkg.hint = PRT_FALSE;
+
+	ent = prt_dp_lkg_find (dp, dp->lkg.key);
+
+	if (ent == 0)
+	{
+		dp->lkg.miss++;
+		return PRT_FALSE;
+	}
+
+	dp->lkg.hit++;
+
+	// The policy maker rejected the hint before
+	if (dp->lkg.no_hint)
+		return PRT_FALSE;
+
+	// The entry exceeds the current link limits
+	if ((ent->rate > dp->lnk.max_rate) || (ent->lanes > dp->lnk.max_lanes))
+		return PRT_FALSE;
+
+	#ifdef PRT_DP_LKG_HINT
+	prt_dp_mail_new (dp);
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_CFG;			// Config
+	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_CFG_TRN_HINT;		// Training hint
+	dp->mail_out.dat[dp->mail_out.len++] = ent->rate;				// Rate
+	dp->mail_out.dat[dp->mail_out.len++] = ent->lanes;				// Lanes
+	dp->mail_out.dat[dp->mail_out.len++] = ent->volt;				// Voltage swing
+	dp->mail_out.dat[dp->mail_out.len++] = ent->pre;				// Pre-emphasis
+
+	// Send mail and wait for response
+	if (prt_dp_mail_trx (dp) != PRT_TRUE)
+	{
+		dp->lkg.no_hint = PRT_TRUE;
+		return PRT_FALSE;
+	}
+
+	// The link settings start at the cached values
+	dp->lnk.phy_rate = ent->rate;
+	dp->lnk.phy_volt = ent->volt;
+	dp->lnk.phy_pre = ent->pre;
+
+	dp->lkg.hint = PRT_TRUE;
+	return PRT_TRUE;
+	#else
+	return PRT_FALSE;
+	#endif
+}
+
+// Last known good put
+// Called from the mail decoder when the link is up.
+// Stores the final settings of the connected sink.
+void prt_dp_lkg_put (prt_dp_ds_struct *dp)
+{
+	// Variables
+	prt_dp_lkg_ent_struct *ent;
+
+	if (dp->lkg.key == 0)
+		return;
+
+	ent = prt_dp_lkg_find (dp, dp->lkg.key);
+
+	// Replace the oldest entry
+	if (ent == 0)
+	{
+		ent = &dp->lkg.ent[dp->lkg.nxt];
+		dp->lkg.nxt = (dp->lkg.nxt + 1) & (PRT_DP_LKG_SIZE - 1);
+	}
+
+	ent->key = dp->lkg.key;
+	ent->rate = dp->lnk.act_rate;
+	ent->lanes = dp->lnk.act_lanes;
+	ent->volt = dp->lnk.phy_volt;
+	ent->pre = dp->lnk.phy_pre;
+
+	dp->lkg.hint = PRT_FALSE;
+}
+
+// Check video
+// This function returns PRT_TRUE when the video is up and running
+uint8_t prt_dp_is_vid_up (prt_dp_ds_struct *dp, uint8_t stream)
+{
+	if (dp->vid[stream].up)
+		return PRT_TRUE;
+	else
+		return PRT_FALSE;
+}
+
+// Get video down reason
+uint8_t prt_dp_get_vid_reason (prt_dp_ds_struct *dp, uint8_t stream)
+{
+	return dp->vid[stream].reason;
+}
+
+// Training pass
+// This function returns PRT_TRUE when the training passed
+uint8_t prt_dp_is_trn_pass (prt_dp_ds_struct *dp)
+{
+	if (dp->trn.pass)
+		return PRT_TRUE;
+	else
+		return PRT_FALSE;
+}
+
+// Get training pattern
+// This function returns the current training pattern
+uint8_t prt_dprx_get_trn_tps (prt_dp_ds_struct *dp)
+{
+	return dp->trn.tps;
+}
+
+// Send message
+void prt_dp_mail_send (prt_dp_ds_struct *dp)
+{
+	// Variables
+	uint32_t ctl;
+
+	// Trace
+	if (dp->trc)
+	{
+		// Mask the interrupt, 
+		// so that the mail in trace can't interleave with this entry 
+		ctl = dp->dev->ctl;
+		dp->dev->ctl = ctl & ~PRT_DP_CTL_IE;
+
+		prt_dp_trc_str (dp, PRT_DP_TRC_DIR_OUT, dp->mail_out.len);
+		for (uint32_t i = 0; i < dp->mail_out.len; i++)
+			prt_dp_trc_wr (dp, dp->mail_out.dat[i]);
+
+		// Restore interrupt
+		dp->dev->ctl = ctl;
+	}
+
+	// Start of mail token
+	dp->dev->mail_out = PRT_DP_MAIL_SOM;
+
+	for (uint32_t i = 0; i < dp->mail_out.len; i++)
+		dp->dev->mail_out = dp->mail_out.dat[i];
+
+	// End of mail token
+	dp->dev->mail_out = PRT_DP_MAIL_EOM;
+}
+
+// Check mail
+// Called from interrupt handler
+uint8_t prt_dp_mail_chk (prt_dp_ds_struct *dp)
+{
+	// Variables
+	uint32_t dat;
+
+	// Read status register
+	dat = dp->dev->sta;
+
+	// Extract mail word words
+	dat >>= PRT_DP_STA_MAIL_IN_WRDS_SHIFT;
+	dat &= 0x1f;
+
+	return dat;
+}
+
+// Get message
+// Called from interrupt handler
+// Drains the mailbox words into the mail ring.
+// Only complete messages are published to the consumer.
+void prt_dp_mail_get (prt_dp_ds_struct *dp, uint8_t len)
+{
+	// Variables
+	uint32_t dat;
+	uint8_t wr;
+	uint8_t nxt;
+	uint8_t used;
+
+	// Write pointer
+	wr = dp->mail_ring.wr;
+
+	for (uint8_t idx = 0; idx < len; idx++)
+	{
+		// Get data
+		dat = dp->dev->mail_in & 0x1ff;
+
+		// Start of message
+		// A partial message is discarded
+		if (dat == PRT_DP_MAIL_SOM)
+		{
+			wr = dp->mail_ring.head;
+			dp->mail_ring.drop = PRT_FALSE;
+		}
+
+		// Skip the rest of a dropped message
+		else if (dp->mail_ring.drop == PRT_FALSE)
+		{
+			nxt = (wr + 1) & (PRT_DP_MAIL_RING_SIZE - 1);
+
+			// Ring full
+			if (nxt == dp->mail_ring.tail)
+			{
+				dp->mail_ring.drop = PRT_TRUE;
+				dp->mail_ring.ovf++;
+				wr = dp->mail_ring.head;
+			}
+
+			else
+			{
+				// Copy data
+				dp->mail_ring.dat[wr] = dat;
+				wr = nxt;
+
+				// End of message
+				if (dat == PRT_DP_MAIL_EOM)
+				{
+					// Trace
+					// The payload is between the head and the end of mail token
+					if (dp->trc)
+					{
+						used = ((wr - dp->mail_ring.head) & (PRT_DP_MAIL_RING_SIZE - 1)) - 1;
+						prt_dp_trc_str (dp, PRT_DP_TRC_DIR_IN, used);
+						for (uint8_t i = 0; i < used; i++)
+							prt_dp_trc_wr (dp, dp->mail_ring.dat[(dp->mail_ring.head + i) & (PRT_DP_MAIL_RING_SIZE - 1)]);
+					}
+
+					// Publish message
+					dp->mail_ring.head = wr;
+
+					// High watermark
+					used = (wr - dp->mail_ring.tail) & (PRT_DP_MAIL_RING_SIZE - 1);
+					if (used > dp->mail_ring.hwm)
+						dp->mail_ring.hwm = used;
+				}
+			}
+		}
+	}
+
+	// Store write pointer
+	dp->mail_ring.wr = wr;
+}
+
+// Read message
+// Copies the next message from the mail ring into the mail in buffer.
+// This function returns PRT_TRUE when a message was read.
+uint8_t prt_dp_mail_rd (prt_dp_ds_struct *dp)
+{
+	// Variables
+	uint16_t dat;
+	uint8_t tail;
+
+	tail = dp->mail_ring.tail;
+
+	// Empty
+	if (tail == dp->mail_ring.head)
+		return PRT_FALSE;
+
+	dp->mail_in.len = 0;
+
+	do
+	{
+		// Get data
+		dat = dp->mail_ring.dat[tail];
+		tail = (tail + 1) & (PRT_DP_MAIL_RING_SIZE - 1);
+
+		// Copy data
+		if ((dat != PRT_DP_MAIL_EOM) && (dp->mail_in.len < sizeof (dp->mail_in.dat)))
+			dp->mail_in.dat[dp->mail_in.len++] = dat;
+
+	} while (dat != PRT_DP_MAIL_EOM);
+
+	// Release message
+	dp->mail_ring.tail = tail;
+
+	return PRT_TRUE;
+}
+
+// Mail ready
+// Prepares the mail out buffer for a request.
+// The completion of the previous transaction is delivered first, as its callback might send mail.
+// This function returns PRT_FALSE when a transaction is in flight or a transaction wait is running.
+uint8_t prt_dp_mail_rdy (prt_dp_ds_struct *dp)
+{
+	if ((dp->trx.sta == PRT_DP_TRX_BUSY) || dp->trx.wait)
+		return PRT_FALSE;
+
+	// Deliver the completion of the previous transaction
+	prt_dp_trx_cb_exec (dp);
+
+	// The callback might have started a transaction
+	if (dp->trx.sta == PRT_DP_TRX_BUSY)
+		return PRT_FALSE;
+
+	dp->mail_out.len = 0;
+	return PRT_TRUE;
+}
+
+// New mail
+// Waits for the transaction in flight and prepares the mail out buffer.
+// The mail is built after the wait, so nothing that runs during the wait can overwrite it.
+// During a transaction wait the mail is refused by prt_dp_trx_submit, so there is no wait.
+void prt_dp_mail_new (prt_dp_ds_struct *dp)
+{
+	if (!dp->trx.wait)
+	{
+		while (!prt_dp_mail_rdy (dp))
+			prt_dp_trx_wait (dp, dp->trx.hndl);
+	}
+
+	dp->mail_out.len = 0;
+}
+
+// Mail transaction
+// Sends the mail built after prt_dp_mail_new and waits for the response
+uint8_t prt_dp_mail_trx (prt_dp_ds_struct *dp)
+{
+	// Variables
+	prt_dp_trx_hndl hndl;
+
+	// Send mail
+	hndl = prt_dp_trx_submit (dp, PRT_DP_TRX_DEF_TIMEOUT, 0);
+
+	// Wait for response
+	return prt_dp_mail_resp (dp, hndl);
+}
+
+// Mail response
+// This function returns PRT_TRUE when the policy maker replied ok
+uint8_t prt_dp_mail_resp (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl)
+{
+	if (prt_dp_trx_wait (dp, hndl) == PRT_DP_TRX_OK)
+		return PRT_TRUE;
+	else
+		return PRT_FALSE;
+}
+
+// Transaction submit
+// Sends the mail in the mail out buffer and returns the transaction handle.
+// The completion callback is optional and is called from the interrupt handler,
+// or from prt_dp_trx_poll when the transaction times out.
+// This function returns zero when another transaction is still in flight or when there is no timer.
+// During a transaction wait no transaction is taken, as the new handle would end the wait.
+prt_dp_trx_hndl prt_dp_trx_submit (prt_dp_ds_struct *dp, uint32_t timeout, prt_dp_trx_cb cb)
+{
+	// Only one transaction can be in flight
+	if ((dp->trx.sta == PRT_DP_TRX_BUSY) || dp->trx.wait)
+		return 0;
+
+	// The time out needs the timer.
+	// Without timer a lost response would block prt_dp_trx_wait forever.
+	if (dp->tmr == 0)
+		return 0;
+
+	// Next handle
+	dp->trx.hndl++;
+
+	// Zero is not a valid handle
+	if (dp->trx.hndl == 0)
+		dp->trx.hndl = 1;
+
+	dp->trx.cb = cb;
+	dp->trx.len = 0;
+
+	// Deadline
+	dp->trx.dl = prt_tmr_get_ts (dp->tmr) + timeout;
+
+	// The response can arrive before the mail has been sent completely,
+	// so the transaction must be armed first.
+	dp->trx.sta = PRT_DP_TRX_BUSY;
+
+	// Send mail
+	prt_dp_mail_send (dp);
+
+	return dp->trx.hndl;
+}
+
+// Transaction status
+// A handle of an older transaction returns idle, as its result is no longer available.
+prt_dp_trx_sta_type prt_dp_trx_get_sta (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl)
+{
+	if ((hndl == 0) || (hndl != dp->trx.hndl))
+		return PRT_DP_TRX_IDLE;
+
+	// Check deadline
+	prt_dp_trx_poll (dp);
+
+	return dp->trx.sta;
+}
+
+// Transaction wait
+// This function is blocking.
+// The messages are decoded while waiting, but the callbacks of this instance are held
+// until the next prt_dp_dispatch outside the wait. So a callback can't start a transaction in the middle of this one.
+// The idle callback runs while waiting, so the other DP instance keeps handling its events.
+prt_dp_trx_sta_type prt_dp_trx_wait (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl)
+{
+	// Variables
+	prt_dp_trx_sta_type sta;
+	uint8_t wait;
+
+	wait = dp->trx.wait;
+	dp->trx.wait = PRT_TRUE;
+
+	do
+	{
+		sta = prt_dp_trx_get_sta (dp, hndl);
+
+		// Decode the response
+		#ifndef PRT_DP_CB_DIRECT
+			prt_dp_mail_proc (dp);
+		#endif
+
+		// Other work
+		if ((sta == PRT_DP_TRX_BUSY) && (dp->cb.idle != 0))
+			dp->cb.idle (dp);
+	} while (sta == PRT_DP_TRX_BUSY);
+
+	dp->trx.wait = wait;
+
+	return sta;
+}
+
+// Transaction poll
+// Must be called from the main loop to time out a transaction.
+void prt_dp_trx_poll (prt_dp_ds_struct *dp)
+{
+	// Variables
+	uint32_t ctl;
+
+	if ((dp->trx.sta == PRT_DP_TRX_BUSY) && (dp->tmr != 0))
+	{
+		if (prt_tmr_is_exp (dp->tmr, dp->trx.dl))
+		{
+			// Mask the interrupt, 
+			// so that a late response can't complete the transaction at the same time
+			ctl = dp->dev->ctl;
+			dp->dev->ctl = ctl & ~PRT_DP_CTL_IE;
+
+			prt_dp_trx_done (dp, PRT_DP_TRX_TIMEOUT);
+
+			// Restore interrupt
+			dp->dev->ctl = ctl;
+		}
+	}
+}
+
+// Transaction busy
+// This function returns PRT_TRUE when a transaction is in flight
+uint8_t prt_dp_is_trx_busy (prt_dp_ds_struct *dp)
+{
+	if (dp->trx.sta == PRT_DP_TRX_BUSY)
+		return PRT_TRUE;
+	else
+		return PRT_FALSE;
+}
+
+// Transaction done
+// Called from the mail decoder
+void prt_dp_trx_done (prt_dp_ds_struct *dp, prt_dp_trx_sta_type sta)
+{
+	// A response without a transaction in flight is dropped.
+	// This happens when the response arrives after the time out.
+	if (dp->trx.sta != PRT_DP_TRX_BUSY)
+		return;
+
+	// Copy response data
+	if (sta != PRT_DP_TRX_TIMEOUT)
+	{
+		for (uint8_t i = 0; i < dp->mail_in.len; i++)
+			dp->trx.dat[i] = dp->mail_in.dat[i];
+		dp->trx.len = dp->mail_in.len;
+	}
+
+	// Set status
+	dp->trx.sta = sta;
+
+	// Callback
+	// When the callbacks are deferred, prt_dp_dispatch runs the callback
+	#ifdef PRT_DP_CB_DIRECT
+		prt_dp_trx_cb_exec (dp);
+	#endif
+}
+
+// Transaction callback
+// Runs the completion callback of a finished transaction once
+void prt_dp_trx_cb_exec (prt_dp_ds_struct *dp)
+{
+	// Variables
+	prt_dp_trx_cb cb;
+
+	if ((dp->trx.cb != 0) && (dp->trx.sta != PRT_DP_TRX_BUSY))
+	{
+		cb = dp->trx.cb;
+		dp->trx.cb = 0;
+		cb (dp, dp->trx.hndl, dp->trx.sta);
+	}
+}
+
+// Process mail
+// Decodes the received messages without running the callbacks
+void prt_dp_mail_proc (prt_dp_ds_struct *dp)
 {
-	return dp->lnk.act_lanes;
+	while (prt_dp_mail_rd (dp))
+		prt_dp_mail_dec (dp);
 }
 
-// Get active rate
-uint8_t prt_dp_get_lnk_act_rate (prt_dp_ds_struct *dp)
+// Dispatch
+// Decodes the received messages and runs the callbacks.
+// Must be called from the main loop.
+// During a transaction wait or a callback of this instance the messages are only decoded,
+// the callbacks run at the next dispatch.
+void prt_dp_dispatch (prt_dp_ds_struct *dp)
 {
-	return dp->lnk.act_rate;
+	// When the callbacks are direct, the interrupt handler decodes the messages
+	#ifndef PRT_DP_CB_DIRECT
+		if (dp->trx.wait || dp->cb_busy)
+		{
+			prt_dp_mail_proc (dp);
+			return;
+		}
+
+		dp->cb_busy = PRT_TRUE;
+
+		// Events decoded during a wait
+		prt_dp_cb_exec (dp);
+
+		// Decode messages
+		while (prt_dp_mail_rd (dp))
+		{
+			prt_dp_mail_dec (dp);
+			prt_dp_cb_exec (dp);
+		}
+
+		// Transaction callback
+		prt_dp_trx_cb_exec (dp);
+
+		dp->cb_busy = PRT_FALSE;
+	#endif
 }
 
-// Get link down reason
-uint8_t prt_dp_get_lnk_reason (prt_dp_ds_struct *dp)
+// Poll
+// Times out the transaction in flight and runs the queued callbacks.
+// Must be called from the main loop.
+void prt_dp_poll (prt_dp_ds_struct *dp)
 {
-	return dp->lnk.reason;
+	prt_dp_trx_poll (dp);
+	prt_dp_dispatch (dp);
 }
 
-// Set max lanes
-void prt_dp_set_lnk_max_lanes (prt_dp_ds_struct *dp, uint8_t lanes)
+// Clear latched events
+// Call this before the request that triggers the event,
+// else an older event ends the wait.
+void prt_dp_clr_evt (prt_dp_ds_struct *dp, uint32_t evt)
 {
-	dp->lnk.max_lanes = lanes;
+	// Variables
+	uint32_t ctl;
+
+	// Mask the interrupt, the mail decoder might run in the interrupt handler
+	ctl = dp->dev->ctl;
+	dp->dev->ctl = ctl & ~PRT_DP_CTL_IE;
+
+	dp->evt_lat &= ~evt;
+
+	// Restore interrupt
+	dp->dev->ctl = ctl;
 }
 
-// Set max rate
-void prt_dp_set_lnk_max_rate (prt_dp_ds_struct *dp, uint8_t rate)
+// Wait for event
+// Polls until one of the events is latched by the mail decoder or the time out (us) expires.
+// The latch is independent of the callbacks, so an event that is handled by a callback still ends the wait.
+// The idle callback runs while waiting, so the application can do other work.
+// This function returns PRT_TRUE when an event occurred. The event is cleared.
+uint8_t prt_dp_wait_evt (prt_dp_ds_struct *dp, uint32_t evt, uint32_t timeout)
 {
-	dp->lnk.max_rate = rate;
+	// Variables
+	uint32_t dl = 0;
+
+	// Without timer there is no wait
+	if (dp->tmr != 0)
+		dl = prt_tmr_get_ts (dp->tmr) + timeout;
+
+	while (1)
+	{
+		prt_dp_poll (dp);
+
+		// Event
+		if (dp->evt_lat & evt)
+		{
+			prt_dp_clr_evt (dp, evt);
+			return PRT_TRUE;
+		}
+
+		// Time out
+		if ((dp->tmr == 0) || prt_tmr_is_exp (dp->tmr, dl))
+			return PRT_FALSE;
+
+		// Other work
+		if (dp->cb.idle != 0)
+			dp->cb.idle (dp);
+	}
 }
 
-// Set MST capability
-void prt_dp_set_mst_cap (prt_dp_ds_struct *dp, uint8_t cap)
+// Get mail ring overflow count
+uint32_t prt_dp_get_mail_ovf (prt_dp_ds_struct *dp)
 {
-	dp->lnk.mst_cap = cap;
+	return dp->mail_ring.ovf;
 }
 
-// Check video
-// This function returns PRT_TRUE when the video is up and running
-uint8_t prt_dp_is_vid_up (prt_dp_ds_struct *dp, uint8_t stream)
+// Get mail ring high watermark
+uint8_t prt_dp_get_mail_hwm (prt_dp_ds_struct *dp)
 {
-	if (dp->vid[stream].up)
-		return PRT_TRUE;
-	else
-		return PRT_FALSE;
+	return dp->mail_ring.hwm;
 }
 
-// Get video down reason
-uint8_t prt_dp_get_vid_reason (prt_dp_ds_struct *dp, uint8_t stream)
+// Get statistics
+// Copies a snapshot of the statistics. 
+// The time in the current state is included.
+void prt_dp_get_stat (prt_dp_ds_struct *dp, prt_dp_stat_struct *stat)
 {
-	return dp->vid[stream].reason;
+	// Variables
+	uint32_t ctl;
+	uint8_t *src;
+	uint8_t *dst;
+
+	// Mask the interrupt,
+	// so that the mail decoder can't update the statistics during the copy
+	ctl = dp->dev->ctl;
+	dp->dev->ctl = ctl & ~PRT_DP_CTL_IE;
+
+	// Close the current state interval
+	prt_dp_stat_set_state (dp, dp->stat.state);
+
+	// Copy
+	// There is no memcpy, so the structure is copied byte wise
+	src = (uint8_t *) &dp->stat;
+	dst = (uint8_t *) stat;
+	for (uint16_t i = 0; i < sizeof (prt_dp_stat_struct); i++)
+		*dst++ = *src++;
+
+	// Restore interrupt
+	dp->dev->ctl = ctl;
 }
 
-// Training pass
-// This function returns PRT_TRUE when the training passed
-uint8_t prt_dp_is_trn_pass (prt_dp_ds_struct *dp)
+// Clear statistics
+void prt_dp_clr_stat (prt_dp_ds_struct *dp)
 {
-	if (dp->trn.pass)
-		return PRT_TRUE;
-	else
-		return PRT_FALSE;
+	// Variables
+	uint32_t ctl;
+
+	// Mask the interrupt
+	ctl = dp->dev->ctl;
+	dp->dev->ctl = ctl & ~PRT_DP_CTL_IE;
+
+	prt_dp_stat_rst (dp);
+
+	// Restore interrupt
+	dp->dev->ctl = ctl;
 }
 
-// Get training pattern
-// This function returns the current training pattern
-uint8_t prt_dprx_get_trn_tps (prt_dp_ds_struct *dp)
+// Statistics reset
+// The current state is kept
+void prt_dp_stat_rst (prt_dp_ds_struct *dp)
 {
-	return dp->trn.tps;
+	// Variables
+	uint8_t state;
+	uint8_t *p;
+
+	// Keep state
+	if (dp->lnk.up)
+	{
+		state = PRT_DP_STAT_STATE_LNK;
+
+		// Any stream with video
+		for (uint8_t i = 0; i < PRT_DP_MST_STREAMS; i++)
+		{
+			if (dp->vid[i].up)
+				state = PRT_DP_STAT_STATE_VID;
+		}
+	}
+
+	else
+		state = PRT_DP_STAT_STATE_DOWN;
+
+	// Clear 
+	p = (uint8_t *) &dp->stat;
+	for (uint16_t i = 0; i < sizeof (prt_dp_stat_struct); i++)
+		*p++ = 0;
+
+	dp->stat.state = state;
+
+	if (dp->tmr)
+	{
+		dp->stat.state_ts = prt_tmr_get_ts (dp->tmr);
+		dp->stat.lnk_ts = dp->stat.state_ts;
+	}
 }
 
-// Send message
-void prt_dp_mail_send (prt_dp_ds_struct *dp)
+// Statistics set state
+// Adds the time since the last state change to the current state.
+void prt_dp_stat_set_state (prt_dp_ds_struct *dp, uint8_t state)
 {
-	// Start of mail token
-	dp->dev->mail_out = PRT_DP_MAIL_SOM;
+	// Variables
+	uint32_t ts;
+	uint32_t us;
+	uint8_t cur;
 
-	for (uint32_t i = 0; i < dp->mail_out.len; i++)
-		dp->dev->mail_out = dp->mail_out.dat[i];
+	if (!dp->tmr)
+		return;
 
-	// End of mail token
-	dp->dev->mail_out = PRT_DP_MAIL_EOM;
+	ts = prt_tmr_get_ts (dp->tmr);
+	cur = dp->stat.state;
+
+	// Add the elapsed time
+	us = dp->stat.tis_us[cur] + (ts - dp->stat.state_ts);
+
+	// Carry into seconds
+	while (us >= 1000000)
+	{
+		us -= 1000000;
+		dp->stat.tis_s[cur]++;
+	}
+
+	dp->stat.tis_us[cur] = us;
+
+	// New state
+	dp->stat.state = state;
+	dp->stat.state_ts = ts;
 }
 
-// Check mail
-// Called from interrupt handler
-uint8_t prt_dp_mail_chk (prt_dp_ds_struct *dp)
+// Statistics training
+void prt_dp_stat_trn (prt_dp_ds_struct *dp, uint8_t pass, uint8_t rate, uint8_t lanes)
 {
 	// Variables
-	uint32_t dat;
+	uint8_t r;
+	uint8_t l;
 
-	// Read status register
-	dat = dp->dev->sta;
+	// Rate index
+	switch (rate)
+	{
+		case PRT_DP_PHY_LINERATE_1620 : r = 0; break;
+		case PRT_DP_PHY_LINERATE_2700 : r = 1; break;
+		case PRT_DP_PHY_LINERATE_5400 : r = 2; break;
+		case PRT_DP_PHY_LINERATE_8100 : r = 3; break;
+		default : return;
+	}
 
-	// Extract mail word words
-	dat >>= PRT_DP_STA_MAIL_IN_WRDS_SHIFT;
-	dat &= 0x1f;
+	// Lanes index
+	switch (lanes)
+	{
+		case 1 : l = 0; break;
+		case 2 : l = 1; break;
+		case 4 : l = 2; break;
+		default : return;
+	}
 
-	return dat;
+	if (pass)
+		dp->stat.trn_pass[r][l]++;
+	else
+		dp->stat.trn_fail[r][l]++;
 }
 
-// Get message
-// Called from interrupt handler
-void prt_dp_mail_get (prt_dp_ds_struct *dp, uint8_t len)
+// Statistics link up
+void prt_dp_stat_lnk_up (prt_dp_ds_struct *dp)
 {
 	// Variables
-	uint32_t dat;
+	uint32_t dif;
 	uint8_t idx;
 
-	// Clear index
-	idx = 0;
+	// Count
+	dp->stat.lnk_up++;
 
-	do
+	// Time to link up histogram
+	if (dp->tmr)
 	{
-		// Get data
-		dat = dp->dev->mail_in;
+		dif = prt_tmr_get_ts (dp->tmr) - dp->stat.lnk_ts;
+
+		if (dif < 10000)
+			idx = 0;
+		else if (dif < 50000)
+			idx = 1;
+		else if (dif < 100000)
+			idx = 2;
+		else if (dif < 500000)
+			idx = 3;
+		else if (dif < 1000000)
+			idx = 4;
+		else
+			idx = 5;
 
-		// Start of message
-		if ((dat & 0x1ff) == PRT_DP_MAIL_SOM)
-		{
-			dp->mail_in.len = 0;
-		}
+		dp->stat.lnk_hist[idx]++;
+	}
 
-		// End of message
-		else if ((dat & 0x1ff) == PRT_DP_MAIL_EOM)
-		{
-			// Set process mail flag
-			dp->mail_in.proc = PRT_TRUE;
-		}
+	// State
+	prt_dp_stat_set_state (dp, PRT_DP_STAT_STATE_LNK);
+}
 
-		else
-		{
-			// Copy data
-			dp->mail_in.dat[dp->mail_in.len++] = dat;
+// Set trace
+// A null pointer disables the trace
+void prt_dp_set_trc (prt_dp_ds_struct *dp, prt_dp_trc_struct *trc)
+{
+	// Clear trace
+	if (trc)
+	{
+		trc->head = 0;
+		trc->tail = 0;
+		trc->ovf = 0;
+	}
 
-			// Clear process mail flag
-			dp->mail_in.proc = PRT_FALSE;
-		}
+	dp->trc = trc;
+}
 
-		// Increment index
-		idx++;
+// Trace start entry
+// Writes the entry header.
+// The oldest entries are dropped until the entry fits.
+void prt_dp_trc_str (prt_dp_ds_struct *dp, uint8_t dir, uint8_t len)
+{
+	// Variables
+	prt_dp_trc_struct *trc = dp->trc;
+	uint32_t ts;
+	uint16_t used;
+
+	// Make room
+	while (1)
+	{
+		used = (trc->head - trc->tail) & (PRT_DP_TRC_SIZE - 1);
+
+		if ((PRT_DP_TRC_SIZE - 1 - used) >= (PRT_DP_TRC_HDR_LEN + len))
+			break;
+
+		trc->tail = (trc->tail + PRT_DP_TRC_HDR_LEN + trc->dat[trc->tail]) & (PRT_DP_TRC_SIZE - 1);
+		trc->ovf++;
+	}
 
-	} while ((idx < len) && (dp->mail_in.proc == PRT_FALSE));
+	// Timestamp
+	if (dp->tmr)
+		ts = prt_tmr_get_ts (dp->tmr);
+	else
+		ts = 0;
+
+	// Header
+	prt_dp_trc_wr (dp, len);
+	prt_dp_trc_wr (dp, dir);
+	prt_dp_trc_wr (dp, ts);
+	prt_dp_trc_wr (dp, ts >> 8);
+	prt_dp_trc_wr (dp, ts >> 16);
+	prt_dp_trc_wr (dp, ts >> 24);
 }
 
-// Mail response
-// To do: add time out
-uint8_t prt_dp_mail_resp (prt_dp_ds_struct *dp)
+// Trace write
+void prt_dp_trc_wr (prt_dp_ds_struct *dp, uint8_t dat)
+{
+	dp->trc->dat[dp->trc->head] = dat;
+	dp->trc->head = (dp->trc->head + 1) & (PRT_DP_TRC_SIZE - 1);
+}
+
+// Trace dump
+// Every entry is printed as one line: 
+// trc <id> <dir> <timestamp> <payload>
+// The values are in hex. The lines are decoded by the host tool dec_trc.pl.
+void prt_dp_trc_dump (prt_dp_ds_struct *dp)
 {
 	// Variables
-	uint8_t sta;
-	uint8_t exit_loop = PRT_FALSE;
+	prt_dp_trc_struct *trc = dp->trc;
+	uint16_t tail;
+	uint8_t len;
+	uint32_t ts;
 
-	// Clear flags
-	dp->mail_in.ok = PRT_FALSE;
-	dp->mail_in.err = PRT_FALSE;
+	if (!trc)
+		return;
 
-	do
+	// Pause the trace, 
+	// so that the interrupt handler can't overwrite the entries while they are printed
+	dp->trc = 0;
+
+	tail = trc->tail;
+
+	while (tail != trc->head)
 	{
-		if (dp->mail_in.ok)
-		{
-			// Set status
-			sta = PRT_TRUE;
-			exit_loop = PRT_TRUE;
-		}
+		// Header
+		len = trc->dat[tail];
+		prt_printf ("trc %x %x ", dp->id, trc->dat[(tail + 1) & (PRT_DP_TRC_SIZE - 1)]);
 
-		else if (dp->mail_in.err)
-		{
-			// Set status
-			sta = PRT_FALSE;
-			exit_loop = PRT_TRUE;
-		}
-	} while (!exit_loop);
+		ts = 0;
+		for (uint8_t i = 0; i < 4; i++)
+			ts |= trc->dat[(tail + 2 + i) & (PRT_DP_TRC_SIZE - 1)] << (i * 8);
+		prt_printf ("%x", ts);
 
-	return sta;
+		// Payload
+		for (uint8_t i = 0; i < len; i++)
+			prt_printf (" %x", trc->dat[(tail + PRT_DP_TRC_HDR_LEN + i) & (PRT_DP_TRC_SIZE - 1)]);
+		prt_printf ("\n");
+
+		tail = (tail + PRT_DP_TRC_HDR_LEN + len) & (PRT_DP_TRC_SIZE - 1);
+	}
+
+	prt_printf ("trc %x ovf %x\n", dp->id, trc->ovf);
+
+	// Resume trace
+	dp->trc = trc;
 }
 
 #ifdef PRT_SIM
@@ -908,33 +2325,42 @@ void prt_dp_decode_aux (prt_dp_ds_struct *dp)
 #endif
 
 // Decode mail
-// Called from interrupt handler
+// Called from prt_dp_dispatch, or from the interrupt handler when the callbacks are direct
 void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 {
 	// Variables
 	uint32_t dat;
 	uint8_t stream;
+	uint8_t state;
+	uint32_t evt;
+	prt_dp_lkg_ent_struct *lkg;
 
-	// Clear mail flags
-	dp->mail_in.proc = PRT_FALSE;
+	// Clear events
+	evt = 0;
 
 	switch (dp->mail_in.dat[0])
 	{
 		case PRT_DP_MAIL_ERR:
-			// Set error flag
-			dp->mail_in.err = PRT_TRUE;
+			// Complete transaction
+			prt_dp_trx_done (dp, PRT_DP_TRX_ERR);
 			break;
 
 		case PRT_DP_MAIL_OK:
-			// Set ok flag
-			dp->mail_in.ok = PRT_TRUE;
+			// Complete transaction
+			prt_dp_trx_done (dp, PRT_DP_TRX_OK);
+			break;
+
+		case PRT_DP_MAIL_DPCD_NACK:
+		case PRT_DP_MAIL_DPCD_DEFER:
+			// Complete transaction
+			prt_dp_trx_done (dp, PRT_DP_TRX_NACK);
 			break;
 
 		case PRT_DP_MAIL_DEBUG:
 			prt_dp_debug_put (dp, dp->mail_in.dat[1]);
 			
 			// Set event
-			dp->evt |= PRT_DP_EVT_DEBUG;
+			evt |= PRT_DP_EVT_DEBUG;
 			break;
 
 		case PRT_DP_MAIL_STA:
@@ -944,6 +2370,12 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->sta.sw_ver_minor = dp->mail_in.dat[4];
 			dp->sta.mst = dp->mail_in.dat[5];
 			dp->sta.pio = dp->mail_in.dat[6];
+
+			// The MST logic moves the time slots in groups of symbols per lane
+			if (dp->sta.pio & PRT_DP_PIO_SPL)
+				dp->mst.spl = 4;
+			else
+				dp->mst.spl = 2;
 			dp->sta.hpd = dp->mail_in.dat[7];
 			dp->sta.lnk_up = dp->mail_in.dat[8];
 			dp->sta.lnk_act_lanes = dp->mail_in.dat[9];
@@ -951,28 +2383,36 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->sta.vid_up = dp->mail_in.dat[11];
 
 			// Set event
-			dp->evt |= PRT_DP_EVT_STA;
+			evt |= PRT_DP_EVT_STA;
 			break;
 
 		case PRT_DP_MAIL_HPD_UNPLUG:
 			dp->hpd = PRT_DP_HPD_UNPLUG;
 
+			// Another sink can be connected next
+			dp->lkg.key = 0;
+			dp->lkg.hint = PRT_FALSE;
+
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_HPD;
+			evt |= PRT_DP_EVT_HPD;
 			break;
 
 		case PRT_DP_MAIL_HPD_PLUG:
 			dp->hpd = PRT_DP_HPD_PLUG;
 
+			// Start of the time to link up
+			if (dp->tmr)
+				dp->stat.lnk_ts = prt_tmr_get_ts (dp->tmr);
+
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_HPD;
+			evt |= PRT_DP_EVT_HPD;
 			break;
 
 		case PRT_DP_MAIL_HPD_IRQ:
 			dp->hpd = PRT_DP_HPD_IRQ;
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_HPD;
+			evt |= PRT_DP_EVT_HPD;
 			break;
 
 		case PRT_DP_MAIL_PHY_RST_REQ:		
@@ -980,7 +2420,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->trn.tps = dp->mail_in.dat[1];
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_PHY_RST;
+			evt |= PRT_DP_EVT_PHY_RST;
 			break;
 
 		case PRT_DP_MAIL_TRN_PASS:
@@ -994,13 +2434,27 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->trn.tps = 0;
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_TRN;
+			evt |= PRT_DP_EVT_TRN;
 			break;
 
 		case PRT_DP_MAIL_TRN_ERR:
 			// Set training fail flag
 			dp->trn.fail = PRT_TRUE;
 
+			// Statistics
+			// The error has no lane count, so the maximum lanes are used.
+			prt_dp_stat_trn (dp, PRT_FALSE, dp->lnk.phy_rate, dp->lnk.max_lanes);
+
+			// The cached settings failed, fall back to a full training
+			if (dp->lkg.hint)
+			{
+				lkg = prt_dp_lkg_find (dp, dp->lkg.key);
+
+				if (lkg)
+					lkg->key = 0;
+				dp->lkg.hint = PRT_FALSE;
+			}
+
 			// Clear training pass flag
 			dp->trn.pass = PRT_FALSE;
 
@@ -1008,7 +2462,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->trn.tps = 0;
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_TRN;
+			evt |= PRT_DP_EVT_TRN;
 			break;
 
 		case PRT_DP_MAIL_LNK_RATE_REQ:
@@ -1022,7 +2476,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			}
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_PHY_RATE;
+			evt |= PRT_DP_EVT_PHY_RATE;
 			break;
 
 		case PRT_DP_MAIL_LNK_VAP_REQ:
@@ -1031,7 +2485,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			dp->lnk.phy_pre = dp->mail_in.dat[2];
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_PHY_VAP;
+			evt |= PRT_DP_EVT_PHY_VAP;
 			break;
 
 		case PRT_DP_MAIL_LNK_UP:
@@ -1044,8 +2498,17 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			// Rate
 			dp->lnk.act_rate = dp->mail_in.dat[2];
 
+			// Statistics
+			// The link comes up after a training pass with the active rate and lanes.
+			prt_dp_stat_trn (dp, PRT_TRUE, dp->lnk.act_rate, dp->lnk.act_lanes);
+			prt_dp_stat_lnk_up (dp);
+
+			// Last known good
+			if (dp->id == PRT_DPTX_ID)
+				prt_dp_lkg_put (dp);
+
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_LNK;
+			evt |= PRT_DP_EVT_LNK;
 			break;
 
 		case PRT_DP_MAIL_LNK_DOWN:
@@ -1055,8 +2518,19 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			// Reason
 			dp->lnk.reason = dp->mail_in.dat[1];
 
+			// Statistics
+			if (dp->lnk.reason < PRT_DP_STAT_LNK_DOWN)
+				dp->stat.lnk_down[dp->lnk.reason]++;
+			else
+				dp->stat.lnk_down[0]++;
+
+			if (dp->tmr)
+				dp->stat.lnk_ts = prt_tmr_get_ts (dp->tmr);
+
+			prt_dp_stat_set_state (dp, PRT_DP_STAT_STATE_DOWN);
+
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_LNK;
+			evt |= PRT_DP_EVT_LNK;
 			break;
 
 		case PRT_DP_MAIL_VID_STR:
@@ -1079,13 +2553,16 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			// Set video up flag
 			dp->vid[stream].up = PRT_TRUE;
 
+			// Statistics
+			prt_dp_stat_set_state (dp, PRT_DP_STAT_STATE_VID);
+
 			// Set the video event flag
 			// To prevent race conditions, besides the dp video event flag,
 			// each video stream has its own event flag.
 			dp->vid[stream].evt = PRT_TRUE;
 
 			// Set dp event flag
-			dp->evt |= PRT_DP_EVT_VID;
+			evt |= PRT_DP_EVT_VID;
 			break;
 
 		case PRT_DP_MAIL_VID_DOWN:
@@ -1111,13 +2588,33 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			// Clear video up flag
 			dp->vid[stream].up = PRT_FALSE;
 
+			// Statistics
+			if (dp->vid[stream].reason < PRT_DP_STAT_VID_DOWN)
+				dp->stat.vid_down[dp->vid[stream].reason]++;
+			else
+				dp->stat.vid_down[0]++;
+
+			// The link state is kept while another stream still has video
+			if (dp->lnk.up)
+			{
+				state = PRT_DP_STAT_STATE_LNK;
+				for (uint8_t i = 0; i < PRT_DP_MST_STREAMS; i++)
+				{
+					if (dp->vid[i].up)
+						state = PRT_DP_STAT_STATE_VID;
+				}
+
+				if (state == PRT_DP_STAT_STATE_LNK)
+					prt_dp_stat_set_state (dp, state);
+			}
+
 			// Set the video event flag
 			// To prevent race conditions, besides the dp video event flag,
 			// each video stream has its own event flag.
 			dp->vid[stream].evt = PRT_TRUE;
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_VID;
+			evt |= PRT_DP_EVT_VID;
 			break;
 
 		case PRT_DP_MAIL_MSA_DAT:
@@ -1193,7 +2690,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			//dp->vid[stream].tp.misc1 = dat;
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_MSA;
+			evt |= PRT_DP_EVT_MSA;
 
 			break;
 
@@ -1206,7 +2703,7 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			}
 
 			// Set event flag
-			dp->evt |= PRT_DP_EVT_EDID;
+			evt |= PRT_DP_EVT_EDID;
 
 			break;
 
@@ -1215,6 +2712,25 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 			break;	
 	}
 
+	// Callbacks
+	if (evt)
+	{
+		// Latch for the event wait
+		dp->evt_lat |= evt;
+
+		// The events are kept until prt_dp_dispatch runs the callbacks
+		dp->evt |= evt;
+
+		#ifdef PRT_DP_CB_DIRECT
+			prt_dp_cb_exec (dp);
+		#endif
+	}
+}
+
+// Execute callbacks
+// The events to handle are in dp->evt
+void prt_dp_cb_exec (prt_dp_ds_struct *dp)
+{
 	// Callbacks
 	if (dp->evt)
 	{
@@ -1294,41 +2810,50 @@ void prt_dp_mail_dec (prt_dp_ds_struct *dp)
 }
 
 // DP Initialize rom
-void prt_dp_rom_init (prt_dp_ds_struct *dp, uint32_t len, uint8_t *rom)
+void prt_dp_rom_init (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *rom)
 {
-	uint32_t dat = 0;
-
 	// Start initialization
 	dp->dev->ctl = PRT_DP_CTL_MEM_STR;
 
-	for (int word = 0; word < (len/4)+1; word++)
-	{
-		for (int byte = 3; byte >= 0; byte--)
-		{
-			dat <<= 8;
-			dat |= rom[(word * 4) + byte];
-		}
-		dp->dev->mem = dat;
-	}
+	// Copy data
+	prt_dp_mem_wr (dp, len, rom);
 }
 
 // DP Initialize ram
-void prt_dp_ram_init (prt_dp_ds_struct *dp, uint32_t len, uint8_t *ram)
+void prt_dp_ram_init (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *ram)
 {
-	uint32_t dat = 0;
-
 	// Start initialization and select ram
 	dp->dev->ctl = PRT_DP_CTL_MEM_STR | PRT_DP_CTL_MEM_SEL;
 
 	// Copy data
-	for (int word = 0; word < (len/4)+1; word++)
+	prt_dp_mem_wr (dp, len, ram);
+}
+
+// DP Memory write
+// The images are pre-packed into words, so every iteration is a plain load and store.
+void prt_dp_mem_wr (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *dat)
+{
+	// Variables
+	volatile uint32_t *mem;
+	uint32_t blk;
+
+	// Memory port
+	mem = &dp->dev->mem;
+
+	// Copy four words per iteration
+	for (blk = len >> 2; blk > 0; blk--)
 	{
-		for (int byte = 3; byte >= 0; byte--)
-		{
-			dat <<= 8;
-			dat |= ram[(word * 4) + byte];
-		}
-		dp->dev->mem = dat;
+		*mem = dat[0];
+		*mem = dat[1];
+		*mem = dat[2];
+		*mem = dat[3];
+		dat += 4;
+	}
+
+	// Copy the remaining words
+	for (blk = len & 3; blk > 0; blk--)
+	{
+		*mem = *dat++;
 	}
 }
 
@@ -1338,44 +2863,29 @@ uint8_t prt_dptx_edid_rd (prt_dp_ds_struct *dp)
 {
 	// Variables
 	uint8_t sta;
-	uint8_t done;
 
 	// Reset address
+	// The mail decoder increments the address with every block
 	dp->edid.adr = 0;
-	done = PRT_FALSE;
 
 	do
 	{
-		dp->mail_out.len = 0;
+		// Clear event
+		prt_dp_clr_evt (dp, PRT_DP_EVT_EDID);
+
+		prt_dp_mail_new (dp);
 		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_EDID_RD;	// Token
 		dp->mail_out.dat[dp->mail_out.len++] = dp->edid.adr;	// Base address
-		prt_dp_mail_send (dp);
 
-		// Wait for response
-		sta = prt_dp_mail_resp (dp);
+		// Send mail and wait for response
+		sta = prt_dp_mail_trx (dp);
 
+		// Wait for the block
 		if (sta)
-		{
-			// Wait for edid event
-			while (prt_dp_is_evt (dp, PRT_DP_EVT_EDID));
-
-			// Last block
-			if (dp->edid.adr == (15 * 16))
-			{
-				sta = PRT_TRUE;
-				done = PRT_TRUE;
-			}
-
-			else
-				dp->edid.adr += 16;
-		}
+			sta = prt_dp_wait_evt (dp, PRT_DP_EVT_EDID, PRT_DP_EDID_TIMEOUT);
 
-		else
-		{
-			sta = PRT_FALSE;
-			done = PRT_TRUE;
-		}
-	} while (!done);
+	// 16 blocks
+	} while (sta && (dp->edid.adr < 256));
 
 	return sta;
 }
@@ -1393,7 +2903,7 @@ uint8_t prt_dprx_edid_wr (prt_dp_ds_struct *dp, uint16_t len)
 
 	do
 	{
-		dp->mail_out.len = 0;
+		prt_dp_mail_new (dp);
 		dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_EDID_DAT;	// Token
 		dp->mail_out.dat[dp->mail_out.len++] = dp->edid.adr >> 8;		// Base address high
 		dp->mail_out.dat[dp->mail_out.len++] = dp->edid.adr & 0xff;		// Base address low
@@ -1401,10 +2911,8 @@ uint8_t prt_dprx_edid_wr (prt_dp_ds_struct *dp, uint16_t len)
 		for (uint8_t i = 0; i < 16; i++)
 			dp->mail_out.dat[dp->mail_out.len++] = dp->edid.dat[dp->edid.adr++];	// Data
 
-		prt_dp_mail_send (dp);
-
-		// Wait for response
-		sta = prt_dp_mail_resp (dp);
+		// Send mail and wait for response
+		sta = prt_dp_mail_trx (dp);
 
 		if (sta)
 		{
@@ -1452,10 +2960,11 @@ void prt_dp_irq_handler (prt_dp_ds_struct *dp)
 			dp->dev->sta = PRT_DP_STA_IRQ;
 
 			// Decode mail
-			if (dp->mail_in.proc)
-			{
-				prt_dp_mail_dec (dp);
-			}
+			// Otherwise the messages are decoded by prt_dp_dispatch
+			#ifdef PRT_DP_CB_DIRECT
+				while (prt_dp_mail_rd (dp))
+					prt_dp_mail_dec (dp);
+			#endif
 		}
 
 		// AUX
@@ -1587,15 +3096,14 @@ uint8_t prt_dptx_mst_str (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_MST_STR;	// MST 
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	if (sta == PRT_TRUE)
-		sta = dp->mail_in.dat[1];
+		sta = dp->trx.dat[1];
 	else
 		sta = PRT_DP_MST_ERR;
 		
@@ -1608,15 +3116,14 @@ uint8_t prt_dptx_mst_stp (prt_dp_ds_struct *dp)
 	// Variables
 	uint8_t sta;
 
-	dp->mail_out.len = 0;
+	prt_dp_mail_new (dp);
 	dp->mail_out.dat[dp->mail_out.len++] = PRT_DP_MAIL_MST_STP;	// MST 
-	prt_dp_mail_send (dp);
 
-	// Wait for response
-	sta = prt_dp_mail_resp (dp);
+	// Send mail and wait for response
+	sta = prt_dp_mail_trx (dp);
 
 	if (sta == PRT_TRUE)
-		sta = dp->mail_in.dat[1];
+		sta = dp->trx.dat[1];
 	else
 		sta = PRT_DP_MST_ERR;
 		
@@ -10,6 +10,18 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added mailbox transactions with time out
+    v1.2 - Added DPCD burst access
+    v1.3 - Added deferred event queue
+    v1.4 - Added inbound mail ring
+    v1.5 - Added packed memory initialization
+    v1.6 - Added mailbox trace
+    v1.7 - Added link and video statistics
+    v1.8 - Added Mvid and Nvid computation
+    v1.9 - Added link planner
+    v1.10 - Added last known good training cache
+    v1.11 - Added MST time slot allocator
+    v1.12 - Added event wait
 
     License
     =======
@@ -29,6 +41,7 @@
 
 // Includes
 #include "prt_types.h"
+#include "prt_tmr.h"
 #include <stdint.h>
 
 // ID
@@ -77,6 +90,16 @@
 #define PRT_DP_PHY_LINERATE_5400		0x14
 #define PRT_DP_PHY_LINERATE_8100		0x1e
 
+// Link planner
+#define PRT_DP_PLAN_HEADROOM			5		// Default bandwidth headroom (%)
+
+// MST
+#define PRT_DP_MST_STREAMS				2		// Streams of the MST logic
+#define PRT_DP_MST_MTP_SLOTS			64		// Time slots per MTP
+
+// Policy maker PIO status
+#define PRT_DP_PIO_SPL					(1 << 1)	// Four symbols per lane
+
 // Video resolution
 #define PRT_DP_VID_RES_RX				0
 #define PRT_DP_VID_RES_480P60			1
@@ -98,12 +121,44 @@
 #define PRT_AUX_REPLY_NACK     		0x1
 #define PRT_AUX_REPLY_DEFER    		0x2
 
+// AUX maximum burst length
+#define PRT_DP_AUX_MAX_LEN			16
+
+// Mail ring size (words)
+// Must be a power of two
+#define PRT_DP_MAIL_RING_SIZE		64
+
+// Mailbox transaction time out (us)
+#define PRT_DP_TRX_DEF_TIMEOUT			500000
+
+// Event wait time outs (us)
+#define PRT_DP_LNK_TIMEOUT				1000000	// Link up, the policy maker might be training
+#define PRT_DP_EDID_TIMEOUT				100000	// EDID block
+
 // Enum HPD
 typedef enum {PRT_DP_HPD_UNPLUG, PRT_DP_HPD_PLUG, PRT_DP_HPD_IRQ} prt_dp_hpd_type;
 
+// Enum transaction status
+typedef enum {
+	PRT_DP_TRX_IDLE,		// No transaction
+	PRT_DP_TRX_BUSY,		// Waiting for response
+	PRT_DP_TRX_OK,			// Policy maker replied ok
+	PRT_DP_TRX_ERR,			// Policy maker replied error
+	PRT_DP_TRX_NACK,		// Sink replied nack or defer
+	PRT_DP_TRX_TIMEOUT		// No response before the deadline
+} prt_dp_trx_sta_type;
+
+// Transaction handle
+// Zero is never a valid handle
+typedef uint8_t prt_dp_trx_hndl;
+
 // Typedef callback
 typedef void (*prt_dp_cb)(void *CallbackRef);
 
+// Typedef transaction callback
+struct dp_ds_struct;
+typedef void (*prt_dp_trx_cb)(struct dp_ds_struct *dp, prt_dp_trx_hndl hndl, prt_dp_trx_sta_type sta);
+
 // Enum callback registration types
 typedef enum {
 	PRT_DP_CB_HPD, 
@@ -115,7 +170,8 @@ typedef enum {
 	PRT_DP_CB_LNK, 
 	PRT_DP_CB_VID, 
 	PRT_DP_CB_MSA, 
-	PRT_DP_CB_DBG
+	PRT_DP_CB_DBG,
+	PRT_DP_CB_IDLE
 } prt_dp_cb_type;
 
 // Device structure
@@ -153,13 +209,23 @@ typedef struct {
 
 // Mail structure
 typedef struct {
-	volatile prt_bool ok;			// Ok flag
-	volatile prt_bool err;		// Error flag
-	prt_bool proc;		// Process
 	uint8_t dat[32]; 	// Data
 	uint8_t len;  			// Length
 } prt_dp_mail_ds_struct;
 
+// Transaction structure
+// The policy maker handles one request at a time,
+// so there is only one transaction in flight per instance.
+typedef struct {
+	volatile prt_dp_trx_sta_type	sta;		// Status
+	prt_dp_trx_hndl					hndl;		// Handle of the last submitted transaction
+	uint32_t						dl;			// Deadline (timer timestamp)
+	prt_dp_trx_cb					cb;			// Completion callback
+	uint8_t							dat[32];	// Response data
+	uint8_t							len;		// Response length
+	uint8_t							wait;		// A transaction wait is running
+} prt_dp_trx_struct;
+
 // AUX structure
 typedef struct {
 	uint8_t proc;		// Process
@@ -186,6 +252,7 @@ typedef struct {
 	uint16_t vstart;		// Vertical start
 	uint16_t vsw;			// Vertical sync width
 	uint8_t bpc;			// Bits per component
+	uint32_t pclk;			// Pixel clock (kHz)
 } prt_dp_tp_struct;
 
 // Link
@@ -201,6 +268,9 @@ typedef struct {
 	uint8_t phy_pre;		// PHY pre-amble
 	uint8_t reason;			// Link down reason
 	prt_bool mst_cap;		// MST capability
+	uint8_t cap_lanes;		// Platform lanes
+	uint8_t cap_rate;		// Platform rate
+	uint8_t headroom;		// Planner bandwidth headroom (%)
 } prt_dp_lnk_struct;
 
 // Video
@@ -211,6 +281,65 @@ typedef struct {
 	prt_dp_tp_struct 	tp;		// Timing parameters
 } prt_dp_vid_struct;
 
+// Statistics
+#define PRT_DP_STAT_RATES					4		// 1.62, 2.7, 5.4 and 8.1 Gbps
+#define PRT_DP_STAT_LANES					3		// 1, 2 and 4 lanes
+#define PRT_DP_STAT_LNK_DOWN				10		// Link down reasons (PRT_DP_LNK_DOWN_*)
+#define PRT_DP_STAT_VID_DOWN				5		// Video down reasons (PRT_DP_VID_DOWN_*)
+#define PRT_DP_STAT_LNK_HIST				6		// Time to link up buckets (< 10, 50, 100, 500, 1000 and >= 1000 ms)
+#define PRT_DP_STAT_STATES					3		// Time in state 
+
+// States
+#define PRT_DP_STAT_STATE_DOWN				0		// Link down
+#define PRT_DP_STAT_STATE_LNK				1		// Link up
+#define PRT_DP_STAT_STATE_VID				2		// Video up
+
+typedef struct {
+	uint16_t lnk_up;									// Link up count
+	uint16_t lnk_down[PRT_DP_STAT_LNK_DOWN];			// Link down count per reason
+	uint16_t trn_pass[PRT_DP_STAT_RATES][PRT_DP_STAT_LANES];	// Training pass count per rate and lanes
+	uint16_t trn_fail[PRT_DP_STAT_RATES][PRT_DP_STAT_LANES];	// Training fail count per rate and lanes
+	uint16_t vid_down[PRT_DP_STAT_VID_DOWN];			// Video down count per reason
+	uint16_t lnk_hist[PRT_DP_STAT_LNK_HIST];			// Time to link up histogram
+	uint32_t tis_s[PRT_DP_STAT_STATES];				// Time in state (seconds)
+	uint32_t tis_us[PRT_DP_STAT_STATES];				// Time in state (microseconds fraction)
+	uint8_t state;										// Current state
+	uint32_t state_ts;									// Current state start timestamp
+	uint32_t lnk_ts;									// Link down timestamp
+} prt_dp_stat_struct;
+
+// Last known good training cache
+#define PRT_DP_LKG_SIZE					4		// Sinks. Must be a power of two.
+
+// Last known good entry
+typedef struct {
+	uint32_t key;			// Sink key (EDID hash). Zero is an empty entry.
+	uint8_t rate;			// Link rate
+	uint8_t lanes;			// Lanes
+	uint8_t volt;			// Voltage swing
+	uint8_t pre;			// Pre-emphasis
+} prt_dp_lkg_ent_struct;
+
+// Last known good cache
+typedef struct {
+	prt_dp_lkg_ent_struct	ent[PRT_DP_LKG_SIZE];	// Entries
+	uint32_t				key;					// Key of the connected sink
+	uint8_t					nxt;					// Next entry to replace
+	prt_bool				hint;					// The training started from a cached entry
+	prt_bool				no_hint;				// The policy maker doesn't support the hint
+	uint32_t				hit;					// Hits
+	uint32_t				miss;					// Misses
+} prt_dp_lkg_struct;
+
+// MST time slot allocation
+typedef struct {
+	uint8_t		spl;							// Symbols per lane of the MST logic
+	uint8_t		streams;						// Streams
+	uint16_t	pbn[PRT_DP_MST_STREAMS];		// Payload bandwidth number
+	uint8_t		ts[PRT_DP_MST_STREAMS];			// Time slots. Zero when the stream isn't allocated.
+	uint8_t		used;							// Allocated time slots
+} prt_dp_mst_struct;
+
 // Debug
 typedef struct {
 	uint8_t 		head;			// Head pointer
@@ -218,6 +347,35 @@ typedef struct {
 	uint8_t 		dat[32];	// Data
 } prt_dp_debug_struct;
 
+// Mail ring
+// Single producer (interrupt handler) / single consumer (main loop)
+// The messages are stored without the start of mail token and end with the end of mail token.
+typedef struct {
+	volatile uint8_t		head;							// Head pointer (producer), moves per complete message
+	volatile uint8_t		tail;							// Tail pointer (consumer)
+	uint8_t					wr;								// Write pointer (producer)
+	prt_bool				drop;							// Drop current message
+	uint16_t				dat[PRT_DP_MAIL_RING_SIZE];		// Data
+	volatile uint8_t		hwm;							// High watermark (words)
+	volatile uint32_t		ovf;							// Dropped messages
+} prt_dp_mail_ring_struct;
+
+// Mailbox trace
+// Every entry is a length byte, a direction byte, a 32-bit timestamp (little endian)
+// and the payload tokens without the start and end of mail tokens.
+// The oldest entries are overwritten when the trace is full.
+#define PRT_DP_TRC_SIZE						512		// Trace size in bytes. Must be a power of two.
+#define PRT_DP_TRC_HDR_LEN					6		// Entry header length
+#define PRT_DP_TRC_DIR_IN					0		// Policy maker -> host
+#define PRT_DP_TRC_DIR_OUT					1		// Host -> policy maker
+
+typedef struct {
+	volatile uint16_t head;					// Head
+	volatile uint16_t tail;					// Tail
+	volatile uint32_t ovf;					// Overwritten entries
+	uint8_t dat[PRT_DP_TRC_SIZE];			// Data
+} prt_dp_trc_struct;
+
 // Call back
 typedef struct {
 	prt_dp_cb		hpd;		// HPD Callback
@@ -230,23 +388,33 @@ typedef struct {
 	prt_dp_cb		vid;		// Video Callback
 	prt_dp_cb		msa;		// MSA Callback
 	prt_dp_cb		dbg;		// Debug Callback
+	prt_dp_cb		idle;		// Idle Callback, runs during an event or transaction wait
 } prt_dp_cb_struct;
 
 // Data structure
-typedef struct {
+typedef struct dp_ds_struct {
 	uint8_t 								id;
 	volatile prt_dp_dev_struct 				*dev;			// Device
+	prt_tmr_ds_struct						*tmr;			// Timer
+	prt_dp_mail_ring_struct					mail_ring;		// Mail ring
 	prt_dp_mail_ds_struct 					mail_in;		// Mail in
 	prt_dp_mail_ds_struct 					mail_out;		// Mail out
+	prt_dp_trx_struct						trx;			// Transaction
+	prt_dp_trc_struct						*trc;			// Trace
 	volatile prt_dp_debug_struct			debug;			// Debug
 	volatile uint32_t 						evt;			// Event
+	volatile uint32_t 						evt_lat;		// Latched events
 	prt_dp_cb_struct						cb;				// Callback
+	uint8_t									cb_busy;		// The callbacks are running
 	prt_dp_sta_struct						sta;			// Status
 	prt_dp_trn_struct						trn;			// Training
 	prt_dp_hpd_type 						hpd;			// HPD
 	prt_dp_lnk_struct						lnk;			// Link
-	prt_dp_vid_struct						vid[2];			// Video
+	prt_dp_vid_struct						vid[PRT_DP_MST_STREAMS];	// Video
 	prt_dp_edid_struct						edid;			// EDID
+	prt_dp_stat_struct						stat;			// Statistics
+	prt_dp_lkg_struct						lkg;			// Last known good training
+	prt_dp_mst_struct						mst;			// MST time slot allocation
 #ifdef PRT_SIM
 	prt_dp_aux_ds_struct					aux;			// AUX
 #endif
@@ -258,10 +426,11 @@ typedef struct {
 // Shared
 uint8_t prt_dp_set_base (prt_dp_ds_struct *dp, uint32_t base);
 void prt_dp_set_cb (prt_dp_ds_struct *dp, prt_dp_cb_type cb_type, void *cb_handler);
-void prt_dp_rom_init (prt_dp_ds_struct *dp, uint32_t len, uint8_t *rom);
-void prt_dp_ram_init (prt_dp_ds_struct *dp, uint32_t len, uint8_t *ram);
-void prt_dp_init (prt_dp_ds_struct *dp, uint8_t id);
+void prt_dp_rom_init (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *rom);
+void prt_dp_ram_init (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *ram);
+void prt_dp_init (prt_dp_ds_struct *dp, prt_tmr_ds_struct *tmr, uint8_t id);
 uint8_t prt_dp_ping (prt_dp_ds_struct *dp);
+prt_dp_trx_hndl prt_dp_ping_req (prt_dp_ds_struct *dp, prt_dp_trx_cb cb);
 uint8_t prt_dp_lic (prt_dp_ds_struct *dp, char *lic);
 void prt_dp_set_lnk_max_lanes (prt_dp_ds_struct *dp, uint8_t lanes);
 void prt_dp_set_lnk_max_rate (prt_dp_ds_struct *dp, uint8_t rate);
@@ -275,14 +444,47 @@ uint8_t prt_dp_get_phy_rate (prt_dp_ds_struct *dp);
 uint8_t prt_dp_get_phy_ssc (prt_dp_ds_struct *dp);
 uint8_t prt_dp_get_phy_volt (prt_dp_ds_struct *dp);
 uint8_t prt_dp_get_phy_pre (prt_dp_ds_struct *dp);
+prt_dp_trx_hndl prt_dp_trx_submit (prt_dp_ds_struct *dp, uint32_t timeout, prt_dp_trx_cb cb);
+prt_dp_trx_sta_type prt_dp_trx_get_sta (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl);
+prt_dp_trx_sta_type prt_dp_trx_wait (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl);
+void prt_dp_trx_poll (prt_dp_ds_struct *dp);
+uint8_t prt_dp_is_trx_busy (prt_dp_ds_struct *dp);
+void prt_dp_dispatch (prt_dp_ds_struct *dp);
+void prt_dp_poll (prt_dp_ds_struct *dp);
+void prt_dp_clr_evt (prt_dp_ds_struct *dp, uint32_t evt);
+uint8_t prt_dp_wait_evt (prt_dp_ds_struct *dp, uint32_t evt, uint32_t timeout);
+uint32_t prt_dp_get_mail_ovf (prt_dp_ds_struct *dp);
+uint8_t prt_dp_get_mail_hwm (prt_dp_ds_struct *dp);
+void prt_dp_set_trc (prt_dp_ds_struct *dp, prt_dp_trc_struct *trc);
+void prt_dp_trc_dump (prt_dp_ds_struct *dp);
+void prt_dp_get_stat (prt_dp_ds_struct *dp, prt_dp_stat_struct *stat);
+void prt_dp_clr_stat (prt_dp_ds_struct *dp);
 
 // DPTX
 uint8_t prt_dptx_msa_set (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t stream);
+prt_dp_trx_hndl prt_dptx_msa_set_req (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t stream, prt_dp_trx_cb cb);
 uint8_t prt_dptx_dpcd_wr (prt_dp_ds_struct *dp, uint32_t adr, uint8_t dat);
+prt_dp_trx_hndl prt_dptx_dpcd_wr_req (prt_dp_ds_struct *dp, uint32_t adr, uint8_t dat, prt_dp_trx_cb cb);
 uint8_t prt_dptx_dpcd_rd (prt_dp_ds_struct *dp, uint32_t adr, uint8_t *dat);
+prt_dp_trx_hndl prt_dptx_dpcd_rd_req (prt_dp_ds_struct *dp, uint32_t adr, prt_dp_trx_cb cb);
+uint8_t prt_dptx_get_dpcd_dat (prt_dp_ds_struct *dp);
+uint8_t prt_dptx_dpcd_wr_burst (prt_dp_ds_struct *dp, uint32_t adr, uint16_t len, uint8_t *dat);
+uint8_t prt_dptx_dpcd_rd_burst (prt_dp_ds_struct *dp, uint32_t adr, uint16_t len, uint8_t *dat);
 uint8_t prt_dptx_mst_str (prt_dp_ds_struct *dp);
 uint8_t prt_dptx_mst_stp (prt_dp_ds_struct *dp);
+uint8_t prt_dptx_mst_alloc (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t streams);
+uint8_t prt_dptx_get_mst_ts (prt_dp_ds_struct *dp, uint8_t stream);
+uint16_t prt_dptx_get_mst_pbn (prt_dp_ds_struct *dp, uint8_t stream);
 uint8_t prt_dptx_trn (prt_dp_ds_struct *dp);
+void prt_dptx_mvid_nvid (prt_dp_ds_struct *dp, uint8_t stream);
+void prt_dptx_set_lnk_cap (prt_dp_ds_struct *dp, uint8_t rate, uint8_t lanes);
+void prt_dptx_set_lnk_headroom (prt_dp_ds_struct *dp, uint8_t headroom);
+uint8_t prt_dptx_lnk_plan (prt_dp_ds_struct *dp, prt_dp_tp_struct *tp, uint8_t streams);
+uint8_t prt_dp_get_lnk_max_lanes (prt_dp_ds_struct *dp);
+uint8_t prt_dp_get_lnk_max_rate (prt_dp_ds_struct *dp);
+uint8_t prt_dptx_lkg_key (prt_dp_ds_struct *dp);
+uint8_t prt_dptx_lkg_hint (prt_dp_ds_struct *dp);
+void prt_dptx_lkg_clr (prt_dp_ds_struct *dp);
 
 // DPRX
 void prt_dprx_phy_rst_ack (prt_dp_ds_struct *dp);
@@ -296,9 +498,32 @@ uint8_t prt_dptx_aux_test (prt_dp_ds_struct *dp, uint8_t run);
 uint8_t prt_dptx_phy_test (prt_dp_ds_struct *dp, uint8_t tps, uint8_t volt, uint8_t pre);
 void prt_dp_mail_send (prt_dp_ds_struct *dp);
 uint8_t prt_dp_mail_chk (prt_dp_ds_struct *dp);
-void prt_dp_get_mail (prt_dp_ds_struct *dp, uint8_t len);
+void prt_dp_mail_get (prt_dp_ds_struct *dp, uint8_t len);
+uint8_t prt_dp_mail_rd (prt_dp_ds_struct *dp);
 void prt_dp_mail_dec (prt_dp_ds_struct *dp);
-uint8_t prt_dp_mail_resp (prt_dp_ds_struct *dp);
+void prt_dp_mail_proc (prt_dp_ds_struct *dp);
+void prt_dp_cb_exec (prt_dp_ds_struct *dp);
+void prt_dp_trx_cb_exec (prt_dp_ds_struct *dp);
+uint8_t prt_dp_mail_rdy (prt_dp_ds_struct *dp);
+void prt_dp_mail_new (prt_dp_ds_struct *dp);
+uint8_t prt_dp_mail_trx (prt_dp_ds_struct *dp);
+uint8_t prt_dp_mail_resp (prt_dp_ds_struct *dp, prt_dp_trx_hndl hndl);
+void prt_dp_trx_done (prt_dp_ds_struct *dp, prt_dp_trx_sta_type sta);
+void prt_dp_mem_wr (prt_dp_ds_struct *dp, uint32_t len, const uint32_t *dat);
+void prt_dp_trc_str (prt_dp_ds_struct *dp, uint8_t dir, uint8_t len);
+void prt_dp_trc_wr (prt_dp_ds_struct *dp, uint8_t dat);
+void prt_dp_stat_rst (prt_dp_ds_struct *dp);
+void prt_dp_stat_set_state (prt_dp_ds_struct *dp, uint8_t state);
+void prt_dp_stat_trn (prt_dp_ds_struct *dp, uint8_t pass, uint8_t rate, uint8_t lanes);
+void prt_dp_stat_lnk_up (prt_dp_ds_struct *dp);
+uint32_t prt_dp_gcd (uint32_t a, uint32_t b);
+uint32_t prt_dp_div (uint32_t n, uint32_t d);
+uint32_t prt_dp_mul (uint32_t a, uint32_t b);
+uint8_t prt_dp_cfg_lnk (prt_dp_ds_struct *dp);
+uint32_t prt_dp_edid_hash (uint8_t *edid);
+prt_dp_lkg_ent_struct *prt_dp_lkg_find (prt_dp_ds_struct *dp, uint32_t key);
+void prt_dp_lkg_put (prt_dp_ds_struct *dp);
+uint16_t prt_dp_mst_pbn (prt_dp_tp_struct *tp);
 uint8_t prt_dp_hpd_get (prt_dp_ds_struct *dp);
 uint8_t prt_dp_is_hpd (prt_dp_ds_struct *dp);
 uint8_t prt_dp_is_lnk_up (prt_dp_ds_struct *dp);
@@ -5,11 +5,13 @@
 
 
     Module: I2C Peripheral driver
-    (c) 2021 - 2024 by Parretto B.V.
+    (c) 2021 - 2025 by Parretto B.V.
 
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added interrupt driven transaction queue
+    v1.2 - Added command sequencer
 
     License
     =======
@@ -44,6 +46,27 @@ void prt_i2c_init (prt_i2c_ds_struct *i2c, uint32_t base, uint32_t beat)
 	// Clear no stop flag
 	i2c->no_stop = PRT_FALSE;
 
+	// Queue
+	// The queue runs from prt_i2c_poll until the interrupt is enabled
+	i2c->tmr = 0;
+	i2c->ctl = PRT_I2C_CTL_RUN;
+	i2c->q.wr = 0;
+	i2c->q.rd = 0;
+	i2c->q.cb = 0;
+	i2c->q.hndl = 0;
+
+	for (uint8_t i = 0; i < PRT_I2C_Q_SIZE; i++)
+	{
+		i2c->q.trx[i].hndl = 0;
+		i2c->q.trx[i].sta = PRT_I2C_TRX_IDLE;
+	}
+
+	// Sequencer
+	// The sequencer is enabled by prt_i2c_set_seq
+	i2c->seq.en = false;
+	i2c->seq.len = 0;
+	i2c->seq.sta = PRT_I2C_TRX_IDLE;
+
 	// Disable device
 	i2c->dev->ctl = 0;
 }
@@ -54,6 +77,10 @@ prt_sta_type prt_i2c_wr (prt_i2c_ds_struct *i2c)
 	// Variables
 	prt_sta_type sta;
 
+	// Wait for the queued transactions and the sequencer
+	while (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
 	// Start condition
 	i2c->dev->ctl = PRT_I2C_CTL_RUN | PRT_I2C_CTL_STR;
 
@@ -131,6 +158,10 @@ prt_sta_type prt_i2c_rd (prt_i2c_ds_struct *i2c)
 	uint8_t cmd;
 	prt_sta_type sta;
 
+	// Wait for the queued transactions and the sequencer
+	while (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
 	// Start condition
 	i2c->dev->ctl = PRT_I2C_CTL_RUN | PRT_I2C_CTL_STR;
 
@@ -209,17 +240,630 @@ prt_sta_type prt_i2c_rd (prt_i2c_ds_struct *i2c)
 // DIA mode
 prt_sta_type prt_i2c_dia (prt_i2c_ds_struct *i2c, bool dia, bool tentiva)
 {
-	// Variables
-	uint8_t dat = 0;
+	// Wait for the queued transactions and the sequencer
+	while (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
+	// The DIA bits are kept in the control bits, so that the interrupt enable is preserved
+	i2c->ctl &= ~(PRT_I2C_CTL_DIA | PRT_I2C_CTL_TENTIVA);
 
 	// Enable dia mode 
 	if (dia)
-		dat = PRT_I2C_CTL_RUN | PRT_I2C_CTL_DIA;
+		i2c->ctl |= PRT_I2C_CTL_DIA;
 
 	// This flag controls which Tentiva revision is used (0 - Rev. C / 1 - Rev. D)
 	if (tentiva)
-		dat |= PRT_I2C_CTL_TENTIVA;
+		i2c->ctl |= PRT_I2C_CTL_TENTIVA;
 
 	// Write control register
-	i2c->dev->ctl = dat;
+	// Without dia mode the device stays disabled until the next transaction
+	if (dia)
+		i2c->dev->ctl = i2c->ctl;
+	else
+		i2c->dev->ctl = i2c->ctl & ~PRT_I2C_CTL_RUN;
+
+	return PRT_STA_OK;
+}
+
+/*
+	Transaction queue
+	The transactions are executed from the ready interrupt, 
+	so the CPU is free while the bus is busy.
+	The queue functions must be called from the main loop.
+*/
+
+// Set timer
+// Without timer the transactions don't time out
+void prt_i2c_set_tmr (prt_i2c_ds_struct *i2c, prt_tmr_ds_struct *tmr)
+{
+	i2c->tmr = tmr;
+}
+
+// Set interrupt
+// The interrupt handler must be registered before the interrupt is enabled.
+// Without interrupt the queue is run by prt_i2c_poll.
+void prt_i2c_set_irq (prt_i2c_ds_struct *i2c, bool en)
+{
+	// Variables
+	uint32_t ctl;
+
+	ctl = prt_i2c_q_lock (i2c);
+
+	if (en)
+		ctl |= PRT_I2C_CTL_IE;
+	else
+		ctl &= ~PRT_I2C_CTL_IE;
+
+	prt_i2c_q_unlock (i2c, ctl);
+}
+
+// Transaction request
+// Copies the write data into the queue and returns the transaction handle.
+// The read data is available in the transaction structure after completion.
+// The completion callback is optional and is called from prt_i2c_poll.
+// This function returns zero when the queue is full, the length is not supported or the sequencer is busy.
+prt_i2c_trx_hndl prt_i2c_req (prt_i2c_ds_struct *i2c, prt_i2c_trx_type type, uint8_t slave, uint8_t *wr_dat, uint8_t wr_len, uint8_t rd_len, uint32_t timeout, prt_i2c_trx_cb cb, void *ref)
+{
+	// Variables
+	prt_i2c_trx_struct *trx;
+	uint32_t ctl;
+
+	// The sequencer has the bus
+	if (prt_i2c_seq_is_busy (i2c))
+		return 0;
+
+	// Check length
+	if ((wr_len > PRT_I2C_TRX_DAT_MAX) || (rd_len > PRT_I2C_TRX_DAT_MAX))
+		return 0;
+
+	// A read needs at least one byte, as the last byte is not acknowledged
+	if ((type != PRT_I2C_TRX_WR) && (rd_len == 0))
+		return 0;
+
+	// Check for a free slot
+	// A slot is free once its completion has been reported
+	if ((uint8_t)(i2c->q.wr - i2c->q.cb) >= PRT_I2C_Q_SIZE)
+		return 0;
+
+	trx = &i2c->q.trx[i2c->q.wr & (PRT_I2C_Q_SIZE - 1)];
+
+	// Next handle
+	i2c->q.hndl++;
+
+	// Zero is not a valid handle
+	if (i2c->q.hndl == 0)
+		i2c->q.hndl = 1;
+
+	trx->hndl = i2c->q.hndl;
+	trx->type = type;
+	trx->slave = slave;
+	trx->rd_len = rd_len;
+	trx->timeout = timeout;
+	trx->cb = cb;
+	trx->ref = ref;
+
+	// Write data
+	if (type == PRT_I2C_TRX_RD)
+		wr_len = 0;
+
+	for (uint8_t i = 0; i < wr_len; i++)
+		trx->wr_dat[i] = wr_dat[i];
+	trx->wr_len = wr_len;
+
+	trx->sta = PRT_I2C_TRX_BUSY;
+
+	// Add to queue
+	ctl = prt_i2c_q_lock (i2c);
+
+	i2c->q.wr++;
+
+	// Start the transaction when the queue was idle
+	if ((uint8_t)(i2c->q.wr - i2c->q.rd) == 1)
+		prt_i2c_q_str (i2c);
+
+	prt_i2c_q_unlock (i2c, ctl);
+
+	return trx->hndl;
+}
+
+// Get transaction
+// This function returns zero when the slot of the transaction has been reused.
+prt_i2c_trx_struct *prt_i2c_get_trx (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl)
+{
+	if (hndl != 0)
+	{
+		for (uint8_t i = 0; i < PRT_I2C_Q_SIZE; i++)
+		{
+			if (i2c->q.trx[i].hndl == hndl)
+				return &i2c->q.trx[i];
+		}
+	}
+	return 0;
+}
+
+// Transaction status
+// A handle of an older transaction returns idle, as its result is no longer available.
+prt_i2c_trx_sta_type prt_i2c_get_sta (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl)
+{
+	// Variables
+	prt_i2c_trx_struct *trx;
+
+	// Check deadline
+	prt_i2c_poll (i2c);
+
+	trx = prt_i2c_get_trx (i2c, hndl);
+
+	if (trx == 0)
+		return PRT_I2C_TRX_IDLE;
+	else
+		return trx->sta;
+}
+
+// Transaction wait
+// This function is blocking
+prt_i2c_trx_sta_type prt_i2c_wait (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl)
+{
+	// Variables
+	prt_i2c_trx_sta_type sta;
+
+	do
+	{
+		sta = prt_i2c_get_sta (i2c, hndl);
+	} while (sta == PRT_I2C_TRX_BUSY);
+
+	return sta;
+}
+
+// Busy
+// This function returns true when there are transactions in the queue
+bool prt_i2c_is_busy (prt_i2c_ds_struct *i2c)
+{
+	if (i2c->q.rd != i2c->q.wr)
+		return true;
+	else
+		return false;
+}
+
+// Poll
+// Runs the queue when the interrupt is disabled, times out the transaction on the bus
+// and runs the completion callbacks.
+// Must be called from the main loop.
+void prt_i2c_poll (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	uint32_t ctl;
+
+	// Sequencer
+	if (prt_i2c_seq_is_busy (i2c))
+	{
+		ctl = prt_i2c_q_lock (i2c);
+
+		// Done
+		if (i2c->dev->sta & PRT_I2C_STA_SEQ_DONE)
+			prt_i2c_seq_done (i2c);
+
+		// Check deadline
+		else if ((i2c->tmr != 0) && prt_tmr_is_exp (i2c->tmr, i2c->seq.dl))
+		{
+			// Disable device
+			// This stops the sequencer and releases the bus
+			i2c->dev->ctl = 0;
+
+			i2c->seq.sta = PRT_I2C_TRX_TIMEOUT;
+		}
+
+		prt_i2c_q_unlock (i2c, ctl);
+	}
+
+	else if (prt_i2c_is_busy (i2c))
+	{
+		ctl = prt_i2c_q_lock (i2c);
+
+		// Next phase
+		if (i2c->dev->sta & PRT_I2C_STA_RDY)
+			prt_i2c_q_step (i2c);
+
+		// Check deadline
+		if (prt_i2c_is_busy (i2c) && (i2c->tmr != 0))
+		{
+			if (prt_tmr_is_exp (i2c->tmr, i2c->q.trx[i2c->q.rd & (PRT_I2C_Q_SIZE - 1)].dl))
+			{
+				// Disable device
+				// This releases the bus
+				i2c->dev->ctl = 0;
+
+				prt_i2c_q_done (i2c, PRT_I2C_TRX_TIMEOUT);
+			}
+		}
+
+		prt_i2c_q_unlock (i2c, ctl);
+	}
+
+	// Callbacks
+	prt_i2c_q_cb_exec (i2c);
+}
+
+// Interrupt handler
+// The interrupt line might be shared with other sources,
+// so the handler checks that the interrupt is enabled and the peripheral is ready.
+void prt_i2c_irq_handler (prt_i2c_ds_struct *i2c)
+{
+	if (i2c->ctl & PRT_I2C_CTL_IE)
+	{
+		// Sequencer
+		if (prt_i2c_seq_is_busy (i2c))
+		{
+			if (i2c->dev->sta & PRT_I2C_STA_SEQ_DONE)
+				prt_i2c_seq_done (i2c);
+		}
+
+		// Queue
+		else if (prt_i2c_is_busy (i2c) && (i2c->dev->sta & PRT_I2C_STA_RDY))
+			prt_i2c_q_step (i2c);
+	}
+}
+
+// Queue lock
+// Masks the interrupt, so that the interrupt handler and the main loop don't run the queue at the same time.
+// Returns the control bits to restore.
+uint32_t prt_i2c_q_lock (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	uint32_t ctl;
+
+	ctl = i2c->ctl;
+
+	// From here the interrupt handler doesn't run the queue
+	i2c->ctl = ctl & ~PRT_I2C_CTL_IE;
+
+	// Mask the interrupt line
+	if (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+	{
+		// Wait for the command to be taken
+		while (i2c->dev->ctl & (PRT_I2C_CTL_STR | PRT_I2C_CTL_STP | PRT_I2C_CTL_WR | PRT_I2C_CTL_RD | PRT_I2C_CTL_SEQ));
+
+		i2c->dev->ctl = i2c->ctl;
+	}
+
+	return ctl;
+}
+
+// Queue unlock
+void prt_i2c_q_unlock (prt_i2c_ds_struct *i2c, uint32_t ctl)
+{
+	i2c->ctl = ctl;
+
+	// Restore the interrupt line
+	// A pending ready raises the interrupt
+	if (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+	{
+		// Wait for the command to be taken
+		while (i2c->dev->ctl & (PRT_I2C_CTL_STR | PRT_I2C_CTL_STP | PRT_I2C_CTL_WR | PRT_I2C_CTL_RD | PRT_I2C_CTL_SEQ));
+
+		i2c->dev->ctl = i2c->ctl;
+	}
+}
+
+// Queue callbacks
+// Reports the completed transactions in order
+void prt_i2c_q_cb_exec (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	prt_i2c_trx_struct *trx;
+
+	while (i2c->q.cb != i2c->q.rd)
+	{
+		trx = &i2c->q.trx[i2c->q.cb & (PRT_I2C_Q_SIZE - 1)];
+
+		// The slot is released before the callback, 
+		// so that the callback can submit the next transaction
+		i2c->q.cb++;
+
+		if (trx->cb != 0)
+			trx->cb (trx);
+	}
+}
+
+// Queue start
+// Puts the transaction at the read pointer on the bus
+void prt_i2c_q_str (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	prt_i2c_trx_struct *trx;
+
+	trx = &i2c->q.trx[i2c->q.rd & (PRT_I2C_Q_SIZE - 1)];
+
+	i2c->q.ph = PRT_I2C_PH_STR;
+	i2c->q.idx = 0;
+	i2c->q.res = PRT_I2C_TRX_OK;
+
+	// A read transaction starts with the read part
+	if (trx->type == PRT_I2C_TRX_RD)
+		i2c->q.rd_part = true;
+	else
+		i2c->q.rd_part = false;
+
+	// Deadline
+	// The time out starts when the transaction gets the bus
+	if (i2c->tmr != 0)
+		trx->dl = prt_tmr_get_ts (i2c->tmr) + trx->timeout;
+
+	// Start condition
+	i2c->dev->ctl = i2c->ctl | PRT_I2C_CTL_STR;
+}
+
+// Queue step
+// Called when the peripheral is ready. Issues the next command of the transaction on the bus.
+void prt_i2c_q_step (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	prt_i2c_trx_struct *trx;
+	uint32_t cmd;
+
+	trx = &i2c->q.trx[i2c->q.rd & (PRT_I2C_Q_SIZE - 1)];
+
+	// Clear ready bit
+	i2c->dev->sta = PRT_I2C_STA_RDY;
+
+	// Default
+	cmd = PRT_I2C_CTL_STP;
+
+	switch (i2c->q.ph)
+	{
+		// Start condition done
+		case PRT_I2C_PH_STR :
+			// Slave address
+			if (i2c->q.rd_part)
+				i2c->dev->wr_dat = (trx->slave << 1) | 0x01;
+			else
+				i2c->dev->wr_dat = trx->slave << 1;
+
+			cmd = PRT_I2C_CTL_WR;
+			i2c->q.ph = PRT_I2C_PH_ADR;
+			break;
+
+		// Slave address done
+		case PRT_I2C_PH_ADR :
+			// No acknowledge
+			if (!(i2c->dev->sta & PRT_I2C_STA_ACK))
+				i2c->q.res = PRT_I2C_TRX_NACK;
+
+			// Read first data
+			else if (i2c->q.rd_part)
+			{
+				i2c->q.idx = 0;
+				cmd = PRT_I2C_CTL_RD;
+				if (trx->rd_len > 1)
+					cmd |= PRT_I2C_CTL_ACK;
+				i2c->q.ph = PRT_I2C_PH_RD;
+			}
+
+			// Write first data
+			else if (trx->wr_len > 0)
+			{
+				i2c->dev->wr_dat = trx->wr_dat[0];
+				i2c->q.idx = 1;
+				cmd = PRT_I2C_CTL_WR;
+				i2c->q.ph = PRT_I2C_PH_WR;
+			}
+			break;
+
+		// Write data done
+		case PRT_I2C_PH_WR :
+			// No acknowledge
+			if (!(i2c->dev->sta & PRT_I2C_STA_ACK))
+				i2c->q.res = PRT_I2C_TRX_NACK;
+
+			// Write next data
+			else if (i2c->q.idx < trx->wr_len)
+			{
+				i2c->dev->wr_dat = trx->wr_dat[i2c->q.idx++];
+				cmd = PRT_I2C_CTL_WR;
+			}
+
+			// Repeated start for the read part
+			else if (trx->type == PRT_I2C_TRX_WR_RD)
+			{
+				i2c->q.rd_part = true;
+				cmd = PRT_I2C_CTL_STR;
+				i2c->q.ph = PRT_I2C_PH_STR;
+			}
+			break;
+
+		// Read data done
+		case PRT_I2C_PH_RD :
+			trx->rd_dat[i2c->q.idx++] = i2c->dev->rd_dat;
+
+			// Read next data
+			// Acknowledge all data, except the last data
+			if (i2c->q.idx < trx->rd_len)
+			{
+				cmd = PRT_I2C_CTL_RD;
+				if (i2c->q.idx < (trx->rd_len - 1))
+					cmd |= PRT_I2C_CTL_ACK;
+			}
+			break;
+
+		// Stop condition done
+		default :
+			prt_i2c_q_done (i2c, i2c->q.res);
+			return;
+	}
+
+	// Stop condition
+	if (cmd == PRT_I2C_CTL_STP)
+		i2c->q.ph = PRT_I2C_PH_STP;
+
+	// Issue command
+	i2c->dev->ctl = i2c->ctl | cmd;
+}
+
+// Queue done
+// Completes the transaction on the bus and starts the next transaction
+void prt_i2c_q_done (prt_i2c_ds_struct *i2c, prt_i2c_trx_sta_type sta)
+{
+	// Set status
+	i2c->q.trx[i2c->q.rd & (PRT_I2C_Q_SIZE - 1)].sta = sta;
+
+	// Next transaction
+	i2c->q.rd++;
+
+	if (prt_i2c_is_busy (i2c))
+		prt_i2c_q_str (i2c);
+
+	// Disable device
+	else
+		i2c->dev->ctl = 0;
+}
+
+/*
+	Command sequencer
+	The sequencer executes a list of commands from the memory in the peripheral.
+	The CPU is free while the list is on the bus, and gets a single interrupt when the list is done.
+	The read data is stored in the read buffer of the peripheral.
+*/
+
+// Set sequencer
+// Older peripherals don't have a sequencer. 
+// This function checks the sequencer address register and returns fail when the sequencer is not available.
+prt_sta_type prt_i2c_set_seq (prt_i2c_ds_struct *i2c, bool en)
+{
+	// Wait for the queued transactions and the sequencer
+	while (prt_i2c_is_busy (i2c) || prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
+	i2c->seq.en = false;
+
+	if (en)
+	{
+		// Check address register
+		i2c->dev->seq_adr = 0x155;
+
+		if (i2c->dev->seq_adr != 0x155)
+			return PRT_STA_FAIL;
+
+		i2c->seq.en = true;
+	}
+
+	// Clear list
+	prt_i2c_seq_clr (i2c);
+
+	return PRT_STA_OK;
+}
+
+// Sequencer busy
+bool prt_i2c_seq_is_busy (prt_i2c_ds_struct *i2c)
+{
+	if (i2c->seq.sta == PRT_I2C_TRX_BUSY)
+		return true;
+	else
+		return false;
+}
+
+// Sequencer clear
+// Starts a new list
+void prt_i2c_seq_clr (prt_i2c_ds_struct *i2c)
+{
+	// Wait for the sequencer
+	while (prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
+	// The address increments after every command
+	i2c->dev->seq_adr = 0;
+	i2c->seq.len = 0;
+}
+
+// Sequencer add
+// Adds a command to the list.
+// The last location is kept for the end of list command.
+prt_sta_type prt_i2c_seq_add (prt_i2c_ds_struct *i2c, uint16_t cmd)
+{
+	if (i2c->seq.len >= (PRT_I2C_SEQ_MAX - 1))
+		return PRT_STA_FAIL;
+
+	i2c->dev->seq_dat = cmd;
+	i2c->seq.len++;
+
+	return PRT_STA_OK;
+}
+
+// Sequencer free
+// Returns the number of commands that can be added to the list
+uint16_t prt_i2c_seq_free (prt_i2c_ds_struct *i2c)
+{
+	return (PRT_I2C_SEQ_MAX - 1) - i2c->seq.len;
+}
+
+// Sequencer run
+// Ends the list and starts the sequencer.
+// The completion is handled by the interrupt handler or by prt_i2c_poll.
+prt_sta_type prt_i2c_seq_run (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	uint32_t ctl;
+
+	if (!i2c->seq.en || prt_i2c_seq_is_busy (i2c))
+		return PRT_STA_FAIL;
+
+	// Wait for the queued transactions
+	while (prt_i2c_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
+	// End of list
+	i2c->dev->seq_dat = PRT_I2C_SEQ_END;
+
+	ctl = prt_i2c_q_lock (i2c);
+
+	// Deadline
+	if (i2c->tmr != 0)
+		i2c->seq.dl = prt_tmr_get_ts (i2c->tmr) + PRT_I2C_SEQ_TIMEOUT;
+
+	i2c->seq.sta = PRT_I2C_TRX_BUSY;
+
+	// Clear done bit
+	i2c->dev->sta = PRT_I2C_STA_SEQ_DONE;
+
+	// Start
+	i2c->dev->ctl = i2c->ctl | PRT_I2C_CTL_SEQ;
+
+	prt_i2c_q_unlock (i2c, ctl);
+
+	return PRT_STA_OK;
+}
+
+// Sequencer wait
+// This function is blocking
+prt_i2c_trx_sta_type prt_i2c_seq_wait (prt_i2c_ds_struct *i2c)
+{
+	while (prt_i2c_seq_is_busy (i2c))
+		prt_i2c_poll (i2c);
+
+	return i2c->seq.sta;
+}
+
+// Sequencer read
+// Reads the read buffer from the start
+void prt_i2c_seq_rd (prt_i2c_ds_struct *i2c, uint8_t *dat, uint16_t len)
+{
+	// The address increments after every read
+	i2c->dev->seq_adr = 0;
+
+	for (uint16_t i = 0; i < len; i++)
+		dat[i] = i2c->dev->seq_dat;
+}
+
+// Sequencer done
+void prt_i2c_seq_done (prt_i2c_ds_struct *i2c)
+{
+	// Status
+	if (i2c->dev->sta & PRT_I2C_STA_SEQ_NACK)
+		i2c->seq.sta = PRT_I2C_TRX_NACK;
+	else
+		i2c->seq.sta = PRT_I2C_TRX_OK;
+
+	// Clear done bit
+	i2c->dev->sta = PRT_I2C_STA_SEQ_DONE;
+
+	// Disable device
+	i2c->dev->ctl = 0;
 }
@@ -10,6 +10,9 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Increased data buffer for burst writes
+    v1.2 - Added interrupt driven transaction queue
+    v1.3 - Added command sequencer
 
     License
     =======
@@ -29,6 +32,103 @@
 
 // Includes
 #include <stdbool.h>
+#include "prt_tmr.h"
+
+// Data buffer length
+// This is the largest transfer, including any register offset bytes.
+#define PRT_I2C_DAT_MAX       64
+
+// Transaction queue size
+// Must be a power of two
+#define PRT_I2C_Q_SIZE        8
+
+// Transaction data length
+// Maximum number of bytes in the write and read part of a queued transaction.
+#define PRT_I2C_TRX_DAT_MAX   16
+
+// Transaction time out (us)
+#define PRT_I2C_TRX_DEF_TIMEOUT   10000
+
+// Sequencer
+// The command memory holds 1024 commands, including the end of list command.
+// The read buffer holds 256 bytes.
+#define PRT_I2C_SEQ_MAX       1024
+#define PRT_I2C_SEQ_BUF_MAX   256
+
+// Sequencer time out (us)
+#define PRT_I2C_SEQ_TIMEOUT   100000
+
+// Enum transaction type
+typedef enum {
+  PRT_I2C_TRX_WR,       // Write
+  PRT_I2C_TRX_RD,       // Read
+  PRT_I2C_TRX_WR_RD     // Write, repeated start and read
+} prt_i2c_trx_type;
+
+// Enum transaction status
+typedef enum {
+  PRT_I2C_TRX_IDLE,     // No transaction
+  PRT_I2C_TRX_BUSY,     // Queued or on the bus
+  PRT_I2C_TRX_OK,       // Completed
+  PRT_I2C_TRX_NACK,     // Slave didn't acknowledge
+  PRT_I2C_TRX_TIMEOUT   // Not completed before the deadline
+} prt_i2c_trx_sta_type;
+
+// Enum transaction phase
+typedef enum {
+  PRT_I2C_PH_STR,       // Start condition
+  PRT_I2C_PH_ADR,       // Slave address
+  PRT_I2C_PH_WR,        // Write data
+  PRT_I2C_PH_RD,        // Read data
+  PRT_I2C_PH_STP        // Stop condition
+} prt_i2c_ph_type;
+
+// Transaction handle
+// Zero is never a valid handle
+typedef uint8_t prt_i2c_trx_hndl;
+
+// Typedef transaction callback
+struct prt_i2c_trx_struct;
+typedef void (*prt_i2c_trx_cb)(struct prt_i2c_trx_struct *trx);
+
+// Transaction structure
+typedef struct prt_i2c_trx_struct {
+  volatile prt_i2c_trx_sta_type sta;    // Status
+  prt_i2c_trx_hndl  hndl;               // Handle
+  prt_i2c_trx_type  type;               // Type
+  uint8_t   slave;                      // Slave address
+  uint8_t   wr_dat[PRT_I2C_TRX_DAT_MAX];  // Write data
+  uint8_t   wr_len;                     // Write length
+  uint8_t   rd_dat[PRT_I2C_TRX_DAT_MAX];  // Read data
+  uint8_t   rd_len;                     // Read length
+  uint32_t  timeout;                    // Time out (us)
+  uint32_t  dl;                         // Deadline (timer timestamp)
+  prt_i2c_trx_cb cb;                    // Completion callback
+  void      *ref;                       // Callback reference
+} prt_i2c_trx_struct;
+
+// Queue structure
+// The transactions are executed in order from the ready interrupt.
+// The slots of completed transactions stay valid until they are reused.
+typedef struct {
+  prt_i2c_trx_struct trx[PRT_I2C_Q_SIZE];   // Transactions
+  volatile uint8_t  wr;                 // Write pointer (next free slot)
+  volatile uint8_t  rd;                 // Read pointer (transaction on the bus)
+  volatile uint8_t  cb;                 // Callback pointer (next completion to report)
+  prt_i2c_trx_hndl  hndl;               // Last handle
+  volatile prt_i2c_ph_type ph;          // Phase
+  uint8_t   idx;                        // Byte index
+  bool      rd_part;                    // The read part is on the bus
+  prt_i2c_trx_sta_type res;             // Result, reported after the stop condition
+} prt_i2c_q_struct;
+
+// Sequencer structure
+typedef struct {
+  bool      en;                         // Enable
+  uint16_t  len;                        // Number of commands in the list
+  uint32_t  dl;                         // Deadline (timer timestamp)
+  volatile prt_i2c_trx_sta_type sta;    // Status
+} prt_i2c_seq_struct;
 
 // Device structure
 typedef struct {
@@ -37,15 +137,21 @@ typedef struct {
   uint32_t beat; 		  // Beat
   uint32_t wr_dat; 		// Write data
   uint32_t rd_dat; 		// Read data
+  uint32_t seq_adr;   // Sequencer address
+  uint32_t seq_dat;   // Sequencer data
 } prt_i2c_dev_struct;
 
 // Data structure
 typedef struct {
   volatile  prt_i2c_dev_struct *dev;
   uint8_t   slave;
-  uint8_t   dat[16];
+  uint8_t   dat[PRT_I2C_DAT_MAX];
   uint8_t   len;
   bool      no_stop;
+  prt_tmr_ds_struct *tmr;         // Timer
+  uint32_t  ctl;                  // Control bits for the queued transactions
+  prt_i2c_q_struct q;             // Transaction queue
+  prt_i2c_seq_struct seq;         // Command sequencer
 } prt_i2c_ds_struct;
 
 // Defines
@@ -57,14 +163,56 @@ typedef struct {
 #define PRT_I2C_CTL_ACK 	    (1<<5)
 #define PRT_I2C_CTL_DIA       (1<<6)
 #define PRT_I2C_CTL_TENTIVA   (1<<7)
+#define PRT_I2C_CTL_IE        (1<<8)
+#define PRT_I2C_CTL_SEQ       (1<<9)
 
 #define PRT_I2C_STA_BUSY	    (1<<0)
 #define PRT_I2C_STA_RDY 	    (1<<1)
 #define PRT_I2C_STA_ACK 	    (1<<2)
 #define PRT_I2C_STA_BUS       (1<<3)
+#define PRT_I2C_STA_SEQ_BUSY  (1<<4)
+#define PRT_I2C_STA_SEQ_DONE  (1<<5)
+#define PRT_I2C_STA_SEQ_NACK  (1<<6)
+
+// Sequencer commands
+#define PRT_I2C_SEQ_END       (0<<12)   // End of list
+#define PRT_I2C_SEQ_STR       (1<<12)   // Start condition
+#define PRT_I2C_SEQ_WR        (2<<12)   // Write, data in bits [7:0]
+#define PRT_I2C_SEQ_RD        (3<<12)   // Read
+#define PRT_I2C_SEQ_STP       (4<<12)   // Stop condition
+#define PRT_I2C_SEQ_DLY       (5<<12)   // Delay, bits [11:0] times 16 beats
+#define PRT_I2C_SEQ_ACK       (1<<8)    // Acknowledge the read data
 
 // Prototypes
 void prt_i2c_init (prt_i2c_ds_struct *i2c, uint32_t base, uint32_t beat);
 prt_sta_type prt_i2c_wr (prt_i2c_ds_struct *i2c);
 prt_sta_type prt_i2c_rd (prt_i2c_ds_struct *i2c);
 prt_sta_type prt_i2c_dia (prt_i2c_ds_struct *i2c, bool dia, bool tentiva);
+
+// Transaction queue
+void prt_i2c_set_tmr (prt_i2c_ds_struct *i2c, prt_tmr_ds_struct *tmr);
+void prt_i2c_set_irq (prt_i2c_ds_struct *i2c, bool en);
+prt_i2c_trx_hndl prt_i2c_req (prt_i2c_ds_struct *i2c, prt_i2c_trx_type type, uint8_t slave, uint8_t *wr_dat, uint8_t wr_len, uint8_t rd_len, uint32_t timeout, prt_i2c_trx_cb cb, void *ref);
+prt_i2c_trx_struct *prt_i2c_get_trx (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl);
+prt_i2c_trx_sta_type prt_i2c_get_sta (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl);
+prt_i2c_trx_sta_type prt_i2c_wait (prt_i2c_ds_struct *i2c, prt_i2c_trx_hndl hndl);
+bool prt_i2c_is_busy (prt_i2c_ds_struct *i2c);
+void prt_i2c_poll (prt_i2c_ds_struct *i2c);
+void prt_i2c_irq_handler (prt_i2c_ds_struct *i2c);
+uint32_t prt_i2c_q_lock (prt_i2c_ds_struct *i2c);
+void prt_i2c_q_unlock (prt_i2c_ds_struct *i2c, uint32_t ctl);
+void prt_i2c_q_cb_exec (prt_i2c_ds_struct *i2c);
+void prt_i2c_q_str (prt_i2c_ds_struct *i2c);
+void prt_i2c_q_step (prt_i2c_ds_struct *i2c);
+void prt_i2c_q_done (prt_i2c_ds_struct *i2c, prt_i2c_trx_sta_type sta);
+
+// Command sequencer
+prt_sta_type prt_i2c_set_seq (prt_i2c_ds_struct *i2c, bool en);
+bool prt_i2c_seq_is_busy (prt_i2c_ds_struct *i2c);
+void prt_i2c_seq_clr (prt_i2c_ds_struct *i2c);
+prt_sta_type prt_i2c_seq_add (prt_i2c_ds_struct *i2c, uint16_t cmd);
+uint16_t prt_i2c_seq_free (prt_i2c_ds_struct *i2c);
+prt_sta_type prt_i2c_seq_run (prt_i2c_ds_struct *i2c);
+prt_i2c_trx_sta_type prt_i2c_seq_wait (prt_i2c_ds_struct *i2c);
+void prt_i2c_seq_rd (prt_i2c_ds_struct *i2c, uint8_t *dat, uint16_t len);
+void prt_i2c_seq_done (prt_i2c_ds_struct *i2c);
@@ -11,6 +11,8 @@
     =======
     v1.0 - Initial release
 	v1.1 - Added interrupt handler define
+	v1.2 - Added interrupt dispatch table
+	v1.3 - Added source handlers
 
     License
     =======
@@ -31,6 +33,9 @@
 #include "prt_dp_drv.h"
 #include "prt_irq.h"
 
+// Data structure
+static prt_irq_ds_struct irq;
+
 // Initialize
 void prt_irq_init (void)
 {
@@ -65,17 +70,67 @@ void prt_irq_init (void)
 		);
 }
 
+// Register
+// Adds a DP instance to the dispatch table
+prt_sta_type prt_irq_reg (prt_u8 src, prt_dp_ds_struct *dp)
+{
+	if (src >= PRT_IRQ_SRC_MAX)
+		return PRT_STA_FAIL;
+
+	// Set the instance before the source is enabled,
+	// the interrupt handler might already be running
+	irq.dp[src] = dp;
+	irq.cb[src] = 0;
+	irq.msk |= (1 << src);
+
+	return PRT_STA_OK;
+}
+
+// Register handler
+// Adds a source handler to the dispatch table.
+// This is used for the peripherals without a DP instance.
+prt_sta_type prt_irq_reg_cb (prt_u8 src, prt_irq_src_cb cb)
+{
+	if (src >= PRT_IRQ_SRC_MAX)
+		return PRT_STA_FAIL;
+
+	// Set the handler before the source is enabled
+	irq.cb[src] = cb;
+	irq.msk |= (1 << src);
+
+	return PRT_STA_OK;
+}
+
+// Set pending callback
+// The callback returns the pending sources. 
+// Without callback all registered sources are serviced.
+void prt_irq_set_pnd (prt_irq_pnd_cb cb)
+{
+	irq.pnd = cb;
+}
+
 // Interrupt Handler
 void prt_irq_handler (void)
 {
-	// DPTX interrupt handler
-	#ifdef PRT_IRQ_DPTX
-		prt_dp_irq_handler (&dptx);
-	#endif
-
-	// DPRX interrupt handler
-	#ifdef PRT_IRQ_DPRX
-		prt_dp_irq_handler (&dprx);
-	#endif
-}
+	// Variables
+	prt_u32 pnd;
 
+	// Pending sources
+	if (irq.pnd)
+		pnd = irq.pnd () & irq.msk;
+	else
+		pnd = irq.msk;
+
+	// Service the pending sources
+	for (prt_u8 src = 0; pnd; src++)
+	{
+		if (pnd & 1)
+		{
+			if (irq.cb[src])
+				irq.cb[src] ();
+			else
+				prt_dp_irq_handler (irq.dp[src]);
+		}
+		pnd >>= 1;
+	}
+}
@@ -10,6 +10,8 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added interrupt dispatch table
+    v1.2 - Added source handlers
 
     License
     =======
@@ -27,13 +29,30 @@
 
 #pragma once
 
-// The DP data structures are defined at main
-extern prt_dp_ds_struct dptx;
-extern prt_dp_ds_struct dprx;
+// Maximum number of interrupt sources
+#define PRT_IRQ_SRC_MAX 	8
 
 #define PRT_IRQ_MSTATUS_MIE 	(1 << 3)
 #define PRT_IRQ_MIE_MEIE 	    (1 << 11)
 
+// Pending callback
+// Returns the mask of the sources with a pending interrupt
+typedef prt_u32 (*prt_irq_pnd_cb)(void);
+
+// Source handler
+typedef void (*prt_irq_src_cb)(void);
+
+// Data structure
+typedef struct {
+	prt_dp_ds_struct 	*dp[PRT_IRQ_SRC_MAX];	// Registered DP instances
+	prt_irq_src_cb 		cb[PRT_IRQ_SRC_MAX];	// Registered source handlers
+	volatile prt_u32 	msk;					// Registered sources mask
+	prt_irq_pnd_cb 		pnd;					// Pending callback
+} prt_irq_ds_struct;
+
 // Prototpyes
 void prt_irq_init (void);
+prt_sta_type prt_irq_reg (prt_u8 src, prt_dp_ds_struct *dp);
+prt_sta_type prt_irq_reg_cb (prt_u8 src, prt_irq_src_cb cb);
+void prt_irq_set_pnd (prt_irq_pnd_cb cb);
 void prt_irq_handler (void) __attribute__ ((interrupt)) ;
@@ -0,0 +1,133 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Profiler
+    The profiler records named phases in a fixed table.
+    The CPU has no cycle counter, so the phases are timed with the system timer (us).
+
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+// Includes
+#include <stdint.h>
+#include "prt_types.h"
+#include "prt_tmr.h"
+#include "prt_printf.h"
+#include "prt_dp_drv.h"
+#include "prt_prf.h"
+
+/*
+  Init
+  The origin is the reference for all marker offsets
+  The CPU clock (Hz) converts the timer microseconds into CPU cycles
+*/
+void prt_prf_init (prt_prf_ds_struct *prf, prt_tmr_ds_struct *tmr, prt_u32 clk)
+{
+  // Timer
+  prf->tmr = tmr;
+
+  // CPU clock in MHz
+  prf->clk = prt_dp_div (clk, 1000000);
+
+  // Origin
+  prf->org = prt_tmr_get_ts (tmr);
+
+  // Clear markers
+  prf->cnt = 0;
+}
+
+/*
+  Start marker
+  Returns the marker id or PRT_PRF_MRK_NONE when the table is full
+*/
+prt_u8 prt_prf_str (prt_prf_ds_struct *prf, const char *name)
+{
+  // Variables
+  prt_u8 id;
+
+  // Table full
+  if (prf->cnt == PRT_PRF_MRK_MAX)
+    return PRT_PRF_MRK_NONE;
+
+  // Allocate marker
+  id = prf->cnt++;
+
+  // Set marker
+  prf->mrk[id].name = name;
+  prf->mrk[id].dur = 0;
+  prf->mrk[id].run = PRT_TRUE;
+  prf->mrk[id].str = prt_tmr_get_ts (prf->tmr);
+
+  return id;
+}
+
+/*
+  Stop marker
+  Only the first stop is recorded
+*/
+void prt_prf_stp (prt_prf_ds_struct *prf, prt_u8 id)
+{
+  // Valid running marker
+  if ((id < prf->cnt) && prf->mrk[id].run)
+  {
+    prf->mrk[id].dur = prt_tmr_get_ts (prf->tmr) - prf->mrk[id].str;
+    prf->mrk[id].run = PRT_FALSE;
+  }
+}
+
+/*
+  Get duration
+  Returns the marker duration in us
+*/
+prt_u32 prt_prf_get_dur (prt_prf_ds_struct *prf, prt_u8 id)
+{
+  if (id < prf->cnt)
+    return prf->mrk[id].dur;
+  else
+    return 0;
+}
+
+/*
+  Dump
+  Prints the offset from the origin, the duration and the cycles of every marker
+*/
+void prt_prf_dump (prt_prf_ds_struct *prf)
+{
+  // Variables
+  prt_prf_mrk_struct *mrk;
+
+  prt_printf ("marker\t\toffset (us)\tduration (us)\tcycles\n");
+
+  for (prt_u8 i = 0; i < prf->cnt; i++)
+  {
+    mrk = &prf->mrk[i];
+
+    prt_printf ("%s\t\t%d\t\t", mrk->name, mrk->str - prf->org);
+
+    // Still running
+    if (mrk->run)
+      prt_printf ("-\t\t-\n");
+    else
+      prt_printf ("%d\t\t%d\n", mrk->dur, prt_dp_mul (mrk->dur, prf->clk));
+  }
+}
@@ -0,0 +1,58 @@
+/*
+     __        __   __   ___ ___ ___  __  
+    |__)  /\  |__) |__) |__   |   |  /  \ 
+    |    /~~\ |  \ |  \ |___  |   |  \__/ 
+
+
+    Module: Profiler Header
+    (c) 2025 by Parretto B.V.
+
+    History
+    =======
+    v1.0 - Initial release
+
+    License
+    =======
+    This License will apply to the use of the IP-core (as defined in the License). 
+    Please read the License carefully so that you know what your rights and obligations are when using the IP-core.
+    The acceptance of this License constitutes a valid and binding agreement between Parretto and you for the use of the IP-core. 
+    If you download and/or make any use of the IP-core you agree to be bound by this License. 
+    The License is available for download and print at www.parretto.com/license.html
+    Parretto grants you, as the Licensee, a free, non-exclusive, non-transferable, limited right to use the IP-core 
+    solely for internal business purposes for the term and conditions of the License. 
+    You are also allowed to create Modifications for internal business purposes, but explicitly only under the conditions of art. 3.2.
+    You are, however, obliged to pay the License Fees to Parretto for the use of the IP-core, or any Modification, in, or embodied in, 
+    a physical or non-tangible product or service that has substantial commercial, industrial or non-consumer uses. 
+*/
+
+#pragma once
+
+// Maximum number of markers
+#define PRT_PRF_MRK_MAX   16
+
+// Invalid marker
+#define PRT_PRF_MRK_NONE  0xff
+
+// Marker structure
+typedef struct {
+  const char *name;   // Name
+  prt_u32 str;        // Start timestamp
+  prt_u32 dur;        // Duration in us
+  prt_bool run;       // Running
+} prt_prf_mrk_struct;
+
+// Data structure
+typedef struct {
+  prt_tmr_ds_struct *tmr;                   // Timer
+  prt_u32 clk;                              // CPU clock in MHz
+  prt_u32 org;                              // Origin timestamp
+  prt_u8 cnt;                               // Number of markers
+  prt_prf_mrk_struct mrk[PRT_PRF_MRK_MAX];  // Markers
+} prt_prf_ds_struct;
+
+// Prototypes
+void prt_prf_init (prt_prf_ds_struct *prf, prt_tmr_ds_struct *tmr, prt_u32 clk);
+prt_u8 prt_prf_str (prt_prf_ds_struct *prf, const char *name);
+void prt_prf_stp (prt_prf_ds_struct *prf, prt_u8 id);
+prt_u32 prt_prf_get_dur (prt_prf_ds_struct *prf, prt_u8 id);
+void prt_prf_dump (prt_prf_ds_struct *prf);
@@ -10,6 +10,10 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added burst writes
+    v1.2 - Added configuration differences
+    v1.3 - Added run-time register reload
+    v1.4 - Added sequencer load
 
     License
     =======
@@ -141,25 +145,271 @@ prt_sta_type prt_rc22504a_wr (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t of
 	return sta;
 }
 
+// Burst write
+// This function writes a run of consecutive registers in a single transfer.
+// The device increments the offset after every data byte.
+prt_sta_type prt_rc22504a_burst (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config)
+{
+	// Variables
+	prt_sta_type sta;
+
+	// Slave
+	i2c->slave = slave;
+
+	// Offset MSB
+	i2c->dat[0] = config->offset >> 8;
+	
+	// Offset LSB
+	i2c->dat[1] = config->offset & 0xff;
+
+	// Data
+	for (uint16_t i = 0; i < length; i++)
+	{
+		i2c->dat[2 + i] = config->value;
+		config++;
+	}
+
+	// Length
+	i2c->len = length + 2;
+
+	// Write
+	sta = prt_i2c_wr (i2c);
+
+	// Return
+	return sta;
+}
+
 // Config
 prt_sta_type prt_rc22504a_cfg (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config)
 {
 	// Variables
 	prt_sta_type sta;
-	uint8_t dat;
-	
+
 	// Load configuration
-	for (uint32_t i = 0; i < length; i++)
+	sta = prt_rc22504a_load (i2c, slave, length, config);
+
+	// APLL re-initialization
+	sta = prt_rc22504a_apll_reinit (i2c, slave);
+
+	return sta;
+}
+
+// Load registers
+// The registers are split into runs of consecutive offsets.
+// Every run is loaded with burst writes.
+// When the I2C sequencer is enabled, the runs are loaded by the sequencer.
+prt_sta_type prt_rc22504a_load (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config)
+{
+	// Variables
+	prt_sta_type sta;
+	uint16_t run;
+	uint32_t offset;
+	
+	// Sequencer
+	if (i2c->seq.en)
+		return prt_rc22504a_seq_load (i2c, slave, length, config);
+
+	// Load registers
+	sta = PRT_STA_OK;
+	while (length > 0)
 	{
-		sta = prt_rc22504a_wr (i2c, slave, config->offset, config->value);
+		// Find the end of the run
+		offset = config->offset;
+		run = 1;
+		while ((run < length) && (run < PRT_RC22504A_BURST_MAX) && (config[run].offset == (offset + run)) 
+			&& (((offset + run) & (PRT_RC22504A_PAGE_SIZE - 1)) != 0))
+		{
+			run++;
+		}
+
+		// Write run
+		sta = prt_rc22504a_burst (i2c, slave, run, config);
 
 		if (sta != PRT_STA_OK)
 		{
 			break;
 		}
-		config++;
+		config += run;
+		length -= run;
+	}
+
+	return sta;
+}
+
+// Sequencer load
+// Every run of consecutive offsets is a single transfer in the command list.
+// A run takes five commands (start, slave address, two offset bytes and stop) plus one command per register.
+// The runs don't have the burst length limit, only the page limit.
+// When the list is full, it is executed and a new list is started.
+prt_sta_type prt_rc22504a_seq_load (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config)
+{
+	// Variables
+	prt_sta_type sta;
+	uint16_t run;
+	uint32_t offset;
+
+	// New list
+	prt_i2c_seq_clr (i2c);
+
+	sta = PRT_STA_OK;
+	while (length > 0)
+	{
+		// Find the end of the run
+		offset = config->offset;
+		run = 1;
+		while ((run < length) && (config[run].offset == (offset + run)) 
+			&& (((offset + run) & (PRT_RC22504A_PAGE_SIZE - 1)) != 0))
+		{
+			run++;
+		}
+
+		// Execute the list when the run doesn't fit
+		if (prt_i2c_seq_free (i2c) < (run + 5))
+		{
+			sta = prt_rc22504a_seq_exe (i2c);
+
+			if (sta != PRT_STA_OK)
+				return sta;
+		}
+
+		// Start condition and slave address
+		prt_i2c_seq_add (i2c, PRT_I2C_SEQ_STR);
+		prt_i2c_seq_add (i2c, PRT_I2C_SEQ_WR | (slave << 1));
+
+		// Offset
+		prt_i2c_seq_add (i2c, PRT_I2C_SEQ_WR | (offset >> 8));
+		prt_i2c_seq_add (i2c, PRT_I2C_SEQ_WR | (offset & 0xff));
+
+		// Data
+		for (uint16_t i = 0; i < run; i++)
+			prt_i2c_seq_add (i2c, PRT_I2C_SEQ_WR | config[i].value);
+
+		// Stop condition
+		prt_i2c_seq_add (i2c, PRT_I2C_SEQ_STP);
+
+		config += run;
+		length -= run;
 	}
 
+	// Execute the remaining list
+	if (i2c->seq.len > 0)
+		sta = prt_rc22504a_seq_exe (i2c);
+
+	return sta;
+}
+
+// Sequencer execute
+// Runs the command list, waits for completion and starts a new list
+prt_sta_type prt_rc22504a_seq_exe (prt_i2c_ds_struct *i2c)
+{
+	// Variables
+	prt_sta_type sta;
+
+	sta = prt_i2c_seq_run (i2c);
+
+	if (sta == PRT_STA_OK)
+	{
+		if (prt_i2c_seq_wait (i2c) != PRT_I2C_TRX_OK)
+			sta = PRT_STA_FAIL;
+	}
+
+	// New list
+	prt_i2c_seq_clr (i2c);
+
+	return sta;
+}
+
+// Reload run-time registers
+// The driver changes the DCO word and the output dividers and drivers at run time.
+// This function reloads these registers from a configuration.
+prt_sta_type prt_rc22504a_rld (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config)
+{
+	// Variables
+	prt_sta_type sta;
+	uint16_t run;
+
+	sta = PRT_STA_OK;
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		// DCO word
+		if (config[i].offset == PRT_RC22504A_MISC_WRITE_FREQ)
+			run = PRT_RC22504A_MISC_WRITE_FREQ_LEN;
+
+		// Output dividers and drivers
+		else if (config[i].offset == PRT_RC22504A_ODRV_BASE)
+			run = PRT_RC22504A_ODRV_LEN;
+
+		else
+			continue;
+
+		// The run ends at the end of the configuration
+		if (run > (length - i))
+			run = length - i;
+
+		sta = prt_rc22504a_load (i2c, slave, run, &config[i]);
+
+		if (sta != PRT_STA_OK)
+			break;
+	}
+
+	return sta;
+}
+
+// Config differences
+// This function switches from another configuration. 
+// First the run-time registers are reloaded, then only the listed registers of the configuration are loaded.
+// The list holds table indices. Consecutive registers are loaded with burst writes.
+prt_sta_type prt_rc22504a_cfg_dif (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t cfg_len, prt_rc22504a_reg_struct *config, uint16_t length, const uint16_t *idx)
+{
+	// Variables
+	prt_sta_type sta;
+	uint16_t run;
+	
+	// Reload run-time registers
+	sta = prt_rc22504a_rld (i2c, slave, cfg_len, config);
+
+	if (sta != PRT_STA_OK)
+	{
+		return sta;
+	}
+
+	// Load registers
+	while (length > 0)
+	{
+		// Find the end of the run
+		run = 1;
+		while ((run < length) && (run < PRT_RC22504A_BURST_MAX) && (idx[run] == (idx[0] + run)) 
+			&& (config[idx[run]].offset == (config[idx[0]].offset + run)) && ((config[idx[run]].offset & (PRT_RC22504A_PAGE_SIZE - 1)) != 0))
+		{
+			run++;
+		}
+
+		// Write run
+		sta = prt_rc22504a_burst (i2c, slave, run, &config[idx[0]]);
+
+		if (sta != PRT_STA_OK)
+		{
+			return sta;
+		}
+		idx += run;
+		length -= run;
+	}
+
+	// APLL re-initialization
+	sta = prt_rc22504a_apll_reinit (i2c, slave);
+
+	return sta;
+}
+
+// APLL re-initialization
+// The new configuration takes effect after the APLL is re-initialized.
+prt_sta_type prt_rc22504a_apll_reinit (prt_i2c_ds_struct *i2c, uint8_t slave)
+{
+	// Variables
+	prt_sta_type sta;
+	uint8_t dat;
+
 	// Read Device reset register
 	sta = prt_rc22504a_rd (i2c, slave, PRT_RC22504A_DEV_RESET, &dat);
 
@@ -10,6 +10,10 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added burst writes
+    v1.2 - Added configuration differences
+    v1.3 - Added run-time register reload
+    v1.4 - Added sequencer load
 
     License
     =======
@@ -39,6 +43,15 @@ typedef struct {
 #define PRT_RC22504A_DEV_RESET			    (0x00 + 0x0A)
 #define PRT_RC22504A_SSI_GLOBAL_CNFG		(0x140 + 0x04)
 #define PRT_RC22504A_MISC_WRITE_FREQ		(0xA0 + 0x28)
+#define PRT_RC22504A_MISC_WRITE_FREQ_LEN	4
+#define PRT_RC22504A_ODRV_BASE				(0x100)
+#define PRT_RC22504A_ODRV_LEN				0x20
+
+// Burst
+// The offset takes the first two bytes of the I2C buffer.
+// A burst doesn't cross a 256 byte register page.
+#define PRT_RC22504A_BURST_MAX				(PRT_I2C_DAT_MAX - 2)
+#define PRT_RC22504A_PAGE_SIZE				256
 
 #define PRT_RC22504A_DEV_RESET_APLL_REINT	(1 << 0)
 #define PRT_RC22504A_ODRV_EN_OUT_DIS		(1 << 1)
@@ -47,7 +60,14 @@ typedef struct {
 prt_sta_type prt_rc22504a_set_adr_mode (prt_i2c_ds_struct *i2c, uint8_t slave);
 prt_sta_type prt_rc22504a_rd (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t offset, uint8_t *dat);
 prt_sta_type prt_rc22504a_wr (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t offset, uint8_t dat);
+prt_sta_type prt_rc22504a_burst (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config);
 prt_sta_type prt_rc22504a_cfg (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config);
+prt_sta_type prt_rc22504a_load (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config);
+prt_sta_type prt_rc22504a_seq_load (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config);
+prt_sta_type prt_rc22504a_seq_exe (prt_i2c_ds_struct *i2c);
+prt_sta_type prt_rc22504a_rld (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t length, prt_rc22504a_reg_struct *config);
+prt_sta_type prt_rc22504a_cfg_dif (prt_i2c_ds_struct *i2c, uint8_t slave, uint16_t cfg_len, prt_rc22504a_reg_struct *config, uint16_t length, const uint16_t *idx);
+prt_sta_type prt_rc22504a_apll_reinit (prt_i2c_ds_struct *i2c, uint8_t slave);
 prt_sta_type prt_rc22504a_out_drv (prt_i2c_ds_struct *i2c, uint8_t slave, uint8_t out, uint8_t en);
 prt_sta_type prt_rc22504a_out_div (prt_i2c_ds_struct *i2c, uint8_t slave, uint8_t out, uint16_t div);
 prt_sta_type prt_rc22504a_dco (prt_i2c_ds_struct *i2c, uint8_t slave, uint32_t val);
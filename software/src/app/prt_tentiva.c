@@ -16,6 +16,8 @@
 	v1.4 - Added multiple clock configurations support
 	v1.5 - Added DP21TX card (TDP2004)
 	v1.6 - Added TDP1204 and TMDS1204 drivers
+	v1.7 - Added clock configuration time
+	v1.8 - Added clock configuration differences
 	
 
     License
@@ -72,8 +74,21 @@ void prt_tentiva_init (prt_tentiva_ds_struct *tentiva, prt_pio_ds_struct *pio, p
 	// Clear variables
 	tentiva->phy_freq = 0;
 	tentiva->vid_freq = 0;
-	tentiva->phy_clk_cfg = 0;
-	tentiva->vid_clk_cfg = 0;
+	tentiva->phy_clk_cfg = PRT_TENTIVA_CLK_CFG_NONE;
+	tentiva->vid_clk_cfg = PRT_TENTIVA_CLK_CFG_NONE;
+	tentiva->clk_cfg_time = 0;
+
+	// Clear configuration differences
+	for (uint8_t i = 0; i < PRT_TENTIVA_CLK_CFG_MAX; i++)
+	{
+		for (uint8_t j = 0; j < PRT_TENTIVA_CLK_CFG_MAX; j++)
+		{
+			tentiva->phy_clk_dif[i][j].idx = 0;
+			tentiva->phy_clk_dif[i][j].len = 0;
+			tentiva->vid_clk_dif[i][j].idx = 0;
+			tentiva->vid_clk_dif[i][j].len = 0;
+		}
+	}
 }
 
 // Set clock configuration
@@ -95,6 +110,28 @@ void prt_tentiva_set_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8
 	}
 }
 
+// Set clock configuration differences
+// This function is used by the application to set the registers that differ between two clock configurations.
+// The list holds table indices, so it is used in both directions.
+void prt_tentiva_set_clk_dif (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8_t cfg_a, uint8_t cfg_b, const uint16_t *idx, uint16_t len)
+{
+	// Variables
+	prt_tentiva_clk_dif_struct (*dif)[PRT_TENTIVA_CLK_CFG_MAX];
+
+	// PHY clock driver
+	if (dev == PRT_TENTIVA_PHY_DEV)
+		dif = tentiva->phy_clk_dif;
+
+	// Video clock driver
+	else
+		dif = tentiva->vid_clk_dif;
+
+	dif[cfg_a][cfg_b].idx = idx;
+	dif[cfg_a][cfg_b].len = len;
+	dif[cfg_b][cfg_a].idx = idx;
+	dif[cfg_b][cfg_a].len = len;
+}
+
 // Configuration
 // This function configures all the Tentiva components.
 prt_sta_type prt_tentiva_cfg (prt_tentiva_ds_struct *tentiva, prt_bool ignore_err)
@@ -112,6 +149,7 @@ prt_sta_type prt_tentiva_cfg (prt_tentiva_ds_struct *tentiva, prt_bool ignore_er
 	{
 		// PHY clock
 		sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_PHY_DEV, tentiva->phy_clk_cfg_len, tentiva->phy_clk_cfg_prt[0], tentiva->pio_phy_refclk_lock);
+		tentiva->phy_clk_cfg = (sta == PRT_STA_OK) ? 0 : PRT_TENTIVA_CLK_CFG_NONE;
 
 		if ((sta != PRT_STA_OK) && (ignore_err == PRT_FALSE))
 		{
@@ -121,6 +159,7 @@ prt_sta_type prt_tentiva_cfg (prt_tentiva_ds_struct *tentiva, prt_bool ignore_er
 
 		// VID clock
 		sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_VID_DEV, tentiva->vid_clk_cfg_len, tentiva->vid_clk_cfg_prt[0], tentiva->pio_vid_refclk_lock);
+		tentiva->vid_clk_cfg = (sta == PRT_STA_OK) ? 0 : PRT_TENTIVA_CLK_CFG_NONE;
 
 		if ((sta != PRT_STA_OK) && (ignore_err == PRT_FALSE))
 		{
@@ -248,6 +287,7 @@ prt_sta_type prt_tentiva_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, u
 {
 	// Variables
 	prt_sta_type sta;
+	prt_u32 ts;
 
 	/*
 		Clocking
@@ -265,7 +305,9 @@ prt_sta_type prt_tentiva_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, u
 	}	
 
 	// Configure device	
+	ts = prt_tmr_get_ts (tentiva->tmr);
 	sta = prt_rc22504a_cfg (tentiva->i2c, PRT_TENTIVA_I2C_RC22504A_ADR, clk_cfg_len, clk_cfg_prt);
+	tentiva->clk_cfg_time = prt_tmr_get_ts (tentiva->tmr) - ts;
 
 	if (sta != PRT_STA_OK)
 	{
@@ -274,10 +316,81 @@ prt_sta_type prt_tentiva_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, u
 
 	sta = prt_tentiva_get_lock (tentiva, pio_phy_lock);
 
-	if (sta != PRT_STA_OK)
+	return sta;
+}
+
+// Switch clock configuration
+// This function switches the clock generator to another stored configuration.
+// When the active configuration is known, only the differing registers are loaded.
+prt_sta_type prt_tentiva_clk_sw (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8_t cfg)
+{
+	// Variables
+	prt_sta_type sta;
+	uint8_t act;
+	prt_rc22504a_reg_struct *prt;
+	uint16_t len;
+	uint32_t lock;
+	prt_tentiva_clk_dif_struct (*dif)[PRT_TENTIVA_CLK_CFG_MAX];
+	prt_u32 ts;
+
+	// PHY clock device
+	if (dev == PRT_TENTIVA_PHY_DEV)
 	{
-		return sta;
-	}	
+		act = tentiva->phy_clk_cfg;
+		prt = tentiva->phy_clk_cfg_prt[cfg];
+		len = tentiva->phy_clk_cfg_len;
+		lock = tentiva->pio_phy_refclk_lock;
+		dif = tentiva->phy_clk_dif;
+	}
+
+	// Video clock device
+	else
+	{
+		act = tentiva->vid_clk_cfg;
+		prt = tentiva->vid_clk_cfg_prt[cfg];
+		len = tentiva->vid_clk_cfg_len;
+		lock = tentiva->pio_vid_refclk_lock;
+		dif = tentiva->vid_clk_dif;
+	}
+
+	// Full configuration
+	// The active configuration is unknown or there are no differences for this pair
+	if ((act >= PRT_TENTIVA_CLK_CFG_MAX) || (dif[act][cfg].idx == 0))
+	{
+		sta = prt_tentiva_clk_cfg (tentiva, dev, len, prt, lock);
+	}
+
+	// Load differences
+	else
+	{
+		// Select clock device
+		prt_tentiva_sel_dev (tentiva, dev);
+
+		// Set two byte addressing mode
+		sta = prt_rc22504a_set_adr_mode (tentiva->i2c, PRT_TENTIVA_I2C_RC22504A_ADR);
+
+		if (sta == PRT_STA_OK)
+		{
+			ts = prt_tmr_get_ts (tentiva->tmr);
+			sta = prt_rc22504a_cfg_dif (tentiva->i2c, PRT_TENTIVA_I2C_RC22504A_ADR, len, prt, dif[act][cfg].len, dif[act][cfg].idx);
+			tentiva->clk_cfg_time = prt_tmr_get_ts (tentiva->tmr) - ts;
+		}
+
+		if (sta == PRT_STA_OK)
+			sta = prt_tentiva_get_lock (tentiva, lock);
+	}
+
+	// Store current configuration
+	// After a failure the next switch loads the full configuration.
+	if (sta != PRT_STA_OK)
+		cfg = PRT_TENTIVA_CLK_CFG_NONE;
+
+	if (dev == PRT_TENTIVA_PHY_DEV)
+		tentiva->phy_clk_cfg = cfg;
+	else
+		tentiva->vid_clk_cfg = cfg;
+
+	return sta;
 }
 
 // Select clock device
@@ -301,6 +414,7 @@ prt_sta_type prt_tentiva_phy_cfg (prt_tentiva_ds_struct *tentiva)
 
 	// PHY clock
 	sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_PHY_DEV, tentiva->phy_clk_cfg_len, tentiva->phy_clk_cfg_prt[0], tentiva->pio_phy_refclk_lock);
+	tentiva->phy_clk_cfg = (sta == PRT_STA_OK) ? 0 : PRT_TENTIVA_CLK_CFG_NONE;
 
 	return sta;
 }
@@ -341,10 +455,7 @@ prt_sta_type prt_tentiva_set_phy_freq (prt_tentiva_ds_struct *tentiva, uint32_t
 			if (tentiva->phy_freq == 270000)
 			{
 				// PHY clock
-				sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_PHY_DEV, tentiva->phy_clk_cfg_len, tentiva->phy_clk_cfg_prt[1], tentiva->pio_phy_refclk_lock);
-			
-				// Store current configuration
-				tentiva->phy_clk_cfg = 1;
+				sta = prt_tentiva_clk_sw (tentiva, PRT_TENTIVA_PHY_DEV, 1);
 			}
 
 			else
@@ -354,10 +465,7 @@ prt_sta_type prt_tentiva_set_phy_freq (prt_tentiva_ds_struct *tentiva, uint32_t
 				if (tentiva->phy_clk_cfg != 0)
 				{
 					// PHY clock
-					sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_PHY_DEV, tentiva->phy_clk_cfg_len, tentiva->phy_clk_cfg_prt[0], tentiva->pio_phy_refclk_lock);
-				
-					// Store current configuration
-					tentiva->phy_clk_cfg = 0;
+					sta = prt_tentiva_clk_sw (tentiva, PRT_TENTIVA_PHY_DEV, 0);
 				}
 
 				// Select PHY clock device
@@ -389,6 +497,7 @@ prt_sta_type prt_tentiva_set_vid_freq (prt_tentiva_ds_struct *tentiva, uint32_t
 	// Variables
 	prt_sta_type sta;
 	uint16_t div;
+	uint8_t cfg;
 
 	// Store frequency
 	tentiva->vid_freq = freq;
@@ -407,36 +516,29 @@ prt_sta_type prt_tentiva_set_vid_freq (prt_tentiva_ds_struct *tentiva, uint32_t
 	else
 	{
 		// Clock 254.974 MHz
+		// This frequency uses configuration 1. 
 		if (freq == 254974)
-		{	
-			// This frequency uses configuration 1. 
-			// If this configuration isn't active, the clock generator needs to be configured.
-			if (tentiva->vid_clk_cfg != 1)
-			{
-				// VID clock
-				sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_VID_DEV, tentiva->vid_clk_cfg_len, tentiva->vid_clk_cfg_prt[1], tentiva->pio_vid_refclk_lock);
-				
-				// Store current configuration
-				tentiva->vid_clk_cfg = 1;
-			}
-		}
+			cfg = 1;
 
+		// Clock 231.036 MHz
+		// This frequency uses configuration 2. 
+		else if (freq == 231036)
+			cfg = 2;
+
+		// The other frequencies use configuration 0 and an output divider
 		else
-		{
-			// This frequency uses configuration 0. 
-			// If this configuration isn't active, the clock generator needs to be configured.
-			if (tentiva->vid_clk_cfg != 0)
-			{
-				// VID clock
-				sta = prt_tentiva_clk_cfg (tentiva, PRT_TENTIVA_VID_DEV, tentiva->vid_clk_cfg_len, tentiva->vid_clk_cfg_prt[0], tentiva->pio_vid_refclk_lock);
-				
-				// Store current configuration
-				tentiva->vid_clk_cfg = 0;
-			}
+			cfg = 0;
 
-			// Select video clock device
-			prt_tentiva_sel_dev (tentiva, PRT_TENTIVA_VID_DEV);
+		// If this configuration isn't active, the clock generator needs to be configured.
+		sta = PRT_STA_OK;
+		if (tentiva->vid_clk_cfg != cfg)
+		{
+			// VID clock
+			sta = prt_tentiva_clk_sw (tentiva, PRT_TENTIVA_VID_DEV, cfg);
+		}
 
+		if ((sta == PRT_STA_OK) && (cfg == 0))
+		{
 			// Select divider
 			switch (freq)
 			{
@@ -444,9 +546,15 @@ prt_sta_type prt_tentiva_set_vid_freq (prt_tentiva_ds_struct *tentiva, uint32_t
 				case 148500 : div = 68; break;	// 148.5 MHz
 				case 74250  : div = 136; break;	// 74.25 MHz
 				case 37125  : div = 272; break;	// 37.125 MHz
-				default : div = 544; break;								// 18.5625 MHz
+				case 18562  : div = 544; break;	// 18.5625 MHz
+				default :
+					prt_printf ("Tentiva: unsupported video clock\n");
+					return PRT_STA_FAIL;
 			}
 
+			// Select video clock device
+			prt_tentiva_sel_dev (tentiva, PRT_TENTIVA_VID_DEV);
+
 			// Set output divider
 			//sta = prt_rc22504a_out_div (tentiva->i2c, PRT_TENTIVA_I2C_RC22504A_ADR, 0, div);
 			sta = prt_rc22504a_out_div (tentiva->i2c, PRT_TENTIVA_I2C_RC22504A_ADR, 1, div);
@@ -649,6 +757,19 @@ uint8_t prt_tentiva_get_slot_id (prt_tentiva_ds_struct *tentiva, uint8_t slot)
 	return tentiva->slot_id[slot];
 }
 
+// Get clock configuration time
+// This function returns the load time (in us) of the last clock configuration.
+// The time is cleared after reading, so every configuration is reported once.
+prt_u32 prt_tentiva_get_clk_cfg_time (prt_tentiva_ds_struct *tentiva)
+{
+	// Variables
+	prt_u32 time;
+
+	time = tentiva->clk_cfg_time;
+	tentiva->clk_cfg_time = 0;
+	return time;
+}
+
 // Force ID
 // This function forces a slot identifier
 void prt_tentiva_force_slot_id (prt_tentiva_ds_struct *tentiva, uint8_t slot, uint8_t id)
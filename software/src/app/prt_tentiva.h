@@ -10,6 +10,8 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added clock configuration time
+    v1.2 - Added clock configuration differences
 
     License
     =======
@@ -30,6 +32,16 @@
 // Includes 
 #include "prt_rc22504a.h"
 
+// Clock configurations
+#define PRT_TENTIVA_CLK_CFG_MAX                 3
+#define PRT_TENTIVA_CLK_CFG_NONE                0xff
+
+// Clock configuration difference structure
+typedef struct {
+    const uint16_t *idx;                            // Table indices of the differing registers
+    prt_u16 len;                                    // Number of registers
+} prt_tentiva_clk_dif_struct;
+
 // Data structure
 typedef struct {
     // Hardware identification
@@ -42,18 +54,21 @@ typedef struct {
 	prt_tmr_ds_struct *tmr;                         // Timer
     
 	uint32_t phy_freq;			                    // PHY clock frequency (in kHz)
-    prt_rc22504a_reg_struct *phy_clk_cfg_prt[2];    // PHY clock configuration pointer
+    prt_rc22504a_reg_struct *phy_clk_cfg_prt[PRT_TENTIVA_CLK_CFG_MAX];    // PHY clock configuration pointer
     prt_u16 phy_clk_cfg_len;                        // PHY clock configuration length
+    prt_tentiva_clk_dif_struct phy_clk_dif[PRT_TENTIVA_CLK_CFG_MAX][PRT_TENTIVA_CLK_CFG_MAX];   // PHY clock configuration differences
 
 	uint32_t vid_freq;			                    // Video clock frequency (in kHz)
-    prt_rc22504a_reg_struct *vid_clk_cfg_prt[2];    // Video clock configuration pointer
+    prt_rc22504a_reg_struct *vid_clk_cfg_prt[PRT_TENTIVA_CLK_CFG_MAX];    // Video clock configuration pointer
     prt_u16 vid_clk_cfg_len;                        // Video clock configuration length
+    prt_tentiva_clk_dif_struct vid_clk_dif[PRT_TENTIVA_CLK_CFG_MAX][PRT_TENTIVA_CLK_CFG_MAX];   // Video clock configuration differences
     
     uint32_t pio_phy_refclk_lock;                    // PIO PHY reference clock lock
     uint32_t pio_vid_refclk_lock;                    // PIO VID reference clock lock
     uint32_t pio_clk_sel;                            // PIO clock select
     uint8_t phy_clk_cfg;                             // Active phy clock configuration
     uint8_t vid_clk_cfg;                             // Active video clock configuration
+    prt_u32 clk_cfg_time;                            // Last clock configuration load time (in us)
 } prt_tentiva_ds_struct;
 
 // Defines
@@ -105,13 +120,16 @@ typedef struct {
 void prt_tentiva_init (prt_tentiva_ds_struct *tentiva, prt_pio_ds_struct *pio, prt_i2c_ds_struct *i2c, prt_tmr_ds_struct *tmr, 
     uint32_t pio_phy_refclk_lock, uint32_t pio_vid_refclk_lock, uint32_t pio_clk_sel);
 void prt_tentiva_set_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8_t cfg, prt_rc22504a_reg_struct *prt, prt_u16 len);
+void prt_tentiva_set_clk_dif (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8_t cfg_a, uint8_t cfg_b, const uint16_t *idx, prt_u16 len);
 void prt_tentiva_scan (prt_tentiva_ds_struct *tentiva);
 uint8_t prt_tentiva_get_fmc_id (prt_tentiva_ds_struct *tentiva);
 bool prt_tentiva_has_sc (prt_tentiva_ds_struct *tentiva);
 uint8_t prt_tentiva_get_slot_id (prt_tentiva_ds_struct *tentiva, uint8_t slot);
+prt_u32 prt_tentiva_get_clk_cfg_time (prt_tentiva_ds_struct *tentiva);
 void prt_tentiva_force_slot_id (prt_tentiva_ds_struct *tentiva, uint8_t slot, uint8_t id);
 prt_sta_type prt_tentiva_cfg (prt_tentiva_ds_struct *tentiva, prt_bool ingore_err);
 prt_sta_type prt_tentiva_clk_cfg (prt_tentiva_ds_struct *tentiva, uint8_t dev, prt_u16 clk_cfg_len, prt_rc22504a_reg_struct *clk_cfg_prt, uint32_t pio_phy_lock);
+prt_sta_type prt_tentiva_clk_sw (prt_tentiva_ds_struct *tentiva, uint8_t dev, uint8_t cfg);
 void prt_tentiva_sel_dev (prt_tentiva_ds_struct *tentiva, uint8_t dev);
 prt_sta_type prt_tentiva_phy_cfg (prt_tentiva_ds_struct *tentiva);
 prt_sta_type prt_tentiva_set_phy_freq (prt_tentiva_ds_struct *tentiva, uint32_t freq);
@@ -10,6 +10,7 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added timestamp
 
     License
     =======
@@ -137,3 +138,33 @@ prt_bool prt_tmr_is_alrm (prt_tmr_ds_struct *tmr, prt_u8 alrm)
   }
 }
 
+/*
+  Get timestamp
+  The timer is a free running counter in us
+*/
+prt_u32 prt_tmr_get_ts (prt_tmr_ds_struct *tmr)
+{
+  return tmr->dev->tmr;
+}
+
+/*
+  This function returns true when the timestamp has expired
+  The signed difference makes the compare safe across a counter wrap
+*/
+prt_bool prt_tmr_is_exp (prt_tmr_ds_struct *tmr, prt_u32 ts)
+{
+  // Variables
+  prt_s32 dif;
+
+  dif = (prt_s32) (prt_tmr_get_ts (tmr) - ts);
+
+  if (dif >= 0)
+  {
+    return PRT_TRUE;
+  }
+
+  else
+  {
+    return PRT_FALSE;
+  }
+}
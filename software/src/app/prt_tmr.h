@@ -10,6 +10,7 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added timestamp
 
     License
     =======
@@ -58,3 +59,5 @@ void prt_tmr_init (prt_tmr_ds_struct *tmr, prt_u32 base);
 void prt_tmr_sleep (prt_tmr_ds_struct *tmr, prt_u8 alrm, prt_u32 us);
 void prt_tmr_set_alrm (prt_tmr_ds_struct *tmr, prt_u8 alrm, prt_u32 us);
 prt_bool prt_tmr_is_alrm (prt_tmr_ds_struct *tmr, prt_u8 alrm);
+prt_u32 prt_tmr_get_ts (prt_tmr_ds_struct *tmr);
+prt_bool prt_tmr_is_exp (prt_tmr_ds_struct *tmr, prt_u32 ts);
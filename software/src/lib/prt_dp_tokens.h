@@ -10,6 +10,8 @@
     History
     =======
     v1.0 - Initial release
+    v1.1 - Added training hint config
+    v1.2 - Added MST time slots config
 
     License
     =======
@@ -105,3 +107,4 @@
   #define PRT_DP_CFG_MAX_RATE          0
   #define PRT_DP_CFG_MAX_LANES         1
   #define PRT_DP_CFG_MST_CAP           2
+  #define PRT_DP_CFG_TRN_HINT          3       // Training start point (rate, lanes, voltage swing, pre-emphasis)
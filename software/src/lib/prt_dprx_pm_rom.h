@@ -1,1185 +1,595 @@
-unsigned char prt_dprx_pm_rom[] = {
-  0x6f, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x00, 0x05, 0x6f, 0x00, 0x40, 0x09,
-  0x6f, 0x00, 0x80, 0x0d, 0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x00, 0x45, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xf0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x00, 0x56, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xe0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x40, 0x5c, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xd0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x00, 0x59, 0x6f, 0x00, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x00, 0x23, 0xa0, 0x07, 0x00,
-  0x23, 0xa2, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x07, 0x03,
-  0xb7, 0x17, 0x00, 0x00, 0x93, 0x87, 0x47, 0x23, 0x03, 0xa7, 0x06, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0x13, 0x57, 0x07, 0x01, 0x63, 0x18, 0xf7, 0x00,
-  0x93, 0x07, 0x30, 0x00, 0x23, 0xa2, 0xf6, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03,
-  0x03, 0xa5, 0x07, 0x00, 0x13, 0x15, 0x05, 0x01, 0x13, 0x55, 0x05, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03,
-  0x13, 0x15, 0x25, 0x00, 0x03, 0xa7, 0x47, 0x00, 0x33, 0x65, 0xe5, 0x00,
-  0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x07, 0x03, 0x13, 0x15, 0xa5, 0x00, 0x03, 0xa7, 0x47, 0x00,
-  0x33, 0x65, 0xe5, 0x00, 0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x23, 0xac, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03,
-  0x23, 0xae, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x07, 0x03, 0x23, 0xa0, 0xa7, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x23, 0xa4, 0xb7, 0x02,
-  0x23, 0xa2, 0xa7, 0x02, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x07, 0x03, 0x03, 0xa5, 0xc7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x83, 0xa7, 0xc7, 0x00,
-  0x33, 0xf5, 0xa7, 0x00, 0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x23, 0xac, 0xa7, 0x00,
-  0x23, 0xae, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x20, 0x91, 0x00, 0xb7, 0x84, 0x00, 0x00, 0x83, 0xa7, 0x04, 0x03,
-  0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00, 0x83, 0xa7, 0x87, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8c, 0x07, 0x04, 0x13, 0x04, 0x05, 0x00,
-  0xef, 0x00, 0xc0, 0x58, 0x03, 0xa7, 0x04, 0x03, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x00, 0x03, 0x26, 0x07, 0x01, 0x83, 0xa6, 0x07, 0x00,
-  0x13, 0x05, 0x04, 0x00, 0x03, 0x24, 0x41, 0x00, 0xb3, 0xe6, 0xc6, 0x00,
-  0x23, 0xa0, 0xd7, 0x00, 0x03, 0x26, 0x47, 0x01, 0x83, 0xa6, 0x47, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x83, 0x24, 0x01, 0x00, 0xb3, 0xe6, 0xc6, 0x00,
-  0x23, 0xa2, 0xd7, 0x00, 0x93, 0x07, 0x10, 0x00, 0x23, 0x24, 0xf7, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0x00, 0xc0, 0x56, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff, 0x23, 0x22, 0x91, 0x00,
-  0xb7, 0x84, 0x00, 0x00, 0x93, 0x84, 0xc4, 0x00, 0x83, 0xa7, 0x04, 0x00,
-  0x23, 0x24, 0x81, 0x00, 0x23, 0x26, 0x11, 0x00, 0xb3, 0xf7, 0xa7, 0x00,
-  0x13, 0x04, 0x05, 0x00, 0x13, 0x05, 0x00, 0x00, 0x63, 0x86, 0x07, 0x02,
-  0x13, 0x85, 0x05, 0x00, 0x23, 0x20, 0xb1, 0x00, 0xef, 0x00, 0x40, 0x4f,
-  0x83, 0xa7, 0x04, 0x00, 0x03, 0x25, 0x01, 0x00, 0x13, 0x44, 0xf4, 0xff,
-  0x33, 0x74, 0xf4, 0x00, 0x23, 0xa0, 0x84, 0x00, 0xef, 0x00, 0x80, 0x50,
-  0x13, 0x05, 0x10, 0x00, 0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x01, 0xff, 0x23, 0x22, 0x91, 0x00, 0xb7, 0x84, 0x00, 0x00,
-  0x93, 0x84, 0xc4, 0x00, 0x83, 0xa7, 0x44, 0x00, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x26, 0x11, 0x00, 0xb3, 0xf7, 0xa7, 0x00, 0x13, 0x04, 0x05, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0x63, 0x86, 0x07, 0x02, 0x13, 0x85, 0x05, 0x00,
-  0x23, 0x20, 0xb1, 0x00, 0xef, 0x00, 0xc0, 0x48, 0x83, 0xa7, 0x44, 0x00,
-  0x03, 0x25, 0x01, 0x00, 0x13, 0x44, 0xf4, 0xff, 0x33, 0x74, 0xf4, 0x00,
-  0x23, 0xa2, 0x84, 0x00, 0xef, 0x00, 0x00, 0x4a, 0x13, 0x05, 0x10, 0x00,
-  0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x00, 0x03, 0xa7, 0x07, 0x00, 0x13, 0x45, 0xf5, 0xff,
-  0x33, 0x75, 0xe5, 0x00, 0x23, 0xa0, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x00, 0x03, 0xa7, 0x47, 0x00,
-  0x13, 0x45, 0xf5, 0xff, 0x33, 0x75, 0xe5, 0x00, 0x23, 0xa2, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x02,
-  0x13, 0x07, 0x30, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x80, 0x07, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0xc7, 0x02, 0x63, 0x1c, 0x05, 0x02, 0x23, 0xa6, 0xb7, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0x83, 0xa6, 0x07, 0x00, 0x33, 0x67, 0xd7, 0x00,
-  0x23, 0xa0, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x33, 0x85, 0xa7, 0x00, 0x23, 0x00, 0x05, 0x00, 0x83, 0x47, 0x05, 0x00,
-  0xe3, 0x8e, 0x07, 0xfe, 0x23, 0x00, 0x05, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x23, 0xa8, 0xb7, 0x00, 0x13, 0x07, 0x80, 0x00, 0x6f, 0xf0, 0xdf, 0xfc,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x02, 0x63, 0x16, 0x05, 0x02,
-  0x23, 0xa6, 0xb7, 0x00, 0x13, 0x07, 0x40, 0x00, 0x83, 0xa6, 0x07, 0x00,
-  0x33, 0x67, 0xd7, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x33, 0x05, 0xf5, 0x00, 0x23, 0x00, 0x05, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x23, 0xa8, 0xb7, 0x00, 0x13, 0x07, 0x80, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfd, 0x63, 0x0e, 0x05, 0x02, 0x93, 0x06, 0x40, 0x00,
-  0x93, 0x07, 0x80, 0x00, 0x37, 0x87, 0x00, 0x00, 0x03, 0x27, 0xc7, 0x02,
-  0x93, 0xc7, 0xf7, 0xff, 0x03, 0x26, 0x07, 0x00, 0xb3, 0xf7, 0xc7, 0x00,
-  0x23, 0x20, 0xf7, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x23, 0x22, 0xd7, 0x00, 0x33, 0x05, 0xf5, 0x00, 0x23, 0x00, 0x05, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x06, 0x20, 0x00, 0x93, 0x07, 0x40, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfc, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0xc7, 0x02,
-  0x83, 0x27, 0x47, 0x00, 0x93, 0xf6, 0x07, 0x01, 0x63, 0x8e, 0x06, 0x00,
-  0x93, 0x06, 0x00, 0x01, 0x23, 0x22, 0xd7, 0x00, 0xb7, 0x86, 0x00, 0x00,
-  0x93, 0x86, 0x06, 0x00, 0x13, 0x06, 0x10, 0x00, 0x23, 0x81, 0xc6, 0x00,
-  0x93, 0xf6, 0x27, 0x00, 0x63, 0x8c, 0x06, 0x00, 0x93, 0x06, 0x20, 0x00,
-  0x23, 0x22, 0xd7, 0x00, 0x13, 0x06, 0x10, 0x00, 0xb7, 0x86, 0x00, 0x00,
-  0x23, 0x80, 0xc6, 0x00, 0x93, 0xf7, 0x47, 0x00, 0x63, 0x8e, 0x07, 0x00,
-  0x93, 0x07, 0x40, 0x00, 0x23, 0x22, 0xf7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x80, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0xb3, 0x87, 0xa7, 0x00, 0x03, 0xc7, 0x07, 0x00, 0x13, 0x75, 0xf7, 0x0f,
-  0x63, 0x06, 0x07, 0x00, 0x23, 0x80, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x03, 0xc7, 0x27, 0x00, 0x13, 0x75, 0xf7, 0x0f, 0x63, 0x06, 0x07, 0x00,
-  0x23, 0x81, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x02, 0x13, 0x07, 0x10, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x02, 0x23, 0xa0, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x02,
-  0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x87, 0x02, 0x03, 0xa5, 0x87, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x02, 0x23, 0xa4, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x47, 0x02,
-  0x13, 0x07, 0xf0, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa2, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x47, 0x02,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x07, 0x00, 0x10, 0x23, 0xa6, 0xf6, 0x00,
-  0x13, 0x07, 0xc7, 0x6a, 0x93, 0x07, 0x00, 0x00, 0x03, 0x46, 0x17, 0x00,
-  0x63, 0xe8, 0xc7, 0x00, 0x93, 0x07, 0xf0, 0x1f, 0x23, 0xa6, 0xf6, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x33, 0x06, 0xf7, 0x00, 0x03, 0x46, 0x26, 0x00,
-  0x93, 0x87, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x13, 0x76, 0xf6, 0x0f,
-  0x23, 0xa6, 0xc6, 0x00, 0x6f, 0xf0, 0x5f, 0xfd, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x47, 0x02, 0x23, 0xaa, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa6, 0x47, 0x02, 0x93, 0x06, 0x00, 0x10,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0x27, 0x06, 0x01, 0x93, 0x87, 0x07, 0x6d,
-  0x13, 0x77, 0xf7, 0x1f, 0x63, 0x1c, 0xd7, 0x00, 0x23, 0x80, 0x07, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x93, 0x07, 0x10, 0x00, 0x23, 0x24, 0xf6, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x06, 0xf0, 0x1f, 0x63, 0x18, 0xd7, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x80, 0xe7, 0x00, 0x6f, 0xf0, 0x5f, 0xfe,
-  0x83, 0xc5, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x93, 0x86, 0x15, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x80, 0xd7, 0x00, 0xb3, 0x87, 0xb7, 0x00,
-  0x23, 0x81, 0xe7, 0x00, 0x6f, 0xf0, 0x5f, 0xfc, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x6f, 0x23, 0x86, 0x07, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x87, 0x01,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0xa0, 0xf6, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x86, 0x47, 0x6f, 0x83, 0x45, 0x56, 0x00, 0x03, 0x47, 0x46, 0x00,
-  0x03, 0x26, 0x06, 0x00, 0x93, 0x87, 0x47, 0x6f, 0x13, 0x17, 0x87, 0x00,
-  0x33, 0x67, 0xb7, 0x00, 0x63, 0x16, 0x06, 0x00, 0x37, 0x86, 0x00, 0x00,
-  0x33, 0x67, 0xc7, 0x00, 0x37, 0x06, 0x02, 0x00, 0x33, 0x67, 0xc7, 0x00,
-  0x23, 0xa4, 0xe6, 0x00, 0x37, 0x05, 0x01, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x03, 0xc6, 0x57, 0x00, 0x63, 0x6c, 0xc7, 0x00, 0x03, 0xa6, 0x07, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x63, 0x02, 0xe6, 0x08, 0x23, 0xa0, 0x06, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x83, 0xa5, 0x07, 0x00, 0x13, 0x06, 0x00, 0x00,
-  0x63, 0x9a, 0x05, 0x00, 0x03, 0xa6, 0x87, 0x00, 0x93, 0x15, 0x17, 0x00,
-  0x33, 0x06, 0xb6, 0x00, 0x03, 0x56, 0x06, 0x00, 0x83, 0xc5, 0x57, 0x00,
-  0x93, 0x85, 0xf5, 0xff, 0x63, 0x14, 0xb7, 0x00, 0x33, 0x66, 0xa6, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x23, 0xa4, 0xc6, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x6f, 0xf0, 0xdf, 0xfa, 0x03, 0xa6, 0x46, 0x00, 0x93, 0x75, 0x26, 0x00,
-  0x63, 0x96, 0x05, 0x00, 0x13, 0x76, 0x46, 0x00, 0xe3, 0x18, 0x06, 0xfe,
-  0x83, 0xa5, 0xc6, 0x00, 0x03, 0xa6, 0x87, 0x00, 0x13, 0x15, 0x17, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x33, 0x06, 0xa6, 0x00, 0x23, 0x10, 0xb6, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x03, 0xc6, 0x57, 0x00, 0xe3, 0x66, 0xc7, 0xfc,
-  0x6f, 0xf0, 0x5f, 0xf8, 0x13, 0x07, 0x00, 0x00, 0x6f, 0xf0, 0x1f, 0xff,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x01, 0x83, 0xa7, 0x47, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8a, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x6f, 0x13, 0x07, 0x10, 0x00, 0x23, 0x86, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x47, 0x01,
-  0x13, 0x07, 0x10, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x07, 0x10, 0x00, 0x33, 0x95, 0xa7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0x47, 0x01, 0x93, 0x76, 0xf5, 0x0f,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x22, 0xa7, 0x00, 0x83, 0x27, 0x47, 0x00,
-  0xb3, 0xf7, 0xf6, 0x00, 0xe3, 0x8a, 0x07, 0xfe, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0x47, 0x01, 0x93, 0x07, 0x10, 0x00,
-  0xb3, 0x97, 0xa7, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x24, 0xf7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x01,
-  0x13, 0x07, 0x30, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x70, 0xa3, 0x8e, 0x07, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0x47, 0x70,
-  0x03, 0x47, 0xd7, 0x01, 0x13, 0x06, 0x00, 0x00, 0x93, 0x87, 0x47, 0x70,
-  0x63, 0x16, 0x07, 0x00, 0x13, 0x05, 0x00, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x83, 0x26, 0xc7, 0x01, 0xa3, 0x8e, 0x07, 0x00,
-  0x03, 0xa7, 0x46, 0x00, 0x13, 0x77, 0x87, 0x00, 0xe3, 0x02, 0x07, 0xfe,
-  0x03, 0xa7, 0xc6, 0x00, 0x93, 0x55, 0x47, 0x00, 0x93, 0xf5, 0xf5, 0x00,
-  0x23, 0xa0, 0xb7, 0x00, 0x13, 0x17, 0x07, 0x01, 0xb7, 0x05, 0x0f, 0x00,
-  0x33, 0x77, 0xb7, 0x00, 0x23, 0xa4, 0xe7, 0x00, 0x03, 0xa7, 0xc6, 0x00,
-  0xb7, 0x05, 0x01, 0x00, 0x03, 0xa5, 0x87, 0x00, 0x93, 0x85, 0xf5, 0xff,
-  0x13, 0x17, 0x87, 0x00, 0x33, 0x77, 0xb7, 0x00, 0x33, 0x67, 0xa7, 0x00,
-  0x23, 0xa4, 0xe7, 0x00, 0x03, 0xa7, 0xc6, 0x00, 0x83, 0xa5, 0x87, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x33, 0x67, 0xb7, 0x00, 0x23, 0xa4, 0xe7, 0x00,
-  0x03, 0xa7, 0x46, 0x00, 0x13, 0x77, 0x07, 0x10, 0x63, 0x0e, 0x07, 0x02,
-  0x23, 0x86, 0x07, 0x00, 0x83, 0xa5, 0x07, 0x00, 0x13, 0x07, 0x80, 0x00,
-  0x63, 0x9a, 0xe5, 0x04, 0x13, 0x07, 0x00, 0x00, 0x93, 0x87, 0xd7, 0x00,
-  0x93, 0x75, 0xf7, 0x0f, 0x63, 0xfc, 0xc5, 0x04, 0x83, 0xa5, 0xc6, 0x00,
-  0x33, 0x85, 0xe7, 0x00, 0x13, 0x07, 0x17, 0x00, 0x93, 0xf5, 0xf5, 0x0f,
-  0x23, 0x00, 0xb5, 0x00, 0x6f, 0xf0, 0x5f, 0xfe, 0x03, 0xa7, 0xc6, 0x00,
-  0x13, 0x06, 0x00, 0x01, 0x13, 0x07, 0x17, 0x00, 0x93, 0x05, 0x07, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x63, 0x74, 0xe6, 0x00, 0x93, 0x05, 0x00, 0x01,
-  0x13, 0xf6, 0xf5, 0x0f, 0x23, 0x86, 0xb7, 0x00, 0x6f, 0xf0, 0x9f, 0xfa,
-  0x03, 0xa7, 0x07, 0x00, 0xe3, 0x08, 0x07, 0xfa, 0x83, 0xa5, 0x07, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0xe3, 0x80, 0xe5, 0xfa, 0x13, 0x05, 0x10, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x01,
-  0x13, 0x07, 0x00, 0x10, 0x23, 0xa4, 0x07, 0x00, 0x23, 0xa4, 0x07, 0x00,
-  0x23, 0xa4, 0x07, 0x00, 0x23, 0xa4, 0x07, 0x00, 0x23, 0xa4, 0xe7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x06, 0x47, 0x70, 0x03, 0xa6, 0x06, 0x00,
-  0x93, 0x06, 0x80, 0x00, 0x13, 0x07, 0x47, 0x70, 0x63, 0x08, 0xd6, 0x00,
-  0x03, 0x26, 0x07, 0x00, 0x93, 0x06, 0x90, 0x00, 0x63, 0x18, 0xd6, 0x04,
-  0x83, 0x26, 0x47, 0x00, 0x93, 0x96, 0x46, 0x00, 0x23, 0xa4, 0xd7, 0x00,
-  0x83, 0x46, 0xc7, 0x00, 0x63, 0x96, 0x06, 0x06, 0x93, 0x06, 0x00, 0x10,
-  0x23, 0xa4, 0xd7, 0x00, 0x83, 0xa6, 0x07, 0x00, 0x93, 0xe6, 0x46, 0x00,
-  0x23, 0xa0, 0xd7, 0x00, 0xa3, 0x0e, 0x07, 0x00, 0x83, 0x46, 0xd7, 0x01,
-  0xe3, 0x8e, 0x06, 0xfe, 0xa3, 0x0e, 0x07, 0x00, 0x03, 0xa5, 0x47, 0x00,
-  0x13, 0x55, 0x15, 0x00, 0x13, 0x45, 0x15, 0x00, 0x13, 0x75, 0x15, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x83, 0x26, 0x47, 0x00, 0x93, 0x96, 0x66, 0x00,
-  0x6f, 0xf0, 0x5f, 0xfb, 0x33, 0x06, 0xd7, 0x00, 0x03, 0x46, 0xd6, 0x00,
-  0x93, 0x86, 0x16, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x13, 0x76, 0xf6, 0x0f,
-  0x23, 0xa4, 0xc7, 0x00, 0x03, 0x46, 0xc7, 0x00, 0xe3, 0xe2, 0xc6, 0xfe,
-  0x6f, 0xf0, 0xdf, 0xf9, 0x93, 0x06, 0x00, 0x00, 0x6f, 0xf0, 0x1f, 0xff,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0xc7, 0x01, 0x83, 0xa7, 0x46, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8c, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0xa2, 0xe6, 0x00, 0x93, 0x87, 0x47, 0x70,
-  0xa3, 0x8e, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x93, 0x07, 0x44, 0x70,
-  0x03, 0xa7, 0x87, 0x00, 0x23, 0x24, 0x11, 0x00, 0x93, 0x07, 0x00, 0x03,
-  0x13, 0x04, 0x44, 0x70, 0x63, 0x16, 0xf7, 0x02, 0x83, 0x47, 0xc4, 0x00,
-  0x63, 0x86, 0x07, 0x00, 0x03, 0x45, 0xd4, 0x00, 0xef, 0x00, 0x90, 0x63,
-  0x23, 0x22, 0x04, 0x00, 0x23, 0x06, 0x04, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x03, 0x27, 0x84, 0x00, 0x93, 0x07, 0x00, 0x05, 0x63, 0x1c, 0xf7, 0x00,
-  0x83, 0x47, 0xc4, 0x00, 0xe3, 0x8c, 0x07, 0xfc, 0x03, 0x45, 0xd4, 0x00,
-  0xef, 0x00, 0x10, 0x61, 0x6f, 0xf0, 0xdf, 0xfc, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x22, 0xf4, 0x00, 0x6f, 0xf0, 0x5f, 0xfc, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x93, 0x07, 0x44, 0x70,
-  0x83, 0xa6, 0x87, 0x00, 0x23, 0x24, 0x11, 0x00, 0x13, 0x07, 0x00, 0x05,
-  0x63, 0x9c, 0xe6, 0x02, 0x13, 0x04, 0x44, 0x70, 0x83, 0x47, 0xc4, 0x00,
-  0x63, 0x84, 0x07, 0x00, 0xef, 0x00, 0x50, 0x5f, 0x03, 0x27, 0x04, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0x63, 0x14, 0xf7, 0x00, 0xef, 0x00, 0x90, 0x5a,
-  0x23, 0x22, 0x04, 0x00, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0xa2, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00, 0x6f, 0xf0, 0x5f, 0xfe,
-  0x37, 0x86, 0x00, 0x00, 0x93, 0x07, 0x86, 0x26, 0x93, 0x06, 0x40, 0x01,
-  0x23, 0x80, 0xd7, 0x00, 0xa3, 0x80, 0xd7, 0x00, 0x13, 0x07, 0x40, 0xfc,
-  0x23, 0x81, 0xe7, 0x00, 0xa3, 0x81, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x82, 0xe7, 0x00, 0xa3, 0x82, 0xe7, 0x00, 0x93, 0x05, 0x00, 0xf8,
-  0x23, 0x83, 0xb7, 0x00, 0x93, 0x05, 0x20, 0x00, 0xa3, 0x83, 0xb7, 0x00,
-  0x13, 0x05, 0x10, 0xf8, 0x23, 0x84, 0xa7, 0x00, 0xa3, 0x84, 0x07, 0x00,
-  0x23, 0x85, 0xd7, 0x00, 0x93, 0x06, 0x40, 0x00, 0xa3, 0x85, 0xd7, 0x00,
-  0x23, 0x86, 0x07, 0x00, 0xa3, 0x86, 0x07, 0x00, 0x23, 0x87, 0x07, 0x00,
-  0xa3, 0x87, 0x07, 0x00, 0x23, 0x88, 0x07, 0x00, 0xa3, 0x88, 0x07, 0x00,
-  0x23, 0x89, 0x07, 0x00, 0xa3, 0x89, 0x07, 0x00, 0x23, 0x8a, 0x07, 0x00,
-  0xa3, 0x8a, 0x07, 0x00, 0x23, 0x8b, 0x07, 0x00, 0xa3, 0x8b, 0xe7, 0x00,
-  0x23, 0x8c, 0x07, 0x00, 0xa3, 0x8c, 0x07, 0x00, 0x23, 0x8d, 0x07, 0x00,
-  0xa3, 0x8d, 0xb7, 0x00, 0x23, 0x8e, 0xe7, 0x00, 0x93, 0x06, 0x00, 0x00,
-  0x13, 0x07, 0x00, 0x01, 0x33, 0x86, 0xd7, 0x00, 0xa3, 0x0e, 0x06, 0x00,
-  0x93, 0x86, 0x16, 0x00, 0xe3, 0x9a, 0xe6, 0xfe, 0xa3, 0x86, 0x07, 0x02,
-  0x13, 0x07, 0xd0, 0x04, 0x23, 0x87, 0xe7, 0x02, 0x13, 0x07, 0x70, 0x04,
-  0xa3, 0x87, 0xe7, 0x02, 0x13, 0x07, 0x00, 0x05, 0x23, 0x88, 0xe7, 0x02,
-  0x13, 0x06, 0x20, 0x05, 0xa3, 0x88, 0xc7, 0x02, 0x13, 0x06, 0x40, 0x05,
-  0x23, 0x89, 0xc7, 0x02, 0x13, 0x06, 0x00, 0x02, 0xa3, 0x89, 0xc7, 0x02,
-  0x13, 0x06, 0x40, 0x04, 0x23, 0x8a, 0xc7, 0x02, 0xa3, 0x8a, 0xe7, 0x02,
-  0x23, 0x8b, 0xd7, 0x02, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x8b, 0xe7, 0x02,
-  0x23, 0x8c, 0x07, 0x02, 0xa3, 0x8c, 0x07, 0x02, 0x23, 0x8d, 0x07, 0x02,
-  0xa3, 0x8d, 0x07, 0x02, 0x23, 0x8e, 0x07, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x07, 0x87, 0x26, 0xa3, 0x88, 0x07, 0x00,
-  0xa3, 0x89, 0x07, 0x00, 0x23, 0x8c, 0x07, 0x00, 0x23, 0x8d, 0x07, 0x00,
-  0x23, 0x8a, 0x07, 0x00, 0xa3, 0x8a, 0x07, 0x00, 0x23, 0x8b, 0x07, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0x07, 0x00, 0x00, 0x93, 0x06, 0x00, 0x01,
-  0x33, 0x06, 0xf7, 0x00, 0xa3, 0x0e, 0x06, 0x00, 0x93, 0x87, 0x17, 0x00,
-  0xe3, 0x9a, 0xd7, 0xfe, 0x67, 0x80, 0x00, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0x93, 0x07, 0x05, 0x00, 0x63, 0x06, 0xe5, 0x02, 0x13, 0x07, 0x10, 0x02,
-  0x63, 0x06, 0xe5, 0x04, 0x13, 0x07, 0x10, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x63, 0x90, 0xe7, 0x06, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26,
-  0xa3, 0x80, 0xb7, 0x00, 0x13, 0x05, 0x00, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x23, 0x81, 0xb7, 0x00,
-  0x03, 0xc7, 0x27, 0x00, 0x13, 0x67, 0x07, 0x04, 0x23, 0x81, 0xe7, 0x00,
-  0x03, 0xc7, 0x27, 0x00, 0x13, 0x67, 0x07, 0x08, 0x23, 0x81, 0xe7, 0x00,
-  0x6f, 0xf0, 0x5f, 0xfd, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x63, 0x96, 0xe5, 0x00, 0xa3, 0x84, 0xb7, 0x00,
-  0x6f, 0xf0, 0xdf, 0xfb, 0xa3, 0x84, 0x07, 0x00, 0x6f, 0xf0, 0x5f, 0xfb,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26,
-  0x03, 0xc5, 0xb7, 0x00, 0x13, 0x75, 0x75, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26,
-  0x03, 0xc5, 0xb7, 0x00, 0x13, 0x75, 0x75, 0x00, 0x13, 0x05, 0xe5, 0xff,
-  0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xb7, 0x00, 0x13, 0x75, 0x75, 0x00,
-  0x13, 0x05, 0xc5, 0xff, 0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x83, 0xc7, 0xc7, 0x00,
-  0x13, 0x07, 0x60, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0xf7, 0x77, 0x00,
-  0x93, 0x87, 0xf7, 0xff, 0x93, 0xf7, 0xf7, 0x0f, 0x63, 0x6a, 0xf7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x47, 0x1d, 0xb3, 0x07, 0xf7, 0x00,
-  0x03, 0xc5, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x24, 0x11, 0x00, 0xef, 0xf0, 0x1f, 0xfc, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x05, 0xf5, 0xff, 0x13, 0x35, 0x15, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00,
-  0xef, 0xf0, 0x1f, 0xfa, 0x83, 0x20, 0x81, 0x00, 0x13, 0x35, 0x25, 0x00,
-  0x13, 0x45, 0x15, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00, 0xef, 0xf0, 0x1f, 0xf8,
-  0x83, 0x20, 0x81, 0x00, 0x13, 0x35, 0x15, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26,
-  0x03, 0xc5, 0xd7, 0x00, 0x13, 0x75, 0x35, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xd7, 0x00,
-  0x13, 0x55, 0x35, 0x00, 0x13, 0x75, 0x35, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xd7, 0x00,
-  0x13, 0x75, 0x45, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xd7, 0x00, 0x13, 0x75, 0x05, 0x02,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21,
-  0x83, 0xc5, 0xc7, 0x00, 0x03, 0xc5, 0x07, 0x01, 0x03, 0xc6, 0x47, 0x01,
-  0x83, 0xc6, 0xd7, 0x00, 0x13, 0x15, 0x15, 0x00, 0x03, 0xc7, 0x17, 0x01,
-  0x13, 0x16, 0x26, 0x00, 0x83, 0xc7, 0x57, 0x01, 0x33, 0x65, 0xc5, 0x00,
-  0x33, 0x65, 0xb5, 0x00, 0x93, 0x96, 0x46, 0x00, 0x33, 0x65, 0xd5, 0x00,
-  0x13, 0x17, 0x57, 0x00, 0x33, 0x65, 0xe5, 0x00, 0x93, 0x97, 0x67, 0x00,
-  0x33, 0x65, 0xf5, 0x00, 0x13, 0x75, 0xf5, 0x0f, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21, 0x83, 0xc5, 0xe7, 0x00,
-  0x03, 0xc5, 0x27, 0x01, 0x03, 0xc6, 0x67, 0x01, 0x83, 0xc6, 0xf7, 0x00,
-  0x13, 0x15, 0x15, 0x00, 0x03, 0xc7, 0x37, 0x01, 0x13, 0x16, 0x26, 0x00,
-  0x83, 0xc7, 0x77, 0x01, 0x33, 0x65, 0xc5, 0x00, 0x33, 0x65, 0xb5, 0x00,
-  0x93, 0x96, 0x46, 0x00, 0x33, 0x65, 0xd5, 0x00, 0x13, 0x17, 0x57, 0x00,
-  0x33, 0x65, 0xe5, 0x00, 0x93, 0x97, 0x67, 0x00, 0x33, 0x65, 0xf5, 0x00,
-  0x13, 0x75, 0xf5, 0x0f, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0x97, 0x01, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x21, 0x83, 0xc7, 0x87, 0x01, 0x33, 0x65, 0xf5, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x21,
-  0x83, 0x47, 0xb7, 0x01, 0x83, 0x46, 0xa7, 0x01, 0x93, 0x97, 0x27, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0xb3, 0xe7, 0xd7, 0x00, 0x83, 0x46, 0xb7, 0x01,
-  0x93, 0x97, 0x27, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x03, 0x45, 0xa7, 0x01,
-  0xb3, 0xe7, 0xd7, 0x00, 0x93, 0x97, 0x27, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0x33, 0xe5, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc7, 0x97, 0x01, 0x63, 0x08, 0x05, 0x00,
-  0x13, 0x67, 0x07, 0x08, 0xa3, 0x8c, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x77, 0xf7, 0x07, 0x6f, 0xf0, 0x5f, 0xff, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0x97, 0x00, 0x13, 0x75, 0x15, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26,
-  0x03, 0xc5, 0x37, 0x01, 0x13, 0x75, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc7, 0x87, 0x01,
-  0x13, 0x67, 0x07, 0x01, 0x23, 0x8c, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc7, 0xa7, 0x01,
-  0x13, 0x67, 0x17, 0x00, 0x23, 0x8d, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc7, 0xa7, 0x01,
-  0x13, 0x67, 0x27, 0x00, 0x23, 0x8d, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0x17, 0x01,
-  0x13, 0x75, 0x05, 0x01, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc5, 0xb7, 0x01, 0x13, 0x75, 0x75, 0x00,
-  0x13, 0x05, 0xf5, 0xff, 0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x01, 0xff, 0x23, 0x26, 0x11, 0x00, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0xef, 0xf0, 0xdf, 0x82, 0xe3, 0x0c, 0x05, 0x06,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0x47, 0x70, 0x03, 0x26, 0x07, 0x00,
-  0x93, 0x06, 0x80, 0x00, 0x13, 0x84, 0x47, 0x70, 0x63, 0x1c, 0xd6, 0x3a,
-  0x03, 0x26, 0x87, 0x00, 0x93, 0x06, 0xf0, 0x2f, 0x63, 0xf6, 0xc6, 0x02,
-  0x03, 0x26, 0x87, 0x00, 0x93, 0x06, 0xf0, 0x3f, 0x63, 0xe0, 0xc6, 0x02,
-  0x23, 0x22, 0x07, 0x00, 0x23, 0x06, 0x07, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x83, 0x20, 0xc1, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x6f, 0xf0, 0x1f, 0x8f, 0x83, 0x26, 0x84, 0x00, 0x37, 0x17, 0x00, 0x00,
-  0x63, 0xee, 0xe6, 0x00, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf7, 0x1f,
-  0x63, 0x68, 0xd7, 0x00, 0x23, 0x22, 0x04, 0x00, 0x23, 0x06, 0x04, 0x00,
-  0x6f, 0xf0, 0xdf, 0xfc, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x02,
-  0x63, 0x76, 0xd7, 0x04, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x03,
-  0x63, 0x60, 0xd7, 0x04, 0x03, 0x26, 0x84, 0x00, 0xb7, 0x86, 0x00, 0x00,
-  0x93, 0x86, 0x86, 0x26, 0x13, 0x76, 0xf6, 0x0f, 0x13, 0x07, 0x00, 0x00,
-  0xb3, 0x86, 0xc6, 0x00, 0x03, 0x46, 0xc4, 0x00, 0xe3, 0x70, 0xc7, 0xfc,
-  0x33, 0x06, 0xe4, 0x00, 0x03, 0x46, 0xd6, 0x00, 0x13, 0x07, 0x17, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x13, 0x76, 0xf6, 0x0f, 0xa3, 0x8e, 0xc6, 0x00,
-  0x6f, 0xf0, 0x1f, 0xfe, 0x23, 0x22, 0x04, 0x00, 0x93, 0x04, 0x00, 0x00,
-  0x03, 0x27, 0x84, 0x00, 0x93, 0xf7, 0xf4, 0x0f, 0x23, 0x20, 0xf1, 0x00,
-  0x93, 0x06, 0x10, 0x11, 0x63, 0xe8, 0xe6, 0x02, 0x93, 0x06, 0xf0, 0x0f,
-  0x63, 0xf6, 0xe6, 0x04, 0x13, 0x07, 0x07, 0xf0, 0x93, 0x06, 0x10, 0x01,
-  0x63, 0xe0, 0xe6, 0x04, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0x47, 0x03, 0x33, 0x07, 0xd7, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x67, 0x00, 0x07, 0x00, 0x93, 0x06, 0x10, 0x20, 0x63, 0x06, 0xd7, 0x26,
-  0x63, 0xe4, 0xe6, 0x02, 0x93, 0x06, 0x10, 0x1c, 0x63, 0x04, 0xd7, 0x22,
-  0x93, 0x06, 0x20, 0x1c, 0x63, 0x0e, 0xd7, 0x22, 0x93, 0x06, 0x00, 0x1c,
-  0x63, 0x0e, 0xd7, 0x1e, 0x13, 0x07, 0x10, 0x00, 0x23, 0x22, 0xe4, 0x00,
-  0x6f, 0x00, 0x40, 0x08, 0x93, 0x06, 0x00, 0x60, 0x63, 0x00, 0xd7, 0x26,
-  0xb7, 0x26, 0x00, 0x00, 0x93, 0x86, 0x36, 0x00, 0x63, 0x08, 0xd7, 0x22,
-  0x93, 0x06, 0x00, 0x2c, 0xe3, 0x1e, 0xd7, 0xfc, 0x33, 0x07, 0x94, 0x00,
-  0x03, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x83, 0x46, 0xa7, 0x01, 0x13, 0x46, 0xf6, 0xff, 0xb3, 0xf6, 0xc6, 0x00,
-  0x23, 0x0d, 0xd7, 0x00, 0x6f, 0x00, 0x40, 0x04, 0x33, 0x07, 0x94, 0x00,
-  0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x05, 0xd7, 0x00, 0xef, 0x00, 0x10, 0x16,
-  0xef, 0x00, 0x10, 0x31, 0xef, 0x10, 0x00, 0x66, 0x6f, 0x00, 0xc0, 0x01,
-  0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x05, 0xd7, 0x00,
-  0x03, 0x27, 0x84, 0x00, 0x83, 0x27, 0x01, 0x00, 0x93, 0x84, 0x14, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x23, 0x24, 0xe4, 0x00, 0x83, 0x26, 0x44, 0x00,
-  0x03, 0x46, 0xc4, 0x00, 0x13, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x63, 0x74, 0xc7, 0x00, 0xe3, 0x84, 0x06, 0xee, 0x03, 0x27, 0x44, 0x00,
-  0x93, 0x06, 0x10, 0x00, 0xe3, 0x1c, 0xd7, 0xe6, 0x83, 0x27, 0x01, 0x00,
-  0xa3, 0x06, 0xf4, 0x00, 0x23, 0x06, 0xe4, 0x00, 0x6f, 0xf0, 0x9f, 0xe3,
-  0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x06, 0xd7, 0x00,
-  0xef, 0xf0, 0x9f, 0xb9, 0xe3, 0x1e, 0x05, 0xf6, 0xef, 0x00, 0x50, 0x26,
-  0x13, 0x07, 0x20, 0x00, 0xe3, 0x04, 0x05, 0xf0, 0xef, 0x10, 0x80, 0x5b,
-  0x6f, 0xf0, 0x9f, 0xf8, 0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x06, 0xd7, 0x00, 0xef, 0x10, 0x00, 0x5c, 0x6f, 0xf0, 0x9f, 0xf6,
-  0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x07, 0xd7, 0x00,
-  0x6f, 0xf0, 0xdf, 0xf4, 0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x07, 0xd7, 0x00, 0x6f, 0xf0, 0x1f, 0xf3, 0x33, 0x07, 0x94, 0x00,
-  0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x08, 0xd7, 0x00, 0x6f, 0xf0, 0x5f, 0xf1,
-  0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x08, 0xd7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xef, 0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x09, 0xd7, 0x00, 0x6f, 0xf0, 0xdf, 0xed, 0x33, 0x07, 0x94, 0x00,
-  0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x09, 0xd7, 0x00, 0xef, 0x00, 0xd0, 0x17,
-  0xe3, 0x0e, 0x05, 0xea, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0x87, 0x26,
-  0x03, 0x47, 0x37, 0x01, 0x13, 0x05, 0x10, 0x00, 0x13, 0x77, 0x17, 0x00,
-  0x63, 0x14, 0x07, 0x00, 0x13, 0x05, 0x00, 0x00, 0xef, 0x00, 0x10, 0x0c,
-  0x6f, 0xf0, 0x9f, 0xe9, 0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x0a, 0xd7, 0x00, 0x6f, 0xf0, 0xdf, 0xe7, 0x33, 0x07, 0x94, 0x00,
-  0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x0a, 0xd7, 0x00, 0x6f, 0xf0, 0x1f, 0xe6,
-  0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x0b, 0xd7, 0x00,
-  0x6f, 0xf0, 0x5f, 0xe4, 0x33, 0x07, 0x94, 0x00, 0x03, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x83, 0x46, 0x87, 0x01,
-  0x13, 0x46, 0xf6, 0xff, 0xb3, 0xf6, 0xc6, 0x00, 0x23, 0x0c, 0xd7, 0x00,
-  0x6f, 0xf0, 0x1f, 0xe2, 0x33, 0x07, 0x94, 0x00, 0x83, 0x46, 0xd7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x0d, 0xd7, 0x00, 0xef, 0x00, 0x00, 0x4d, 0xef, 0xf0, 0x1f, 0xc1,
-  0xe3, 0x1e, 0x05, 0xde, 0xef, 0xf0, 0x9f, 0x85, 0x6f, 0xf0, 0x5f, 0xdf,
-  0x03, 0x26, 0x04, 0x00, 0x93, 0x06, 0x90, 0x00, 0x63, 0x12, 0xd6, 0x46,
-  0x23, 0x22, 0x04, 0x00, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x02,
-  0x63, 0x72, 0xd7, 0x06, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x03,
-  0x63, 0x6c, 0xd7, 0x04, 0x83, 0x25, 0x84, 0x00, 0x37, 0x85, 0x00, 0x00,
-  0x13, 0x07, 0x00, 0x00, 0x93, 0xf5, 0xf5, 0x00, 0x13, 0x05, 0x85, 0x26,
-  0x03, 0x46, 0xc4, 0x00, 0xb3, 0x86, 0xe5, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x63, 0x6a, 0xc7, 0x00, 0x83, 0x26, 0x44, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0xe3, 0x9c, 0xe6, 0xc0, 0x6f, 0xf0, 0x5f, 0xc4, 0xb3, 0x06, 0xd5, 0x00,
-  0x83, 0xc6, 0xd6, 0x01, 0x33, 0x06, 0xe4, 0x00, 0x13, 0x07, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x06, 0xd6, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x6f, 0xf0, 0x5f, 0xfc, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x3f,
-  0x63, 0x7a, 0xd7, 0x04, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf0, 0x40,
-  0x63, 0x64, 0xd7, 0x04, 0x83, 0x25, 0x84, 0x00, 0x37, 0x85, 0x00, 0x00,
-  0x13, 0x07, 0x00, 0x00, 0x93, 0xf5, 0xf5, 0x00, 0x13, 0x05, 0x85, 0x26,
-  0x03, 0x46, 0xc4, 0x00, 0xb3, 0x86, 0xe5, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0xe3, 0x7c, 0xc7, 0xf8, 0xb3, 0x06, 0xd5, 0x00, 0x83, 0xc6, 0xd6, 0x02,
-  0x33, 0x06, 0xe4, 0x00, 0x13, 0x07, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x06, 0xd6, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x6f, 0xf0, 0x5f, 0xfd,
-  0x03, 0x26, 0x84, 0x00, 0x37, 0x17, 0x00, 0x00, 0x93, 0x06, 0xf7, 0x3f,
-  0x63, 0xf8, 0xc6, 0x00, 0x83, 0x26, 0x84, 0x00, 0x13, 0x07, 0xf7, 0x5f,
-  0x63, 0x70, 0xd7, 0x06, 0x93, 0x04, 0x00, 0x00, 0x03, 0x27, 0x84, 0x00,
-  0x93, 0x06, 0x10, 0x1c, 0x63, 0x0c, 0xd7, 0x2a, 0x63, 0xe6, 0xe6, 0x0c,
-  0x93, 0x06, 0x10, 0x11, 0x63, 0xe6, 0xe6, 0x0a, 0x93, 0x06, 0xf0, 0x0f,
-  0x63, 0xe8, 0xe6, 0x06, 0x93, 0x06, 0xe0, 0x00, 0x63, 0xf6, 0xe6, 0x08,
-  0x93, 0x06, 0x10, 0x02, 0x63, 0x02, 0xd7, 0x1e, 0x33, 0x07, 0x94, 0x00,
-  0xa3, 0x06, 0x07, 0x00, 0x6f, 0x00, 0x80, 0x12, 0xb3, 0x06, 0xe4, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0xa3, 0x86, 0x06, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x83, 0x46, 0xc4, 0x00, 0xe3, 0x66, 0xd7, 0xfe, 0x6f, 0xf0, 0x1f, 0xf0,
-  0x13, 0x07, 0x00, 0x00, 0x6f, 0xf0, 0x1f, 0xff, 0xb7, 0xe6, 0xff, 0xff,
-  0x93, 0x86, 0x06, 0xe0, 0x33, 0x07, 0xd7, 0x00, 0x93, 0x06, 0xe0, 0x00,
-  0xe3, 0xe0, 0xe6, 0xfc, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0xc7, 0x07, 0x33, 0x07, 0xd7, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x67, 0x00, 0x07, 0x00, 0x13, 0x07, 0x07, 0xf0, 0x93, 0x06, 0x10, 0x01,
-  0xe3, 0xee, 0xe6, 0xf8, 0xb7, 0x86, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0x86, 0x0b, 0x33, 0x07, 0xd7, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x67, 0x00, 0x07, 0x00, 0xb7, 0x86, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0xc6, 0x07, 0x6f, 0xf0, 0x5f, 0xfc, 0x93, 0x06, 0x00, 0x1c,
-  0xe3, 0x16, 0xd7, 0xf6, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x47, 0x01, 0x6f, 0x00, 0x00, 0x08, 0x93, 0x06, 0x00, 0x2c,
-  0x63, 0x0c, 0xd7, 0x26, 0x63, 0xe8, 0xe6, 0x02, 0x93, 0x06, 0x20, 0x1c,
-  0x63, 0x04, 0xd7, 0x1e, 0x13, 0x07, 0x07, 0xe0, 0x93, 0x06, 0x70, 0x00,
-  0xe3, 0xee, 0xe6, 0xf2, 0xb7, 0x86, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0x06, 0x10, 0x33, 0x07, 0xd7, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x67, 0x00, 0x07, 0x00, 0xb7, 0x26, 0x00, 0x00, 0x13, 0x86, 0xe6, 0x20,
-  0xe3, 0x6c, 0xe6, 0xf0, 0x13, 0x86, 0xf6, 0x1f, 0xe3, 0x60, 0xe6, 0xf4,
-  0x13, 0x86, 0x26, 0x00, 0x63, 0x0e, 0xc7, 0x22, 0x93, 0x86, 0x36, 0x00,
-  0x63, 0x00, 0xd7, 0x1c, 0x93, 0x06, 0x00, 0x60, 0xe3, 0x1c, 0xd7, 0xee,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xb7, 0x01,
-  0x6f, 0x00, 0xc0, 0x00, 0x37, 0x87, 0x00, 0x00, 0x03, 0x47, 0x87, 0x26,
-  0x13, 0x77, 0xf7, 0x0f, 0xb3, 0x06, 0x94, 0x00, 0xa3, 0x86, 0xe6, 0x00,
-  0x03, 0x27, 0x84, 0x00, 0x93, 0x84, 0x14, 0x00, 0x13, 0x07, 0x17, 0x00,
-  0x23, 0x24, 0xe4, 0x00, 0x83, 0x26, 0x44, 0x00, 0x03, 0x46, 0xc4, 0x00,
-  0x13, 0xf7, 0xf4, 0x0f, 0x93, 0xb6, 0x16, 0x00, 0x33, 0x37, 0xc7, 0x00,
-  0x33, 0x77, 0xd7, 0x00, 0xe3, 0x1c, 0x07, 0xe6, 0x6f, 0xf0, 0x9f, 0xdc,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x17, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfb, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x27, 0x00, 0x6f, 0xf0, 0x9f, 0xfa, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x37, 0x00, 0x6f, 0xf0, 0x9f, 0xf9,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x47, 0x00,
-  0x6f, 0xf0, 0x9f, 0xf8, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x57, 0x00, 0x6f, 0xf0, 0x9f, 0xf7, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x67, 0x00, 0x6f, 0xf0, 0x9f, 0xf6,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x77, 0x00,
-  0x6f, 0xf0, 0x9f, 0xf5, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x87, 0x00, 0x6f, 0xf0, 0x9f, 0xf4, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x97, 0x00, 0x6f, 0xf0, 0x9f, 0xf3,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xa7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xf2, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0xb7, 0x00, 0x6f, 0xf0, 0x9f, 0xf1, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xc7, 0x00, 0x6f, 0xf0, 0x9f, 0xf0,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xd7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xef, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0xe7, 0x00, 0x6f, 0xf0, 0x9f, 0xee, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xf7, 0x00, 0x6f, 0xf0, 0x9f, 0xed,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x07, 0x01,
-  0x6f, 0xf0, 0x9f, 0xec, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x17, 0x01, 0x6f, 0xf0, 0x9f, 0xeb, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x27, 0x01, 0x6f, 0xf0, 0x9f, 0xea,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x37, 0x01,
-  0x6f, 0xf0, 0x9f, 0xe9, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x57, 0x01, 0x6f, 0xf0, 0x9f, 0xe8, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x67, 0x01, 0x6f, 0xf0, 0x9f, 0xe7,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0x77, 0x01,
-  0x6f, 0xf0, 0x9f, 0xe6, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26,
-  0x03, 0x47, 0x87, 0x01, 0x6f, 0xf0, 0x9f, 0xe5, 0xef, 0x10, 0x40, 0x01,
-  0x63, 0x0c, 0x05, 0x00, 0xef, 0x10, 0x80, 0x05, 0xef, 0x10, 0x80, 0x06,
-  0x63, 0x16, 0x05, 0x00, 0x13, 0x07, 0x20, 0x00, 0x23, 0x22, 0xe4, 0x00,
-  0xef, 0xf0, 0x4f, 0xe4, 0x33, 0x07, 0x94, 0x00, 0xa3, 0x06, 0xa7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xe3, 0xef, 0xf0, 0x4f, 0xe8, 0x6f, 0xf0, 0x1f, 0xff,
-  0xef, 0xf0, 0xcf, 0xec, 0x33, 0x07, 0x94, 0x00, 0xa3, 0x06, 0xa7, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xf0, 0xcf, 0xf1, 0x6f, 0xf0, 0x9f, 0xe1,
-  0xef, 0xf0, 0x4f, 0xed, 0x6f, 0xf0, 0x1f, 0xfd, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xa7, 0x01, 0x6f, 0xf0, 0x5f, 0xdf,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x26, 0x03, 0x47, 0xc7, 0x01,
-  0x6f, 0xf0, 0x5f, 0xde, 0x83, 0x27, 0x07, 0x00, 0x63, 0x88, 0x07, 0x00,
-  0x83, 0x26, 0x07, 0x00, 0x93, 0x07, 0x40, 0x00, 0x63, 0x96, 0xf6, 0x00,
-  0xef, 0xf0, 0x0f, 0x9e, 0x6f, 0xf0, 0x8f, 0xfe, 0x83, 0x26, 0x07, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0x63, 0x88, 0xf6, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x93, 0x07, 0x50, 0x00, 0x63, 0x18, 0xf7, 0xfc, 0xef, 0xf0, 0x8f, 0xa3,
-  0x6f, 0xf0, 0x8f, 0xfc, 0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x84, 0x07, 0x2a, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x84, 0xa7, 0x2a, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x2a, 0x03, 0xc7, 0x07, 0x00,
-  0x13, 0x17, 0x87, 0x00, 0x23, 0x91, 0xe7, 0x00, 0x03, 0xd7, 0x27, 0x00,
-  0x33, 0x65, 0xe5, 0x00, 0x23, 0x91, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x85, 0x00, 0x00, 0x37, 0x86, 0x00, 0x00, 0x93, 0x07, 0x00, 0x00,
-  0x93, 0x85, 0x45, 0x70, 0x13, 0x06, 0x86, 0x2a, 0x03, 0xc7, 0xc5, 0x00,
-  0x63, 0xe4, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0x03, 0x57, 0x26, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0x96, 0x06, 0x01, 0x93, 0xd6, 0x06, 0x01,
-  0x23, 0x11, 0xd6, 0x00, 0x33, 0x07, 0xe6, 0x00, 0x03, 0x47, 0x47, 0x00,
-  0xb3, 0x86, 0xf5, 0x00, 0x93, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0xa3, 0x86, 0xe6, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x6f, 0xf0, 0x5f, 0xfc,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x00, 0x23, 0xa0, 0x07, 0x00,
-  0x23, 0x82, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00, 0x23, 0x83, 0x07, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x02, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0xa0, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x00, 0x23, 0x82, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x83, 0x07, 0x00, 0x13, 0x07, 0x87, 0x1e,
-  0x83, 0x46, 0x07, 0x00, 0x63, 0x86, 0x06, 0x02, 0xb7, 0x86, 0x00, 0x00,
-  0x03, 0xa6, 0x06, 0x02, 0x23, 0xa0, 0x07, 0x00, 0x83, 0x26, 0x06, 0x00,
-  0x93, 0xe6, 0x26, 0x00, 0x23, 0x20, 0xd6, 0x00, 0x23, 0x00, 0x07, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x82, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x83, 0x46, 0x17, 0x00, 0x63, 0x86, 0x06, 0x02, 0xb7, 0x86, 0x00, 0x00,
-  0x83, 0xa5, 0x06, 0x02, 0x13, 0x06, 0x10, 0x00, 0x23, 0xa0, 0xc7, 0x00,
-  0x83, 0xa6, 0x05, 0x00, 0x93, 0xe6, 0x46, 0x00, 0x23, 0xa0, 0xd5, 0x00,
-  0xa3, 0x00, 0x07, 0x00, 0xa3, 0x82, 0xc7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x83, 0x46, 0x27, 0x00, 0x63, 0x82, 0x06, 0x02, 0xb7, 0x86, 0x00, 0x00,
-  0x03, 0xa6, 0x06, 0x02, 0x83, 0x26, 0x06, 0x00, 0x93, 0xe6, 0x86, 0x00,
-  0x23, 0x20, 0xd6, 0x00, 0x23, 0x01, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x83, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x03, 0xa5, 0x47, 0x00, 0x13, 0x05, 0xf5, 0xff, 0x13, 0x35, 0x15, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x00,
-  0x03, 0xc5, 0x57, 0x00, 0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x00, 0x03, 0xc5, 0x47, 0x00,
-  0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x00, 0x03, 0xc5, 0x67, 0x00, 0x33, 0x35, 0xa0, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0x07, 0x02,
-  0x83, 0x27, 0x07, 0x00, 0x93, 0xe7, 0x87, 0x00, 0x23, 0x20, 0xf7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00,
-  0x23, 0x22, 0x81, 0x00, 0xef, 0xe0, 0xdf, 0xb1, 0x93, 0x77, 0x15, 0x00,
-  0x63, 0x8e, 0x07, 0x06, 0x93, 0x77, 0x25, 0x00, 0x13, 0x04, 0x05, 0x00,
-  0x63, 0x8a, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00, 0xef, 0xe0, 0x8f, 0xf8,
-  0x13, 0x05, 0x20, 0x00, 0xef, 0xe0, 0x9f, 0xb0, 0x93, 0x77, 0x44, 0x00,
-  0x63, 0x88, 0x07, 0x00, 0xef, 0xe0, 0x5f, 0xa0, 0x13, 0x05, 0x40, 0x00,
-  0xef, 0xe0, 0x5f, 0xaf, 0x93, 0x77, 0x04, 0x02, 0x63, 0x88, 0x07, 0x00,
-  0xef, 0xe0, 0xdf, 0xf5, 0x13, 0x05, 0x00, 0x02, 0xef, 0xe0, 0x1f, 0xae,
-  0x93, 0x77, 0x04, 0x04, 0x63, 0x88, 0x07, 0x00, 0xef, 0xe0, 0x9f, 0xb5,
-  0x13, 0x05, 0x00, 0x04, 0xef, 0xe0, 0xdf, 0xac, 0x13, 0x74, 0x04, 0x08,
-  0x63, 0x0e, 0x04, 0x00, 0xef, 0x10, 0xd0, 0x10, 0x03, 0x24, 0x41, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x13, 0x05, 0x00, 0x08, 0x13, 0x01, 0xc1, 0x00,
-  0x6f, 0xe0, 0xdf, 0xaa, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x25, 0x23, 0xa0, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00,
-  0xa3, 0x82, 0x07, 0x00, 0x23, 0x83, 0x07, 0x00, 0xa3, 0x83, 0x07, 0x00,
-  0x23, 0x84, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x07, 0x01, 0x00,
-  0x13, 0x01, 0x01, 0xff, 0x93, 0x87, 0xf7, 0x01, 0x23, 0x20, 0xf1, 0x00,
-  0x23, 0x26, 0x11, 0x00, 0xef, 0xf0, 0x4f, 0x9b, 0x93, 0x07, 0x40, 0x00,
-  0x63, 0x1e, 0xf5, 0x04, 0x83, 0x57, 0x21, 0x00, 0x93, 0xe7, 0x67, 0x00,
-  0x23, 0x11, 0xf1, 0x00, 0x83, 0x57, 0x21, 0x00, 0x93, 0xe7, 0x87, 0x00,
-  0x23, 0x11, 0xf1, 0x00, 0xef, 0xf0, 0xcf, 0xc0, 0x63, 0x06, 0x05, 0x00,
-  0x93, 0x07, 0x00, 0x01, 0x23, 0x11, 0xf1, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x6f, 0x13, 0x07, 0x00, 0x01, 0x23, 0x82, 0xe7, 0x00,
-  0x23, 0xa0, 0x07, 0x00, 0x13, 0x07, 0x20, 0x00, 0xa3, 0x82, 0xe7, 0x00,
-  0x23, 0xa4, 0x27, 0x00, 0xef, 0xe0, 0xdf, 0xb0, 0x83, 0x20, 0xc1, 0x00,
-  0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00, 0xef, 0xf0, 0x0f, 0x95,
-  0x93, 0x07, 0x20, 0x00, 0x63, 0x18, 0xf5, 0x00, 0x83, 0x57, 0x21, 0x00,
-  0x93, 0xe7, 0x47, 0x00, 0x6f, 0xf0, 0xdf, 0xf9, 0xef, 0xf0, 0x8f, 0x93,
-  0x93, 0x07, 0x10, 0x00, 0xe3, 0x1a, 0xf5, 0xf8, 0x83, 0x57, 0x21, 0x00,
-  0x93, 0xe7, 0x27, 0x00, 0x6f, 0xf0, 0x5f, 0xf8, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0xc7, 0x25, 0xa3, 0x83, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x23, 0x84, 0xe7, 0x00,
-  0x6f, 0xf0, 0xdf, 0xf3, 0x13, 0x01, 0x01, 0xff, 0xb7, 0x87, 0x00, 0x00,
-  0x23, 0x26, 0x11, 0x00, 0x93, 0x87, 0x47, 0x6f, 0x13, 0x07, 0x00, 0x01,
-  0x23, 0x82, 0xe7, 0x00, 0x23, 0x10, 0xe1, 0x00, 0x23, 0xa0, 0x07, 0x00,
-  0x13, 0x07, 0x20, 0x00, 0x33, 0x35, 0xa0, 0x00, 0x13, 0x15, 0x45, 0x00,
-  0xa3, 0x82, 0xe7, 0x00, 0x23, 0x11, 0xa1, 0x00, 0x23, 0xa4, 0x27, 0x00,
-  0xef, 0xe0, 0x5f, 0xa7, 0x83, 0x20, 0xc1, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff, 0x93, 0x07, 0x00, 0x06,
-  0x23, 0x10, 0xf1, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x23, 0x26, 0x11, 0x00,
-  0x93, 0x87, 0x47, 0x6f, 0x13, 0x07, 0x00, 0x01, 0x23, 0x82, 0xe7, 0x00,
-  0x13, 0x05, 0x65, 0xff, 0x23, 0xa0, 0x07, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0x13, 0x35, 0x15, 0x00, 0x13, 0x15, 0x55, 0x00, 0xa3, 0x82, 0xe7, 0x00,
-  0x23, 0x11, 0xa1, 0x00, 0x23, 0xa4, 0x27, 0x00, 0xef, 0xe0, 0x5f, 0xa2,
-  0x83, 0x20, 0xc1, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x25, 0x03, 0xc5, 0x77, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x25,
-  0x03, 0xc5, 0x57, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x25, 0x03, 0xc5, 0x67, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x25, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x82, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x13, 0x05, 0x00, 0x02, 0x23, 0x24, 0x11, 0x00, 0xef, 0xe0, 0xcf, 0xcc,
-  0x83, 0x20, 0x81, 0x00, 0x13, 0x05, 0x80, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x6f, 0xe0, 0x8f, 0xe8, 0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00,
-  0x23, 0x20, 0x91, 0x00, 0x13, 0x84, 0x05, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x04, 0x05, 0x00, 0xef, 0xf0, 0x9f, 0xfc, 0x37, 0x87, 0x00, 0x00,
-  0x93, 0x07, 0xc7, 0x25, 0x83, 0xc7, 0x77, 0x00, 0xb3, 0xe5, 0x87, 0x00,
-  0x13, 0x04, 0xc7, 0x25, 0x63, 0x88, 0x05, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x1e, 0xa3, 0x83, 0x97, 0x00, 0x83, 0x47, 0x74, 0x00,
-  0x63, 0x88, 0x07, 0x00, 0xef, 0x00, 0x90, 0x24, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xf0, 0x8f, 0x9f, 0xef, 0xe0, 0xdf, 0xee, 0xa3, 0x03, 0x04, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x05, 0x00, 0x02,
-  0x6f, 0xe0, 0x4f, 0xc3, 0x13, 0x01, 0x01, 0xff, 0x23, 0x24, 0x81, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0x13, 0x04, 0xc4, 0x25, 0x83, 0x27, 0x04, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0x23, 0x26, 0x11, 0x00, 0x93, 0x04, 0x10, 0x00,
-  0x63, 0x8e, 0x97, 0x06, 0x13, 0x07, 0x20, 0x00, 0x63, 0x8c, 0xe7, 0x0c,
-  0x63, 0x94, 0x07, 0x02, 0x83, 0x47, 0x44, 0x00, 0x63, 0x8a, 0x07, 0x04,
-  0x23, 0x02, 0x04, 0x00, 0xa3, 0x02, 0x04, 0x00, 0x23, 0x03, 0x04, 0x00,
-  0xef, 0xe0, 0xdf, 0xf5, 0x83, 0x47, 0x84, 0x00, 0x63, 0x98, 0xa7, 0x00,
-  0xa3, 0x02, 0x94, 0x00, 0x23, 0x20, 0x04, 0x00, 0x6f, 0x00, 0x00, 0x03,
-  0x23, 0x04, 0x04, 0x00, 0xef, 0xf0, 0x9f, 0xf0, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x1e, 0xb7, 0x85, 0x01, 0x00, 0x23, 0x85, 0x07, 0x00,
-  0x93, 0x85, 0x05, 0x6a, 0x13, 0x05, 0x00, 0x00, 0xa3, 0x84, 0x97, 0x00,
-  0xef, 0xe0, 0x8f, 0xe3, 0x23, 0x20, 0x94, 0x00, 0x83, 0x20, 0xc1, 0x00,
-  0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x1e,
-  0x03, 0x47, 0xa7, 0x00, 0x63, 0x00, 0x07, 0x02, 0xef, 0xf0, 0xdf, 0xf4,
-  0x93, 0x05, 0x80, 0x3e, 0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x0f, 0xe0,
-  0x93, 0x07, 0x20, 0x00, 0x23, 0x20, 0xf4, 0x00, 0x6f, 0xf0, 0x5f, 0xfc,
-  0x37, 0x87, 0x00, 0x00, 0x03, 0x47, 0xc7, 0x1d, 0xe3, 0x1c, 0x07, 0xfa,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0x20, 0xf1, 0x00, 0xef, 0xe0, 0x0f, 0xed,
-  0xe3, 0x04, 0x05, 0xfa, 0xef, 0xf0, 0x5f, 0xe8, 0x83, 0x27, 0x01, 0x00,
-  0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x10, 0x00, 0x23, 0x03, 0xf4, 0x00,
-  0xef, 0xf0, 0x1f, 0xe9, 0x6f, 0xf0, 0x9f, 0xf5, 0x93, 0x05, 0x30, 0x00,
-  0x13, 0x05, 0x80, 0x00, 0xef, 0xe0, 0x4f, 0xc3, 0x63, 0x08, 0x05, 0x00,
-  0xa3, 0x02, 0x94, 0x00, 0x23, 0x04, 0x04, 0x00, 0x6f, 0xf0, 0xdf, 0xf3,
-  0xef, 0xe0, 0x0f, 0xe9, 0xe3, 0x04, 0x05, 0xf6, 0x13, 0x05, 0x00, 0x02,
-  0xef, 0xe0, 0x8f, 0xb1, 0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x20, 0x00,
-  0xef, 0xf0, 0x5f, 0xe5, 0x23, 0x03, 0x94, 0x00, 0x6f, 0xf0, 0x9f, 0xf1,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x23, 0x80, 0x07, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x23, 0x81, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00,
-  0x23, 0x83, 0x07, 0x00, 0xa3, 0x81, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00,
-  0xa3, 0x83, 0x07, 0x00, 0x23, 0x84, 0x07, 0x00, 0xa3, 0x84, 0x07, 0x00,
-  0x23, 0x85, 0x07, 0x00, 0xa3, 0x85, 0x07, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0xa3, 0x86, 0x07, 0x00, 0x23, 0x87, 0x07, 0x02, 0xa3, 0x87, 0x07, 0x02,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x88, 0x07, 0x6c, 0xb7, 0x87, 0x00, 0x00,
-  0x23, 0x86, 0x07, 0x6a, 0x67, 0x80, 0x00, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x93, 0x07, 0x07, 0x6d, 0x83, 0xc7, 0x07, 0x00, 0x63, 0x8e, 0x07, 0x2a,
-  0x13, 0x07, 0x07, 0x6d, 0x23, 0x00, 0x07, 0x00, 0x83, 0x46, 0x27, 0x00,
-  0x13, 0x06, 0x20, 0x01, 0x93, 0xf7, 0xf6, 0x0f, 0x63, 0x64, 0xd6, 0x04,
-  0x93, 0x06, 0x20, 0x00, 0x63, 0xfc, 0xf6, 0x04, 0x93, 0x87, 0xd7, 0xff,
-  0x93, 0xf7, 0xf7, 0x0f, 0x93, 0x06, 0xf0, 0x00, 0x63, 0xe4, 0xf6, 0x04,
-  0xb7, 0x86, 0x00, 0x00, 0x93, 0x97, 0x27, 0x00, 0x93, 0x86, 0x06, 0x12,
-  0xb3, 0x87, 0xd7, 0x00, 0x83, 0xa7, 0x07, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x13, 0x04, 0xc4, 0x6a, 0x67, 0x80, 0x07, 0x00, 0x93, 0x06, 0x20, 0x04,
-  0x63, 0x88, 0xd7, 0x1c, 0x93, 0x06, 0x10, 0x08, 0x63, 0x8e, 0xd7, 0x1c,
-  0x13, 0x07, 0x40, 0x02, 0x63, 0x88, 0xe7, 0x18, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x6a, 0x23, 0x81, 0x07, 0x00, 0x6f, 0x00, 0xc0, 0x19,
-  0x83, 0x46, 0x37, 0x00, 0x83, 0x45, 0x47, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0x93, 0xf7, 0xf6, 0x0f, 0x93, 0xf5, 0xf5, 0x0f, 0x63, 0x8a, 0xe6, 0x04,
-  0x63, 0x62, 0xf7, 0x02, 0x13, 0x05, 0x20, 0x00, 0x63, 0x94, 0x07, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xe0, 0x5f, 0xcb, 0x63, 0x1c, 0x05, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x6f, 0x00, 0x00, 0x01,
-  0x13, 0x07, 0xf0, 0x0f, 0x63, 0x88, 0xe7, 0x02, 0x23, 0x01, 0x04, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x6a,
-  0xa3, 0x80, 0xe7, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0xcf, 0xdc, 0x13, 0x05, 0x10, 0x02,
-  0x6f, 0xf0, 0xdf, 0xfb, 0x93, 0x07, 0x70, 0x04, 0xe3, 0x98, 0xf5, 0xfc,
-  0x13, 0x05, 0x00, 0x02, 0xef, 0xe0, 0x4f, 0x98, 0xef, 0x00, 0x00, 0x55,
-  0x6f, 0xf0, 0xdf, 0xfa, 0x93, 0x07, 0x10, 0x00, 0xb7, 0x85, 0x00, 0x00,
-  0x23, 0x01, 0xf4, 0x00, 0x93, 0x85, 0xc5, 0x1d, 0x93, 0x07, 0x00, 0x00,
-  0x13, 0x05, 0x80, 0x00, 0x93, 0x86, 0x07, 0x00, 0x93, 0x87, 0x17, 0x00,
-  0x33, 0x06, 0xf7, 0x00, 0x03, 0x46, 0x26, 0x00, 0xb3, 0x86, 0xd5, 0x00,
-  0x13, 0x76, 0xf6, 0x0f, 0xa3, 0x80, 0xc6, 0x00, 0xe3, 0x92, 0xa7, 0xfe,
-  0xef, 0x10, 0x80, 0x3a, 0xe3, 0x12, 0x05, 0xf8, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xe0, 0xcf, 0xbf, 0x6f, 0xf0, 0x9f, 0xf7, 0x93, 0x07, 0x50, 0x00,
-  0x23, 0x01, 0xf4, 0x00, 0xef, 0xe0, 0x4f, 0x8d, 0x93, 0x57, 0x85, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0xa3, 0x01, 0xf4, 0x00, 0x13, 0x75, 0xf5, 0x0f,
-  0x93, 0x07, 0x20, 0x00, 0x23, 0x02, 0xa4, 0x00, 0xa3, 0x02, 0xf4, 0x00,
-  0x23, 0x03, 0x04, 0x00, 0xa3, 0x03, 0x04, 0x00, 0xef, 0xe0, 0x0f, 0x94,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x04, 0xa4, 0x00, 0xef, 0xf0, 0x9f, 0x95,
-  0xa3, 0x04, 0xa4, 0x00, 0xef, 0xf0, 0xdf, 0xbd, 0x23, 0x05, 0xa4, 0x00,
-  0xef, 0xe0, 0xdf, 0xc3, 0xa3, 0x05, 0xa4, 0x00, 0xef, 0xe0, 0x9f, 0xc4,
-  0x23, 0x06, 0xa4, 0x00, 0xef, 0x00, 0x10, 0x31, 0xa3, 0x06, 0xa4, 0x00,
-  0x13, 0x07, 0xc0, 0x00, 0x6f, 0xf0, 0x1f, 0xf1, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0x87, 0x1e, 0xa3, 0x80, 0xe7, 0x00,
-  0x23, 0x01, 0xe4, 0x00, 0x6f, 0xf0, 0x5f, 0xef, 0x37, 0x87, 0x00, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0x04, 0xf7, 0x1e, 0x6f, 0xf0, 0x1f, 0xed,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0x87, 0x1e,
-  0x23, 0x81, 0xe7, 0x00, 0x6f, 0xf0, 0x9f, 0xfd, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x23, 0x82, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x6a, 0x23, 0x81, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0xc7, 0x6a,
-  0xa3, 0x80, 0xe7, 0x00, 0x6f, 0xf0, 0xdf, 0xeb, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x23, 0x85, 0xe7, 0x00,
-  0x6f, 0xf0, 0x1f, 0xfd, 0x83, 0x46, 0x37, 0x00, 0x83, 0x47, 0x47, 0x00,
-  0x37, 0x85, 0x00, 0x00, 0x93, 0x96, 0x86, 0x00, 0xb3, 0xe7, 0xd7, 0x00,
-  0x93, 0x87, 0xd7, 0xff, 0x93, 0x97, 0x07, 0x01, 0x13, 0x06, 0x30, 0x00,
-  0x93, 0xd7, 0x07, 0x01, 0x13, 0x05, 0x85, 0x2a, 0x13, 0x03, 0x30, 0x01,
-  0xb3, 0x05, 0xc7, 0x00, 0x83, 0xc5, 0x25, 0x00, 0xb3, 0x86, 0xc7, 0x00,
-  0x93, 0x96, 0x06, 0x01, 0x93, 0xd6, 0x06, 0x01, 0x93, 0xf5, 0xf5, 0x0f,
-  0xb3, 0x06, 0xd5, 0x00, 0x23, 0x82, 0xb6, 0x00, 0x13, 0x06, 0x16, 0x00,
-  0xe3, 0x1e, 0x66, 0xfc, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x6a,
-  0x13, 0x07, 0x10, 0x00, 0x6f, 0xf0, 0x5f, 0xf7, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x6a, 0x23, 0x81, 0x07, 0x00, 0x6f, 0xf0, 0x9f, 0xe1,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e,
-  0x03, 0xc7, 0xe7, 0x02, 0x33, 0x87, 0xe7, 0x00, 0x23, 0x07, 0xa7, 0x00,
-  0x83, 0xc6, 0xe7, 0x02, 0x13, 0x07, 0xf0, 0x01, 0x63, 0x76, 0xd7, 0x00,
-  0x23, 0x87, 0x07, 0x02, 0x67, 0x80, 0x00, 0x00, 0x03, 0xc7, 0xe7, 0x02,
-  0x13, 0x07, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x87, 0xe7, 0x02,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e,
-  0x03, 0xc7, 0xf7, 0x02, 0x33, 0x87, 0xe7, 0x00, 0x03, 0x45, 0xe7, 0x00,
-  0x83, 0xc6, 0xf7, 0x02, 0x13, 0x07, 0xf0, 0x01, 0x13, 0x75, 0xf5, 0x0f,
-  0x63, 0x76, 0xd7, 0x00, 0xa3, 0x87, 0x07, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0x03, 0xc7, 0xf7, 0x02, 0x13, 0x07, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0xa3, 0x87, 0xe7, 0x02, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x1e, 0x03, 0xc5, 0xf7, 0x02, 0x83, 0xc7, 0xe7, 0x02,
-  0x33, 0x05, 0xf5, 0x40, 0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00,
-  0xef, 0xf0, 0x9f, 0xfd, 0x63, 0x02, 0x05, 0x02, 0x37, 0x84, 0x00, 0x00,
-  0x13, 0x04, 0xc4, 0x6a, 0x93, 0x07, 0x20, 0x00, 0x23, 0x01, 0xf4, 0x00,
-  0xef, 0xf0, 0x1f, 0xf8, 0xa3, 0x01, 0xa4, 0x00, 0x93, 0x07, 0x20, 0x00,
-  0x6f, 0x00, 0xc0, 0x08, 0x37, 0x87, 0x00, 0x00, 0x93, 0x07, 0x87, 0x1e,
-  0x83, 0xc6, 0x97, 0x00, 0x13, 0x07, 0x87, 0x1e, 0x63, 0x8a, 0x06, 0x02,
-  0xa3, 0x84, 0x07, 0x00, 0x37, 0x84, 0x00, 0x00, 0x23, 0x85, 0x07, 0x00,
-  0x13, 0x04, 0xc4, 0x6a, 0x93, 0x07, 0x00, 0x04, 0x23, 0x01, 0xf4, 0x00,
-  0xef, 0xe0, 0x1f, 0xa4, 0xa3, 0x01, 0xa4, 0x00, 0xef, 0xe0, 0xdf, 0xcf,
-  0x23, 0x02, 0xa4, 0x00, 0x93, 0x07, 0x30, 0x00, 0x6f, 0x00, 0x80, 0x04,
-  0x83, 0xc6, 0x37, 0x00, 0x63, 0x80, 0x06, 0x02, 0x37, 0x84, 0x00, 0x00,
-  0xa3, 0x81, 0x07, 0x00, 0x13, 0x04, 0xc4, 0x6a, 0x93, 0x07, 0x30, 0x02,
-  0x23, 0x01, 0xf4, 0x00, 0xef, 0xe0, 0x5f, 0xa5, 0x6f, 0xf0, 0x1f, 0xf9,
-  0x83, 0xc6, 0x57, 0x00, 0x63, 0x8c, 0x06, 0x02, 0xa3, 0x82, 0x07, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x6a, 0x13, 0x07, 0x10, 0x03,
-  0x23, 0x81, 0xe7, 0x00, 0x93, 0x07, 0x10, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0xc7, 0x6a, 0xa3, 0x00, 0xf7, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0xcf, 0xa8,
-  0x83, 0xc6, 0x67, 0x00, 0x63, 0x8c, 0x06, 0x00, 0x23, 0x83, 0x07, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x6a, 0x13, 0x07, 0x20, 0x03,
-  0x6f, 0xf0, 0x5f, 0xfc, 0x83, 0xc6, 0x77, 0x00, 0x63, 0x84, 0x06, 0x02,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0xc7, 0x6a, 0x93, 0x06, 0x50, 0x04,
-  0x23, 0x01, 0xd7, 0x00, 0x83, 0xc6, 0x77, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x01, 0xd7, 0x00, 0xa3, 0x83, 0x07, 0x00, 0x6f, 0xf0, 0x1f, 0xf1,
-  0x83, 0xc6, 0x87, 0x00, 0x63, 0x84, 0x06, 0x02, 0x37, 0x84, 0x00, 0x00,
-  0x23, 0x84, 0x07, 0x00, 0x13, 0x04, 0xc4, 0x6a, 0x93, 0x07, 0x40, 0x04,
-  0x23, 0x01, 0xf4, 0x00, 0xef, 0xe0, 0x1f, 0x95, 0xa3, 0x01, 0xa4, 0x00,
-  0xef, 0xe0, 0xdf, 0x95, 0x6f, 0xf0, 0x5f, 0xf2, 0x83, 0xc6, 0xd7, 0x00,
-  0x63, 0x8c, 0x06, 0x14, 0xa3, 0x86, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x6a, 0x13, 0x07, 0x60, 0x06, 0x23, 0x81, 0xe7, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x87, 0x23, 0x83, 0x26, 0x47, 0x00,
-  0x93, 0xd6, 0x06, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x81, 0xd7, 0x00,
-  0x83, 0x26, 0x47, 0x00, 0x93, 0xd6, 0x86, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x82, 0xd7, 0x00, 0x83, 0x26, 0x47, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x82, 0xd7, 0x00, 0x83, 0x26, 0x87, 0x00, 0x93, 0xd6, 0x06, 0x01,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x83, 0xd7, 0x00, 0x83, 0x26, 0x87, 0x00,
-  0x93, 0xd6, 0x86, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x83, 0xd7, 0x00,
-  0x83, 0x26, 0x87, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x84, 0xd7, 0x00,
-  0x83, 0x56, 0xc7, 0x00, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x84, 0xd7, 0x00,
-  0x83, 0x56, 0xc7, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x85, 0xd7, 0x00,
-  0x83, 0x56, 0xe7, 0x00, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x85, 0xd7, 0x00,
-  0x83, 0x56, 0xe7, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00,
-  0x83, 0x56, 0x27, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x86, 0xd7, 0x00,
-  0x83, 0x56, 0x27, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x87, 0xd7, 0x00,
-  0x83, 0x56, 0x07, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x87, 0xd7, 0x00,
-  0x83, 0x56, 0x07, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x88, 0xd7, 0x00,
-  0x83, 0x56, 0x47, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x88, 0xd7, 0x00,
-  0x83, 0x56, 0x47, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x89, 0xd7, 0x00,
-  0x83, 0x56, 0x67, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x89, 0xd7, 0x00,
-  0x83, 0x56, 0x67, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x8a, 0xd7, 0x00,
-  0x83, 0x56, 0xa7, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x8a, 0xd7, 0x00,
-  0x83, 0x56, 0xa7, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x8b, 0xd7, 0x00,
-  0x83, 0x56, 0x87, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x8b, 0xd7, 0x00,
-  0x83, 0x56, 0x87, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x8c, 0xd7, 0x00,
-  0x83, 0x56, 0xc7, 0x01, 0x93, 0xd6, 0x86, 0x00, 0xa3, 0x8c, 0xd7, 0x00,
-  0x03, 0x57, 0xc7, 0x01, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x8d, 0xe7, 0x00,
-  0x93, 0x07, 0x90, 0x01, 0x6f, 0xf0, 0x9f, 0xe1, 0x83, 0xc6, 0xb7, 0x00,
-  0x63, 0x8c, 0x06, 0x00, 0xa3, 0x85, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x6a, 0x13, 0x07, 0x20, 0x06, 0x6f, 0xf0, 0x5f, 0xdf,
-  0x83, 0x47, 0xc7, 0x00, 0x63, 0x84, 0x07, 0x02, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x6a, 0x93, 0x06, 0x30, 0x06, 0x23, 0x81, 0xd7, 0x00,
-  0x83, 0x46, 0xc7, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x81, 0xd7, 0x00,
-  0x23, 0x06, 0x07, 0x00, 0x6f, 0xf0, 0x1f, 0xd4, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21,
-  0x13, 0x07, 0x10, 0x00, 0x93, 0x05, 0x40, 0x00, 0x33, 0x86, 0xd7, 0x00,
-  0x23, 0x06, 0xe6, 0x00, 0x23, 0x08, 0xe6, 0x00, 0x23, 0x0a, 0xe6, 0x00,
-  0x93, 0x86, 0x16, 0x00, 0xe3, 0x96, 0xb6, 0xfe, 0x23, 0x8c, 0xe7, 0x00,
-  0xa3, 0x85, 0xe7, 0x00, 0x23, 0x84, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x26, 0x03, 0xc7, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x85, 0xe7, 0x00, 0x03, 0xc7, 0x27, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0xa3, 0x85, 0xe7, 0x00, 0x6f, 0xf0, 0x4f, 0xe1, 0x13, 0x01, 0x01, 0xff,
-  0x23, 0x26, 0x11, 0x00, 0x23, 0x24, 0x81, 0x00, 0xef, 0xe0, 0x4f, 0xf2,
-  0x13, 0x04, 0x05, 0x00, 0xef, 0xe0, 0x8f, 0xf7, 0x93, 0x06, 0x00, 0x00,
-  0x23, 0x10, 0x81, 0x00, 0x93, 0x07, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x63, 0x10, 0x87, 0x04, 0x63, 0x9e, 0x06, 0x04, 0x23, 0x11, 0x01, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x6f, 0x13, 0x07, 0x10, 0x01,
-  0x23, 0x82, 0xe7, 0x00, 0x23, 0xa0, 0x07, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0xa3, 0x82, 0xe7, 0x00, 0x23, 0xa4, 0x27, 0x00, 0xef, 0xe0, 0x8f, 0x88,
-  0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x97, 0x47, 0x00, 0xb3, 0x67, 0xf5, 0x00,
-  0x93, 0x97, 0x07, 0x01, 0x13, 0x07, 0x17, 0x00, 0x93, 0xd7, 0x07, 0x01,
-  0x13, 0x77, 0xf7, 0x0f, 0x93, 0x06, 0x10, 0x00, 0x6f, 0xf0, 0x5f, 0xfa,
-  0x23, 0x11, 0xf1, 0x00, 0x6f, 0xf0, 0x9f, 0xfa, 0x13, 0x01, 0x01, 0xfd,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x6f, 0x23, 0x26, 0x11, 0x02,
-  0x23, 0x24, 0x81, 0x02, 0x23, 0x22, 0x91, 0x02, 0x13, 0x07, 0x10, 0x01,
-  0x23, 0x82, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x13, 0x07, 0x50, 0x00, 0xa3, 0x82, 0xe7, 0x00, 0x13, 0x04, 0x41, 0x01,
-  0x23, 0xa4, 0x87, 0x00, 0x23, 0x2a, 0x01, 0x00, 0x23, 0x2c, 0x01, 0x00,
-  0x23, 0x1e, 0x01, 0x00, 0xef, 0xe0, 0x8f, 0x80, 0xef, 0xe0, 0x8f, 0xe5,
-  0x03, 0x56, 0x41, 0x01, 0x93, 0x07, 0x04, 0x00, 0x93, 0x06, 0xc1, 0x00,
-  0x13, 0x07, 0x00, 0x00, 0x93, 0x87, 0x27, 0x00, 0x63, 0x10, 0xa7, 0x04,
-  0x93, 0x57, 0x16, 0x00, 0x23, 0x20, 0xf1, 0x00, 0xef, 0xe0, 0x4f, 0xe3,
-  0x23, 0x22, 0xa1, 0x00, 0x13, 0x04, 0x00, 0x00, 0x93, 0x06, 0x10, 0x00,
-  0x03, 0x27, 0x41, 0x00, 0x93, 0x77, 0xf4, 0x0f, 0x63, 0xea, 0xe7, 0x02,
-  0x83, 0x20, 0xc1, 0x02, 0x03, 0x24, 0x81, 0x02, 0x83, 0x24, 0x41, 0x02,
-  0x13, 0x85, 0x06, 0x00, 0x13, 0x01, 0x01, 0x03, 0x67, 0x80, 0x00, 0x00,
-  0x83, 0xd5, 0x07, 0x00, 0x13, 0x07, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x90, 0xb6, 0x00, 0x93, 0x86, 0x26, 0x00, 0x6f, 0xf0, 0x9f, 0xfa,
-  0x93, 0x17, 0x14, 0x00, 0x93, 0x87, 0xc7, 0x00, 0xb3, 0x87, 0x27, 0x00,
-  0x03, 0xd6, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x84, 0x87, 0x21,
-  0x83, 0x27, 0x01, 0x00, 0x23, 0x24, 0xd1, 0x00, 0x63, 0x68, 0xf6, 0x02,
-  0xef, 0xe0, 0x8f, 0xe5, 0x83, 0x26, 0x81, 0x00, 0xb3, 0x87, 0x84, 0x00,
-  0x13, 0x06, 0x10, 0x00, 0x63, 0x08, 0x05, 0x00, 0x23, 0x86, 0xc7, 0x00,
-  0x13, 0x04, 0x14, 0x00, 0x6f, 0xf0, 0x5f, 0xf8, 0x23, 0x88, 0xc7, 0x00,
-  0x23, 0x8a, 0xc7, 0x00, 0x6f, 0xf0, 0x1f, 0xff, 0xef, 0xe0, 0xcf, 0xe2,
-  0xb3, 0x87, 0x84, 0x00, 0x63, 0x08, 0x05, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0x93, 0x06, 0x00, 0x00, 0x6f, 0xf0, 0x9f, 0xfd, 0x23, 0x88, 0x07, 0x00,
-  0x23, 0x8a, 0x07, 0x00, 0x6f, 0xf0, 0x1f, 0xff, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21, 0x13, 0x06, 0x40, 0x00,
-  0xb3, 0x86, 0xe7, 0x00, 0x23, 0x86, 0x06, 0x00, 0x23, 0x88, 0x06, 0x00,
-  0x23, 0x8a, 0x06, 0x00, 0x13, 0x07, 0x17, 0x00, 0xe3, 0x16, 0xc7, 0xfe,
-  0x23, 0x8c, 0x07, 0x00, 0x23, 0x84, 0x07, 0x00, 0xa3, 0x8c, 0x07, 0x00,
-  0x23, 0x8d, 0x07, 0x00, 0xa3, 0x8d, 0x07, 0x00, 0x23, 0x8e, 0x07, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21,
-  0x23, 0xa0, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00,
-  0x23, 0x83, 0x07, 0x00, 0xa3, 0x83, 0x07, 0x00, 0x23, 0x85, 0x07, 0x00,
-  0xa3, 0x85, 0x07, 0x00, 0x6f, 0xf0, 0x9f, 0xf9, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x21, 0x03, 0xc5, 0x77, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x82, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x21, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x82, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x83, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x21, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x85, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x21, 0x03, 0xc5, 0xb7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x86, 0x87, 0x21, 0x03, 0xc6, 0x96, 0x01,
-  0x93, 0x05, 0x40, 0x00, 0x93, 0x87, 0x87, 0x21, 0x13, 0x77, 0xf6, 0x0f,
-  0x63, 0xe0, 0xc5, 0x08, 0xb7, 0x86, 0x00, 0x00, 0x13, 0x17, 0x27, 0x00,
-  0x93, 0x86, 0x06, 0x16, 0x33, 0x07, 0xd7, 0x00, 0x03, 0x27, 0x07, 0x00,
-  0x67, 0x00, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00, 0x23, 0x8d, 0xe7, 0x00,
-  0xa3, 0x8d, 0x07, 0x00, 0xa3, 0x8c, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x8d, 0xe7, 0x00, 0xa3, 0x8d, 0xe7, 0x00,
-  0x13, 0x07, 0x20, 0x00, 0x6f, 0xf0, 0x9f, 0xfe, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x8d, 0xe7, 0x00, 0x13, 0x07, 0x20, 0x00, 0xa3, 0x8d, 0xe7, 0x00,
-  0x13, 0x07, 0x30, 0x00, 0x6f, 0xf0, 0x1f, 0xfd, 0x13, 0x07, 0x20, 0x00,
-  0x23, 0x8d, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x8d, 0xe7, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0x6f, 0xf0, 0x9f, 0xfb, 0x13, 0x07, 0x20, 0x00,
-  0x23, 0x8d, 0xe7, 0x00, 0x6f, 0xf0, 0xdf, 0xfe, 0x23, 0x8d, 0x06, 0x00,
-  0xa3, 0x8d, 0x06, 0x00, 0xa3, 0x8c, 0x06, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00,
-  0x93, 0x07, 0x84, 0x21, 0x23, 0x24, 0x11, 0x00, 0x83, 0xc7, 0x47, 0x00,
-  0x13, 0x04, 0x84, 0x21, 0x63, 0x96, 0x07, 0x00, 0x83, 0x47, 0x54, 0x00,
-  0x63, 0x88, 0x07, 0x00, 0x23, 0x20, 0x04, 0x00, 0x23, 0x05, 0x04, 0x00,
-  0xa3, 0x05, 0x04, 0x00, 0x83, 0x27, 0x04, 0x00, 0x13, 0x07, 0x60, 0x00,
-  0x63, 0x6e, 0xf7, 0x14, 0x37, 0x87, 0x00, 0x00, 0x93, 0x97, 0x27, 0x00,
-  0x13, 0x07, 0x47, 0x17, 0xb3, 0x87, 0xe7, 0x00, 0x83, 0xa7, 0x07, 0x00,
-  0x67, 0x80, 0x07, 0x00, 0x83, 0x47, 0x54, 0x00, 0x63, 0x80, 0x07, 0x04,
-  0xa3, 0x02, 0x04, 0x00, 0x83, 0x47, 0x74, 0x00, 0x63, 0x80, 0x07, 0x02,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x05, 0x00, 0x00, 0x13, 0x05, 0x50, 0x00, 0x23, 0x83, 0xe7, 0x00,
-  0xef, 0xf0, 0x8f, 0xb6, 0xa3, 0x03, 0x04, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x83, 0x47, 0x44, 0x00, 0xe3, 0x86, 0x07, 0xfe, 0x23, 0x02, 0x04, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0xa3, 0x03, 0xf4, 0x00, 0xa3, 0x05, 0x04, 0x00,
-  0x23, 0x04, 0x04, 0x00, 0x23, 0x0e, 0x04, 0x00, 0xef, 0xe0, 0x8f, 0xbc,
-  0x63, 0x04, 0x05, 0x00, 0xef, 0xf0, 0x9f, 0xdb, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x20, 0xf4, 0x00, 0x6f, 0xf0, 0xdf, 0xfb, 0xef, 0xf0, 0x8f, 0xaf,
-  0x83, 0x47, 0x64, 0x00, 0xe3, 0x88, 0x07, 0xfa, 0x23, 0x03, 0x04, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e, 0xa3, 0x05, 0x04, 0x00,
-  0x23, 0x82, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x81, 0xe7, 0x00,
-  0x93, 0x07, 0x20, 0x00, 0x6f, 0xf0, 0xdf, 0xfc, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x1e, 0x83, 0xc7, 0x47, 0x00, 0xe3, 0x8e, 0x07, 0xf6,
-  0x93, 0x07, 0x30, 0x00, 0x6f, 0xf0, 0x5f, 0xfb, 0x93, 0x05, 0x40, 0x06,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xd0, 0x9f, 0x9f, 0x93, 0x07, 0x40, 0x00,
-  0x6f, 0xf0, 0x1f, 0xfa, 0x13, 0x05, 0x00, 0x00, 0xef, 0xd0, 0xdf, 0xad,
-  0xe3, 0x0a, 0x05, 0xf4, 0xef, 0xf0, 0x0f, 0xb2, 0xef, 0xf0, 0x1f, 0xb8,
-  0x93, 0x07, 0x50, 0x00, 0x6f, 0xf0, 0x5f, 0xf8, 0x83, 0x47, 0xa4, 0x00,
-  0xe3, 0x8e, 0x07, 0xf2, 0x23, 0x05, 0x04, 0x00, 0xef, 0xf0, 0x9f, 0xbf,
-  0xa3, 0x04, 0xa4, 0x00, 0x83, 0x47, 0x94, 0x00, 0x63, 0x8e, 0x07, 0x02,
-  0xef, 0xe0, 0xcf, 0xb3, 0x63, 0x02, 0x05, 0x04, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x0c, 0xe4, 0x00, 0x23, 0x04, 0xe4, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x1e, 0xa3, 0x03, 0x04, 0x00, 0x13, 0x05, 0xf0, 0xff,
-  0xa3, 0x82, 0xe7, 0x00, 0xef, 0xd0, 0xdf, 0x8f, 0xef, 0xf0, 0xcf, 0x93,
-  0x23, 0x20, 0x04, 0x00, 0x6f, 0xf0, 0x1f, 0xef, 0x83, 0x47, 0xc4, 0x01,
-  0x63, 0x8a, 0x07, 0x00, 0xef, 0xf0, 0x1f, 0xdb, 0x23, 0x0e, 0x04, 0x00,
-  0x93, 0x07, 0x60, 0x00, 0x6f, 0xf0, 0x9f, 0xf1, 0x83, 0x47, 0xc4, 0x01,
-  0x93, 0x87, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x0e, 0xf4, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfe, 0x93, 0x07, 0x10, 0x00, 0xa3, 0x05, 0xf4, 0x00,
-  0x03, 0x47, 0xa4, 0x00, 0xe3, 0x0a, 0x07, 0xea, 0x23, 0x05, 0x04, 0x00,
-  0xa3, 0x05, 0x04, 0x00, 0x03, 0x47, 0x94, 0x00, 0xe3, 0x02, 0x07, 0xee,
-  0x6f, 0xf0, 0xdf, 0xfa, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xa5, 0x87, 0x21,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x23,
-  0xa3, 0x8f, 0x07, 0x00, 0x23, 0x8f, 0x07, 0x00, 0x23, 0x90, 0x07, 0x00,
-  0x23, 0xa0, 0x07, 0x02, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x26, 0x11, 0x00, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0x93, 0x87, 0x87, 0x1e, 0x93, 0x04, 0x10, 0x00,
-  0x13, 0x05, 0x00, 0x04, 0x37, 0x84, 0x00, 0x00, 0x13, 0x04, 0x84, 0x23,
-  0xa3, 0x85, 0x97, 0x00, 0xef, 0xd0, 0x0f, 0xe5, 0x83, 0x57, 0x24, 0x01,
-  0x13, 0x07, 0x30, 0x01, 0x23, 0x10, 0xf1, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x6f, 0x23, 0x82, 0xe7, 0x00, 0x23, 0xa0, 0x07, 0x00,
-  0xa3, 0x82, 0x97, 0x00, 0x23, 0xa4, 0x27, 0x00, 0xef, 0xd0, 0x1f, 0xb3,
-  0xa3, 0x0f, 0x94, 0x00, 0x83, 0x20, 0xc1, 0x00, 0x23, 0x20, 0x04, 0x02,
-  0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00,
-  0x13, 0x04, 0x05, 0x00, 0x13, 0x05, 0x00, 0x04, 0x23, 0x24, 0x11, 0x00,
-  0xef, 0xd0, 0x4f, 0xe0, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x1e,
-  0x23, 0x86, 0x87, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x23,
-  0xa3, 0x8f, 0x07, 0x00, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x23, 0x90, 0x07, 0x00, 0x23, 0xa0, 0x07, 0x02, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x23,
-  0x03, 0xc5, 0xf7, 0x01, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x23, 0x83, 0xa6, 0x07, 0x02, 0x13, 0x07, 0x80, 0x3e,
-  0x63, 0x98, 0xe6, 0x00, 0x23, 0xa0, 0x07, 0x02, 0x13, 0x05, 0x10, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x03, 0xa7, 0x07, 0x02, 0x13, 0x05, 0x00, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x23, 0xa0, 0xe7, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x23, 0x83, 0xd7, 0xc7, 0x01,
-  0x13, 0x05, 0x80, 0x00, 0x93, 0xf7, 0x07, 0x04, 0x63, 0x84, 0x07, 0x00,
-  0x13, 0x05, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xfb,
-  0x23, 0x22, 0x81, 0x04, 0x37, 0x84, 0x00, 0x00, 0x23, 0x24, 0x11, 0x04,
-  0x23, 0x20, 0x91, 0x04, 0x93, 0x07, 0x84, 0x23, 0x83, 0xc7, 0xe7, 0x01,
-  0x63, 0x9e, 0x07, 0x00, 0x13, 0x05, 0x00, 0x00, 0x83, 0x20, 0x81, 0x04,
-  0x03, 0x24, 0x41, 0x04, 0x83, 0x24, 0x01, 0x04, 0x13, 0x01, 0xc1, 0x04,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x04, 0x84, 0x23, 0x23, 0x0f, 0x04, 0x00,
-  0xef, 0xe0, 0x8f, 0x87, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x6f,
-  0x13, 0x07, 0x20, 0x01, 0x23, 0x82, 0xe7, 0x00, 0x93, 0x06, 0x10, 0x00,
-  0x23, 0xa0, 0xd7, 0x00, 0xa3, 0x82, 0xe7, 0x00, 0x13, 0x07, 0x81, 0x01,
-  0x23, 0xa4, 0xe7, 0x00, 0x23, 0x20, 0xa1, 0x00, 0xef, 0xd0, 0x9f, 0x9f,
-  0x03, 0x57, 0x81, 0x01, 0x93, 0x07, 0x40, 0x00, 0x83, 0x54, 0xa1, 0x01,
-  0x23, 0x22, 0xe1, 0x00, 0x03, 0x27, 0x01, 0x00, 0x63, 0x14, 0xf7, 0x22,
-  0x83, 0x27, 0x41, 0x00, 0x03, 0x57, 0x01, 0x02, 0x37, 0x03, 0xff, 0x00,
-  0x13, 0x96, 0x87, 0x00, 0x83, 0x57, 0xc1, 0x01, 0x93, 0x56, 0x87, 0x00,
-  0x33, 0x76, 0x66, 0x00, 0x93, 0xf5, 0x07, 0xf0, 0xb3, 0xe6, 0xb6, 0x00,
-  0xb3, 0xe6, 0xc6, 0x00, 0x03, 0x26, 0x41, 0x00, 0x37, 0x05, 0x01, 0x00,
-  0x13, 0x05, 0xf5, 0xff, 0x13, 0x16, 0x06, 0x01, 0x93, 0x97, 0x87, 0x00,
-  0x33, 0x76, 0x66, 0x00, 0xb3, 0xf7, 0xa7, 0x00, 0xb3, 0xe7, 0xc7, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x83, 0x55, 0xe1, 0x01, 0x33, 0x67, 0xf7, 0x00,
-  0x83, 0x57, 0x21, 0x02, 0x93, 0xf3, 0x05, 0xf0, 0x93, 0x92, 0x84, 0x00,
-  0x13, 0xd6, 0x87, 0x00, 0xb3, 0xf2, 0x62, 0x00, 0x33, 0x66, 0x76, 0x00,
-  0x33, 0x66, 0x56, 0x00, 0x93, 0x95, 0x85, 0x00, 0x93, 0x92, 0x04, 0x01,
-  0xb3, 0xf2, 0x62, 0x00, 0xb3, 0xf5, 0xa5, 0x00, 0xb3, 0xe5, 0x55, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0xb3, 0xe7, 0xb7, 0x00, 0xe3, 0x96, 0xe6, 0xf0,
-  0xe3, 0x94, 0xc6, 0xf0, 0xe3, 0x92, 0xf6, 0xf0, 0x03, 0x27, 0x01, 0x00,
-  0x93, 0x07, 0x40, 0x00, 0x63, 0x1e, 0xf7, 0x24, 0x13, 0x07, 0x81, 0x01,
-  0x13, 0x06, 0xe1, 0x02, 0x93, 0x07, 0x00, 0x00, 0x83, 0x56, 0xc7, 0x00,
-  0x13, 0x07, 0x27, 0x00, 0xb3, 0x87, 0xd7, 0x00, 0x93, 0x97, 0x07, 0x01,
-  0x93, 0xd7, 0x07, 0x01, 0xe3, 0x16, 0xe6, 0xfe, 0x03, 0x57, 0x04, 0x00,
-  0xe3, 0x06, 0xf7, 0xec, 0x23, 0x10, 0xf4, 0x00, 0x83, 0x27, 0x41, 0x00,
-  0x83, 0x56, 0x61, 0x03, 0x83, 0x20, 0x01, 0x00, 0x93, 0x93, 0x87, 0x00,
-  0x83, 0x57, 0x01, 0x02, 0x23, 0x22, 0xd1, 0x00, 0x13, 0x03, 0x40, 0x00,
-  0x23, 0x26, 0xf1, 0x00, 0x03, 0x56, 0xc1, 0x01, 0x83, 0x57, 0x01, 0x03,
-  0x03, 0x57, 0x81, 0x03, 0x83, 0x55, 0x41, 0x02, 0x83, 0x52, 0x61, 0x02,
-  0x83, 0x56, 0x81, 0x02, 0x63, 0x9a, 0x60, 0x3e, 0x83, 0x20, 0xc1, 0x00,
-  0x37, 0x03, 0xff, 0x00, 0x13, 0x76, 0x06, 0xf0, 0x93, 0xf0, 0xf0, 0x0f,
-  0xb3, 0xf3, 0x63, 0x00, 0x33, 0x66, 0x16, 0x00, 0x33, 0x66, 0x76, 0x00,
-  0x83, 0x53, 0xa1, 0x02, 0x23, 0x22, 0xc4, 0x00, 0x13, 0x96, 0x02, 0x01,
-  0x33, 0x73, 0x66, 0x00, 0x37, 0x06, 0x01, 0x00, 0x13, 0x06, 0xf6, 0xff,
-  0x93, 0x90, 0x83, 0x00, 0xb3, 0xf0, 0xc0, 0x00, 0xb3, 0xe0, 0x60, 0x00,
-  0x03, 0x53, 0xe1, 0x02, 0x93, 0xf2, 0x02, 0xf0, 0x93, 0xd3, 0x83, 0x00,
-  0x93, 0x74, 0xf3, 0x0f, 0xb3, 0xe0, 0x14, 0x00, 0x93, 0xf4, 0x05, 0xf0,
-  0x93, 0x95, 0x85, 0x00, 0x23, 0x24, 0x14, 0x00, 0xb3, 0xf5, 0xc5, 0x00,
-  0x93, 0xd0, 0x86, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xb3, 0xe6, 0xb6, 0x00,
-  0xb3, 0xe0, 0x90, 0x00, 0x93, 0x96, 0x06, 0x01, 0x23, 0x16, 0x14, 0x00,
-  0x93, 0xd6, 0x06, 0x01, 0x23, 0x17, 0xd4, 0x00, 0x83, 0x56, 0x41, 0x03,
-  0xb3, 0xe3, 0x53, 0x00, 0x93, 0x55, 0x87, 0x00, 0x93, 0xf6, 0x06, 0xf0,
-  0x23, 0x19, 0x74, 0x00, 0xb3, 0xe5, 0xb6, 0x00, 0x23, 0x18, 0xb4, 0x00,
-  0x83, 0x55, 0xc1, 0x02, 0x93, 0xd2, 0x87, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0x93, 0xf3, 0x05, 0xf0, 0x93, 0x95, 0x85, 0x00, 0xb3, 0xf5, 0xc5, 0x00,
-  0xb3, 0xe7, 0xb7, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0xb3, 0xe2, 0x72, 0x00,
-  0x93, 0x97, 0x07, 0x01, 0x23, 0x1a, 0x54, 0x00, 0x93, 0xd7, 0x07, 0x01,
-  0xb3, 0xe6, 0xe6, 0x00, 0x03, 0x27, 0x41, 0x00, 0x23, 0x1b, 0xf4, 0x00,
-  0x83, 0x57, 0x21, 0x03, 0x13, 0x15, 0x87, 0x00, 0x13, 0x73, 0x03, 0xf0,
-  0x93, 0xd5, 0x87, 0x00, 0x33, 0x75, 0xc5, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0xb3, 0xe5, 0x65, 0x00, 0xb3, 0xe7, 0xa7, 0x00, 0x23, 0x1d, 0xb4, 0x00,
-  0x93, 0x97, 0x07, 0x01, 0x23, 0x1c, 0xd4, 0x00, 0x93, 0xd7, 0x07, 0x01,
-  0x23, 0x1e, 0xf4, 0x00, 0x6f, 0x00, 0x40, 0x42, 0x83, 0x27, 0x41, 0x00,
-  0x03, 0x55, 0xa1, 0x02, 0x03, 0x27, 0x01, 0x00, 0x93, 0x96, 0x87, 0x00,
-  0x93, 0x07, 0x20, 0x00, 0x13, 0x13, 0x85, 0x00, 0x63, 0x14, 0xf7, 0x08,
-  0x03, 0x57, 0xc1, 0x01, 0xb7, 0x03, 0xff, 0x00, 0x13, 0xf6, 0x04, 0xf0,
-  0x93, 0x57, 0x87, 0x00, 0xb3, 0xe7, 0xc7, 0x00, 0xb3, 0xf6, 0x76, 0x00,
-  0xb3, 0xe6, 0xd7, 0x00, 0x83, 0x27, 0x41, 0x00, 0xb7, 0x02, 0x01, 0x00,
-  0x93, 0x82, 0xf2, 0xff, 0x13, 0x96, 0x07, 0x01, 0x93, 0x97, 0x84, 0x00,
-  0x33, 0x76, 0x76, 0x00, 0xb3, 0xf7, 0x57, 0x00, 0xb3, 0xe7, 0xc7, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x33, 0x67, 0xf7, 0x00, 0xb3, 0x77, 0x73, 0x00,
-  0x23, 0x24, 0xf1, 0x00, 0x83, 0x57, 0xe1, 0x02, 0x83, 0x55, 0xc1, 0x02,
-  0x13, 0x15, 0x05, 0x01, 0x13, 0xd6, 0x87, 0x00, 0x13, 0x03, 0x06, 0x00,
-  0x13, 0xf6, 0x05, 0xf0, 0x33, 0x66, 0xc3, 0x00, 0x03, 0x23, 0x81, 0x00,
-  0x93, 0x95, 0x85, 0x00, 0x33, 0x75, 0x75, 0x00, 0xb3, 0xf5, 0x55, 0x00,
-  0x33, 0x66, 0x66, 0x00, 0xb3, 0xe5, 0xa5, 0x00, 0x6f, 0xf0, 0x5f, 0xdc,
-  0x83, 0x55, 0x01, 0x02, 0x03, 0x57, 0x21, 0x02, 0xb7, 0x07, 0xff, 0x00,
-  0x93, 0x95, 0x05, 0x01, 0xb3, 0xf5, 0xf5, 0x00, 0x33, 0x67, 0xb7, 0x00,
-  0x83, 0x55, 0x21, 0x03, 0x13, 0xd6, 0x84, 0x00, 0xb3, 0x66, 0xd6, 0x00,
-  0x93, 0x95, 0x05, 0x01, 0xb3, 0xf5, 0xf5, 0x00, 0x33, 0x66, 0x66, 0x00,
-  0x83, 0x57, 0x41, 0x03, 0x6f, 0xf0, 0x1f, 0xd9, 0x03, 0x27, 0x01, 0x00,
-  0x93, 0x07, 0x20, 0x00, 0x63, 0x1c, 0xf7, 0x10, 0x83, 0x57, 0x01, 0x03,
-  0x13, 0x07, 0x81, 0x01, 0x93, 0x06, 0x30, 0x00, 0x93, 0xf7, 0x07, 0xf0,
-  0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01, 0x23, 0x24, 0xf1, 0x00,
-  0x83, 0x57, 0x21, 0x03, 0x93, 0x05, 0xd0, 0x00, 0x93, 0x03, 0xe0, 0x00,
-  0x93, 0xf7, 0x07, 0xf0, 0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01,
-  0x23, 0x26, 0xf1, 0x00, 0x83, 0x57, 0x41, 0x03, 0x93, 0x02, 0xc0, 0x00,
-  0x13, 0x03, 0x80, 0x00, 0x93, 0xf7, 0x07, 0xf0, 0x93, 0x97, 0x07, 0x01,
-  0x93, 0xd7, 0x07, 0x01, 0x23, 0x28, 0xf1, 0x00, 0x93, 0x07, 0x00, 0x00,
-  0x63, 0x84, 0xb6, 0x06, 0x13, 0x06, 0x27, 0x00, 0x63, 0xee, 0xd5, 0x00,
-  0x63, 0x80, 0x56, 0x04, 0x13, 0x85, 0x16, 0x00, 0x63, 0x76, 0xd3, 0x08,
-  0x93, 0x76, 0xf5, 0x0f, 0x13, 0x07, 0x06, 0x00, 0x6f, 0xf0, 0x1f, 0xfe,
-  0x63, 0x80, 0x76, 0x06, 0x13, 0x06, 0x00, 0x01, 0x83, 0x56, 0x67, 0x00,
-  0x13, 0x07, 0x27, 0x00, 0xb3, 0x86, 0xd7, 0x00, 0x93, 0x97, 0x06, 0x01,
-  0x93, 0x06, 0x00, 0x01, 0x93, 0xd7, 0x07, 0x01, 0xe3, 0x02, 0xd6, 0xd2,
-  0x6f, 0xf0, 0x9f, 0xfb, 0x03, 0x27, 0x81, 0x00, 0x93, 0x06, 0xd0, 0x00,
-  0xb3, 0x07, 0xf7, 0x00, 0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01,
-  0x13, 0x07, 0x06, 0x00, 0x6f, 0xf0, 0xdf, 0xf9, 0x83, 0x26, 0xc1, 0x00,
-  0x13, 0x07, 0x27, 0x00, 0xb3, 0x87, 0xf6, 0x00, 0x93, 0x97, 0x07, 0x01,
-  0x93, 0xd7, 0x07, 0x01, 0x93, 0x06, 0xe0, 0x00, 0x6f, 0xf0, 0x5f, 0xf8,
-  0x03, 0x27, 0x01, 0x01, 0xb3, 0x07, 0xf7, 0x00, 0x93, 0x97, 0x07, 0x01,
-  0x13, 0x07, 0x06, 0x00, 0x93, 0xd7, 0x07, 0x01, 0x13, 0x06, 0xf0, 0x00,
-  0x6f, 0xf0, 0x1f, 0xf9, 0x03, 0x57, 0x67, 0x00, 0x93, 0x76, 0xf5, 0x0f,
-  0x33, 0x87, 0xe7, 0x00, 0x93, 0x17, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01,
-  0x13, 0x07, 0x06, 0x00, 0x6f, 0xf0, 0xdf, 0xf4, 0x83, 0x57, 0x01, 0x02,
-  0x83, 0x43, 0xc1, 0x02, 0x83, 0x42, 0x81, 0x03, 0x93, 0xf7, 0x07, 0xf0,
-  0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01, 0x23, 0x26, 0xf1, 0x00,
-  0x37, 0x86, 0x00, 0x00, 0x93, 0xf7, 0xf4, 0x0f, 0x23, 0x24, 0xf1, 0x00,
-  0x13, 0x07, 0x81, 0x01, 0x93, 0x06, 0x00, 0x00, 0x93, 0x07, 0x00, 0x00,
-  0x13, 0x05, 0x00, 0x01, 0x13, 0x03, 0x20, 0x01, 0x13, 0x06, 0x06, 0x19,
-  0x63, 0x66, 0xd5, 0x02, 0x93, 0x95, 0x26, 0x00, 0xb3, 0x85, 0xc5, 0x00,
-  0x83, 0xa5, 0x05, 0x00, 0x67, 0x80, 0x05, 0x00, 0x83, 0x26, 0x81, 0x00,
-  0x13, 0x07, 0x27, 0x00, 0xb3, 0x87, 0xf6, 0x00, 0x93, 0x97, 0x07, 0x01,
-  0x93, 0xd7, 0x07, 0x01, 0x93, 0x06, 0x20, 0x00, 0x83, 0x55, 0x07, 0x00,
-  0x93, 0x86, 0x16, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xb3, 0x85, 0xb7, 0x00,
-  0x93, 0x97, 0x05, 0x01, 0x93, 0xd7, 0x07, 0x01, 0x63, 0x94, 0x66, 0x02,
-  0x6f, 0xf0, 0x5f, 0xc2, 0x83, 0x26, 0xc1, 0x00, 0x13, 0x07, 0x27, 0x00,
-  0xb3, 0x87, 0xf6, 0x00, 0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01,
-  0x93, 0x06, 0x50, 0x00, 0x93, 0x86, 0x16, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x13, 0x07, 0x27, 0x00, 0x6f, 0xf0, 0x1f, 0xf9, 0xb3, 0x87, 0xf3, 0x00,
-  0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01, 0x13, 0x07, 0x27, 0x00,
-  0x93, 0x06, 0xb0, 0x00, 0x6f, 0xf0, 0x5f, 0xfa, 0xb3, 0x87, 0xf2, 0x00,
-  0x93, 0x97, 0x07, 0x01, 0x93, 0xd7, 0x07, 0x01, 0x13, 0x07, 0x27, 0x00,
-  0x93, 0x06, 0x10, 0x01, 0x6f, 0xf0, 0xdf, 0xf8, 0x03, 0x23, 0xc1, 0x00,
-  0x03, 0x25, 0x01, 0x00, 0x13, 0x53, 0x83, 0x00, 0x23, 0x2a, 0x61, 0x00,
-  0x03, 0x53, 0xe1, 0x01, 0x93, 0x10, 0x83, 0x00, 0x23, 0x24, 0x61, 0x00,
-  0x37, 0x03, 0x01, 0x00, 0x13, 0x03, 0xf3, 0xff, 0xb3, 0xf0, 0x60, 0x00,
-  0x23, 0x28, 0x11, 0x00, 0x93, 0x00, 0x20, 0x00, 0x63, 0x12, 0x15, 0x12,
-  0xb7, 0x00, 0xff, 0x00, 0x13, 0x85, 0x00, 0x00, 0xb3, 0xf3, 0x13, 0x00,
-  0x13, 0x76, 0xf6, 0x0f, 0x93, 0xf0, 0x04, 0xf0, 0xb3, 0xe0, 0xc0, 0x00,
-  0x03, 0x56, 0x21, 0x03, 0xb3, 0xe0, 0x70, 0x00, 0x23, 0x22, 0x14, 0x00,
-  0x93, 0x13, 0x86, 0x00, 0x93, 0x90, 0x07, 0x01, 0xb3, 0xf0, 0xa0, 0x00,
-  0xb3, 0xf3, 0x63, 0x00, 0xb3, 0xe3, 0x13, 0x00, 0x83, 0x50, 0x41, 0x03,
-  0x03, 0x25, 0x81, 0x00, 0x93, 0xf7, 0x07, 0xf0, 0x93, 0xf4, 0xf0, 0x0f,
-  0xb3, 0xe4, 0x74, 0x00, 0x93, 0x73, 0x05, 0xf0, 0x03, 0x25, 0x41, 0x01,
-  0x23, 0x24, 0x94, 0x00, 0x13, 0x56, 0x86, 0x00, 0xb3, 0x63, 0x75, 0x00,
-  0x23, 0x16, 0x74, 0x00, 0x03, 0x25, 0x01, 0x01, 0x83, 0x43, 0xc1, 0x00,
-  0x33, 0x66, 0xf6, 0x00, 0x93, 0xd7, 0x86, 0x00, 0xb3, 0xe3, 0xa3, 0x00,
-  0x93, 0x93, 0x03, 0x01, 0x93, 0xd3, 0x03, 0x01, 0x23, 0x17, 0x74, 0x00,
-  0x23, 0x19, 0xc4, 0x00, 0x13, 0xf6, 0x02, 0xf0, 0xb3, 0xe7, 0xc7, 0x00,
-  0x23, 0x18, 0xf4, 0x00, 0x83, 0x57, 0x21, 0x02, 0x13, 0xd6, 0x85, 0x00,
-  0x93, 0xf5, 0xf5, 0x0f, 0x93, 0xf3, 0x07, 0xf0, 0x93, 0x97, 0x87, 0x00,
-  0xb3, 0xf7, 0x67, 0x00, 0xb3, 0xe5, 0xf5, 0x00, 0x83, 0x27, 0x41, 0x00,
-  0x03, 0x45, 0x41, 0x00, 0x93, 0x92, 0x82, 0x00, 0x33, 0x66, 0x76, 0x00,
-  0x93, 0x95, 0x05, 0x01, 0xb3, 0xf2, 0x62, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x13, 0x17, 0x87, 0x00, 0x23, 0x1a, 0xc4, 0x00, 0x93, 0xd5, 0x05, 0x01,
-  0x93, 0xd7, 0x87, 0x00, 0x93, 0xf0, 0x00, 0xf0, 0xb3, 0xe6, 0x56, 0x00,
-  0x33, 0x77, 0x67, 0x00, 0x23, 0x1b, 0xb4, 0x00, 0xb3, 0xe7, 0x17, 0x00,
-  0x93, 0x96, 0x06, 0x01, 0x33, 0x67, 0xa7, 0x00, 0x23, 0x1d, 0xf4, 0x00,
-  0x93, 0xd6, 0x06, 0x01, 0x13, 0x17, 0x07, 0x01, 0x23, 0x1c, 0xd4, 0x00,
-  0x13, 0x57, 0x07, 0x01, 0x23, 0x1e, 0xe4, 0x00, 0xef, 0xf0, 0x5f, 0x91,
-  0xef, 0xe0, 0x1f, 0x93, 0x13, 0x05, 0x10, 0x00, 0x6f, 0xf0, 0xdf, 0x94,
-  0x03, 0x25, 0x41, 0x00, 0x93, 0xd0, 0x84, 0x00, 0xb3, 0xe0, 0x70, 0x00,
-  0x13, 0x15, 0x85, 0x00, 0x93, 0x53, 0x87, 0x00, 0x23, 0x22, 0x14, 0x00,
-  0x33, 0x65, 0x75, 0x00, 0x23, 0x24, 0xa4, 0x00, 0x13, 0x95, 0x84, 0x00,
-  0x33, 0x75, 0x65, 0x00, 0x93, 0x53, 0x86, 0x00, 0xb3, 0xe3, 0xa3, 0x00,
-  0x93, 0x93, 0x03, 0x01, 0x93, 0xd3, 0x03, 0x01, 0x23, 0x16, 0x74, 0x00,
-  0x83, 0x53, 0xc1, 0x02, 0x23, 0x17, 0xb4, 0x00, 0x83, 0x55, 0xe1, 0x02,
-  0x93, 0x93, 0x83, 0x00, 0xb3, 0xf3, 0x63, 0x00, 0x13, 0xd5, 0x85, 0x00,
-  0x33, 0x65, 0x75, 0x00, 0x13, 0x15, 0x05, 0x01, 0x13, 0x55, 0x05, 0x01,
-  0x23, 0x19, 0xa4, 0x00, 0x83, 0x23, 0x01, 0x01, 0x03, 0x25, 0x41, 0x01,
-  0x13, 0x16, 0x86, 0x00, 0x93, 0x95, 0x85, 0x00, 0x33, 0x65, 0x75, 0x00,
-  0x13, 0x15, 0x05, 0x01, 0x13, 0x55, 0x05, 0x01, 0x23, 0x18, 0xa4, 0x00,
-  0x33, 0x75, 0x66, 0x00, 0x03, 0x26, 0x81, 0x00, 0xb3, 0xf5, 0x65, 0x00,
-  0x93, 0xd7, 0x87, 0x00, 0x13, 0x56, 0x86, 0x00, 0x33, 0x66, 0xa6, 0x00,
-  0x13, 0x16, 0x06, 0x01, 0x13, 0x56, 0x06, 0x01, 0xb3, 0xe7, 0xb7, 0x00,
-  0x23, 0x1a, 0xc4, 0x00, 0x93, 0x97, 0x07, 0x01, 0x23, 0x1b, 0x54, 0x00,
-  0x93, 0xd7, 0x07, 0x01, 0x23, 0x1d, 0xf4, 0x00, 0x83, 0x57, 0xa1, 0x03,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x1c, 0xd4, 0x00, 0x93, 0xf7, 0x07, 0xf0,
-  0xb3, 0xe7, 0xe7, 0x00, 0x6f, 0xf0, 0x9f, 0xaf, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x23, 0x13, 0x07, 0x10, 0x00, 0x23, 0x8f, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x37, 0x87, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0x13, 0x07, 0xc7, 0x1d, 0x13, 0x06, 0x70, 0x00,
-  0xb3, 0x05, 0xd7, 0x00, 0x83, 0xc5, 0x15, 0x00, 0x93, 0x86, 0x16, 0x00,
-  0xb3, 0xc7, 0xf5, 0x00, 0xe3, 0x98, 0xc6, 0xfe, 0x03, 0x47, 0x87, 0x00,
-  0x13, 0x85, 0x27, 0x00, 0x13, 0x75, 0xf5, 0x0f, 0x33, 0x05, 0xe5, 0x40,
-  0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x13, 0x05, 0x10, 0x00, 0x23, 0x24, 0x11, 0x00, 0xef, 0xc0, 0x1f, 0xda,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x1d, 0x63, 0x0c, 0x05, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x80, 0xe7, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x23, 0x80, 0x07, 0x00,
-  0x6f, 0xf0, 0x1f, 0xff, 0xb7, 0xc7, 0x00, 0x00, 0x93, 0x86, 0x07, 0x10,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x28, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x20,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x26, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x30,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x24, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x40,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x22, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x50,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x20, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x60,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x2e, 0xd7, 0x00, 0x93, 0x87, 0x07, 0x70,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x2c, 0xf7, 0x00, 0xb7, 0xd7, 0x00, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x80, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x2a, 0xf7, 0x00, 0x23, 0x24, 0x11, 0x00, 0xef, 0xe0, 0x1f, 0x9c,
-  0xef, 0xc0, 0xdf, 0xc1, 0x13, 0x05, 0x80, 0x00, 0xef, 0xc0, 0xdf, 0xc6,
-  0x13, 0x05, 0x80, 0x02, 0xef, 0xc0, 0x1f, 0xc8, 0xef, 0xf0, 0x1f, 0xf4,
-  0xef, 0xc0, 0x9f, 0xea, 0xef, 0xd0, 0x4f, 0x98, 0xef, 0xd0, 0x4f, 0x8a,
-  0xef, 0xd0, 0x4f, 0xb0, 0xef, 0xe0, 0x8f, 0xc1, 0xef, 0xd0, 0xcf, 0xa9,
-  0xef, 0xd0, 0x0f, 0xe0, 0xef, 0xe0, 0x8f, 0xde, 0xef, 0xf0, 0xcf, 0xdd,
-  0xef, 0xf0, 0xcf, 0xa9, 0x13, 0x05, 0x10, 0x00, 0xef, 0xc0, 0x9f, 0xc6,
-  0x13, 0x05, 0x20, 0x00, 0xef, 0xc0, 0x1f, 0xc6, 0x13, 0x05, 0x40, 0x00,
-  0xef, 0xc0, 0x9f, 0xc5, 0xb7, 0xa5, 0x93, 0xd6, 0x93, 0x85, 0x05, 0x40,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xc0, 0x1f, 0xed, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x1d, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x84, 0xe7, 0x00,
-  0xef, 0xe0, 0x4f, 0xbf, 0xef, 0xe0, 0x0f, 0xcc, 0x63, 0x06, 0x05, 0x00,
-  0xef, 0xf0, 0x4f, 0xa5, 0xef, 0xd0, 0xcf, 0xeb, 0xef, 0xd0, 0x5f, 0xa8,
-  0x6f, 0xf0, 0x9f, 0xfe, 0x13, 0x07, 0x20, 0x00, 0x63, 0x0a, 0xe5, 0x00,
-  0x13, 0x07, 0x30, 0x00, 0x63, 0x08, 0xe5, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x63, 0x18, 0xe5, 0x00, 0x6f, 0xc0, 0x1f, 0xc0, 0x13, 0x05, 0x40, 0x00,
-  0x6f, 0xf0, 0x9f, 0xff, 0x67, 0x80, 0x00, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0x63, 0x0a, 0xe5, 0x00, 0x13, 0x07, 0x30, 0x00, 0x63, 0x08, 0xe5, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x63, 0x18, 0xe5, 0x00, 0x6f, 0xc0, 0x9f, 0xbe,
-  0x13, 0x05, 0x40, 0x00, 0x6f, 0xf0, 0x9f, 0xff, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00,
-  0xef, 0xc0, 0xdf, 0xf7, 0x13, 0x05, 0x20, 0x00, 0xef, 0xc0, 0xdf, 0xf8,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xc0, 0x5f, 0xf8, 0x13, 0x05, 0x00, 0x02,
-  0xef, 0xc0, 0xdf, 0xf7, 0x13, 0x05, 0x00, 0x04, 0xef, 0xc0, 0x5f, 0xf7,
-  0x13, 0x05, 0x00, 0x08, 0xef, 0xc0, 0xdf, 0xf6, 0x37, 0x85, 0x00, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0xef, 0xc0, 0x1f, 0xf6, 0x13, 0x04, 0xc4, 0x1d,
-  0xef, 0xe0, 0x0f, 0xc5, 0xef, 0xc0, 0xdf, 0xf1, 0x63, 0x06, 0x05, 0x00,
-  0x13, 0x05, 0x80, 0x00, 0xef, 0xc0, 0x1f, 0xb9, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xc0, 0x5f, 0xee, 0xe3, 0x02, 0x05, 0xfe, 0x83, 0x47, 0x94, 0x00,
-  0x63, 0x8e, 0x07, 0x00, 0x13, 0x05, 0x40, 0x00, 0xef, 0xc0, 0x5f, 0xb6,
-  0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x90, 0x00, 0xef, 0xe0, 0x0f, 0xea,
-  0x6f, 0xf0, 0x5f, 0xfc, 0x83, 0x47, 0x94, 0x00, 0xb7, 0xa5, 0x93, 0xd6,
-  0x93, 0x85, 0x05, 0x40, 0x93, 0x87, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0x13, 0x05, 0x10, 0x00, 0xa3, 0x04, 0xf4, 0x00, 0xef, 0xc0, 0xdf, 0xda,
-  0x6f, 0xf0, 0x1f, 0xfa, 0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00,
-  0xef, 0xe0, 0x1f, 0x88, 0xef, 0xe0, 0x1f, 0xbe, 0x6f, 0xf0, 0x9f, 0xff,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0xef, 0xe0, 0x8f, 0xec, 0xef, 0xf0, 0x0f, 0xa6,
-  0xef, 0xe0, 0x4f, 0xde, 0xe3, 0x0a, 0x05, 0xfe, 0x93, 0x05, 0x30, 0x00,
-  0x13, 0x05, 0x80, 0x02, 0xef, 0xc0, 0x5f, 0xc5, 0x63, 0x0c, 0x05, 0x02,
-  0x13, 0x05, 0x80, 0x00, 0xef, 0xc0, 0x9f, 0xb2, 0x93, 0x07, 0x05, 0x00,
-  0x13, 0x05, 0x20, 0x00, 0x63, 0x8a, 0x07, 0x00, 0x13, 0x05, 0x00, 0x02,
-  0xef, 0xc0, 0x5f, 0xb1, 0x13, 0x35, 0x15, 0x00, 0x13, 0x15, 0x35, 0x00,
-  0x93, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x8f, 0xe0, 0x13, 0x05, 0x30, 0x00,
-  0xef, 0xf0, 0x0f, 0xca, 0xef, 0xf0, 0x4f, 0xce, 0x63, 0x00, 0x05, 0x02,
-  0x13, 0x05, 0x00, 0x04, 0xef, 0xc0, 0xdf, 0xae, 0x63, 0x1a, 0x05, 0x00,
-  0xef, 0xf0, 0x0f, 0xce, 0x63, 0x06, 0x05, 0x00, 0x13, 0x05, 0x20, 0x00,
-  0xef, 0xf0, 0xcf, 0xc7, 0xef, 0xf0, 0x4f, 0xd2, 0xe3, 0x02, 0x05, 0xf8,
-  0x93, 0x07, 0xc4, 0x1d, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x8c, 0xe7, 0x00,
-  0xef, 0xf0, 0xcf, 0xca, 0xe3, 0x18, 0x05, 0xf6, 0xef, 0xf0, 0x8f, 0xbe,
-  0x6f, 0xf0, 0x9f, 0xf6
+// prt_dprx_pm_rom - packed 32-bit words
+const uint32_t prt_dprx_pm_rom[] = {
+  0x0100006f, 0x0500006f, 0x0940006f, 0x0d80006f, 0x00000093, 0x00009137,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x450030ef, 0x0000006f, 0x00000093, 0x00009137, 0xf0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x560030ef, 0x0000006f, 0x00000093, 0x00009137, 0xe0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x5c4030ef, 0x0000006f, 0x00000093, 0x00009137, 0xd0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x590030ef, 0x0000006f, 0x000087b7, 0x00c78793, 0x0007a023,
+  0x0007a223, 0x000087b7, 0x0307a683, 0x000017b7, 0x23478793, 0x0006a703,
+  0x00100513, 0x01075713, 0x00f71863, 0x00300793, 0x00f6a223, 0x00000513,
+  0x00008067, 0x000087b7, 0x0307a783, 0x0007a503, 0x01051513, 0x01055513,
+  0x00008067, 0x000087b7, 0x0307a783, 0x00251513, 0x0047a703, 0x00e56533,
+  0x00a7a223, 0x00008067, 0x000087b7, 0x0307a783, 0x00a51513, 0x0047a703,
+  0x00e56533, 0x00a7a223, 0x00008067, 0x000087b7, 0x0307a783, 0x00a7ac23,
+  0x00008067, 0x000087b7, 0x0307a783, 0x00a7ae23, 0x00008067, 0x000087b7,
+  0x0307a783, 0x02a7a023, 0x00008067, 0x000087b7, 0x0307a783, 0x02b7a423,
+  0x02a7a223, 0x00008067, 0x000087b7, 0x0307a783, 0x00c7a503, 0x00008067,
+  0x000087b7, 0x0307a783, 0x00c7a783, 0x00a7f533, 0x00a03533, 0x00008067,
+  0x000087b7, 0x0307a783, 0x00a7ac23, 0x00a7ae23, 0x00008067, 0xff410113,
+  0x00912023, 0x000084b7, 0x0304a783, 0x00112423, 0x00812223, 0x0087a783,
+  0x0017f793, 0x04078c63, 0x00050413, 0x58c000ef, 0x0304a703, 0x000087b7,
+  0x00c78793, 0x01072603, 0x0007a683, 0x00040513, 0x00412403, 0x00c6e6b3,
+  0x00d7a023, 0x01472603, 0x0047a683, 0x00812083, 0x00012483, 0x00c6e6b3,
+  0x00d7a223, 0x00100793, 0x00f72423, 0x00c10113, 0x56c0006f, 0x00812083,
+  0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0xff010113, 0x00912223,
+  0x000084b7, 0x00c48493, 0x0004a783, 0x00812423, 0x00112623, 0x00a7f7b3,
+  0x00050413, 0x00000513, 0x02078663, 0x00058513, 0x00b12023, 0x4f4000ef,
+  0x0004a783, 0x00012503, 0xfff44413, 0x00f47433, 0x0084a023, 0x508000ef,
+  0x00100513, 0x00c12083, 0x00812403, 0x00412483, 0x01010113, 0x00008067,
+  0xff010113, 0x00912223, 0x000084b7, 0x00c48493, 0x0044a783, 0x00812423,
+  0x00112623, 0x00a7f7b3, 0x00050413, 0x00000513, 0x02078663, 0x00058513,
+  0x00b12023, 0x48c000ef, 0x0044a783, 0x00012503, 0xfff44413, 0x00f47433,
+  0x0084a223, 0x4a0000ef, 0x00100513, 0x00c12083, 0x00812403, 0x00412483,
+  0x01010113, 0x00008067, 0x000087b7, 0x00c78793, 0x0007a703, 0xfff54513,
+  0x00e57533, 0x00a7a023, 0x00008067, 0x000087b7, 0x00c78793, 0x0047a703,
+  0xfff54513, 0x00e57533, 0x00a7a223, 0x00008067, 0x000087b7, 0x02c7a783,
+  0x00300713, 0x00000513, 0x00e7a023, 0x000087b7, 0x00078023, 0x00078793,
+  0x000780a3, 0x00008067, 0x000087b7, 0x02c7a783, 0x02051c63, 0x00b7a623,
+  0x00400713, 0x0007a683, 0x00d76733, 0x00e7a023, 0x000087b7, 0x00078793,
+  0x00a78533, 0x00050023, 0x00054783, 0xfe078ee3, 0x00050023, 0x00008067,
+  0x00b7a823, 0x00800713, 0xfcdff06f, 0x000087b7, 0x02c7a783, 0x02051663,
+  0x00b7a623, 0x00400713, 0x0007a683, 0x00d76733, 0x00e7a023, 0x000087b7,
+  0x00078793, 0x00f50533, 0x00050023, 0x00008067, 0x00b7a823, 0x00800713,
+  0xfd9ff06f, 0x02050e63, 0x00400693, 0x00800793, 0x00008737, 0x02c72703,
+  0xfff7c793, 0x00072603, 0x00c7f7b3, 0x00f72023, 0x000087b7, 0x00078793,
+  0x00d72223, 0x00f50533, 0x00050023, 0x00008067, 0x00200693, 0x00400793,
+  0xfc9ff06f, 0x000087b7, 0x02c7a703, 0x00472783, 0x0107f693, 0x00068e63,
+  0x01000693, 0x00d72223, 0x000086b7, 0x00068693, 0x00100613, 0x00c68123,
+  0x0027f693, 0x00068c63, 0x00200693, 0x00d72223, 0x00100613, 0x000086b7,
+  0x00c68023, 0x0047f793, 0x00078e63, 0x00400793, 0x00f72223, 0x000087b7,
+  0x00078793, 0x00100713, 0x00e780a3, 0x00008067, 0x000087b7, 0x00078793,
+  0x00a787b3, 0x0007c703, 0x0ff77513, 0x00070663, 0x00078023, 0x00100513,
+  0x00008067, 0x000087b7, 0x00078793, 0x0027c703, 0x0ff77513, 0x00070663,
+  0x00078123, 0x00100513, 0x00008067, 0x000087b7, 0x0287a783, 0x00100713,
+  0x00000513, 0x00e7a023, 0x00008067, 0x000087b7, 0x0287a783, 0x00a7a023,
+  0x00008067, 0x000087b7, 0x0287a783, 0x00a7a223, 0x00008067, 0x000087b7,
+  0x0287a783, 0x0087a503, 0x00008067, 0x000087b7, 0x0287a783, 0x00a7a423,
+  0x00008067, 0x000087b7, 0x0247a783, 0x00f00713, 0x00000513, 0x00e7a223,
+  0x00008067, 0x000087b7, 0x0247a683, 0x00008737, 0x10000793, 0x00f6a623,
+  0x6ac70713, 0x00000793, 0x00174603, 0x00c7e863, 0x1ff00793, 0x00f6a623,
+  0x00008067, 0x00f70633, 0x00264603, 0x00178793, 0x0ff7f793, 0x0ff67613,
+  0x00c6a623, 0xfd5ff06f, 0x000087b7, 0x0247a783, 0x00a7aa23, 0x00008067,
+  0x000087b7, 0x0247a603, 0x10000693, 0x000087b7, 0x01062703, 0x6d078793,
+  0x1ff77713, 0x00d71c63, 0x00078023, 0x000780a3, 0x00100793, 0x00f62423,
+  0x00008067, 0x1ff00693, 0x00d71863, 0x00100713, 0x00e78023, 0xfe5ff06f,
+  0x0017c583, 0x0ff77713, 0x00158693, 0x0ff6f693, 0x00d780a3, 0x00b787b3,
+  0x00e78123, 0xfc5ff06f, 0x000087b7, 0x6f478793, 0x00078623, 0x00000513,
+  0x00008067, 0x000087b7, 0x0187a683, 0x00100793, 0x00f6a023, 0x000087b7,
+  0x6f478613, 0x00564583, 0x00464703, 0x00062603, 0x6f478793, 0x00871713,
+  0x00b76733, 0x00061663, 0x00008637, 0x00c76733, 0x00020637, 0x00c76733,
+  0x00e6a423, 0x00010537, 0x00000713, 0x0057c603, 0x00c76c63, 0x0007a603,
+  0x00100713, 0x08e60263, 0x0006a023, 0x00008067, 0x0007a583, 0x00000613,
+  0x00059a63, 0x0087a603, 0x00171593, 0x00b60633, 0x00065603, 0x0057c583,
+  0xfff58593, 0x00b71463, 0x00a66633, 0x00170713, 0x00c6a423, 0x0ff77713,
+  0xfadff06f, 0x0046a603, 0x00267593, 0x00059663, 0x00467613, 0xfe0618e3,
+  0x00c6a583, 0x0087a603, 0x00171513, 0x00170713, 0x00a60633, 0x00b61023,
+  0x0ff77713, 0x0057c603, 0xfcc766e3, 0xf85ff06f, 0x00000713, 0xff1ff06f,
+  0x000087b7, 0x0187a783, 0x0047a783, 0x0017f793, 0x00078a63, 0x000087b7,
+  0x6f478793, 0x00100713, 0x00e78623, 0x00008067, 0x000087b7, 0x0147a783,
+  0x00100713, 0x00000513, 0x00e7a023, 0x00008067, 0x00100793, 0x00a79533,
+  0x000087b7, 0x0147a703, 0x0ff57693, 0x0ff57513, 0x00a72223, 0x00472783,
+  0x00f6f7b3, 0xfe078ae3, 0x00008067, 0x000087b7, 0x0147a703, 0x00100793,
+  0x00a797b3, 0x0ff7f793, 0x00f72423, 0x00008067, 0x000087b7, 0x01c7a783,
+  0x00300713, 0x00000513, 0x00e7a023, 0x000087b7, 0x70478793, 0x00078ea3,
+  0x00008067, 0x000087b7, 0x70478713, 0x01d74703, 0x00000613, 0x70478793,
+  0x00071663, 0x00000513, 0x00008067, 0x00008737, 0x01c72683, 0x00078ea3,
+  0x0046a703, 0x00877713, 0xfe0702e3, 0x00c6a703, 0x00475593, 0x00f5f593,
+  0x00b7a023, 0x01071713, 0x000f05b7, 0x00b77733, 0x00e7a423, 0x00c6a703,
+  0x000105b7, 0x0087a503, 0xfff58593, 0x00871713, 0x00b77733, 0x00a76733,
+  0x00e7a423, 0x00c6a703, 0x0087a583, 0x0ff77713, 0x00b76733, 0x00e7a423,
+  0x0046a703, 0x10077713, 0x02070e63, 0x00078623, 0x0007a583, 0x00800713,
+  0x04e59a63, 0x00000713, 0x00d78793, 0x0ff77593, 0x04c5fc63, 0x00c6a583,
+  0x00e78533, 0x00170713, 0x0ff5f593, 0x00b50023, 0xfe5ff06f, 0x00c6a703,
+  0x01000613, 0x00170713, 0x00070593, 0x0ff77713, 0x00e67463, 0x01000593,
+  0x0ff5f613, 0x00b78623, 0xfa9ff06f, 0x0007a703, 0xfa0708e3, 0x0007a583,
+  0x00400713, 0xfae580e3, 0x00100513, 0x00008067, 0x000087b7, 0x01c7a783,
+  0x10000713, 0x0007a423, 0x0007a423, 0x0007a423, 0x0007a423, 0x00e7a423,
+  0x00008737, 0x70470693, 0x0006a603, 0x00800693, 0x70470713, 0x00d60863,
+  0x00072603, 0x00900693, 0x04d61863, 0x00472683, 0x00469693, 0x00d7a423,
+  0x00c74683, 0x06069663, 0x10000693, 0x00d7a423, 0x0007a683, 0x0046e693,
+  0x00d7a023, 0x00070ea3, 0x01d74683, 0xfe068ee3, 0x00070ea3, 0x0047a503,
+  0x00155513, 0x00154513, 0x00157513, 0x00008067, 0x00472683, 0x00669693,
+  0xfb5ff06f, 0x00d70633, 0x00d64603, 0x00168693, 0x0ff6f693, 0x0ff67613,
+  0x00c7a423, 0x00c74603, 0xfec6e2e3, 0xf9dff06f, 0x00000693, 0xff1ff06f,
+  0x000087b7, 0x01c7a683, 0x0046a783, 0x0017f793, 0x00078c63, 0x00100713,
+  0x000087b7, 0x00e6a223, 0x70478793, 0x00e78ea3, 0x00008067, 0xff410113,
+  0x00812223, 0x00008437, 0x70440793, 0x0087a703, 0x00112423, 0x03000793,
+  0x70440413, 0x02f71663, 0x00c44783, 0x00078663, 0x00d44503, 0x639000ef,
+  0x00042223, 0x00040623, 0x00812083, 0x00412403, 0x00c10113, 0x00008067,
+  0x00842703, 0x05000793, 0x00f71c63, 0x00c44783, 0xfc078ce3, 0x00d44503,
+  0x611000ef, 0xfcdff06f, 0x00100793, 0x00f42223, 0xfc5ff06f, 0xff410113,
+  0x00812223, 0x00008437, 0x70440793, 0x0087a683, 0x00112423, 0x05000713,
+  0x02e69c63, 0x70440413, 0x00c44783, 0x00078463, 0x5f5000ef, 0x00042703,
+  0x00100793, 0x00f71463, 0x5a9000ef, 0x00042223, 0x00812083, 0x00412403,
+  0x00c10113, 0x00008067, 0x00100713, 0x00e7a223, 0x00078623, 0xfe5ff06f,
+  0x00008637, 0x26860793, 0x01400693, 0x00d78023, 0x00d780a3, 0xfc400713,
+  0x00e78123, 0x000781a3, 0x00100713, 0x00e78223, 0x00e782a3, 0xf8000593,
+  0x00b78323, 0x00200593, 0x00b783a3, 0xf8100513, 0x00a78423, 0x000784a3,
+  0x00d78523, 0x00400693, 0x00d785a3, 0x00078623, 0x000786a3, 0x00078723,
+  0x000787a3, 0x00078823, 0x000788a3, 0x00078923, 0x000789a3, 0x00078a23,
+  0x00078aa3, 0x00078b23, 0x00e78ba3, 0x00078c23, 0x00078ca3, 0x00078d23,
+  0x00b78da3, 0x00e78e23, 0x00000693, 0x01000713, 0x00d78633, 0x00060ea3,
+  0x00168693, 0xfee69ae3, 0x020786a3, 0x04d00713, 0x02e78723, 0x04700713,
+  0x02e787a3, 0x05000713, 0x02e78823, 0x05200613, 0x02c788a3, 0x05400613,
+  0x02c78923, 0x02000613, 0x02c789a3, 0x04400613, 0x02c78a23, 0x02e78aa3,
+  0x02d78b23, 0x00100713, 0x02e78ba3, 0x02078c23, 0x02078ca3, 0x02078d23,
+  0x02078da3, 0x02078e23, 0x00008067, 0x00008737, 0x26870793, 0x000788a3,
+  0x000789a3, 0x00078c23, 0x00078d23, 0x00078a23, 0x00078aa3, 0x00078b23,
+  0x26870713, 0x00000793, 0x01000693, 0x00f70633, 0x00060ea3, 0x00178793,
+  0xfed79ae3, 0x00008067, 0x00200713, 0x00050793, 0x02e50663, 0x02100713,
+  0x04e50663, 0x00100713, 0x00100513, 0x06e79063, 0x000087b7, 0x26878793,
+  0x00b780a3, 0x00000513, 0x00008067, 0x000087b7, 0x26878793, 0x00b78123,
+  0x0027c703, 0x04076713, 0x00e78123, 0x0027c703, 0x08076713, 0x00e78123,
+  0xfd5ff06f, 0x000087b7, 0x00100713, 0x26878793, 0x00e59663, 0x00b784a3,
+  0xfbdff06f, 0x000784a3, 0xfb5ff06f, 0x00008067, 0x000087b7, 0x26878793,
+  0x00b7c503, 0x00757513, 0x00008067, 0x000087b7, 0x26878793, 0x00a7c503,
+  0x00008067, 0x000087b7, 0x26878793, 0x00b7c503, 0x00757513, 0xffe50513,
+  0x00153513, 0x00008067, 0x000087b7, 0x26878793, 0x00b7c503, 0x00757513,
+  0xffc50513, 0x00153513, 0x00008067, 0x000087b7, 0x26878793, 0x00c7c783,
+  0x00600713, 0x00000513, 0x0077f793, 0xfff78793, 0x0ff7f793, 0x00f76a63,
+  0x00008737, 0x1d470713, 0x00f707b3, 0x0007c503, 0x00008067, 0xff410113,
+  0x00112423, 0xfc1ff0ef, 0x00812083, 0xfff50513, 0x00153513, 0x00c10113,
+  0x00008067, 0xff410113, 0x00112423, 0xfa1ff0ef, 0x00812083, 0x00253513,
+  0x00154513, 0x00c10113, 0x00008067, 0xff410113, 0x00112423, 0xf81ff0ef,
+  0x00812083, 0x00153513, 0x00c10113, 0x00008067, 0x000087b7, 0x26878793,
+  0x00d7c503, 0x00357513, 0x00008067, 0x000087b7, 0x26878793, 0x00d7c503,
+  0x00355513, 0x00357513, 0x00008067, 0x000087b7, 0x26878793, 0x00d7c503,
+  0x00457513, 0x00008067, 0x000087b7, 0x26878793, 0x00d7c503, 0x02057513,
+  0x00008067, 0x000087b7, 0x21878793, 0x00c7c583, 0x0107c503, 0x0147c603,
+  0x00d7c683, 0x00151513, 0x0117c703, 0x00261613, 0x0157c783, 0x00c56533,
+  0x00b56533, 0x00469693, 0x00d56533, 0x00571713, 0x00e56533, 0x00679793,
+  0x00f56533, 0x0ff57513, 0x00008067, 0x000087b7, 0x21878793, 0x00e7c583,
+  0x0127c503, 0x0167c603, 0x00f7c683, 0x00151513, 0x0137c703, 0x00261613,
+  0x0177c783, 0x00c56533, 0x00b56533, 0x00469693, 0x00d56533, 0x00571713,
+  0x00e56533, 0x00679793, 0x00f56533, 0x0ff57513, 0x00008067, 0x000087b7,
+  0x26878793, 0x0197c503, 0x000087b7, 0x21878793, 0x0187c783, 0x00f56533,
+  0x00008067, 0x00008737, 0x21870713, 0x01b74783, 0x01a74683, 0x00279793,
+  0x0ff7f793, 0x00d7e7b3, 0x01b74683, 0x00279793, 0x0ff7f793, 0x01a74503,
+  0x00d7e7b3, 0x00279793, 0x0ff7f793, 0x00a7e533, 0x00008067, 0x000087b7,
+  0x26878793, 0x0197c703, 0x00050863, 0x08076713, 0x00e78ca3, 0x00008067,
+  0x07f77713, 0xff5ff06f, 0x000087b7, 0x26878793, 0x0097c503, 0x00157513,
+  0x00008067, 0x000087b7, 0x26878793, 0x0137c503, 0x00157513, 0x00008067,
+  0x000087b7, 0x26878793, 0x0187c703, 0x01076713, 0x00e78c23, 0x00008067,
+  0x000087b7, 0x26878793, 0x01a7c703, 0x00176713, 0x00e78d23, 0x00008067,
+  0x000087b7, 0x26878793, 0x01a7c703, 0x00276713, 0x00e78d23, 0x00008067,
+  0x000087b7, 0x26878793, 0x0117c503, 0x01057513, 0x00008067, 0x000087b7,
+  0x26878793, 0x01b7c503, 0x00757513, 0xfff50513, 0x00153513, 0x00008067,
+  0xff010113, 0x00112623, 0x00812423, 0x00912223, 0x82dff0ef, 0x06050ce3,
+  0x000087b7, 0x70478713, 0x00072603, 0x00800693, 0x70478413, 0x3ad61c63,
+  0x00872603, 0x2ff00693, 0x02c6f663, 0x00872603, 0x3ff00693, 0x02c6e063,
+  0x00072223, 0x00070623, 0x00812403, 0x00c12083, 0x00412483, 0x01010113,
+  0x8f1ff06f, 0x00842683, 0x00001737, 0x00e6ee63, 0x00842683, 0x1ff70713,
+  0x00d76863, 0x00042223, 0x00040623, 0xfcdff06f, 0x00842683, 0x02f00713,
+  0x04d77663, 0x00842683, 0x03f00713, 0x04d76063, 0x00842603, 0x000086b7,
+  0x26868693, 0x0ff67613, 0x00000713, 0x00c686b3, 0x00c44603, 0xfcc770e3,
+  0x00e40633, 0x00d64603, 0x00170713, 0x0ff77713, 0x0ff67613, 0x00c68ea3,
+  0xfe1ff06f, 0x00042223, 0x00000493, 0x00842703, 0x0ff4f793, 0x00f12023,
+  0x11100693, 0x02e6e863, 0x0ff00693, 0x04e6f663, 0xf0070713, 0x01100693,
+  0x04e6e063, 0x000087b7, 0x00271713, 0x03478693, 0x00d70733, 0x00072703,
+  0x00070067, 0x20100693, 0x26d70663, 0x02e6e463, 0x1c100693, 0x22d70463,
+  0x1c200693, 0x22d70e63, 0x1c000693, 0x1ed70e63, 0x00100713, 0x00e42223,
+  0x0840006f, 0x60000693, 0x26d70063, 0x000026b7, 0x00368693, 0x22d70863,
+  0x2c000693, 0xfcd71ee3, 0x00940733, 0x00d74603, 0x00008737, 0x26870713,
+  0x01a74683, 0xfff64613, 0x00c6f6b3, 0x00d70d23, 0x0440006f, 0x00940733,
+  0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693, 0x00d70523, 0x161000ef,
+  0x311000ef, 0x660010ef, 0x01c0006f, 0x00940733, 0x00d74683, 0x00008737,
+  0x26870713, 0x0ff6f693, 0x00d705a3, 0x00842703, 0x00012783, 0x00148493,
+  0x00170713, 0x00e42423, 0x00442683, 0x00c44603, 0x00178713, 0x0ff77713,
+  0x00c77463, 0xee0684e3, 0x00442703, 0x00100693, 0xe6d71ce3, 0x00012783,
+  0x00f406a3, 0x00e40623, 0xe39ff06f, 0x00940733, 0x00d74683, 0x00008737,
+  0x26870713, 0x0ff6f693, 0x00d70623, 0xb99ff0ef, 0xf6051ee3, 0x265000ef,
+  0x00200713, 0xf00504e3, 0x5b8010ef, 0xf89ff06f, 0x00940733, 0x00d74683,
+  0x00008737, 0x26870713, 0x0ff6f693, 0x00d706a3, 0x5c0010ef, 0xf69ff06f,
+  0x00940733, 0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693, 0x00d70723,
+  0xf4dff06f, 0x00940733, 0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693,
+  0x00d707a3, 0xf31ff06f, 0x00940733, 0x00d74683, 0x00008737, 0x26870713,
+  0x0ff6f693, 0x00d70823, 0xf15ff06f, 0x00940733, 0x00d74683, 0x00008737,
+  0x26870713, 0x0ff6f693, 0x00d708a3, 0xef9ff06f, 0x00940733, 0x00d74683,
+  0x00008737, 0x26870713, 0x0ff6f693, 0x00d70923, 0xeddff06f, 0x00940733,
+  0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693, 0x00d709a3, 0x17d000ef,
+  0xea050ee3, 0x000087b7, 0x26878713, 0x01374703, 0x00100513, 0x00177713,
+  0x00071463, 0x00000513, 0x0c1000ef, 0xe99ff06f, 0x00940733, 0x00d74683,
+  0x00008737, 0x26870713, 0x0ff6f693, 0x00d70a23, 0xe7dff06f, 0x00940733,
+  0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693, 0x00d70aa3, 0xe61ff06f,
+  0x00940733, 0x00d74683, 0x00008737, 0x26870713, 0x0ff6f693, 0x00d70b23,
+  0xe45ff06f, 0x00940733, 0x00d74603, 0x00008737, 0x26870713, 0x01874683,
+  0xfff64613, 0x00c6f6b3, 0x00d70c23, 0xe21ff06f, 0x00940733, 0x00d74683,
+  0x00008737, 0x26870713, 0x0ff6f693, 0x00d70da3, 0x4d0000ef, 0xc11ff0ef,
+  0xde051ee3, 0x859ff0ef, 0xdf5ff06f, 0x00042603, 0x00900693, 0x46d61263,
+  0x00042223, 0x00842683, 0x02f00713, 0x06d77263, 0x00842683, 0x03f00713,
+  0x04d76c63, 0x00842583, 0x00008537, 0x00000713, 0x00f5f593, 0x26850513,
+  0x00c44603, 0x00e586b3, 0x0ff6f693, 0x00c76a63, 0x00442683, 0x00200713,
+  0xc0e69ce3, 0xc45ff06f, 0x00d506b3, 0x01d6c683, 0x00e40633, 0x00170713,
+  0x0ff6f693, 0x00d606a3, 0x0ff77713, 0xfc5ff06f, 0x00842683, 0x3ff00713,
+  0x04d77a63, 0x00842683, 0x40f00713, 0x04d76463, 0x00842583, 0x00008537,
+  0x00000713, 0x00f5f593, 0x26850513, 0x00c44603, 0x00e586b3, 0x0ff6f693,
+  0xf8c77ce3, 0x00d506b3, 0x02d6c683, 0x00e40633, 0x00170713, 0x0ff6f693,
+  0x00d606a3, 0x0ff77713, 0xfd5ff06f, 0x00842603, 0x00001737, 0x3ff70693,
+  0x00c6f863, 0x00842683, 0x5ff70713, 0x06d77063, 0x00000493, 0x00842703,
+  0x1c100693, 0x2ad70c63, 0x0ce6e663, 0x11100693, 0x0ae6e663, 0x0ff00693,
+  0x06e6e863, 0x00e00693, 0x08e6f663, 0x02100693, 0x1ed70263, 0x00940733,
+  0x000706a3, 0x1280006f, 0x00e406b3, 0x00170713, 0x000686a3, 0x0ff77713,
+  0x00c44683, 0xfed766e3, 0xf01ff06f, 0x00000713, 0xff1ff06f, 0xffffe6b7,
+  0xe0068693, 0x00d70733, 0x00e00693, 0xfce6e0e3, 0x000087b7, 0x00271713,
+  0x07c78693, 0x00d70733, 0x00072703, 0x00070067, 0xf0070713, 0x01100693,
+  0xf8e6eee3, 0x000086b7, 0x00271713, 0x0b868693, 0x00d70733, 0x00072703,
+  0x00070067, 0x000086b7, 0x00271713, 0x07c68693, 0xfc5ff06f, 0x1c000693,
+  0xf6d716e3, 0x00008737, 0x26870713, 0x01474703, 0x0800006f, 0x2c000693,
+  0x26d70c63, 0x02e6e863, 0x1c200693, 0x1ed70463, 0xe0070713, 0x00700693,
+  0xf2e6eee3, 0x000086b7, 0x00271713, 0x10068693, 0x00d70733, 0x00072703,
+  0x00070067, 0x000026b7, 0x20e68613, 0xf0e66ce3, 0x1ff68613, 0xf4e660e3,
+  0x00268613, 0x22c70e63, 0x00368693, 0x1cd70063, 0x60000693, 0xeed71ce3,
+  0x00008737, 0x26870713, 0x01b74703, 0x00c0006f, 0x00008737, 0x26874703,
+  0x0ff77713, 0x009406b3, 0x00e686a3, 0x00842703, 0x00148493, 0x00170713,
+  0x00e42423, 0x00442683, 0x00c44603, 0x0ff4f713, 0x0016b693, 0x00c73733,
+  0x00d77733, 0xe6071ce3, 0xdc9ff06f, 0x00008737, 0x26870713, 0x00174703,
+  0xfb9ff06f, 0x00008737, 0x26870713, 0x00274703, 0xfa9ff06f, 0x00008737,
+  0x26870713, 0x00374703, 0xf99ff06f, 0x00008737, 0x26870713, 0x00474703,
+  0xf89ff06f, 0x00008737, 0x26870713, 0x00574703, 0xf79ff06f, 0x00008737,
+  0x26870713, 0x00674703, 0xf69ff06f, 0x00008737, 0x26870713, 0x00774703,
+  0xf59ff06f, 0x00008737, 0x26870713, 0x00874703, 0xf49ff06f, 0x00008737,
+  0x26870713, 0x00974703, 0xf39ff06f, 0x00008737, 0x26870713, 0x00a74703,
+  0xf29ff06f, 0x00008737, 0x26870713, 0x00b74703, 0xf19ff06f, 0x00008737,
+  0x26870713, 0x00c74703, 0xf09ff06f, 0x00008737, 0x26870713, 0x00d74703,
+  0xef9ff06f, 0x00008737, 0x26870713, 0x00e74703, 0xee9ff06f, 0x00008737,
+  0x26870713, 0x00f74703, 0xed9ff06f, 0x00008737, 0x26870713, 0x01074703,
+  0xec9ff06f, 0x00008737, 0x26870713, 0x01174703, 0xeb9ff06f, 0x00008737,
+  0x26870713, 0x01274703, 0xea9ff06f, 0x00008737, 0x26870713, 0x01374703,
+  0xe99ff06f, 0x00008737, 0x26870713, 0x01574703, 0xe89ff06f, 0x00008737,
+  0x26870713, 0x01674703, 0xe79ff06f, 0x00008737, 0x26870713, 0x01774703,
+  0xe69ff06f, 0x00008737, 0x26870713, 0x01874703, 0xe59ff06f, 0x014010ef,
+  0x00050c63, 0x058010ef, 0x068010ef, 0x00051663, 0x00200713, 0x00e42223,
+  0xe44ff0ef, 0x00940733, 0x00a706a3, 0xe39ff06f, 0xe84ff0ef, 0xff1ff06f,
+  0xeccff0ef, 0x00940733, 0x00a706a3, 0x00000513, 0xf1cff0ef, 0xe19ff06f,
+  0xed4ff0ef, 0xfd1ff06f, 0x00008737, 0x26870713, 0x01a74703, 0xdf5ff06f,
+  0x00008737, 0x26870713, 0x01c74703, 0xde5ff06f, 0x00072783, 0x00078863,
+  0x00072683, 0x00400793, 0x00f69663, 0x9e0ff0ef, 0xfe8ff06f, 0x00072683,
+  0x00100793, 0x00f68863, 0x00072703, 0x00500793, 0xfcf71863, 0xa38ff0ef,
+  0xfc8ff06f, 0x00c12083, 0x00812403, 0x00412483, 0x01010113, 0x00008067,
+  0x000087b7, 0x2a078423, 0x00008067, 0x000087b7, 0x2aa78423, 0x00008067,
+  0x000087b7, 0x2a878793, 0x0007c703, 0x00871713, 0x00e79123, 0x0027d703,
+  0x00e56533, 0x00a79123, 0x00008067, 0x000085b7, 0x00008637, 0x00000793,
+  0x70458593, 0x2a860613, 0x00c5c703, 0x00e7e463, 0x00008067, 0x00265703,
+  0x00170693, 0x01069693, 0x0106d693, 0x00d61123, 0x00e60733, 0x00474703,
+  0x00f586b3, 0x00178793, 0x0ff77713, 0x00e686a3, 0x0ff7f793, 0xfc5ff06f,
+  0x000087b7, 0x00478793, 0x0007a023, 0x00078223, 0x000782a3, 0x00078323,
+  0x000087b7, 0x0207a783, 0x00100713, 0x00e7a023, 0x00008067, 0x000087b7,
+  0x00478793, 0x00078223, 0x000782a3, 0x00008737, 0x00078323, 0x1e870713,
+  0x00074683, 0x02068663, 0x000086b7, 0x0206a603, 0x0007a023, 0x00062683,
+  0x0026e693, 0x00d62023, 0x00070023, 0x00100713, 0x00e78223, 0x00008067,
+  0x00174683, 0x02068663, 0x000086b7, 0x0206a583, 0x00100613, 0x00c7a023,
+  0x0005a683, 0x0046e693, 0x00d5a023, 0x000700a3, 0x00c782a3, 0x00008067,
+  0x00274683, 0x02068263, 0x000086b7, 0x0206a603, 0x00062683, 0x0086e693,
+  0x00d62023, 0x00070123, 0x00100713, 0x00e78323, 0x00008067, 0x000087b7,
+  0x0047a503, 0xfff50513, 0x00153513, 0x00008067, 0x000087b7, 0x00478793,
+  0x0057c503, 0x00a03533, 0x00008067, 0x000087b7, 0x00478793, 0x0047c503,
+  0x00a03533, 0x00008067, 0x000087b7, 0x00478793, 0x0067c503, 0x00a03533,
+  0x00008067, 0x000087b7, 0x0207a703, 0x00072783, 0x0087e793, 0x00f72023,
+  0x00008067, 0xff410113, 0x00112423, 0x00812223, 0xb1dfe0ef, 0x00157793,
+  0x06078e63, 0x00257793, 0x00050413, 0x00078a63, 0x00100513, 0xf88fe0ef,
+  0x00200513, 0xb09fe0ef, 0x00447793, 0x00078863, 0xa05fe0ef, 0x00400513,
+  0xaf5fe0ef, 0x02047793, 0x00078863, 0xf5dfe0ef, 0x02000513, 0xae1fe0ef,
+  0x04047793, 0x00078863, 0xb59fe0ef, 0x04000513, 0xacdfe0ef, 0x08047413,
+  0x00040e63, 0x10d010ef, 0x00412403, 0x00812083, 0x08000513, 0x00c10113,
+  0xaadfe06f, 0x00812083, 0x00412403, 0x00c10113, 0x00008067, 0x000087b7,
+  0x25c78793, 0x0007a023, 0x00078223, 0x000782a3, 0x00078323, 0x000783a3,
+  0x00078423, 0x00008067, 0x000107b7, 0xff010113, 0x01f78793, 0x00f12023,
+  0x00112623, 0x9b4ff0ef, 0x00400793, 0x04f51e63, 0x00215783, 0x0067e793,
+  0x00f11123, 0x00215783, 0x0087e793, 0x00f11123, 0xc0cff0ef, 0x00050663,
+  0x01000793, 0x00f11123, 0x000087b7, 0x6f478793, 0x01000713, 0x00e78223,
+  0x0007a023, 0x00200713, 0x00e782a3, 0x0027a423, 0xb0dfe0ef, 0x00c12083,
+  0x01010113, 0x00008067, 0x950ff0ef, 0x00200793, 0x00f51863, 0x00215783,
+  0x0047e793, 0xf9dff06f, 0x938ff0ef, 0x00100793, 0xf8f51ae3, 0x00215783,
+  0x0027e793, 0xf85ff06f, 0x000087b7, 0x00100713, 0x25c78793, 0x00e783a3,
+  0x000087b7, 0x1e878793, 0x00e78423, 0xf3dff06f, 0xff010113, 0x000087b7,
+  0x00112623, 0x6f478793, 0x01000713, 0x00e78223, 0x00e11023, 0x0007a023,
+  0x00200713, 0x00a03533, 0x00451513, 0x00e782a3, 0x00a11123, 0x0027a423,
+  0xa75fe0ef, 0x00c12083, 0x01010113, 0x00008067, 0xff010113, 0x06000793,
+  0x00f11023, 0x000087b7, 0x00112623, 0x6f478793, 0x01000713, 0x00e78223,
+  0xff650513, 0x0007a023, 0x00200713, 0x00153513, 0x00551513, 0x00e782a3,
+  0x00a11123, 0x0027a423, 0xa25fe0ef, 0x00c12083, 0x01010113, 0x00008067,
+  0x000087b7, 0x25c78793, 0x0077c503, 0x00008067, 0x000087b7, 0x25c78793,
+  0x0057c503, 0x00008067, 0x000087b7, 0x25c78793, 0x0067c503, 0x00008067,
+  0x000087b7, 0x25c78793, 0x00100713, 0x00e78223, 0x00008067, 0xff410113,
+  0x02000513, 0x00112423, 0xcccfe0ef, 0x00812083, 0x00800513, 0x00c10113,
+  0xe88fe06f, 0xff410113, 0x00812223, 0x00912023, 0x00058413, 0x00112423,
+  0x00050493, 0xfc9ff0ef, 0x00008737, 0x25c70793, 0x0077c783, 0x0087e5b3,
+  0x25c70413, 0x00058863, 0x000087b7, 0x1e878793, 0x009783a3, 0x00744783,
+  0x00078863, 0x249000ef, 0x00100513, 0x9f8ff0ef, 0xeedfe0ef, 0x000403a3,
+  0x00812083, 0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0x02000513,
+  0xc34fe06f, 0xff010113, 0x00812423, 0x00008437, 0x25c40413, 0x00042783,
+  0x00912223, 0x00112623, 0x00100493, 0x06978e63, 0x00200713, 0x0ce78c63,
+  0x02079463, 0x00444783, 0x04078a63, 0x00040223, 0x000402a3, 0x00040323,
+  0xf5dfe0ef, 0x00844783, 0x00a79863, 0x009402a3, 0x00042023, 0x0300006f,
+  0x00040423, 0xf09ff0ef, 0x000087b7, 0x1e878793, 0x000185b7, 0x00078523,
+  0x6a058593, 0x00000513, 0x009784a3, 0xe38fe0ef, 0x00942023, 0x00c12083,
+  0x00812403, 0x00412483, 0x01010113, 0x00008067, 0x00008737, 0x1e870713,
+  0x00a74703, 0x02070063, 0xf4dff0ef, 0x3e800593, 0x00000513, 0xe00fe0ef,
+  0x00200793, 0x00f42023, 0xfc5ff06f, 0x00008737, 0x1dc74703, 0xfa071ce3,
+  0x00000513, 0x00f12023, 0xed0fe0ef, 0xfa0504e3, 0xe85ff0ef, 0x00012783,
+  0x00100593, 0x00100513, 0x00f40323, 0xe91ff0ef, 0xf59ff06f, 0x00300593,
+  0x00800513, 0xc34fe0ef, 0x00050863, 0x009402a3, 0x00040423, 0xf3dff06f,
+  0xe90fe0ef, 0xf60504e3, 0x02000513, 0xb18fe0ef, 0x00100593, 0x00200513,
+  0xe55ff0ef, 0x00940323, 0xf19ff06f, 0x000087b7, 0x1e878793, 0x00078023,
+  0x000780a3, 0x00078123, 0x000782a3, 0x00078323, 0x000781a3, 0x00078223,
+  0x000783a3, 0x00078423, 0x000784a3, 0x00078523, 0x000785a3, 0x00078623,
+  0x000786a3, 0x02078723, 0x020787a3, 0x000087b7, 0x6c078823, 0x000087b7,
+  0x6a078623, 0x00008067, 0x00008737, 0x6d070793, 0x0007c783, 0x2a078e63,
+  0x6d070713, 0x00070023, 0x00274683, 0x01200613, 0x0ff6f793, 0x04d66463,
+  0x00200693, 0x04f6fc63, 0xffd78793, 0x0ff7f793, 0x00f00693, 0x04f6e463,
+  0x000086b7, 0x00279793, 0x12068693, 0x00d787b3, 0x0007a783, 0xff410113,
+  0x00812223, 0x00008437, 0x00112423, 0x6ac40413, 0x00078067, 0x04200693,
+  0x1cd78863, 0x08100693, 0x1cd78e63, 0x02400713, 0x18e78863, 0x000087b7,
+  0x6ac78793, 0x00078123, 0x19c0006f, 0x00374683, 0x00474583, 0x00200713,
+  0x0ff6f793, 0x0ff5f593, 0x04e68a63, 0x02f76263, 0x00200513, 0x00079463,
+  0x00100513, 0xcb5fe0ef, 0x00051c63, 0x00100793, 0x00f40123, 0x0100006f,
+  0x0ff00713, 0x02e78863, 0x00040123, 0x00100713, 0x000087b7, 0x6ac78793,
+  0x00e780a3, 0x00412403, 0x00812083, 0x00c10113, 0xdccfe06f, 0x02100513,
+  0xfbdff06f, 0x04700793, 0xfcf598e3, 0x02000513, 0x984fe0ef, 0x550000ef,
+  0xfadff06f, 0x00100793, 0x000085b7, 0x00f40123, 0x1dc58593, 0x00000793,
+  0x00800513, 0x00078693, 0x00178793, 0x00f70633, 0x00264603, 0x00d586b3,
+  0x0ff67613, 0x00c680a3, 0xfea792e3, 0x3a8010ef, 0xf80512e3, 0x00100513,
+  0xbfcfe0ef, 0xf79ff06f, 0x00500793, 0x00f40123, 0x8d4fe0ef, 0x00855793,
+  0x0ff7f793, 0x00f401a3, 0x0ff57513, 0x00200793, 0x00a40223, 0x00f402a3,
+  0x00040323, 0x000403a3, 0x940fe0ef, 0x0ff57513, 0x00a40423, 0x959ff0ef,
+  0x00a404a3, 0xbddff0ef, 0x00a40523, 0xc3dfe0ef, 0x00a405a3, 0xc49fe0ef,
+  0x00a40623, 0x311000ef, 0x00a406a3, 0x00c00713, 0xf11ff06f, 0x000087b7,
+  0x00100713, 0x1e878793, 0x00e780a3, 0x00e40123, 0xef5ff06f, 0x00008737,
+  0x00100793, 0x1ef70423, 0xed1ff06f, 0x000087b7, 0x00100713, 0x1e878793,
+  0x00e78123, 0xfd9ff06f, 0x000087b7, 0x00100713, 0x1e878793, 0x00e78223,
+  0x000087b7, 0x6ac78793, 0x00e78123, 0x000087b7, 0x00100713, 0x6ac78793,
+  0x00e780a3, 0xebdff06f, 0x000087b7, 0x00100713, 0x1e878793, 0x00e78523,
+  0xfd1ff06f, 0x00374683, 0x00474783, 0x00008537, 0x00869693, 0x00d7e7b3,
+  0xffd78793, 0x01079793, 0x00300613, 0x0107d793, 0x2a850513, 0x01300313,
+  0x00c705b3, 0x0025c583, 0x00c786b3, 0x01069693, 0x0106d693, 0x0ff5f593,
+  0x00d506b3, 0x00b68223, 0x00160613, 0xfc661ee3, 0x000087b7, 0x6ac78793,
+  0x00100713, 0xf75ff06f, 0x000087b7, 0x6ac78793, 0x00078123, 0xe19ff06f,
+  0x00008067, 0x000087b7, 0x1e878793, 0x02e7c703, 0x00e78733, 0x00a70723,
+  0x02e7c683, 0x01f00713, 0x00d77663, 0x02078723, 0x00008067, 0x02e7c703,
+  0x00170713, 0x0ff77713, 0x02e78723, 0x00008067, 0x000087b7, 0x1e878793,
+  0x02f7c703, 0x00e78733, 0x00e74503, 0x02f7c683, 0x01f00713, 0x0ff57513,
+  0x00d77663, 0x020787a3, 0x00008067, 0x02f7c703, 0x00170713, 0x0ff77713,
+  0x02e787a3, 0x00008067, 0x000087b7, 0x1e878793, 0x02f7c503, 0x02e7c783,
+  0x40f50533, 0x00a03533, 0x00008067, 0xff410113, 0x00112423, 0x00812223,
+  0xfd9ff0ef, 0x02050263, 0x00008437, 0x6ac40413, 0x00200793, 0x00f40123,
+  0xf81ff0ef, 0x00a401a3, 0x00200793, 0x08c0006f, 0x00008737, 0x1e870793,
+  0x0097c683, 0x1e870713, 0x02068a63, 0x000784a3, 0x00008437, 0x00078523,
+  0x6ac40413, 0x04000793, 0x00f40123, 0xa41fe0ef, 0x00a401a3, 0xcfdfe0ef,
+  0x00a40223, 0x00300793, 0x0480006f, 0x0037c683, 0x02068063, 0x00008437,
+  0x000781a3, 0x6ac40413, 0x02300793, 0x00f40123, 0xa55fe0ef, 0xf91ff06f,
+  0x0057c683, 0x02068c63, 0x000782a3, 0x000087b7, 0x6ac78793, 0x03100713,
+  0x00e78123, 0x00100793, 0x00008737, 0x6ac70713, 0x00f700a3, 0x00412403,
+  0x00812083, 0x00c10113, 0xa8cfe06f, 0x0067c683, 0x00068c63, 0x00078323,
+  0x000087b7, 0x6ac78793, 0x03200713, 0xfc5ff06f, 0x0077c683, 0x02068463,
+  0x00008737, 0x6ac70713, 0x04500693, 0x00d70123, 0x0077c683, 0x0ff6f693,
+  0x00d701a3, 0x000783a3, 0xf11ff06f, 0x0087c683, 0x02068463, 0x00008437,
+  0x00078423, 0x6ac40413, 0x04400793, 0x00f40123, 0x951fe0ef, 0x00a401a3,
+  0x95dfe0ef, 0xf25ff06f, 0x00d7c683, 0x14068c63, 0x000786a3, 0x000087b7,
+  0x6ac78793, 0x06600713, 0x00e78123, 0x00008737, 0x23870713, 0x00472683,
+  0x0106d693, 0x0ff6f693, 0x00d781a3, 0x00472683, 0x0086d693, 0x0ff6f693,
+  0x00d78223, 0x00472683, 0x0ff6f693, 0x00d782a3, 0x00872683, 0x0106d693,
+  0x0ff6f693, 0x00d78323, 0x00872683, 0x0086d693, 0x0ff6f693, 0x00d783a3,
+  0x00872683, 0x0ff6f693, 0x00d78423, 0x00c75683, 0x0086d693, 0x00d784a3,
+  0x00c75683, 0x0ff6f693, 0x00d78523, 0x00e75683, 0x0086d693, 0x00d785a3,
+  0x00e75683, 0x0ff6f693, 0x00d78623, 0x01275683, 0x0086d693, 0x00d786a3,
+  0x01275683, 0x0ff6f693, 0x00d78723, 0x01075683, 0x0086d693, 0x00d787a3,
+  0x01075683, 0x0ff6f693, 0x00d78823, 0x01475683, 0x0086d693, 0x00d788a3,
+  0x01475683, 0x0ff6f693, 0x00d78923, 0x01675683, 0x0086d693, 0x00d789a3,
+  0x01675683, 0x0ff6f693, 0x00d78a23, 0x01a75683, 0x0086d693, 0x00d78aa3,
+  0x01a75683, 0x0ff6f693, 0x00d78b23, 0x01875683, 0x0086d693, 0x00d78ba3,
+  0x01875683, 0x0ff6f693, 0x00d78c23, 0x01c75683, 0x0086d693, 0x00d78ca3,
+  0x01c75703, 0x0ff77713, 0x00e78d23, 0x01900793, 0xe19ff06f, 0x00b7c683,
+  0x00068c63, 0x000785a3, 0x000087b7, 0x6ac78793, 0x06200713, 0xdf5ff06f,
+  0x00c74783, 0x02078463, 0x000087b7, 0x6ac78793, 0x06300693, 0x00d78123,
+  0x00c74683, 0x0ff6f693, 0x00d781a3, 0x00070623, 0xd41ff06f, 0x00812083,
+  0x00412403, 0x00c10113, 0x00008067, 0x000087b7, 0x00000693, 0x21878793,
+  0x00100713, 0x00400593, 0x00d78633, 0x00e60623, 0x00e60823, 0x00e60a23,
+  0x00168693, 0xfeb696e3, 0x00e78c23, 0x00e785a3, 0x00e78423, 0x000087b7,
+  0x26878793, 0x0017c703, 0x0ff77713, 0x00e78523, 0x0027c703, 0x0ff77713,
+  0x00e785a3, 0xe14ff06f, 0xff010113, 0x00112623, 0x00812423, 0xf24fe0ef,
+  0x00050413, 0xf78fe0ef, 0x00000693, 0x00811023, 0x00000793, 0x00000713,
+  0x04871063, 0x04069e63, 0x00011123, 0x000087b7, 0x6f478793, 0x01100713,
+  0x00e78223, 0x0007a023, 0x00200713, 0x00e782a3, 0x0027a423, 0x888fe0ef,
+  0x00c12083, 0x00812403, 0x01010113, 0x00008067, 0x00479793, 0x00f567b3,
+  0x01079793, 0x00170713, 0x0107d793, 0x0ff77713, 0x00100693, 0xfa5ff06f,
+  0x00f11123, 0xfa9ff06f, 0xfd010113, 0x000087b7, 0x6f478793, 0x02112623,
+  0x02812423, 0x02912223, 0x01100713, 0x00e78223, 0x00100713, 0x00e7a023,
+  0x00500713, 0x00e782a3, 0x01410413, 0x0087a423, 0x00012a23, 0x00012c23,
+  0x00011e23, 0x808fe0ef, 0xe58fe0ef, 0x01415603, 0x00040793, 0x00c10693,
+  0x00000713, 0x00278793, 0x04a71063, 0x00165793, 0x00f12023, 0xe34fe0ef,
+  0x00a12223, 0x00000413, 0x00100693, 0x00412703, 0x0ff47793, 0x02e7ea63,
+  0x02c12083, 0x02812403, 0x02412483, 0x00068513, 0x03010113, 0x00008067,
+  0x0007d583, 0x00170713, 0x0ff77713, 0x00b69023, 0x00268693, 0xfa9ff06f,
+  0x00141793, 0x00c78793, 0x002787b3, 0x0007d603, 0x000087b7, 0x21878493,
+  0x00012783, 0x00d12423, 0x02f66863, 0xe58fe0ef, 0x00812683, 0x008487b3,
+  0x00100613, 0x00050863, 0x00c78623, 0x00140413, 0xf85ff06f, 0x00c78823,
+  0x00c78a23, 0xff1ff06f, 0xe2cfe0ef, 0x008487b3, 0x00050863, 0x00078623,
+  0x00000693, 0xfd9ff06f, 0x00078823, 0x00078a23, 0xff1ff06f, 0x000087b7,
+  0x00000713, 0x21878793, 0x00400613, 0x00e786b3, 0x00068623, 0x00068823,
+  0x00068a23, 0x00170713, 0xfec716e3, 0x00078c23, 0x00078423, 0x00078ca3,
+  0x00078d23, 0x00078da3, 0x00078e23, 0x00008067, 0x000087b7, 0x21878793,
+  0x0007a023, 0x00078223, 0x000782a3, 0x00078323, 0x000783a3, 0x00078523,
+  0x000785a3, 0xf99ff06f, 0x000087b7, 0x21878793, 0x0077c503, 0x00008067,
+  0x000087b7, 0x21878793, 0x00100713, 0x00e78223, 0x00008067, 0x000087b7,
+  0x21878793, 0x00100713, 0x00e782a3, 0x00008067, 0x000087b7, 0x21878793,
+  0x00100713, 0x00e78323, 0x00008067, 0x000087b7, 0x21878793, 0x00100713,
+  0x00e78523, 0x00008067, 0x000087b7, 0x21878793, 0x00b7c503, 0x00008067,
+  0x000087b7, 0x21878693, 0x0196c603, 0x00400593, 0x21878793, 0x0ff67713,
+  0x08c5e063, 0x000086b7, 0x00271713, 0x16068693, 0x00d70733, 0x00072703,
+  0x00070067, 0x00100713, 0x00e78d23, 0x00078da3, 0x00e78ca3, 0x00008067,
+  0x00100713, 0x00e78d23, 0x00e78da3, 0x00200713, 0xfe9ff06f, 0x00100713,
+  0x00e78d23, 0x00200713, 0x00e78da3, 0x00300713, 0xfd1ff06f, 0x00200713,
+  0x00e78d23, 0x00100713, 0x00e78da3, 0x00400713, 0xfb9ff06f, 0x00200713,
+  0x00e78d23, 0xfedff06f, 0x00068d23, 0x00068da3, 0x00068ca3, 0x00008067,
+  0xff410113, 0x00812223, 0x00008437, 0x21840793, 0x00112423, 0x0047c783,
+  0x21840413, 0x00079663, 0x00544783, 0x00078863, 0x00042023, 0x00040523,
+  0x000405a3, 0x00042783, 0x00600713, 0x14f76e63, 0x00008737, 0x00279793,
+  0x17470713, 0x00e787b3, 0x0007a783, 0x00078067, 0x00544783, 0x04078063,
+  0x000402a3, 0x00744783, 0x02078063, 0x000087b7, 0x1e878793, 0x00100713,
+  0x00000593, 0x00500513, 0x00e78323, 0xb68ff0ef, 0x000403a3, 0x00812083,
+  0x00412403, 0x00c10113, 0x00008067, 0x00444783, 0xfe0786e3, 0x00040223,
+  0x00100793, 0x00f403a3, 0x000405a3, 0x00040423, 0x00040e23, 0xbc8fe0ef,
+  0x00050463, 0xdb9ff0ef, 0x00100793, 0x00f42023, 0xfbdff06f, 0xaf8ff0ef,
+  0x00644783, 0xfa0788e3, 0x00040323, 0x000087b7, 0x1e878793, 0x000405a3,
+  0x00078223, 0x00100713, 0x00e781a3, 0x00200793, 0xfcdff06f, 0x000087b7,
+  0x1e878793, 0x0047c783, 0xf6078ee3, 0x00300793, 0xfb5ff06f, 0x06400593,
+  0x00000513, 0x9f9fd0ef, 0x00400793, 0xfa1ff06f, 0x00000513, 0xaddfd0ef,
+  0xf4050ae3, 0xb20ff0ef, 0xb81ff0ef, 0x00500793, 0xf85ff06f, 0x00a44783,
+  0xf2078ee3, 0x00040523, 0xbf9ff0ef, 0x00a404a3, 0x00944783, 0x02078e63,
+  0xb3cfe0ef, 0x04050263, 0x00100713, 0x00e40c23, 0x00e40423, 0x000087b7,
+  0x1e878793, 0x000403a3, 0xfff00513, 0x00e782a3, 0x8fdfd0ef, 0x93cff0ef,
+  0x00042023, 0xef1ff06f, 0x01c44783, 0x00078a63, 0xdb1ff0ef, 0x00040e23,
+  0x00600793, 0xf19ff06f, 0x01c44783, 0x00178793, 0x0ff7f793, 0x00f40e23,
+  0xfe9ff06f, 0x00100793, 0x00f405a3, 0x00a44703, 0xea070ae3, 0x00040523,
+  0x000405a3, 0x00944703, 0xee0702e3, 0xfadff06f, 0x000087b7, 0x2187a503,
+  0x00008067, 0x000087b7, 0x23878793, 0x00078fa3, 0x00078f23, 0x00079023,
+  0x0207a023, 0x00008067, 0xff010113, 0x000087b7, 0x00112623, 0x00812423,
+  0x00912223, 0x1e878793, 0x00100493, 0x04000513, 0x00008437, 0x23840413,
+  0x009785a3, 0xe50fd0ef, 0x01245783, 0x01300713, 0x00f11023, 0x000087b7,
+  0x6f478793, 0x00e78223, 0x0007a023, 0x009782a3, 0x0027a423, 0xb31fd0ef,
+  0x00940fa3, 0x00c12083, 0x02042023, 0x00812403, 0x00412483, 0x01010113,
+  0x00008067, 0xff410113, 0x00812223, 0x00050413, 0x04000513, 0x00112423,
+  0xe04fd0ef, 0x000087b7, 0x1e878793, 0x00878623, 0x000087b7, 0x23878793,
+  0x00078fa3, 0x00812083, 0x00412403, 0x00079023, 0x0207a023, 0x00c10113,
+  0x00008067, 0x000087b7, 0x23878793, 0x01f7c503, 0x00008067, 0x000087b7,
+  0x23878793, 0x0207a683, 0x3e800713, 0x00e69863, 0x0207a023, 0x00100513,
+  0x00008067, 0x0207a703, 0x00000513, 0x00170713, 0x02e7a023, 0x00008067,
+  0x000087b7, 0x23878793, 0x01c7d783, 0x00800513, 0x0407f793, 0x00078463,
+  0x00a00513, 0x00008067, 0xfb410113, 0x04812223, 0x00008437, 0x04112423,
+  0x04912023, 0x23840793, 0x01e7c783, 0x00079e63, 0x00000513, 0x04812083,
+  0x04412403, 0x04012483, 0x04c10113, 0x00008067, 0x23840413, 0x00040f23,
+  0x878fe0ef, 0x000087b7, 0x6f478793, 0x01200713, 0x00e78223, 0x00100693,
+  0x00d7a023, 0x00e782a3, 0x01810713, 0x00e7a423, 0x00a12023, 0x9f9fd0ef,
+  0x01815703, 0x00400793, 0x01a15483, 0x00e12223, 0x00012703, 0x22f71463,
+  0x00412783, 0x02015703, 0x00ff0337, 0x00879613, 0x01c15783, 0x00875693,
+  0x00667633, 0xf007f593, 0x00b6e6b3, 0x00c6e6b3, 0x00412603, 0x00010537,
+  0xfff50513, 0x01061613, 0x00879793, 0x00667633, 0x00a7f7b3, 0x00c7e7b3,
+  0x0ff77713, 0x01e15583, 0x00f76733, 0x02215783, 0xf005f393, 0x00849293,
+  0x0087d613, 0x0062f2b3, 0x00766633, 0x00566633, 0x00859593, 0x01049293,
+  0x0062f2b3, 0x00a5f5b3, 0x0055e5b3, 0x0ff7f793, 0x00b7e7b3, 0xf0e696e3,
+  0xf0c694e3, 0xf0f692e3, 0x00012703, 0x00400793, 0x24f71e63, 0x01810713,
+  0x02e10613, 0x00000793, 0x00c75683, 0x00270713, 0x00d787b3, 0x01079793,
+  0x0107d793, 0xfee616e3, 0x00045703, 0xecf706e3, 0x00f41023, 0x00412783,
+  0x03615683, 0x00012083, 0x00879393, 0x02015783, 0x00d12223, 0x00400313,
+  0x00f12623, 0x01c15603, 0x03015783, 0x03815703, 0x02415583, 0x02615283,
+  0x02815683, 0x3e609a63, 0x00c12083, 0x00ff0337, 0xf0067613, 0x0ff0f093,
+  0x0063f3b3, 0x00166633, 0x00766633, 0x02a15383, 0x00c42223, 0x01029613,
+  0x00667333, 0x00010637, 0xfff60613, 0x00839093, 0x00c0f0b3, 0x0060e0b3,
+  0x02e15303, 0xf002f293, 0x0083d393, 0x0ff37493, 0x0014e0b3, 0xf005f493,
+  0x00859593, 0x00142423, 0x00c5f5b3, 0x0086d093, 0x0ff6f693, 0x00b6e6b3,
+  0x0090e0b3, 0x01069693, 0x00141623, 0x0106d693, 0x00d41723, 0x03415683,
+  0x0053e3b3, 0x00875593, 0xf006f693, 0x00741923, 0x00b6e5b3, 0x00b41823,
+  0x02c15583, 0x0087d293, 0x0ff7f793, 0xf005f393, 0x00859593, 0x00c5f5b3,
+  0x00b7e7b3, 0x0ff77713, 0x0072e2b3, 0x01079793, 0x00541a23, 0x0107d793,
+  0x00e6e6b3, 0x00412703, 0x00f41b23, 0x03215783, 0x00871513, 0xf0037313,
+  0x0087d593, 0x00c57533, 0x0ff7f793, 0x0065e5b3, 0x00a7e7b3, 0x00b41d23,
+  0x01079793, 0x00d41c23, 0x0107d793, 0x00f41e23, 0x4240006f, 0x00412783,
+  0x02a15503, 0x00012703, 0x00879693, 0x00200793, 0x00851313, 0x08f71463,
+  0x01c15703, 0x00ff03b7, 0xf004f613, 0x00875793, 0x00c7e7b3, 0x0076f6b3,
+  0x00d7e6b3, 0x00412783, 0x000102b7, 0xfff28293, 0x01079613, 0x00849793,
+  0x00767633, 0x0057f7b3, 0x00c7e7b3, 0x0ff77713, 0x00f76733, 0x007377b3,
+  0x00f12423, 0x02e15783, 0x02c15583, 0x01051513, 0x0087d613, 0x00060313,
+  0xf005f613, 0x00c36633, 0x00812303, 0x00859593, 0x00757533, 0x0055f5b3,
+  0x00666633, 0x00a5e5b3, 0xdc5ff06f, 0x02015583, 0x02215703, 0x00ff07b7,
+  0x01059593, 0x00f5f5b3, 0x00b76733, 0x03215583, 0x0084d613, 0x00d666b3,
+  0x01059593, 0x00f5f5b3, 0x00666633, 0x03415783, 0xd91ff06f, 0x00012703,
+  0x00200793, 0x10f71c63, 0x03015783, 0x01810713, 0x00300693, 0xf007f793,
+  0x01079793, 0x0107d793, 0x00f12423, 0x03215783, 0x00d00593, 0x00e00393,
+  0xf007f793, 0x01079793, 0x0107d793, 0x00f12623, 0x03415783, 0x00c00293,
+  0x00800313, 0xf007f793, 0x01079793, 0x0107d793, 0x00f12823, 0x00000793,
+  0x06b68463, 0x00270613, 0x00d5ee63, 0x04568063, 0x00168513, 0x08d37663,
+  0x0ff57693, 0x00060713, 0xfe1ff06f, 0x06768063, 0x01000613, 0x00675683,
+  0x00270713, 0x00d786b3, 0x01069793, 0x01000693, 0x0107d793, 0xd2d602e3,
+  0xfb9ff06f, 0x00812703, 0x00d00693, 0x00f707b3, 0x01079793, 0x0107d793,
+  0x00060713, 0xf9dff06f, 0x00c12683, 0x00270713, 0x00f687b3, 0x01079793,
+  0x0107d793, 0x00e00693, 0xf85ff06f, 0x01012703, 0x00f707b3, 0x01079793,
+  0x00060713, 0x0107d793, 0x00f00613, 0xf91ff06f, 0x00675703, 0x0ff57693,
+  0x00e78733, 0x01071793, 0x0107d793, 0x00060713, 0xf4dff06f, 0x02015783,
+  0x02c14383, 0x03814283, 0xf007f793, 0x01079793, 0x0107d793, 0x00f12623,
+  0x00008637, 0x0ff4f793, 0x00f12423, 0x01810713, 0x00000693, 0x00000793,
+  0x01000513, 0x01200313, 0x19060613, 0x02d56663, 0x00269593, 0x00c585b3,
+  0x0005a583, 0x00058067, 0x00812683, 0x00270713, 0x00f687b3, 0x01079793,
+  0x0107d793, 0x00200693, 0x00075583, 0x00168693, 0x0ff6f693, 0x00b785b3,
+  0x01059793, 0x0107d793, 0x02669463, 0xc25ff06f, 0x00c12683, 0x00270713,
+  0x00f687b3, 0x01079793, 0x0107d793, 0x00500693, 0x00168693, 0x0ff6f693,
+  0x00270713, 0xf91ff06f, 0x00f387b3, 0x01079793, 0x0107d793, 0x00270713,
+  0x00b00693, 0xfa5ff06f, 0x00f287b3, 0x01079793, 0x0107d793, 0x00270713,
+  0x01100693, 0xf8dff06f, 0x00c12303, 0x00012503, 0x00835313, 0x00612a23,
+  0x01e15303, 0x00831093, 0x00612423, 0x00010337, 0xfff30313, 0x0060f0b3,
+  0x00112823, 0x00200093, 0x12151263, 0x00ff00b7, 0x00008513, 0x0013f3b3,
+  0x0ff67613, 0xf004f093, 0x00c0e0b3, 0x03215603, 0x0070e0b3, 0x00142223,
+  0x00861393, 0x01079093, 0x00a0f0b3, 0x0063f3b3, 0x0013e3b3, 0x03415083,
+  0x00812503, 0xf007f793, 0x0ff0f493, 0x0074e4b3, 0xf0057393, 0x01412503,
+  0x00942423, 0x00865613, 0x007563b3, 0x00741623, 0x01012503, 0x00c14383,
+  0x00f66633, 0x0086d793, 0x00a3e3b3, 0x01039393, 0x0103d393, 0x00741723,
+  0x00c41923, 0xf002f613, 0x00c7e7b3, 0x00f41823, 0x02215783, 0x0085d613,
+  0x0ff5f593, 0xf007f393, 0x00879793, 0x0067f7b3, 0x00f5e5b3, 0x00412783,
+  0x00414503, 0x00829293, 0x00766633, 0x01059593, 0x0062f2b3, 0x0ff6f693,
+  0x00871713, 0x00c41a23, 0x0105d593, 0x0087d793, 0xf000f093, 0x0056e6b3,
+  0x00677733, 0x00b41b23, 0x0017e7b3, 0x01069693, 0x00a76733, 0x00f41d23,
+  0x0106d693, 0x01071713, 0x00d41c23, 0x01075713, 0x00e41e23, 0x915ff0ef,
+  0x931fe0ef, 0x00100513, 0x94dff06f, 0x00412503, 0x0084d093, 0x0070e0b3,
+  0x00851513, 0x00875393, 0x00142223, 0x00756533, 0x00a42423, 0x00849513,
+  0x00657533, 0x00865393, 0x00a3e3b3, 0x01039393, 0x0103d393, 0x00741623,
+  0x02c15383, 0x00b41723, 0x02e15583, 0x00839393, 0x0063f3b3, 0x0085d513,
+  0x00756533, 0x01051513, 0x01055513, 0x00a41923, 0x01012383, 0x01412503,
+  0x00861613, 0x00859593, 0x00756533, 0x01051513, 0x01055513, 0x00a41823,
+  0x00667533, 0x00812603, 0x0065f5b3, 0x0087d793, 0x00865613, 0x00a66633,
+  0x01061613, 0x01065613, 0x00b7e7b3, 0x00c41a23, 0x01079793, 0x00541b23,
+  0x0107d793, 0x00f41d23, 0x03a15783, 0x0ff77713, 0x00d41c23, 0xf007f793,
+  0x00e7e7b3, 0xaf9ff06f, 0x000087b7, 0x23878793, 0x00100713, 0x00e78f23,
+  0x00008067, 0x00008737, 0x00000693, 0x00000793, 0x1dc70713, 0x00700613,
+  0x00d705b3, 0x0015c583, 0x00168693, 0x00f5c7b3, 0xfec698e3, 0x00874703,
+  0x00278513, 0x0ff57513, 0x40e50533, 0x00a03533, 0x00008067, 0xff410113,
+  0x00100513, 0x00112423, 0xda1fc0ef, 0x000087b7, 0x1dc78793, 0x00050c63,
+  0x00100713, 0x00e78023, 0x00812083, 0x00c10113, 0x00008067, 0x00078023,
+  0xff1ff06f, 0x0000c7b7, 0x10078693, 0x00008737, 0x02d72823, 0x20078693,
+  0x00008737, 0x02d72623, 0x30078693, 0x00008737, 0x02d72423, 0x40078693,
+  0x00008737, 0x02d72223, 0x50078693, 0x00008737, 0x02d72023, 0x60078693,
+  0x00008737, 0x00d72e23, 0x70078793, 0x00008737, 0x00f72c23, 0x0000d7b7,
+  0x00008737, 0x80078793, 0xff410113, 0x00f72a23, 0x00112423, 0x9c1fe0ef,
+  0xc1dfc0ef, 0x00800513, 0xc6dfc0ef, 0x02800513, 0xc81fc0ef, 0xf41ff0ef,
+  0xea9fc0ef, 0x984fd0ef, 0x8a4fd0ef, 0xb04fd0ef, 0xc18fe0ef, 0xa9cfd0ef,
+  0xe00fd0ef, 0xde8fe0ef, 0xddcff0ef, 0xa9cff0ef, 0x00100513, 0xc69fc0ef,
+  0x00200513, 0xc61fc0ef, 0x00400513, 0xc59fc0ef, 0xd693a5b7, 0x40058593,
+  0x00100513, 0xed1fc0ef, 0x000087b7, 0x1dc78793, 0x00100713, 0x00e784a3,
+  0xbf4fe0ef, 0xcc0fe0ef, 0x00050663, 0xa54ff0ef, 0xebcfd0ef, 0xa85fd0ef,
+  0xfe9ff06f, 0x00200713, 0x00e50a63, 0x00300713, 0x00e50863, 0x00100713,
+  0x00e51863, 0xc01fc06f, 0x00400513, 0xff9ff06f, 0x00008067, 0x00200713,
+  0x00e50a63, 0x00300713, 0x00e50863, 0x00100713, 0x00e51863, 0xbe9fc06f,
+  0x00400513, 0xff9ff06f, 0x00008067, 0xff410113, 0x00112423, 0x00812223,
+  0xf7dfc0ef, 0x00200513, 0xf8dfc0ef, 0x00400513, 0xf85fc0ef, 0x02000513,
+  0xf7dfc0ef, 0x04000513, 0xf75fc0ef, 0x08000513, 0xf6dfc0ef, 0x00008537,
+  0x00008437, 0xf61fc0ef, 0x1dc40413, 0xc50fe0ef, 0xf1dfc0ef, 0x00050663,
+  0x00800513, 0xb91fc0ef, 0x00100513, 0xee5fc0ef, 0xfe0502e3, 0x00944783,
+  0x00078e63, 0x00400513, 0xb65fc0ef, 0x00100593, 0x00900513, 0xea0fe0ef,
+  0xfc5ff06f, 0x00944783, 0xd693a5b7, 0x40058593, 0x00178793, 0x0ff7f793,
+  0x00100513, 0x00f404a3, 0xdadfc0ef, 0xfa1ff06f, 0xff410113, 0x00112423,
+  0x881fe0ef, 0xbe1fe0ef, 0xff9ff06f, 0xff410113, 0x00812223, 0x00112423,
+  0x00008437, 0xec8fe0ef, 0xa60ff0ef, 0xde4fe0ef, 0xfe050ae3, 0x00300593,
+  0x02800513, 0xc55fc0ef, 0x02050c63, 0x00800513, 0xb29fc0ef, 0x00050793,
+  0x00200513, 0x00078a63, 0x02000513, 0xb15fc0ef, 0x00153513, 0x00351513,
+  0x00000593, 0xe08fe0ef, 0x00300513, 0xca0ff0ef, 0xce4ff0ef, 0x02050063,
+  0x04000513, 0xaedfc0ef, 0x00051a63, 0xce0ff0ef, 0x00050663, 0x00200513,
+  0xc7cff0ef, 0xd24ff0ef, 0xf80502e3, 0x1dc40793, 0x00100713, 0x00e78ca3,
+  0xcacff0ef, 0xf60518e3, 0xbe8ff0ef, 0xf69ff06f
 };
-unsigned int prt_dprx_pm_rom_len = 14176;
+const uint32_t prt_dprx_pm_rom_len = 3544;
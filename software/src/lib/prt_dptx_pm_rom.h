@@ -1,1198 +1,602 @@
-unsigned char prt_dptx_pm_rom[] = {
-  0x6f, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x00, 0x05, 0x6f, 0x00, 0x40, 0x09,
-  0x6f, 0x00, 0x80, 0x0d, 0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x00, 0x2c, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xf0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x40, 0x55, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xe0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x40, 0x5b, 0x6f, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x37, 0x91, 0x00, 0x00, 0x13, 0x01, 0x01, 0xd0,
-  0x93, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x13, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0xef, 0x30, 0x00, 0x58, 0x6f, 0x00, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x01, 0x23, 0xa0, 0x07, 0x00,
-  0x23, 0xa2, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x87, 0x03,
-  0xb7, 0x17, 0x00, 0x00, 0x93, 0x87, 0x47, 0x23, 0x03, 0xa7, 0x06, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0x13, 0x57, 0x07, 0x01, 0x63, 0x18, 0xf7, 0x00,
-  0x93, 0x07, 0x30, 0x00, 0x23, 0xa2, 0xf6, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03,
-  0x03, 0xa5, 0x07, 0x00, 0x13, 0x15, 0x05, 0x01, 0x13, 0x55, 0x05, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03,
-  0x13, 0x15, 0x25, 0x00, 0x03, 0xa7, 0x47, 0x00, 0x33, 0x65, 0xe5, 0x00,
-  0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x87, 0x03, 0x13, 0x15, 0xa5, 0x00, 0x03, 0xa7, 0x47, 0x00,
-  0x33, 0x65, 0xe5, 0x00, 0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03, 0x23, 0xac, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03,
-  0x23, 0xae, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x87, 0x03, 0x23, 0xa0, 0xa7, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03, 0x23, 0xa4, 0xb7, 0x02,
-  0x23, 0xa2, 0xa7, 0x02, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x87, 0x03, 0x03, 0xa5, 0xc7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03, 0x83, 0xa7, 0xc7, 0x00,
-  0x33, 0xf5, 0xa7, 0x00, 0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x03, 0x23, 0xac, 0xa7, 0x00,
-  0x23, 0xae, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x20, 0x91, 0x00, 0xb7, 0x84, 0x00, 0x00, 0x83, 0xa7, 0x84, 0x03,
-  0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00, 0x83, 0xa7, 0x87, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8c, 0x07, 0x04, 0x13, 0x04, 0x05, 0x00,
-  0xef, 0x00, 0xc0, 0x58, 0x03, 0xa7, 0x84, 0x03, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x01, 0x03, 0x26, 0x07, 0x01, 0x83, 0xa6, 0x07, 0x00,
-  0x13, 0x05, 0x04, 0x00, 0x03, 0x24, 0x41, 0x00, 0xb3, 0xe6, 0xc6, 0x00,
-  0x23, 0xa0, 0xd7, 0x00, 0x03, 0x26, 0x47, 0x01, 0x83, 0xa6, 0x47, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x83, 0x24, 0x01, 0x00, 0xb3, 0xe6, 0xc6, 0x00,
-  0x23, 0xa2, 0xd7, 0x00, 0x93, 0x07, 0x10, 0x00, 0x23, 0x24, 0xf7, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0x00, 0xc0, 0x56, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff, 0x23, 0x22, 0x91, 0x00,
-  0xb7, 0x84, 0x00, 0x00, 0x93, 0x84, 0x44, 0x01, 0x83, 0xa7, 0x04, 0x00,
-  0x23, 0x24, 0x81, 0x00, 0x23, 0x26, 0x11, 0x00, 0xb3, 0xf7, 0xa7, 0x00,
-  0x13, 0x04, 0x05, 0x00, 0x13, 0x05, 0x00, 0x00, 0x63, 0x86, 0x07, 0x02,
-  0x13, 0x85, 0x05, 0x00, 0x23, 0x20, 0xb1, 0x00, 0xef, 0x00, 0x40, 0x4f,
-  0x83, 0xa7, 0x04, 0x00, 0x03, 0x25, 0x01, 0x00, 0x13, 0x44, 0xf4, 0xff,
-  0x33, 0x74, 0xf4, 0x00, 0x23, 0xa0, 0x84, 0x00, 0xef, 0x00, 0x80, 0x50,
-  0x13, 0x05, 0x10, 0x00, 0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x01, 0xff, 0x23, 0x22, 0x91, 0x00, 0xb7, 0x84, 0x00, 0x00,
-  0x93, 0x84, 0x44, 0x01, 0x83, 0xa7, 0x44, 0x00, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x26, 0x11, 0x00, 0xb3, 0xf7, 0xa7, 0x00, 0x13, 0x04, 0x05, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0x63, 0x86, 0x07, 0x02, 0x13, 0x85, 0x05, 0x00,
-  0x23, 0x20, 0xb1, 0x00, 0xef, 0x00, 0xc0, 0x48, 0x83, 0xa7, 0x44, 0x00,
-  0x03, 0x25, 0x01, 0x00, 0x13, 0x44, 0xf4, 0xff, 0x33, 0x74, 0xf4, 0x00,
-  0x23, 0xa2, 0x84, 0x00, 0xef, 0x00, 0x00, 0x4a, 0x13, 0x05, 0x10, 0x00,
-  0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x01, 0x03, 0xa7, 0x07, 0x00, 0x13, 0x45, 0xf5, 0xff,
-  0x33, 0x75, 0xe5, 0x00, 0x23, 0xa0, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x01, 0x03, 0xa7, 0x47, 0x00,
-  0x13, 0x45, 0xf5, 0xff, 0x33, 0x75, 0xe5, 0x00, 0x23, 0xa2, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x47, 0x03,
-  0x13, 0x07, 0x30, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x84, 0x07, 0x00, 0x93, 0x87, 0x87, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x47, 0x03, 0x63, 0x1c, 0x05, 0x02, 0x23, 0xa6, 0xb7, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0x83, 0xa6, 0x07, 0x00, 0x33, 0x67, 0xd7, 0x00,
-  0x23, 0xa0, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x00,
-  0x33, 0x85, 0xa7, 0x00, 0x23, 0x00, 0x05, 0x00, 0x83, 0x47, 0x05, 0x00,
-  0xe3, 0x8e, 0x07, 0xfe, 0x23, 0x00, 0x05, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x23, 0xa8, 0xb7, 0x00, 0x13, 0x07, 0x80, 0x00, 0x6f, 0xf0, 0xdf, 0xfc,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x47, 0x03, 0x63, 0x16, 0x05, 0x02,
-  0x23, 0xa6, 0xb7, 0x00, 0x13, 0x07, 0x40, 0x00, 0x83, 0xa6, 0x07, 0x00,
-  0x33, 0x67, 0xd7, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x00, 0x33, 0x05, 0xf5, 0x00, 0x23, 0x00, 0x05, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x23, 0xa8, 0xb7, 0x00, 0x13, 0x07, 0x80, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfd, 0x63, 0x0e, 0x05, 0x02, 0x93, 0x06, 0x40, 0x00,
-  0x93, 0x07, 0x80, 0x00, 0x37, 0x87, 0x00, 0x00, 0x03, 0x27, 0x47, 0x03,
-  0x93, 0xc7, 0xf7, 0xff, 0x03, 0x26, 0x07, 0x00, 0xb3, 0xf7, 0xc7, 0x00,
-  0x23, 0x20, 0xf7, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x00,
-  0x23, 0x22, 0xd7, 0x00, 0x33, 0x05, 0xf5, 0x00, 0x23, 0x00, 0x05, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x06, 0x20, 0x00, 0x93, 0x07, 0x40, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfc, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0x47, 0x03,
-  0x83, 0x27, 0x47, 0x00, 0x93, 0xf6, 0x07, 0x01, 0x63, 0x8e, 0x06, 0x00,
-  0x93, 0x06, 0x00, 0x01, 0x23, 0x22, 0xd7, 0x00, 0xb7, 0x86, 0x00, 0x00,
-  0x93, 0x86, 0x86, 0x00, 0x13, 0x06, 0x10, 0x00, 0x23, 0x81, 0xc6, 0x00,
-  0x93, 0xf6, 0x27, 0x00, 0x63, 0x8c, 0x06, 0x00, 0x93, 0x06, 0x20, 0x00,
-  0x23, 0x22, 0xd7, 0x00, 0x13, 0x06, 0x10, 0x00, 0xb7, 0x86, 0x00, 0x00,
-  0x23, 0x84, 0xc6, 0x00, 0x93, 0xf7, 0x47, 0x00, 0x63, 0x8e, 0x07, 0x00,
-  0x93, 0x07, 0x40, 0x00, 0x23, 0x22, 0xf7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x87, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x80, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x00,
-  0xb3, 0x87, 0xa7, 0x00, 0x03, 0xc7, 0x07, 0x00, 0x13, 0x75, 0xf7, 0x0f,
-  0x63, 0x06, 0x07, 0x00, 0x23, 0x80, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x87, 0x00,
-  0x03, 0xc7, 0x27, 0x00, 0x13, 0x75, 0xf7, 0x0f, 0x63, 0x06, 0x07, 0x00,
-  0x23, 0x81, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x13, 0x07, 0x10, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x23, 0xa0, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03,
-  0x23, 0xa2, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x07, 0x03, 0x03, 0xa5, 0x87, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x03, 0x23, 0xa4, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x02,
-  0x13, 0x07, 0xf0, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa2, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0xc7, 0x02,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x07, 0x00, 0x10, 0x23, 0xa6, 0xf6, 0x00,
-  0x13, 0x07, 0x47, 0x10, 0x93, 0x07, 0x00, 0x00, 0x03, 0x46, 0x17, 0x00,
-  0x63, 0xe8, 0xc7, 0x00, 0x93, 0x07, 0xf0, 0x1f, 0x23, 0xa6, 0xf6, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x33, 0x06, 0xf7, 0x00, 0x03, 0x46, 0x26, 0x00,
-  0x93, 0x87, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x13, 0x76, 0xf6, 0x0f,
-  0x23, 0xa6, 0xc6, 0x00, 0x6f, 0xf0, 0x5f, 0xfd, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0xc7, 0x02, 0x23, 0xaa, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa6, 0xc7, 0x02, 0x93, 0x06, 0x00, 0x10,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0x27, 0x06, 0x01, 0x93, 0x87, 0x87, 0x12,
-  0x13, 0x77, 0xf7, 0x1f, 0x63, 0x1c, 0xd7, 0x00, 0x23, 0x80, 0x07, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x93, 0x07, 0x10, 0x00, 0x23, 0x24, 0xf6, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x06, 0xf0, 0x1f, 0x63, 0x18, 0xd7, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x23, 0x80, 0xe7, 0x00, 0x6f, 0xf0, 0x5f, 0xfe,
-  0x83, 0xc5, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x93, 0x86, 0x15, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x80, 0xd7, 0x00, 0xb3, 0x87, 0xb7, 0x00,
-  0x23, 0x81, 0xe7, 0x00, 0x6f, 0xf0, 0x5f, 0xfc, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x29, 0x23, 0x86, 0x07, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x07, 0x02,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0xa0, 0xf6, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x86, 0xc7, 0x29, 0x83, 0x45, 0x56, 0x00, 0x03, 0x47, 0x46, 0x00,
-  0x03, 0x26, 0x06, 0x00, 0x93, 0x87, 0xc7, 0x29, 0x13, 0x17, 0x87, 0x00,
-  0x33, 0x67, 0xb7, 0x00, 0x63, 0x16, 0x06, 0x00, 0x37, 0x86, 0x00, 0x00,
-  0x33, 0x67, 0xc7, 0x00, 0x37, 0x06, 0x02, 0x00, 0x33, 0x67, 0xc7, 0x00,
-  0x23, 0xa4, 0xe6, 0x00, 0x37, 0x05, 0x01, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x03, 0xc6, 0x57, 0x00, 0x63, 0x6c, 0xc7, 0x00, 0x03, 0xa6, 0x07, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x63, 0x02, 0xe6, 0x08, 0x23, 0xa0, 0x06, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x83, 0xa5, 0x07, 0x00, 0x13, 0x06, 0x00, 0x00,
-  0x63, 0x9a, 0x05, 0x00, 0x03, 0xa6, 0x87, 0x00, 0x93, 0x15, 0x17, 0x00,
-  0x33, 0x06, 0xb6, 0x00, 0x03, 0x56, 0x06, 0x00, 0x83, 0xc5, 0x57, 0x00,
-  0x93, 0x85, 0xf5, 0xff, 0x63, 0x14, 0xb7, 0x00, 0x33, 0x66, 0xa6, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x23, 0xa4, 0xc6, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x6f, 0xf0, 0xdf, 0xfa, 0x03, 0xa6, 0x46, 0x00, 0x93, 0x75, 0x26, 0x00,
-  0x63, 0x96, 0x05, 0x00, 0x13, 0x76, 0x46, 0x00, 0xe3, 0x18, 0x06, 0xfe,
-  0x83, 0xa5, 0xc6, 0x00, 0x03, 0xa6, 0x87, 0x00, 0x13, 0x15, 0x17, 0x00,
-  0x13, 0x07, 0x17, 0x00, 0x33, 0x06, 0xa6, 0x00, 0x23, 0x10, 0xb6, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x03, 0xc6, 0x57, 0x00, 0xe3, 0x66, 0xc7, 0xfc,
-  0x6f, 0xf0, 0x5f, 0xf8, 0x13, 0x07, 0x00, 0x00, 0x6f, 0xf0, 0x1f, 0xff,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x07, 0x02, 0x83, 0xa7, 0x47, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8a, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x29, 0x13, 0x07, 0x10, 0x00, 0x23, 0x86, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0xc7, 0x01,
-  0x13, 0x07, 0x10, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x07, 0x10, 0x00, 0x33, 0x95, 0xa7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0xc7, 0x01, 0x93, 0x76, 0xf5, 0x0f,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x22, 0xa7, 0x00, 0x83, 0x27, 0x47, 0x00,
-  0xb3, 0xf7, 0xf6, 0x00, 0xe3, 0x8a, 0x07, 0xfe, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0xc7, 0x01, 0x93, 0x07, 0x10, 0x00,
-  0xb3, 0x97, 0xa7, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x24, 0xf7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x47, 0x02,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x0e, 0xa3, 0x8e, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x47, 0x02, 0x83, 0xa7, 0x46, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x8c, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0xa2, 0xe6, 0x00, 0x93, 0x87, 0x07, 0x0e,
-  0xa3, 0x8e, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x0e, 0x03, 0xc7, 0xd7, 0x01, 0x13, 0x75, 0xf7, 0x0f,
-  0x63, 0x06, 0x07, 0x00, 0xa3, 0x8e, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0x83, 0x27, 0x44, 0x02, 0x23, 0x24, 0x11, 0x00,
-  0x23, 0x20, 0x91, 0x00, 0x13, 0x07, 0x10, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x23, 0xa4, 0x07, 0x00, 0x23, 0xa4, 0x07, 0x00, 0x23, 0xa4, 0x07, 0x00,
-  0x23, 0xa4, 0x07, 0x00, 0x13, 0x07, 0x00, 0x10, 0x23, 0xa4, 0xe7, 0x00,
-  0x13, 0x05, 0x00, 0x10, 0xef, 0xf0, 0x9f, 0xd5, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x84, 0x07, 0x0e, 0x03, 0xa7, 0x04, 0x00, 0x03, 0xa5, 0x84, 0x00,
-  0x13, 0x17, 0x47, 0x00, 0x13, 0x55, 0x05, 0x01, 0x13, 0x75, 0xf5, 0x00,
-  0x33, 0x65, 0xe5, 0x00, 0x03, 0x27, 0x44, 0x02, 0x13, 0x75, 0xf5, 0x0f,
-  0x23, 0x24, 0xa7, 0x00, 0xef, 0xf0, 0x9f, 0xd2, 0x03, 0xa5, 0x84, 0x00,
-  0x03, 0x27, 0x44, 0x02, 0x13, 0x55, 0x85, 0x00, 0x93, 0x76, 0xf5, 0x0f,
-  0x23, 0x24, 0xd7, 0x00, 0x13, 0x75, 0xf5, 0x0f, 0xef, 0xf0, 0xdf, 0xd0,
-  0x03, 0xa5, 0x84, 0x00, 0x03, 0x27, 0x44, 0x02, 0x93, 0x76, 0xf5, 0x0f,
-  0x23, 0x24, 0xd7, 0x00, 0x13, 0x75, 0xf5, 0x0f, 0xef, 0xf0, 0x5f, 0xcf,
-  0x03, 0xc7, 0xc4, 0x00, 0x63, 0x1a, 0x07, 0x04, 0x83, 0x27, 0x44, 0x02,
-  0x13, 0x07, 0x00, 0x10, 0x13, 0x05, 0x10, 0x10, 0x23, 0xa4, 0xe7, 0x00,
-  0xef, 0xf0, 0x9f, 0xcd, 0x03, 0x24, 0x44, 0x02, 0x83, 0x27, 0x04, 0x00,
-  0x93, 0xe7, 0xe7, 0x00, 0x23, 0x20, 0xf4, 0x00, 0xef, 0xf0, 0x1f, 0xf1,
-  0xe3, 0x0e, 0x05, 0xfe, 0x03, 0x25, 0x44, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x55, 0x15, 0x00, 0x13, 0x45, 0x15, 0x00,
-  0x83, 0x24, 0x01, 0x00, 0x13, 0x75, 0x15, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e,
-  0x03, 0xc5, 0xc7, 0x00, 0x03, 0x27, 0x44, 0x02, 0x13, 0x05, 0xf5, 0xff,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x24, 0xa7, 0x00, 0xef, 0xf0, 0xdf, 0xc7,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e, 0x83, 0xa6, 0x07, 0x00,
-  0x13, 0x07, 0x80, 0x00, 0x63, 0x92, 0xe6, 0x04, 0x93, 0x04, 0x00, 0x00,
-  0x03, 0xc7, 0xc7, 0x00, 0x03, 0x26, 0x44, 0x02, 0xb7, 0x86, 0x00, 0x00,
-  0xe3, 0xf6, 0xe4, 0xf6, 0x13, 0x87, 0xd6, 0x0e, 0x33, 0x87, 0xe4, 0x00,
-  0x03, 0x45, 0x07, 0x00, 0x93, 0x84, 0x14, 0x00, 0x93, 0xf4, 0xf4, 0x0f,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x24, 0xa6, 0x00, 0xef, 0xf0, 0x5f, 0xc3,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e, 0x6f, 0xf0, 0x9f, 0xfc,
-  0x03, 0xa7, 0x07, 0x00, 0xe3, 0x0e, 0x07, 0xfa, 0x83, 0xa6, 0x07, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0xe3, 0x96, 0xe6, 0xf2, 0x6f, 0xf0, 0xdf, 0xfa,
-  0xb7, 0x25, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff, 0x93, 0x85, 0x05, 0x71,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0x26, 0x11, 0x00, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0xef, 0xf0, 0xdf, 0x9f, 0xef, 0xf0, 0x9f, 0xe3,
-  0x63, 0x12, 0x05, 0x06, 0xef, 0xf0, 0x5f, 0xae, 0xe3, 0x0a, 0x05, 0xfe,
-  0x93, 0x06, 0x10, 0x00, 0x6f, 0x00, 0x00, 0x13, 0x93, 0xd7, 0x67, 0x00,
-  0x6f, 0x00, 0x40, 0x0a, 0x83, 0x27, 0x47, 0x02, 0x23, 0x20, 0xd1, 0x00,
-  0x03, 0xa5, 0xc7, 0x00, 0x93, 0x07, 0xd6, 0x0e, 0xb3, 0x87, 0xf4, 0x00,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x80, 0xa7, 0x00, 0xef, 0xf0, 0x1f, 0xbb,
-  0x83, 0x26, 0x01, 0x00, 0x93, 0x84, 0x14, 0x00, 0x93, 0xf4, 0xf4, 0x0f,
-  0x37, 0x87, 0x00, 0x00, 0x83, 0x47, 0xc4, 0x00, 0x37, 0x86, 0x00, 0x00,
-  0xe3, 0xe4, 0xf4, 0xfc, 0x6f, 0x00, 0x80, 0x0d, 0x93, 0x06, 0x10, 0x00,
-  0x6f, 0x00, 0x00, 0x0d, 0x37, 0x87, 0x00, 0x00, 0x83, 0x27, 0x47, 0x02,
-  0x83, 0xa7, 0x47, 0x00, 0x93, 0xf7, 0x87, 0x00, 0xe3, 0x8c, 0x07, 0xf8,
-  0x13, 0x05, 0x20, 0x10, 0xef, 0xf0, 0xdf, 0xb6, 0x37, 0x87, 0x00, 0x00,
-  0x83, 0x27, 0x47, 0x02, 0x37, 0x84, 0x00, 0x00, 0x93, 0x06, 0x80, 0x00,
-  0x23, 0xa2, 0xd7, 0x00, 0x13, 0x06, 0x04, 0x0e, 0x83, 0xa7, 0xc7, 0x00,
-  0x03, 0x26, 0x06, 0x00, 0x13, 0x04, 0x04, 0x0e, 0x93, 0xf7, 0xf7, 0x0f,
-  0x63, 0x08, 0xd6, 0x00, 0x03, 0x26, 0x04, 0x00, 0x93, 0x06, 0x90, 0x00,
-  0xe3, 0x10, 0xd6, 0xf6, 0x93, 0xd7, 0x47, 0x00, 0x23, 0x22, 0xf4, 0x00,
-  0x83, 0x27, 0x44, 0x00, 0x93, 0xf7, 0x37, 0x00, 0x23, 0x22, 0xf4, 0x00,
-  0x03, 0x25, 0x44, 0x00, 0x13, 0x15, 0x05, 0x01, 0x13, 0x55, 0x05, 0x01,
-  0xef, 0xf0, 0x1f, 0xb1, 0x83, 0x26, 0x44, 0x00, 0xe3, 0x9e, 0x06, 0xf6,
-  0x03, 0x26, 0x04, 0x00, 0x93, 0x07, 0x90, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x63, 0x0e, 0xf6, 0x00, 0x03, 0x26, 0x04, 0x00, 0x93, 0x07, 0x10, 0x00,
-  0x63, 0x08, 0xf6, 0x00, 0x03, 0x26, 0x04, 0x00, 0x93, 0x07, 0x50, 0x00,
-  0x63, 0x14, 0xf6, 0x02, 0x83, 0x27, 0x47, 0x02, 0x93, 0x04, 0x00, 0x00,
-  0x83, 0xa7, 0x47, 0x00, 0x93, 0xd7, 0xa7, 0x00, 0x93, 0xf7, 0xf7, 0x01,
-  0x23, 0x06, 0xf4, 0x00, 0x03, 0x46, 0xc4, 0x00, 0x93, 0x07, 0x00, 0x01,
-  0xe3, 0xf0, 0xc7, 0xf2, 0x13, 0x05, 0x30, 0x10, 0x23, 0x20, 0xd1, 0x00,
-  0xef, 0xf0, 0x1f, 0xab, 0x83, 0x26, 0x01, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x83, 0xa7, 0x47, 0x02, 0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x23, 0xa0, 0x07, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x85, 0x06, 0x00,
-  0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x23, 0x20, 0x91, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x13, 0x04, 0x00, 0x00, 0xb7, 0x84, 0x00, 0x00, 0xef, 0xf0, 0x9f, 0xcd,
-  0x63, 0x12, 0x05, 0x02, 0xef, 0xf0, 0x9f, 0xe5, 0x63, 0x1e, 0x05, 0x02,
-  0x93, 0x87, 0x04, 0x0e, 0x03, 0xa5, 0x47, 0x00, 0x63, 0x0e, 0x05, 0x00,
-  0x03, 0xa7, 0x47, 0x00, 0x93, 0x07, 0x20, 0x00, 0x63, 0x16, 0xf7, 0x00,
-  0x93, 0x07, 0x80, 0x00, 0x63, 0x14, 0xf4, 0x02, 0x13, 0x05, 0x10, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x93, 0x07, 0x20, 0x00,
-  0xe3, 0x1e, 0xf5, 0xfc, 0x6f, 0xf0, 0x1f, 0xfe, 0x13, 0x04, 0x14, 0x00,
-  0x13, 0x74, 0xf4, 0x0f, 0x6f, 0xf0, 0x5f, 0xfa, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x07, 0x00, 0x00, 0x63, 0x14, 0xe5, 0x00, 0x93, 0x07, 0x10, 0x01,
-  0x37, 0x87, 0x00, 0x00, 0x03, 0x27, 0x47, 0x02, 0x23, 0x20, 0xf7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x20, 0x91, 0x00,
-  0xb7, 0x84, 0x00, 0x00, 0x23, 0x22, 0x81, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x13, 0x84, 0x04, 0x0e, 0x93, 0x07, 0x40, 0x00, 0x23, 0x20, 0xf4, 0x00,
-  0x83, 0x47, 0xe4, 0x01, 0x93, 0x84, 0x04, 0x0e, 0x93, 0xf7, 0xf7, 0x0f,
-  0x23, 0x24, 0xf4, 0x00, 0x23, 0x06, 0x04, 0x00, 0x03, 0x57, 0x04, 0x02,
-  0x83, 0x47, 0xc4, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x93, 0x86, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x06, 0xd4, 0x00, 0xb3, 0x07, 0xf4, 0x00,
-  0xa3, 0x86, 0xe7, 0x00, 0xef, 0xf0, 0x5f, 0xf1, 0x63, 0x12, 0x05, 0x02,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0x20, 0xf4, 0x00, 0x83, 0x47, 0x24, 0x02,
-  0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x06, 0xf4, 0x00, 0xef, 0xf0, 0x9f, 0xef,
-  0x93, 0x07, 0x10, 0x00, 0x63, 0x02, 0x05, 0x02, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0xa0, 0xf4, 0x00, 0x83, 0xc7, 0xe4, 0x01, 0x93, 0xf7, 0xf7, 0x0f,
-  0x23, 0xa4, 0xf4, 0x00, 0x23, 0x86, 0x04, 0x00, 0xef, 0xf0, 0x5f, 0xed,
-  0x93, 0x07, 0x00, 0x00, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0x83, 0x24, 0x01, 0x00, 0x33, 0x05, 0xf5, 0x40,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x13, 0x04, 0x04, 0x0e, 0x93, 0x07, 0x90, 0x00, 0x23, 0x20, 0xf4, 0x00,
-  0x23, 0x24, 0x04, 0x00, 0x93, 0x07, 0x00, 0x01, 0x23, 0x06, 0xf4, 0x00,
-  0xef, 0xf0, 0x9f, 0xe8, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x25,
-  0x63, 0x18, 0x05, 0x04, 0x03, 0x47, 0xd4, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x80, 0xe7, 0x00, 0x03, 0x47, 0xe4, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0xa3, 0x80, 0xe7, 0x00, 0x03, 0x47, 0xf4, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x81, 0xe7, 0x00, 0x03, 0x47, 0x04, 0x01, 0x13, 0x77, 0xf7, 0x0f,
-  0xa3, 0x81, 0xe7, 0x00, 0x03, 0x47, 0xb4, 0x01, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x82, 0xe7, 0x00, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x23, 0x80, 0x07, 0x00,
-  0xa3, 0x80, 0x07, 0x00, 0x23, 0x81, 0x07, 0x00, 0xa3, 0x81, 0x07, 0x00,
-  0x23, 0x82, 0x07, 0x00, 0x6f, 0xf0, 0xdf, 0xfd, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x13, 0x04, 0x04, 0x0e, 0x93, 0x07, 0x90, 0x00, 0x23, 0x20, 0xf4, 0x00,
-  0x93, 0x07, 0x00, 0x20, 0x23, 0x24, 0xf4, 0x00, 0x93, 0x07, 0x50, 0x00,
-  0x23, 0x06, 0xf4, 0x00, 0xef, 0xf0, 0x9f, 0xde, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x25, 0x63, 0x18, 0x05, 0x04, 0x03, 0x47, 0xd4, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x82, 0xe7, 0x00, 0x03, 0x47, 0xe4, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x83, 0xe7, 0x00, 0x03, 0x47, 0xf4, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x83, 0xe7, 0x00, 0x03, 0x47, 0x04, 0x01,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x84, 0xe7, 0x00, 0x03, 0x47, 0x14, 0x01,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x84, 0xe7, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xa3, 0x82, 0x07, 0x00, 0x23, 0x83, 0x07, 0x00, 0xa3, 0x83, 0x07, 0x00,
-  0x23, 0x84, 0x07, 0x00, 0xa3, 0x84, 0x07, 0x00, 0x6f, 0xf0, 0xdf, 0xfd,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e, 0x13, 0x07, 0x80, 0x00,
-  0x23, 0xa0, 0xe7, 0x00, 0x13, 0x07, 0x00, 0x30, 0x23, 0xa4, 0xe7, 0x00,
-  0x23, 0x86, 0x07, 0x00, 0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00,
-  0x93, 0x06, 0x20, 0x01, 0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00,
-  0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x40, 0x03, 0xa3, 0x06, 0xd7, 0x00,
-  0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x60, 0x05,
-  0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00,
-  0x93, 0x06, 0xd0, 0x04, 0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00,
-  0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x10, 0x04, 0xa3, 0x06, 0xd7, 0x00,
-  0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x20, 0x05,
-  0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00,
-  0x93, 0x06, 0x30, 0x04, 0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00,
-  0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0xf0, 0x04, 0xa3, 0x06, 0xd7, 0x00,
-  0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x70, 0x04,
-  0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00, 0x93, 0x06, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00, 0x33, 0x87, 0xe7, 0x00,
-  0x93, 0x06, 0x00, 0x01, 0xa3, 0x06, 0xd7, 0x00, 0x03, 0xc7, 0xc7, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00,
-  0x33, 0x87, 0xe7, 0x00, 0x93, 0x06, 0x10, 0x00, 0xa3, 0x06, 0xd7, 0x00,
-  0x83, 0xc6, 0xc7, 0x00, 0x13, 0x87, 0x16, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x86, 0xe7, 0x00, 0xb3, 0x87, 0xd7, 0x00, 0xa3, 0x86, 0x07, 0x00,
-  0x6f, 0xf0, 0xdf, 0xc0, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e,
-  0x13, 0x07, 0x80, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0x13, 0x07, 0x00, 0x60,
-  0x23, 0xa4, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00, 0x83, 0xc6, 0xc7, 0x00,
-  0x13, 0x35, 0x15, 0x00, 0x13, 0x05, 0x15, 0x00, 0x13, 0x87, 0x16, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x86, 0xe7, 0x00, 0xb3, 0x87, 0xd7, 0x00,
-  0xa3, 0x86, 0xa7, 0x00, 0x6f, 0xf0, 0xdf, 0xbc, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x0e, 0x13, 0x07, 0x80, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x13, 0x07, 0x70, 0x10, 0x23, 0xa4, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0x83, 0xc6, 0xc7, 0x00, 0x13, 0x87, 0x16, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x86, 0xe7, 0x00, 0xb3, 0x87, 0xd7, 0x00, 0xa3, 0x86, 0x07, 0x00,
-  0x6f, 0xf0, 0x5f, 0xb9, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xc5, 0x07, 0x25,
-  0x13, 0x05, 0xe5, 0xfe, 0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xc5, 0x07, 0x25, 0x13, 0x05, 0xc5, 0xfe,
-  0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x25, 0x03, 0xc5, 0x27, 0x00, 0x13, 0x55, 0x65, 0x00,
-  0x13, 0x75, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x25, 0x03, 0xc5, 0x37, 0x00, 0x13, 0x55, 0x75, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x25,
-  0x03, 0xc5, 0x27, 0x00, 0x13, 0x55, 0x75, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x25, 0x03, 0xc5, 0x37, 0x00,
-  0x13, 0x55, 0x65, 0x00, 0x13, 0x75, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x25, 0x03, 0xc5, 0x67, 0x00,
-  0x13, 0x55, 0x45, 0x00, 0x13, 0x75, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x25, 0xb7, 0x86, 0x00, 0x00,
-  0x83, 0xc7, 0x47, 0x00, 0x83, 0xc6, 0x06, 0x08, 0x13, 0x07, 0x05, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0x63, 0x9e, 0x06, 0x02, 0x13, 0x05, 0x40, 0x06,
-  0x63, 0x0c, 0x07, 0x02, 0x93, 0xf7, 0xf7, 0x07, 0x13, 0x87, 0xf7, 0xff,
-  0x13, 0x77, 0xf7, 0x0f, 0x93, 0x06, 0x30, 0x00, 0x13, 0x05, 0x00, 0x19,
-  0x63, 0xe0, 0xe6, 0x02, 0x13, 0x95, 0x57, 0x00, 0x33, 0x05, 0xf5, 0x40,
-  0x13, 0x15, 0x25, 0x00, 0x33, 0x05, 0xf5, 0x00, 0x13, 0x15, 0x55, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x05, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x14, 0x23, 0x80, 0x07, 0x10,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x23, 0x20, 0x91, 0x00,
-  0xb7, 0x84, 0x00, 0x00, 0x23, 0x22, 0x81, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x87, 0xc4, 0x14, 0x37, 0x84, 0x00, 0x00, 0x23, 0x80, 0x07, 0x10,
-  0x13, 0x07, 0x00, 0x05, 0x93, 0x07, 0x04, 0x0e, 0x23, 0x8f, 0xe7, 0x00,
-  0x23, 0x90, 0x07, 0x02, 0x13, 0x07, 0x00, 0x01, 0x23, 0x81, 0xe7, 0x02,
-  0x93, 0x84, 0xc4, 0x14, 0x13, 0x04, 0x04, 0x0e, 0xef, 0xf0, 0x1f, 0xae,
-  0x63, 0x04, 0x05, 0x06, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x03, 0x57, 0x04, 0x02, 0x93, 0x06, 0x17, 0x00, 0x93, 0x96, 0x06, 0x01,
-  0x93, 0xd6, 0x06, 0x01, 0x23, 0x10, 0xd4, 0x02, 0xb3, 0x06, 0xf4, 0x00,
-  0x83, 0xc6, 0xd6, 0x00, 0x33, 0x87, 0xe4, 0x00, 0x93, 0x87, 0x17, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x00, 0xd7, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0x03, 0x47, 0x24, 0x02, 0xe3, 0xe6, 0xe7, 0xfc, 0x03, 0x57, 0x04, 0x02,
-  0x93, 0x07, 0xf0, 0x0f, 0xe3, 0xf2, 0xe7, 0xfa, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x80, 0xf4, 0x10, 0x6f, 0xf0, 0x1f, 0xfa, 0x93, 0x07, 0x00, 0x00,
-  0x6f, 0xf0, 0xdf, 0xfd, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x00,
-  0x23, 0xa0, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00,
-  0x23, 0x83, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa7, 0x87, 0x02,
-  0x13, 0x07, 0x30, 0x00, 0x13, 0x05, 0x00, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xa7, 0x87, 0x02,
-  0x83, 0x27, 0x07, 0x00, 0x93, 0xe7, 0x47, 0x00, 0x23, 0x20, 0xf7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x83, 0xa6, 0x87, 0x02,
-  0x83, 0xa7, 0x46, 0x00, 0x93, 0xf7, 0x17, 0x00, 0x63, 0x8c, 0x07, 0x06,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0xa2, 0xf6, 0x00, 0x83, 0xa5, 0x46, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x37, 0x86, 0x00, 0x00, 0x93, 0xf5, 0x05, 0x01,
-  0x13, 0x07, 0xc7, 0x00, 0x13, 0x06, 0xc6, 0x08, 0x63, 0x8e, 0x05, 0x00,
-  0x93, 0x05, 0x00, 0x01, 0x23, 0xa2, 0xb6, 0x00, 0x23, 0x20, 0xf7, 0x00,
-  0x23, 0x03, 0xf7, 0x00, 0x23, 0x01, 0x06, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x83, 0xa5, 0x46, 0x00, 0x93, 0xf5, 0x85, 0x00, 0x63, 0x8e, 0x05, 0x00,
-  0x93, 0x05, 0x80, 0x00, 0x23, 0xa2, 0xb6, 0x00, 0x23, 0x20, 0xf7, 0x00,
-  0x23, 0x02, 0xf7, 0x00, 0xa3, 0x00, 0xf6, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x93, 0x05, 0x40, 0x00, 0x23, 0xa2, 0xb6, 0x00, 0x23, 0x20, 0x07, 0x00,
-  0xa3, 0x02, 0xf7, 0x00, 0x23, 0x00, 0xf6, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x03, 0xa5, 0xc7, 0x00, 0x13, 0x05, 0xf5, 0xff,
-  0x13, 0x35, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00, 0xef, 0xf0, 0x0f, 0xae,
-  0x93, 0x77, 0x15, 0x00, 0x63, 0x8e, 0x07, 0x06, 0x93, 0x77, 0x25, 0x00,
-  0x13, 0x04, 0x05, 0x00, 0x63, 0x8a, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xe0, 0xdf, 0xf4, 0x13, 0x05, 0x20, 0x00, 0xef, 0xf0, 0xcf, 0xac,
-  0x93, 0x77, 0x44, 0x00, 0x63, 0x88, 0x07, 0x00, 0xef, 0xf0, 0x8f, 0x9c,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xf0, 0x8f, 0xab, 0x93, 0x77, 0x04, 0x01,
-  0x63, 0x88, 0x07, 0x00, 0xef, 0xf0, 0x1f, 0xf1, 0x13, 0x05, 0x00, 0x01,
-  0xef, 0xf0, 0x4f, 0xaa, 0x93, 0x77, 0x04, 0x02, 0x63, 0x88, 0x07, 0x00,
-  0xef, 0xf0, 0xcf, 0xd2, 0x13, 0x05, 0x00, 0x02, 0xef, 0xf0, 0x0f, 0xa9,
-  0x13, 0x74, 0x04, 0x04, 0x63, 0x0e, 0x04, 0x00, 0xef, 0xf0, 0x8f, 0xb0,
-  0x03, 0x24, 0x41, 0x00, 0x83, 0x20, 0x81, 0x00, 0x13, 0x05, 0x00, 0x04,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xf0, 0x0f, 0xa7, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0xb7, 0x87, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0x40, 0x01, 0x23, 0x80, 0xe7, 0x00,
-  0x13, 0x07, 0x40, 0x00, 0xa3, 0x80, 0xe7, 0x00, 0x23, 0x81, 0x07, 0x00,
-  0xa3, 0x81, 0x07, 0x00, 0x13, 0x07, 0x30, 0x00, 0x23, 0x82, 0xe7, 0x00,
-  0xa3, 0x82, 0xe7, 0x00, 0x13, 0x05, 0x80, 0x00, 0x23, 0x83, 0x07, 0x00,
-  0xef, 0xe0, 0x1f, 0xde, 0x83, 0x20, 0x81, 0x00, 0x13, 0x05, 0x80, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0xdf, 0xde, 0xb7, 0x87, 0x00, 0x00,
-  0x03, 0xc5, 0x07, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x03, 0xc5, 0x17, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x80, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00, 0xa3, 0x80, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x03, 0xc5, 0x27, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x03, 0xc5, 0x37, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00, 0x03, 0xc5, 0x47, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x03, 0xc5, 0x57, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x23, 0x81, 0xa7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00, 0xa3, 0x81, 0xa7, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x23, 0x83, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0xc7, 0x08, 0x23, 0x82, 0xe7, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00, 0x13, 0x04, 0x05, 0x00,
-  0x13, 0x05, 0x00, 0x02, 0x23, 0x20, 0x91, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x84, 0x05, 0x00, 0xef, 0xe0, 0x1f, 0xd4, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x87, 0x07, 0x00, 0x03, 0x47, 0x67, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0xb3, 0x65, 0x97, 0x00, 0x63, 0x88, 0x05, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0xc7, 0x08, 0xa3, 0x01, 0x87, 0x00, 0x23, 0x83, 0x07, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x01, 0xff,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x26, 0x11, 0x00, 0x13, 0x07, 0x07, 0x00,
-  0x03, 0x46, 0x37, 0x00, 0x93, 0x07, 0x70, 0x78, 0x23, 0x10, 0xf1, 0x00,
-  0x93, 0x06, 0x40, 0x00, 0x93, 0x07, 0x30, 0x00, 0x63, 0x0c, 0xd6, 0x00,
-  0x83, 0x46, 0x37, 0x00, 0x13, 0x07, 0x20, 0x00, 0x93, 0x07, 0x20, 0x00,
-  0x63, 0x84, 0xe6, 0x00, 0x93, 0x07, 0x10, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x63, 0x1e, 0xe5, 0x02, 0x93, 0xe7, 0x47, 0x00, 0x23, 0x11, 0xf1, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x29, 0x13, 0x07, 0x00, 0x01,
-  0x23, 0x82, 0xe7, 0x00, 0x23, 0xa0, 0x07, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0xa3, 0x82, 0xe7, 0x00, 0x23, 0xa4, 0x27, 0x00, 0xef, 0xf0, 0xcf, 0x98,
-  0x83, 0x20, 0xc1, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x07, 0x20, 0x00, 0x63, 0x16, 0xe5, 0x00, 0x93, 0xe7, 0x07, 0x10,
-  0x6f, 0xf0, 0x1f, 0xfc, 0x13, 0x07, 0x30, 0x00, 0x63, 0x16, 0xe5, 0x02,
-  0x13, 0x07, 0xf0, 0x78, 0x93, 0xe7, 0x87, 0x08, 0x23, 0x10, 0xe1, 0x00,
-  0x23, 0x11, 0xf1, 0x00, 0x13, 0x05, 0x00, 0x00, 0xef, 0x10, 0x90, 0x4f,
-  0xe3, 0x00, 0x05, 0xfa, 0x83, 0x57, 0x21, 0x00, 0x93, 0xe7, 0x07, 0x20,
-  0x6f, 0xf0, 0x1f, 0xf9, 0x13, 0x07, 0x40, 0x00, 0x63, 0x1e, 0xe5, 0x00,
-  0x13, 0x07, 0x70, 0x79, 0x93, 0xe7, 0x07, 0x09, 0x23, 0x10, 0xe1, 0x00,
-  0x23, 0x11, 0xf1, 0x00, 0x13, 0x05, 0x10, 0x00, 0x6f, 0xf0, 0x1f, 0xfd,
-  0x13, 0x07, 0xf0, 0x79, 0x23, 0x10, 0xe1, 0x00, 0x93, 0xe7, 0x07, 0x08,
-  0x6f, 0xf0, 0x1f, 0xf6, 0x13, 0x01, 0x41, 0xff, 0x13, 0x05, 0x00, 0x02,
-  0x23, 0x22, 0x81, 0x00, 0x23, 0x20, 0x91, 0x00, 0x37, 0x84, 0x00, 0x00,
-  0x23, 0x24, 0x11, 0x00, 0xef, 0xe0, 0xdf, 0xbf, 0x93, 0x07, 0xc4, 0x08,
-  0xa3, 0x82, 0x07, 0x00, 0x93, 0x04, 0x00, 0x00, 0x13, 0x04, 0xc4, 0x08,
-  0x13, 0x05, 0x80, 0x00, 0xef, 0xe0, 0x1f, 0xdb, 0x93, 0x07, 0x10, 0x00,
-  0xa3, 0x03, 0x04, 0x00, 0xa3, 0x02, 0xf4, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x08, 0x83, 0xc7, 0x07, 0x00, 0x93, 0x05, 0x80, 0x3e,
-  0x63, 0x96, 0x07, 0x00, 0xb7, 0x85, 0x01, 0x00, 0x93, 0x85, 0x05, 0x6a,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0xdf, 0xe2, 0x83, 0x47, 0x74, 0x00,
-  0x63, 0x98, 0x07, 0x02, 0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x1f, 0xf1,
-  0xe3, 0x08, 0x05, 0xfe, 0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xf0, 0x9f, 0xe3, 0x93, 0x07, 0x80, 0x00, 0x63, 0x86, 0xf4, 0x06,
-  0x93, 0x84, 0x14, 0x00, 0x93, 0xf4, 0xf4, 0x0f, 0x6f, 0xf0, 0x9f, 0xf9,
-  0x13, 0x05, 0x00, 0x02, 0xef, 0xe0, 0x9f, 0xb6, 0x93, 0x05, 0x80, 0x3e,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x5f, 0xde, 0x93, 0x05, 0x30, 0x00,
-  0x13, 0x05, 0x80, 0x00, 0xef, 0xe0, 0xdf, 0xc5, 0x63, 0x12, 0x05, 0x02,
-  0xef, 0xe0, 0x5f, 0xec, 0xe3, 0x06, 0x05, 0xfe, 0x93, 0x05, 0x10, 0x00,
-  0x13, 0x05, 0x20, 0x00, 0xef, 0xf0, 0xdf, 0xde, 0x13, 0x05, 0x00, 0x02,
-  0xef, 0xe0, 0x1f, 0xb4, 0x6f, 0xf0, 0xdf, 0xfa, 0x13, 0x05, 0x00, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfe, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x00,
-  0x03, 0xc5, 0x67, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x03, 0xc6, 0x27, 0x00, 0x13, 0x07, 0x40, 0x01,
-  0x93, 0x76, 0xf6, 0x0f, 0x63, 0x04, 0xe6, 0x02, 0x13, 0x06, 0xe0, 0x01,
-  0x63, 0x8a, 0xc6, 0x00, 0x13, 0x07, 0xa0, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x63, 0x9e, 0xe6, 0x00, 0x13, 0x07, 0x60, 0x00, 0x23, 0x81, 0xe7, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x07, 0xa0, 0x00,
-  0x6f, 0xf0, 0x1f, 0xff, 0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x83, 0xc6, 0x37, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x25, 0x03, 0xc7, 0x97, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x13, 0x05, 0x10, 0x00, 0x13, 0x77, 0x17, 0x00, 0x63, 0x06, 0x07, 0x02,
-  0x03, 0xc7, 0x77, 0x00, 0x13, 0x06, 0x70, 0x00, 0x13, 0x77, 0x77, 0x00,
-  0x63, 0x1e, 0xc7, 0x00, 0x13, 0x06, 0x20, 0x00, 0x63, 0x9c, 0xc6, 0x00,
-  0x03, 0xc5, 0x77, 0x00, 0x13, 0x75, 0x05, 0x07, 0x13, 0x05, 0x05, 0xf9,
-  0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x06, 0x40, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xe3, 0x9a, 0xc6, 0xfe, 0x83, 0xc6, 0x77, 0x00,
-  0x13, 0x06, 0x00, 0x07, 0x13, 0x05, 0x10, 0x00, 0x93, 0xf6, 0x06, 0x07,
-  0xe3, 0x90, 0xc6, 0xfe, 0x83, 0xc6, 0x87, 0x00, 0x93, 0xf6, 0x76, 0x00,
-  0xe3, 0x9a, 0xe6, 0xfc, 0x03, 0xc5, 0x87, 0x00, 0x6f, 0xf0, 0x1f, 0xfc,
-  0x13, 0x01, 0x41, 0xff, 0xb7, 0x87, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x87, 0x07, 0x00, 0x03, 0xc7, 0x17, 0x00, 0x13, 0x05, 0x00, 0x02,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x81, 0xe7, 0x00, 0x03, 0xc7, 0x07, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x81, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x25, 0x13, 0x07, 0x00, 0xf8, 0x23, 0x81, 0xe7, 0x00,
-  0xef, 0xe0, 0xdf, 0x9e, 0x13, 0x05, 0x00, 0x00, 0xef, 0xf0, 0x5f, 0xcf,
-  0x83, 0x20, 0x81, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x6f, 0xf0, 0xdf, 0xc6,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00,
-  0x23, 0x24, 0x11, 0x00, 0x13, 0x04, 0xc4, 0x08, 0xa3, 0x04, 0x04, 0x00,
-  0x23, 0x05, 0x04, 0x00, 0xef, 0x10, 0x40, 0x41, 0x93, 0x07, 0x10, 0x00,
-  0x63, 0x10, 0x05, 0x02, 0xa3, 0x04, 0xf4, 0x00, 0xef, 0xf0, 0xdf, 0xc3,
-  0x03, 0x24, 0x41, 0x00, 0x83, 0x20, 0x81, 0x00, 0x13, 0x05, 0xf0, 0xff,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0xdf, 0xb8, 0x93, 0x05, 0x10, 0x00,
-  0x13, 0x05, 0x50, 0x00, 0x23, 0x05, 0xf4, 0x00, 0xef, 0xf0, 0x9f, 0xc3,
-  0x6f, 0xf0, 0xdf, 0xfd, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08,
-  0x23, 0x80, 0x07, 0x00, 0xa3, 0x80, 0x07, 0x00, 0x23, 0x81, 0x07, 0x00,
-  0xa3, 0x81, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00,
-  0x23, 0x83, 0x07, 0x00, 0xa3, 0x83, 0x07, 0x00, 0x23, 0x84, 0x07, 0x00,
-  0xa3, 0x84, 0x07, 0x00, 0x23, 0x85, 0x07, 0x00, 0xa3, 0x85, 0x07, 0x00,
-  0x23, 0x86, 0x07, 0x00, 0xa3, 0x86, 0x07, 0x00, 0x23, 0x87, 0x07, 0x00,
-  0xa3, 0x87, 0x07, 0x00, 0x23, 0x88, 0x07, 0x00, 0xa3, 0x88, 0x07, 0x00,
-  0x23, 0x89, 0x07, 0x00, 0xa3, 0x89, 0x07, 0x00, 0x23, 0x8a, 0x07, 0x00,
-  0xa3, 0x8a, 0x07, 0x00, 0x23, 0x8b, 0x07, 0x00, 0xa3, 0x8b, 0x07, 0x00,
-  0xa3, 0x86, 0x07, 0x02, 0xa3, 0x87, 0x07, 0x04, 0x23, 0x88, 0x07, 0x04,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x84, 0x07, 0x12, 0xb7, 0x87, 0x00, 0x00,
-  0x23, 0x82, 0x07, 0x10, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x22, 0x81, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x23, 0x20, 0x91, 0x00, 0x13, 0x04, 0x87, 0x12, 0x83, 0x47, 0x04, 0x00,
-  0x63, 0x80, 0x07, 0x4a, 0x13, 0x07, 0x87, 0x12, 0x23, 0x00, 0x07, 0x00,
-  0x03, 0x46, 0x27, 0x00, 0x93, 0x06, 0x20, 0x04, 0x93, 0x77, 0xf6, 0x0f,
-  0x63, 0x04, 0xd6, 0x2c, 0x63, 0xe6, 0xf6, 0x06, 0xb7, 0x84, 0x00, 0x00,
-  0x93, 0x06, 0x30, 0x01, 0x93, 0x84, 0x44, 0x10, 0x63, 0xea, 0xf6, 0x02,
-  0x93, 0x06, 0x20, 0x00, 0x63, 0xf2, 0xf6, 0x04, 0x93, 0x87, 0xd7, 0xff,
-  0x93, 0xf7, 0xf7, 0x0f, 0x93, 0x06, 0x00, 0x01, 0x63, 0xea, 0xf6, 0x02,
-  0xb7, 0x86, 0x00, 0x00, 0x93, 0x97, 0x27, 0x00, 0x93, 0x86, 0xc6, 0x03,
-  0xb3, 0x87, 0xd7, 0x00, 0x83, 0xa7, 0x07, 0x00, 0x67, 0x80, 0x07, 0x00,
-  0x13, 0x07, 0x20, 0x02, 0x63, 0x84, 0xe7, 0x30, 0x13, 0x07, 0x00, 0x03,
-  0x63, 0x8a, 0xe7, 0x28, 0x13, 0x07, 0x10, 0x02, 0x63, 0x88, 0xe7, 0x2a,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10, 0x23, 0x81, 0x07, 0x00,
-  0x6f, 0x00, 0xc0, 0x15, 0x93, 0x06, 0x10, 0x07, 0x63, 0x80, 0xd7, 0x46,
-  0x63, 0xea, 0xf6, 0x0a, 0x93, 0x06, 0x60, 0x06, 0x63, 0x8c, 0xd7, 0x30,
-  0x63, 0xe6, 0xf6, 0x04, 0xb7, 0x84, 0x00, 0x00, 0x93, 0x06, 0x00, 0x06,
-  0x93, 0x84, 0x44, 0x10, 0x63, 0x8e, 0xd7, 0x2c, 0x93, 0x06, 0x10, 0x06,
-  0xe3, 0x92, 0xd7, 0xfc, 0xef, 0xf0, 0x9f, 0xd1, 0x63, 0x06, 0x05, 0x14,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0x87, 0x12, 0x03, 0x47, 0x37, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x87, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x86, 0xe7, 0x00,
-  0x6f, 0x00, 0x40, 0x1e, 0x93, 0x06, 0x00, 0x07, 0xe3, 0x96, 0xd7, 0xf8,
-  0x83, 0x46, 0x37, 0x00, 0x83, 0x47, 0x47, 0x00, 0x93, 0x96, 0x86, 0x00,
-  0xb3, 0xe7, 0xd7, 0x00, 0x83, 0x46, 0x57, 0x00, 0x93, 0x97, 0x87, 0x00,
-  0xb3, 0xe7, 0xf6, 0x00, 0xb7, 0x86, 0x00, 0x00, 0x13, 0x86, 0xc6, 0x08,
-  0x23, 0x2c, 0xf6, 0x00, 0x83, 0x47, 0x67, 0x00, 0x93, 0x86, 0xc6, 0x08,
-  0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x06, 0xf6, 0x02, 0x13, 0x06, 0x00, 0x00,
-  0x93, 0x75, 0xf6, 0x0f, 0x63, 0xee, 0xf5, 0x38, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x8a, 0xe6, 0x00, 0x63, 0x82, 0x07, 0x36, 0x6f, 0x00, 0x80, 0x15,
-  0x13, 0x07, 0x00, 0x09, 0x63, 0x84, 0xe7, 0x34, 0x37, 0x87, 0x00, 0x00,
-  0x93, 0x06, 0x10, 0x09, 0x13, 0x07, 0x47, 0x10, 0x63, 0x8e, 0xd7, 0x34,
-  0x93, 0x06, 0x00, 0x08, 0xe3, 0x9c, 0xd7, 0xf0, 0x83, 0x46, 0x34, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x87, 0xd7, 0x02, 0xb7, 0x86, 0x00, 0x00, 0x93, 0x86, 0xc6, 0x14,
-  0x83, 0xc6, 0x06, 0x10, 0x63, 0x84, 0x06, 0x3a, 0x93, 0x06, 0x10, 0x00,
-  0x23, 0x01, 0xd7, 0x00, 0xa3, 0x86, 0xd7, 0x02, 0x6f, 0x00, 0xc0, 0x04,
-  0x93, 0x07, 0x10, 0x00, 0xb7, 0x85, 0x00, 0x00, 0x23, 0x81, 0xf4, 0x00,
-  0x93, 0x85, 0x05, 0x08, 0x93, 0x07, 0x00, 0x00, 0x13, 0x05, 0x80, 0x00,
-  0x93, 0x86, 0x07, 0x00, 0x93, 0x87, 0x17, 0x00, 0x33, 0x06, 0xf7, 0x00,
-  0x03, 0x46, 0x26, 0x00, 0xb3, 0x86, 0xd5, 0x00, 0x13, 0x76, 0xf6, 0x0f,
-  0x23, 0x81, 0xc6, 0x00, 0xe3, 0x92, 0xa7, 0xfe, 0xef, 0x10, 0x00, 0x7e,
-  0x63, 0x16, 0x05, 0x00, 0x13, 0x05, 0x10, 0x00, 0xef, 0xe0, 0x5f, 0x9c,
-  0x93, 0x07, 0x10, 0x00, 0x6f, 0x00, 0x40, 0x0b, 0x83, 0x46, 0x37, 0x00,
-  0x03, 0x45, 0x47, 0x00, 0x93, 0x07, 0x10, 0x00, 0x23, 0x81, 0xf4, 0x00,
-  0x13, 0xf6, 0xf6, 0x0f, 0x13, 0x75, 0xf5, 0x0f, 0x63, 0x88, 0x06, 0x00,
-  0x63, 0x0a, 0xf6, 0x00, 0x23, 0x81, 0x04, 0x00, 0x6f, 0xf0, 0x5f, 0xfd,
-  0xef, 0xf0, 0x1f, 0x8e, 0x6f, 0xf0, 0xdf, 0xfc, 0xef, 0xf0, 0x5f, 0x8e,
-  0x6f, 0xf0, 0x5f, 0xfc, 0x93, 0x07, 0x50, 0x00, 0x23, 0x81, 0xf4, 0x00,
-  0xef, 0xe0, 0x0f, 0xe6, 0x93, 0x57, 0x85, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0xa3, 0x81, 0xf4, 0x00, 0x13, 0x75, 0xf5, 0x0f, 0x93, 0x07, 0x20, 0x00,
-  0x23, 0x82, 0xa4, 0x00, 0xa3, 0x82, 0xf4, 0x00, 0x23, 0x83, 0x04, 0x00,
-  0xa3, 0x83, 0x04, 0x00, 0xef, 0xe0, 0xcf, 0xec, 0x13, 0x75, 0xf5, 0x0f,
-  0x23, 0x84, 0xa4, 0x00, 0xef, 0xf0, 0x4f, 0xf7, 0xa3, 0x84, 0xa4, 0x00,
-  0xef, 0xf0, 0xdf, 0xb6, 0x23, 0x85, 0xa4, 0x00, 0xef, 0xf0, 0x1f, 0x8b,
-  0xa3, 0x85, 0xa4, 0x00, 0xef, 0xf0, 0x9f, 0x89, 0x23, 0x86, 0xa4, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0x10, 0x80, 0x6e, 0xa3, 0x86, 0xa4, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0x10, 0xc0, 0x6d, 0x23, 0x87, 0xa4, 0x00,
-  0x93, 0x07, 0xd0, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x47, 0x10,
-  0xa3, 0x00, 0xf7, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0x5f, 0xa5,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00, 0x93, 0x87, 0x07, 0x08,
-  0xa3, 0x80, 0xe7, 0x00, 0x23, 0x81, 0xe4, 0x00, 0x6f, 0xf0, 0x5f, 0xf1,
-  0xef, 0xf0, 0xcf, 0xe5, 0x93, 0x07, 0x10, 0x00, 0x23, 0x81, 0xf4, 0x00,
-  0x6f, 0xf0, 0x5f, 0xf0, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08,
-  0x13, 0x07, 0x10, 0x00, 0xa3, 0x83, 0xe7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x47, 0x10, 0x23, 0x81, 0xe7, 0x00, 0x6f, 0xf0, 0x5f, 0xee,
-  0xef, 0xf0, 0x0f, 0xed, 0xe3, 0x02, 0x05, 0xf0, 0x03, 0x45, 0x34, 0x00,
-  0xef, 0xf0, 0x4f, 0xfe, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x87, 0xc7, 0x08, 0x23, 0x84, 0xe7, 0x00, 0x6f, 0xf0, 0x9f, 0xfa,
-  0x03, 0x47, 0x34, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x25,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x80, 0xe7, 0x00, 0x03, 0x47, 0x44, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x80, 0xe7, 0x00, 0x03, 0x47, 0x54, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x81, 0xe7, 0x00, 0xef, 0xf0, 0x0f, 0xe8,
-  0xe3, 0x0a, 0x05, 0xea, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x93, 0x87, 0xc7, 0x08, 0xa3, 0x85, 0xe7, 0x00, 0x6f, 0xf0, 0x1f, 0xf6,
-  0x03, 0x47, 0x34, 0x00, 0x93, 0x07, 0x10, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x63, 0x04, 0xf7, 0x00, 0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x9f, 0xfc,
-  0x6f, 0xf0, 0x1f, 0xf5, 0xef, 0xf0, 0x9f, 0xa4, 0xe3, 0x0e, 0x05, 0xe6,
-  0x03, 0x47, 0x34, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x87, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x86, 0xe7, 0x00, 0x6f, 0xf0, 0xdf, 0xf1, 0x03, 0x46, 0x34, 0x00,
-  0x83, 0x47, 0x44, 0x00, 0x83, 0x46, 0x54, 0x00, 0x13, 0x17, 0x16, 0x00,
-  0x93, 0x97, 0x87, 0x00, 0xb3, 0xe6, 0xf6, 0x00, 0x33, 0x07, 0xc7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x17, 0x37, 0x00, 0x93, 0x87, 0xc7, 0x26,
-  0xb3, 0x87, 0xe7, 0x00, 0x23, 0x92, 0xd7, 0x00, 0x83, 0x46, 0x64, 0x00,
-  0x03, 0x47, 0x74, 0x00, 0x93, 0x96, 0x86, 0x00, 0x33, 0x67, 0xd7, 0x00,
-  0x23, 0x93, 0xe7, 0x00, 0x83, 0x46, 0x84, 0x00, 0x03, 0x47, 0x94, 0x00,
-  0x93, 0x96, 0x86, 0x00, 0x33, 0x67, 0xd7, 0x00, 0x23, 0x94, 0xe7, 0x00,
-  0x83, 0x46, 0xa4, 0x00, 0x03, 0x47, 0xb4, 0x00, 0x93, 0x96, 0x86, 0x00,
-  0x33, 0x67, 0xd7, 0x00, 0x23, 0x95, 0xe7, 0x00, 0x83, 0x46, 0xc4, 0x00,
-  0x03, 0x47, 0xd4, 0x00, 0x93, 0x96, 0x86, 0x00, 0x33, 0x67, 0xd7, 0x00,
-  0x23, 0x96, 0xe7, 0x00, 0x83, 0x46, 0xe4, 0x00, 0x03, 0x47, 0xf4, 0x00,
-  0x93, 0x96, 0x86, 0x00, 0x33, 0x67, 0xd7, 0x00, 0x23, 0x97, 0xe7, 0x00,
-  0x83, 0x46, 0x04, 0x01, 0x03, 0x47, 0x14, 0x01, 0x93, 0x96, 0x86, 0x00,
-  0x33, 0x67, 0xd7, 0x00, 0x23, 0x98, 0xe7, 0x00, 0x83, 0x46, 0x24, 0x01,
-  0x03, 0x47, 0x34, 0x01, 0x93, 0x96, 0x86, 0x00, 0x33, 0x67, 0xd7, 0x00,
-  0x23, 0x99, 0xe7, 0x00, 0x83, 0x46, 0x44, 0x01, 0x03, 0x47, 0x54, 0x01,
-  0x13, 0x17, 0x87, 0x00, 0x33, 0x67, 0xd7, 0x00, 0x23, 0x9a, 0xe7, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x10, 0x00,
-  0x6f, 0xf0, 0xdf, 0xe6, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08,
-  0x13, 0x07, 0x10, 0x00, 0xa3, 0x88, 0xe7, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x03, 0x24, 0x41, 0x00, 0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x06, 0x10, 0x00,
-  0x93, 0x87, 0xc7, 0x08, 0x23, 0x89, 0xd7, 0x00, 0x23, 0x01, 0xd7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xd1, 0x93, 0x05, 0x56, 0x00, 0xb3, 0x05, 0xb7, 0x00,
-  0x83, 0xc5, 0x25, 0x00, 0x33, 0x85, 0xc6, 0x00, 0x13, 0x06, 0x16, 0x00,
-  0x93, 0xf5, 0xf5, 0x0f, 0x23, 0x0e, 0xb5, 0x00, 0x6f, 0xf0, 0x5f, 0xc4,
-  0x03, 0x47, 0x34, 0x00, 0x83, 0x47, 0x44, 0x00, 0x93, 0x06, 0x10, 0x00,
-  0x13, 0x17, 0x87, 0x00, 0xb3, 0xe7, 0xe7, 0x00, 0x03, 0x47, 0x54, 0x00,
-  0x93, 0x97, 0x87, 0x00, 0xb3, 0x67, 0xf7, 0x00, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0xc7, 0x08, 0x23, 0x2c, 0xf7, 0x00, 0x83, 0x47, 0x64, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x06, 0xf7, 0x02, 0xa3, 0x0a, 0xd7, 0x00,
-  0x6f, 0xf0, 0x5f, 0xc1, 0x23, 0x01, 0x07, 0x00, 0x6f, 0xf0, 0x1f, 0xcb,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08, 0x03, 0xc7, 0xf7, 0x04,
-  0x33, 0x87, 0xe7, 0x00, 0xa3, 0x07, 0xa7, 0x02, 0x83, 0xc6, 0xf7, 0x04,
-  0x13, 0x07, 0xf0, 0x01, 0x63, 0x76, 0xd7, 0x00, 0xa3, 0x87, 0x07, 0x04,
-  0x67, 0x80, 0x00, 0x00, 0x03, 0xc7, 0xf7, 0x04, 0x13, 0x07, 0x17, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x87, 0xe7, 0x04, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08, 0x03, 0xc7, 0x07, 0x05,
-  0x33, 0x87, 0xe7, 0x00, 0x03, 0x45, 0xf7, 0x02, 0x83, 0xc6, 0x07, 0x05,
-  0x13, 0x07, 0xf0, 0x01, 0x13, 0x75, 0xf5, 0x0f, 0x63, 0x76, 0xd7, 0x00,
-  0x23, 0x88, 0x07, 0x04, 0x67, 0x80, 0x00, 0x00, 0x03, 0xc7, 0x07, 0x05,
-  0x13, 0x07, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x88, 0xe7, 0x04,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x08,
-  0x03, 0xc5, 0x07, 0x05, 0x83, 0xc7, 0xf7, 0x04, 0x33, 0x05, 0xf5, 0x40,
-  0x33, 0x35, 0xa0, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00, 0xef, 0xf0, 0x9f, 0xfd,
-  0x63, 0x02, 0x05, 0x02, 0x37, 0x84, 0x00, 0x00, 0x13, 0x04, 0x44, 0x10,
-  0x93, 0x07, 0x20, 0x00, 0x23, 0x01, 0xf4, 0x00, 0xef, 0xf0, 0x1f, 0xf8,
-  0xa3, 0x01, 0xa4, 0x00, 0x13, 0x07, 0x20, 0x00, 0x6f, 0x00, 0x00, 0x11,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0xc7, 0x08, 0x83, 0x46, 0x07, 0x00,
-  0x93, 0x87, 0xc7, 0x08, 0x63, 0x80, 0x06, 0x02, 0xb7, 0x87, 0x00, 0x00,
-  0x23, 0x00, 0x07, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x00, 0x01,
-  0x23, 0x81, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00, 0x6f, 0x00, 0x00, 0x0e,
-  0x83, 0x46, 0x17, 0x00, 0x63, 0x8c, 0x06, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0xa3, 0x00, 0x07, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x10, 0x01,
-  0x6f, 0xf0, 0xdf, 0xfd, 0x83, 0x46, 0x27, 0x00, 0x63, 0x8c, 0x06, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x23, 0x01, 0x07, 0x00, 0x93, 0x87, 0x47, 0x10,
-  0x13, 0x07, 0x20, 0x01, 0x6f, 0xf0, 0x1f, 0xfc, 0x83, 0x46, 0x97, 0x00,
-  0x63, 0x8c, 0x06, 0x00, 0xb7, 0x87, 0x00, 0x00, 0xa3, 0x04, 0x07, 0x00,
-  0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x10, 0x03, 0x6f, 0xf0, 0x5f, 0xfa,
-  0x83, 0x46, 0xa7, 0x00, 0x63, 0x8c, 0x06, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x23, 0x05, 0x07, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x20, 0x03,
-  0x6f, 0xf0, 0x9f, 0xf8, 0x83, 0x46, 0x57, 0x00, 0x63, 0x82, 0x06, 0x02,
-  0xa3, 0x02, 0x07, 0x00, 0x37, 0x84, 0x00, 0x00, 0xa3, 0x03, 0x07, 0x00,
-  0x13, 0x04, 0x44, 0x10, 0x93, 0x07, 0x00, 0x04, 0x23, 0x01, 0xf4, 0x00,
-  0xef, 0xf0, 0xcf, 0xc4, 0x6f, 0xf0, 0x1f, 0xf3, 0x83, 0x46, 0x67, 0x00,
-  0x63, 0x8e, 0x06, 0x04, 0x23, 0x03, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0xa3, 0x03, 0x07, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x10, 0x04,
-  0x23, 0x81, 0xe7, 0x00, 0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0xc7, 0x25,
-  0x83, 0x46, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x81, 0xd7, 0x00,
-  0x03, 0x47, 0x27, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x82, 0xe7, 0x00,
-  0x13, 0x07, 0x30, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10,
-  0xa3, 0x80, 0xe7, 0x00, 0x03, 0x24, 0x41, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xe0, 0x4f, 0xde, 0x83, 0x46, 0x37, 0x00,
-  0x63, 0x84, 0x06, 0x02, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10,
-  0x93, 0x06, 0x50, 0x04, 0x23, 0x81, 0xd7, 0x00, 0x83, 0x46, 0x37, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x81, 0xd7, 0x00, 0xa3, 0x01, 0x07, 0x00,
-  0x6f, 0xf0, 0x9f, 0xea, 0x03, 0xc7, 0x47, 0x00, 0x63, 0x06, 0x07, 0x02,
-  0x37, 0x84, 0x00, 0x00, 0x23, 0x82, 0x07, 0x00, 0x13, 0x04, 0x44, 0x10,
-  0x93, 0x07, 0x40, 0x04, 0x23, 0x01, 0xf4, 0x00, 0xef, 0xf0, 0xcf, 0xba,
-  0xa3, 0x01, 0xa4, 0x00, 0xef, 0xf0, 0x4f, 0xb9, 0x23, 0x02, 0xa4, 0x00,
-  0x6f, 0xf0, 0x9f, 0xf8, 0x03, 0xc7, 0xf7, 0x00, 0x63, 0x04, 0x07, 0x02,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0x47, 0x10, 0x93, 0x06, 0x20, 0x06,
-  0x23, 0x01, 0xd7, 0x00, 0x83, 0xc6, 0xe7, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0xa3, 0x01, 0xd7, 0x00, 0xa3, 0x87, 0x07, 0x00, 0x6f, 0xf0, 0xdf, 0xe4,
-  0x03, 0xc7, 0x07, 0x01, 0x63, 0x0a, 0x07, 0x02, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x07, 0x47, 0x10, 0x93, 0x06, 0x30, 0x06, 0x23, 0x01, 0xd7, 0x00,
-  0x83, 0xc6, 0xe7, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0xa3, 0x01, 0xd7, 0x00,
-  0x83, 0xc6, 0x07, 0x01, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x02, 0xd7, 0x00,
-  0x23, 0x88, 0x07, 0x00, 0x6f, 0xf0, 0x5f, 0xf2, 0x03, 0xc7, 0x37, 0x01,
-  0x93, 0x76, 0xf7, 0x0f, 0x63, 0x02, 0x07, 0x02, 0xa3, 0x89, 0x07, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x81, 0xe7, 0x00, 0x13, 0x07, 0x30, 0x00, 0xa3, 0x81, 0xe7, 0x00,
-  0x6f, 0xf0, 0x9f, 0xde, 0x03, 0xc7, 0x67, 0x01, 0x63, 0x0a, 0x07, 0x06,
-  0x37, 0x86, 0x00, 0x00, 0x13, 0x07, 0x46, 0x10, 0x23, 0x8b, 0x07, 0x00,
-  0x93, 0x05, 0x10, 0x00, 0x23, 0x01, 0xb7, 0x00, 0x03, 0xc7, 0xc7, 0x02,
-  0x13, 0x06, 0x46, 0x10, 0xe3, 0x08, 0x07, 0xde, 0x03, 0xc7, 0xc7, 0x02,
-  0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x01, 0xe6, 0x00, 0x83, 0xc5, 0xc7, 0x02,
-  0x13, 0x87, 0x26, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x63, 0xec, 0xb6, 0x00,
-  0xe3, 0x1a, 0x07, 0xea, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0xb3, 0x85, 0xd7, 0x00,
-  0x83, 0xc5, 0xc5, 0x01, 0x33, 0x07, 0xe6, 0x00, 0x93, 0x86, 0x16, 0x00,
-  0x93, 0xf5, 0xf5, 0x0f, 0x23, 0x01, 0xb7, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x6f, 0xf0, 0x1f, 0xfc, 0x03, 0xc7, 0x77, 0x01, 0x63, 0x0c, 0x07, 0x00,
-  0xa3, 0x8b, 0x07, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x47, 0x10,
-  0x23, 0x81, 0x07, 0x00, 0x6f, 0xf0, 0x5f, 0xd8, 0x03, 0xc7, 0xd7, 0x02,
-  0xe3, 0x08, 0x07, 0xfa, 0x03, 0xc7, 0xe7, 0x02, 0x37, 0x86, 0x00, 0x00,
-  0xa3, 0x86, 0x07, 0x02, 0x93, 0x06, 0x10, 0xf8, 0x93, 0x07, 0x46, 0x10,
-  0x13, 0x17, 0x47, 0x00, 0x23, 0x81, 0xd7, 0x00, 0xb7, 0x85, 0x00, 0x00,
-  0x93, 0x07, 0xf7, 0xff, 0x93, 0x06, 0x10, 0x00, 0x13, 0x06, 0x46, 0x10,
-  0x93, 0xf7, 0xf7, 0x0f, 0x93, 0x85, 0xc5, 0x14, 0x13, 0x05, 0x10, 0x01,
-  0x33, 0x87, 0xd7, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x33, 0x87, 0xe5, 0x00,
-  0x03, 0x47, 0x07, 0x00, 0x33, 0x03, 0xd6, 0x00, 0x93, 0x86, 0x16, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x01, 0xe3, 0x00, 0xe3, 0x90, 0xa6, 0xfe,
-  0x13, 0x07, 0x10, 0x01, 0x6f, 0xf0, 0xdf, 0xdf, 0xb7, 0x87, 0x00, 0x00,
-  0x37, 0xa7, 0x07, 0x00, 0x93, 0x87, 0xc7, 0x25, 0x13, 0x07, 0x07, 0x12,
-  0x23, 0xa4, 0xe7, 0x00, 0x23, 0x80, 0x07, 0x00, 0x13, 0x07, 0x30, 0x00,
-  0xa3, 0x80, 0xe7, 0x00, 0x23, 0x81, 0xe7, 0x00, 0xa3, 0x81, 0x07, 0x00,
-  0x23, 0x82, 0x07, 0x00, 0xa3, 0x82, 0x07, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0x07, 0x0e,
-  0x13, 0x07, 0x80, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0x13, 0x07, 0x20, 0x10,
-  0x23, 0xa4, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00, 0x83, 0xc6, 0xc7, 0x00,
-  0x13, 0x87, 0x16, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x86, 0xe7, 0x00,
-  0xb3, 0x87, 0xd7, 0x00, 0xa3, 0x86, 0x07, 0x00, 0x6f, 0xe0, 0x1f, 0x95,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x87, 0xc7, 0x25, 0x03, 0x45, 0x17, 0x00,
-  0x83, 0x46, 0x27, 0x00, 0x03, 0x47, 0x37, 0x00, 0x93, 0x87, 0xc7, 0x25,
-  0x93, 0x96, 0x36, 0x00, 0x33, 0x65, 0xd5, 0x00, 0x13, 0x75, 0xf5, 0x0f,
-  0x63, 0x04, 0x07, 0x00, 0x13, 0x65, 0x45, 0x00, 0x83, 0xc7, 0x47, 0x00,
-  0x63, 0x84, 0x07, 0x00, 0x13, 0x65, 0x05, 0x02, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0xc1, 0xee, 0x23, 0x26, 0x81, 0x10, 0x13, 0x04, 0x05, 0x00,
-  0x13, 0x05, 0x20, 0x00, 0x23, 0x28, 0x11, 0x10, 0x23, 0x24, 0x91, 0x10,
-  0x23, 0x22, 0xb1, 0x00, 0xef, 0xd0, 0x1f, 0xf5, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x14, 0x01, 0x00, 0x63, 0x1c, 0xf4, 0x10, 0xb7, 0x07, 0x4a, 0x00,
-  0x13, 0x07, 0xa0, 0x04, 0x93, 0x87, 0xa7, 0x04, 0x23, 0x15, 0xe1, 0x00,
-  0x23, 0x26, 0xf1, 0x00, 0x23, 0x18, 0xe1, 0x00, 0x93, 0x06, 0x50, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x29, 0x13, 0x07, 0x10, 0x01,
-  0x23, 0x82, 0xe7, 0x00, 0x23, 0xa0, 0x07, 0x00, 0xa3, 0x82, 0xd7, 0x00,
-  0x13, 0x07, 0x81, 0x00, 0x23, 0xa4, 0xe7, 0x00, 0xef, 0xe0, 0x8f, 0xbb,
-  0x83, 0x27, 0x41, 0x00, 0x63, 0x8c, 0x07, 0x0a, 0xb7, 0x84, 0x00, 0x00,
-  0x93, 0x87, 0x04, 0x0e, 0x13, 0x07, 0x80, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x13, 0x07, 0x20, 0x10, 0x23, 0xa4, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0x93, 0x07, 0x40, 0x00, 0x93, 0x84, 0x04, 0x0e, 0x93, 0x06, 0x70, 0x00,
-  0x63, 0x04, 0xf4, 0x00, 0x93, 0x66, 0x04, 0x02, 0x83, 0xc7, 0xc4, 0x00,
-  0x13, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x86, 0xe4, 0x00,
-  0xb3, 0x87, 0xf4, 0x00, 0xa3, 0x86, 0xd7, 0x00, 0xef, 0xf0, 0x9f, 0xf0,
-  0x83, 0xc7, 0xc4, 0x00, 0x13, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x86, 0xe4, 0x00, 0xb3, 0x87, 0xf4, 0x00, 0xa3, 0x86, 0xa7, 0x00,
-  0x83, 0xc7, 0xc4, 0x00, 0x13, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x86, 0xe4, 0x00, 0xb3, 0x87, 0xf4, 0x00, 0xa3, 0x86, 0xa7, 0x00,
-  0x83, 0xc7, 0xc4, 0x00, 0x13, 0x87, 0x17, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x86, 0xe4, 0x00, 0xb3, 0x87, 0xf4, 0x00, 0xa3, 0x86, 0xa7, 0x00,
-  0x03, 0xc7, 0xc4, 0x00, 0x93, 0x07, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f,
-  0x23, 0x86, 0xf4, 0x00, 0xb3, 0x84, 0xe4, 0x00, 0xa3, 0x86, 0xa4, 0x00,
-  0xef, 0xe0, 0x0f, 0xff, 0x23, 0x20, 0xa1, 0x00, 0x83, 0x20, 0x01, 0x11,
-  0x03, 0x24, 0xc1, 0x10, 0x03, 0x25, 0x01, 0x00, 0x83, 0x24, 0x81, 0x10,
-  0x13, 0x01, 0x41, 0x11, 0x67, 0x80, 0x00, 0x00, 0x33, 0x35, 0xa0, 0x00,
-  0x93, 0x04, 0x20, 0x00, 0x13, 0x05, 0x15, 0x00, 0x63, 0x10, 0x94, 0x06,
-  0xb7, 0x07, 0x4a, 0x00, 0x37, 0x07, 0xbc, 0x07, 0x93, 0x85, 0xb7, 0x0c,
-  0x13, 0x03, 0xc0, 0x5b, 0x93, 0x87, 0xa7, 0x04, 0x13, 0x07, 0xb7, 0x0c,
-  0x13, 0x06, 0xa0, 0x04, 0x23, 0x15, 0x61, 0x00, 0x23, 0x26, 0xe1, 0x00,
-  0x23, 0x28, 0xb1, 0x00, 0x23, 0x2a, 0xf1, 0x00, 0x23, 0x2c, 0xf1, 0x00,
-  0x23, 0x1e, 0xc1, 0x00, 0x93, 0x06, 0xb0, 0x00, 0xe3, 0x10, 0x85, 0xec,
-  0x23, 0x1f, 0x61, 0x00, 0x23, 0x20, 0xe1, 0x02, 0x23, 0x22, 0xb1, 0x02,
-  0x23, 0x24, 0xf1, 0x02, 0x23, 0x26, 0xf1, 0x02, 0x23, 0x18, 0xc1, 0x02,
-  0x93, 0x06, 0x50, 0x01, 0x6f, 0xf0, 0x1f, 0xea, 0x93, 0x07, 0x30, 0x00,
-  0xe3, 0x1e, 0xf4, 0xea, 0x37, 0x06, 0xbc, 0x05, 0x37, 0x07, 0x4a, 0x04,
-  0xb7, 0x07, 0x7e, 0x04, 0x93, 0x03, 0xc6, 0x7b, 0x93, 0x02, 0xc7, 0x7b,
-  0x13, 0x83, 0xc7, 0x7b, 0x13, 0x07, 0xa7, 0x44, 0x93, 0x87, 0xe7, 0x67,
-  0x93, 0x00, 0xc0, 0x5b, 0x13, 0x06, 0xa6, 0x44, 0x93, 0x05, 0xe0, 0x67,
-  0x23, 0x15, 0x11, 0x00, 0x23, 0x26, 0x71, 0x00, 0x23, 0x28, 0x51, 0x00,
-  0x23, 0x2a, 0xe1, 0x00, 0x23, 0x2c, 0xe1, 0x00, 0x23, 0x2e, 0xe1, 0x00,
-  0x23, 0x20, 0xc1, 0x02, 0x23, 0x22, 0x61, 0x02, 0x23, 0x24, 0xf1, 0x02,
-  0x23, 0x26, 0xf1, 0x02, 0x23, 0x28, 0xf1, 0x02, 0x23, 0x2a, 0xf1, 0x02,
-  0x23, 0x2c, 0xf1, 0x02, 0x23, 0x2e, 0xf1, 0x02, 0x23, 0x20, 0xf1, 0x04,
-  0x23, 0x22, 0xf1, 0x04, 0x23, 0x24, 0xf1, 0x04, 0x23, 0x16, 0xb1, 0x04,
-  0x93, 0x06, 0x30, 0x02, 0xe3, 0x1e, 0x95, 0xe0, 0x23, 0x17, 0x11, 0x04,
-  0x23, 0x28, 0x71, 0x04, 0x23, 0x2a, 0x51, 0x04, 0x23, 0x2c, 0xe1, 0x04,
-  0x23, 0x2e, 0xe1, 0x04, 0x23, 0x20, 0xe1, 0x06, 0x23, 0x22, 0xc1, 0x06,
-  0x23, 0x24, 0x61, 0x06, 0x23, 0x26, 0xf1, 0x06, 0x23, 0x28, 0xf1, 0x06,
-  0x23, 0x2a, 0xf1, 0x06, 0x23, 0x2c, 0xf1, 0x06, 0x23, 0x2e, 0xf1, 0x06,
-  0x23, 0x20, 0xf1, 0x08, 0x23, 0x22, 0xf1, 0x08, 0x23, 0x24, 0xf1, 0x08,
-  0x23, 0x26, 0xf1, 0x08, 0x23, 0x18, 0xb1, 0x08, 0x93, 0x06, 0x50, 0x04,
-  0x6f, 0xf0, 0xdf, 0xdc, 0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00,
-  0x23, 0x22, 0x81, 0x00, 0x23, 0x20, 0x91, 0x00, 0x37, 0x84, 0x00, 0x00,
-  0xef, 0xe0, 0x9f, 0xec, 0x13, 0x04, 0x04, 0x0e, 0x93, 0x07, 0x80, 0x00,
-  0x23, 0x20, 0xf4, 0x00, 0x93, 0x07, 0x30, 0x10, 0x23, 0x24, 0xf4, 0x00,
-  0x93, 0x04, 0x05, 0x00, 0x23, 0x06, 0x04, 0x00, 0xef, 0xf0, 0x1f, 0xd1,
-  0x03, 0x47, 0xc4, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x33, 0x07, 0xe4, 0x00, 0x23, 0x06, 0xd4, 0x00, 0xa3, 0x06, 0xa7, 0x00,
-  0x13, 0x07, 0x20, 0x00, 0x63, 0x98, 0xe4, 0x02, 0x03, 0x47, 0xc4, 0x00,
-  0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x06, 0xd4, 0x00,
-  0x33, 0x07, 0xe4, 0x00, 0xa3, 0x06, 0xa7, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x83, 0x20, 0x81, 0x00, 0x83, 0x24, 0x01, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x6f, 0xe0, 0x0f, 0xe1, 0x13, 0x07, 0x40, 0x00, 0xe3, 0x94, 0xe4, 0xfe,
-  0x03, 0x47, 0xc4, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x06, 0xd4, 0x00, 0x33, 0x07, 0xe4, 0x00, 0xa3, 0x06, 0xa7, 0x00,
-  0x03, 0x47, 0xc4, 0x00, 0x93, 0x06, 0x17, 0x00, 0x93, 0xf6, 0xf6, 0x0f,
-  0x23, 0x06, 0xd4, 0x00, 0x33, 0x07, 0xe4, 0x00, 0xa3, 0x06, 0xa7, 0x00,
-  0x83, 0x46, 0xc4, 0x00, 0x13, 0x87, 0x16, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x06, 0xe4, 0x00, 0x33, 0x04, 0xd4, 0x00, 0xa3, 0x06, 0xa4, 0x00,
-  0x6f, 0xf0, 0xdf, 0xf9, 0x13, 0x01, 0x01, 0xff, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0x23, 0x26, 0x11, 0x00, 0x93, 0x04, 0x05, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0xef, 0xe0, 0xdf, 0xde, 0x93, 0x07, 0x04, 0x0e,
-  0x13, 0x07, 0x90, 0x00, 0x23, 0xa0, 0xe7, 0x00, 0x13, 0x07, 0x20, 0x20,
-  0x23, 0xa4, 0xe7, 0x00, 0x13, 0x06, 0x20, 0x00, 0x23, 0x20, 0xa1, 0x00,
-  0x23, 0x86, 0xc7, 0x00, 0xef, 0xe0, 0xcf, 0xd7, 0x63, 0x12, 0x05, 0x12,
-  0x13, 0x04, 0x04, 0x0e, 0x83, 0x47, 0xd4, 0x00, 0x33, 0x33, 0x90, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0xf7, 0x17, 0x00, 0x83, 0x26, 0x01, 0x00,
-  0x13, 0x03, 0x13, 0x00, 0x13, 0x07, 0xc7, 0x25, 0x13, 0x06, 0x20, 0x00,
-  0x63, 0x80, 0x07, 0x04, 0x63, 0x84, 0xc6, 0x04, 0x13, 0x06, 0x40, 0x00,
-  0x63, 0x9e, 0xc6, 0x04, 0x13, 0x06, 0x00, 0x00, 0x83, 0x42, 0xd4, 0x00,
-  0x93, 0x95, 0x47, 0x00, 0xb3, 0xf2, 0xb2, 0x00, 0x63, 0x9e, 0x55, 0x00,
-  0x83, 0x42, 0xe4, 0x00, 0xb3, 0xf2, 0xf2, 0x00, 0x63, 0x98, 0xf2, 0x00,
-  0x83, 0x47, 0xe4, 0x00, 0xb3, 0xf7, 0xb7, 0x00, 0x6f, 0x00, 0x40, 0x02,
-  0x63, 0x1a, 0x06, 0x0c, 0x23, 0x06, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x6f, 0x00, 0x80, 0x02, 0x13, 0x06, 0x00, 0x00, 0x83, 0x45, 0xd4, 0x00,
-  0x93, 0x97, 0x47, 0x00, 0xb3, 0xf5, 0xf5, 0x00, 0xe3, 0x90, 0xb7, 0xfe,
-  0x63, 0x14, 0x06, 0x04, 0xe3, 0x1e, 0x05, 0xfc, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x06, 0xf7, 0x00, 0x93, 0x07, 0x10, 0x00, 0x63, 0x00, 0xf3, 0x04,
-  0x83, 0x47, 0xd4, 0x00, 0x13, 0x06, 0x60, 0x00, 0x93, 0xf7, 0x67, 0x00,
-  0x63, 0x96, 0xc7, 0x08, 0x13, 0x06, 0x20, 0x00, 0x63, 0x8a, 0xc6, 0x00,
-  0x13, 0x06, 0x40, 0x00, 0x63, 0x9a, 0xc6, 0x00, 0x13, 0x06, 0x10, 0x00,
-  0x6f, 0xf0, 0x9f, 0xf7, 0x13, 0x06, 0x10, 0x00, 0x6f, 0xf0, 0xdf, 0xfa,
-  0x63, 0x14, 0x05, 0x06, 0x93, 0x07, 0x10, 0x00, 0xa3, 0x06, 0xf7, 0x00,
-  0x83, 0x47, 0xd7, 0x00, 0x93, 0x84, 0xf4, 0xff, 0x93, 0xb4, 0x14, 0x00,
-  0xb3, 0xf4, 0xf4, 0x00, 0x63, 0x8c, 0x04, 0x02, 0x93, 0x07, 0x90, 0x00,
-  0x23, 0x20, 0xf4, 0x00, 0x93, 0x07, 0x40, 0x20, 0x23, 0x24, 0xf4, 0x00,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0x06, 0xf4, 0x00, 0xef, 0xe0, 0x0f, 0xc7,
-  0x83, 0x47, 0xd4, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x63, 0x18, 0x05, 0x00,
-  0x93, 0xf7, 0x17, 0x00, 0x63, 0x94, 0x07, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00, 0xa3, 0x06, 0x07, 0x00,
-  0x13, 0x05, 0x10, 0x00, 0x6f, 0xf0, 0xdf, 0xf9, 0x13, 0x01, 0xc1, 0xfe,
-  0x23, 0x28, 0x11, 0x00, 0x23, 0x26, 0x81, 0x00, 0x23, 0x24, 0x91, 0x00,
-  0xef, 0xe0, 0x1f, 0xc7, 0x23, 0x22, 0xa1, 0x00, 0xef, 0xe0, 0x9f, 0xc7,
-  0x93, 0x04, 0x05, 0x00, 0x37, 0x84, 0x00, 0x00, 0xef, 0xe0, 0xdf, 0xc7,
-  0x13, 0x04, 0x04, 0x0e, 0x13, 0x07, 0x90, 0x00, 0x23, 0x20, 0xe4, 0x00,
-  0x13, 0x07, 0x60, 0x20, 0x23, 0x24, 0xe4, 0x00, 0x93, 0x06, 0x20, 0x00,
-  0x23, 0x20, 0xa1, 0x00, 0x23, 0x06, 0xd4, 0x00, 0xef, 0xe0, 0xcf, 0xbe,
-  0x63, 0x1e, 0x05, 0x10, 0x83, 0x43, 0xd4, 0x00, 0x03, 0x47, 0xd4, 0x00,
-  0x83, 0x27, 0x41, 0x00, 0x93, 0x06, 0x20, 0x00, 0x13, 0x57, 0x27, 0x00,
-  0x93, 0xf3, 0x33, 0x00, 0x93, 0x72, 0x37, 0x00, 0x63, 0x96, 0xd7, 0x02,
-  0x03, 0x47, 0xd4, 0x00, 0x83, 0x46, 0xd4, 0x00, 0x13, 0x57, 0x47, 0x00,
-  0x13, 0x77, 0x37, 0x00, 0x93, 0xd6, 0x66, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00, 0x13, 0x03, 0x00, 0x00,
-  0x6f, 0x00, 0x80, 0x04, 0x13, 0x07, 0x40, 0x00, 0x63, 0x90, 0xe7, 0x0e,
-  0x03, 0x47, 0xd4, 0x00, 0x83, 0x46, 0xd4, 0x00, 0x03, 0x43, 0xe4, 0x00,
-  0x03, 0x46, 0xe4, 0x00, 0x83, 0x45, 0xe4, 0x00, 0x03, 0x44, 0xe4, 0x00,
-  0x13, 0x57, 0x47, 0x00, 0x13, 0x56, 0x26, 0x00, 0x93, 0xd5, 0x45, 0x00,
-  0x13, 0x77, 0x37, 0x00, 0x93, 0xd6, 0x66, 0x00, 0x13, 0x73, 0x33, 0x00,
-  0x13, 0x76, 0x36, 0x00, 0x93, 0xf5, 0x35, 0x00, 0x13, 0x54, 0x64, 0x00,
-  0x93, 0x77, 0xf3, 0x0f, 0x63, 0x74, 0xb3, 0x00, 0x93, 0xf7, 0xf5, 0x0f,
-  0x93, 0xf5, 0xf7, 0x0f, 0x63, 0xf4, 0x75, 0x00, 0x93, 0xf7, 0xf3, 0x0f,
-  0x93, 0xf5, 0xf7, 0x0f, 0x63, 0xf4, 0xe5, 0x00, 0x93, 0x77, 0xf7, 0x0f,
-  0x37, 0x87, 0x00, 0x00, 0x13, 0x07, 0xc7, 0x25, 0x63, 0xe0, 0x97, 0x08,
-  0x93, 0x07, 0x10, 0x00, 0xa3, 0x01, 0xf7, 0x00, 0x83, 0x47, 0x17, 0x00,
-  0x63, 0x9e, 0x97, 0x06, 0x83, 0x47, 0x57, 0x00, 0x93, 0x87, 0x17, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0xa3, 0x02, 0xf7, 0x00, 0x93, 0x77, 0xf6, 0x0f,
-  0x63, 0x74, 0x86, 0x00, 0x93, 0x77, 0xf4, 0x0f, 0x13, 0xf6, 0xf7, 0x0f,
-  0x63, 0x74, 0x56, 0x00, 0x93, 0xf7, 0xf2, 0x0f, 0x13, 0xf6, 0xf7, 0x0f,
-  0x63, 0x74, 0xd6, 0x00, 0x93, 0xf7, 0xf6, 0x0f, 0x83, 0x26, 0x01, 0x00,
-  0x63, 0xe6, 0xd7, 0x04, 0x93, 0x07, 0x10, 0x00, 0x23, 0x02, 0xf7, 0x00,
-  0x83, 0x27, 0x01, 0x00, 0x23, 0x01, 0xf7, 0x00, 0x83, 0x20, 0x01, 0x01,
-  0x03, 0x24, 0xc1, 0x00, 0x83, 0x24, 0x81, 0x00, 0x13, 0x01, 0x41, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00,
-  0x6f, 0xf0, 0x1f, 0xf0, 0xa3, 0x01, 0x07, 0x00, 0x93, 0x84, 0x07, 0x00,
-  0x6f, 0xf0, 0x5f, 0xf8, 0xa3, 0x02, 0x07, 0x00, 0xa3, 0x00, 0x97, 0x00,
-  0x6f, 0xf0, 0x1f, 0xf9, 0x23, 0x02, 0x07, 0x00, 0x23, 0x20, 0xf1, 0x00,
-  0x6f, 0xf0, 0x9f, 0xfb, 0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0x81, 0x00,
-  0x37, 0x84, 0x00, 0x00, 0x93, 0x07, 0xc4, 0x08, 0x23, 0x24, 0x11, 0x00,
-  0xa3, 0x83, 0x07, 0x00, 0x13, 0x07, 0x10, 0x00, 0x93, 0x05, 0x80, 0x3e,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0x83, 0xe7, 0x00, 0x13, 0x04, 0xc4, 0x08,
-  0xef, 0xd0, 0xdf, 0xae, 0x83, 0x47, 0x74, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0x63, 0x98, 0x07, 0x00, 0xef, 0xd0, 0x1f, 0xbd, 0xe3, 0x08, 0x05, 0xfe,
-  0x13, 0x05, 0x10, 0x00, 0x83, 0x20, 0x81, 0x00, 0x03, 0x24, 0x41, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff,
-  0x13, 0x05, 0x00, 0x02, 0x23, 0x24, 0x11, 0x00, 0xef, 0xd0, 0xdf, 0x82,
-  0x93, 0x05, 0x80, 0x3e, 0x13, 0x05, 0x00, 0x00, 0xef, 0xd0, 0xdf, 0xa5,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xe0, 0xdf, 0xa9, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xe0, 0x1f, 0xb2, 0xb7, 0x87, 0x00, 0x00, 0x03, 0xc5, 0xc7, 0x25,
-  0x93, 0x05, 0x00, 0x00, 0xef, 0xf0, 0x9f, 0x8e, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x6f, 0xf0, 0x5f, 0xf6, 0x13, 0x01, 0x01, 0xff,
-  0x23, 0x24, 0x81, 0x00, 0x37, 0x84, 0x00, 0x00, 0x93, 0x07, 0x04, 0x25,
-  0x23, 0x26, 0x11, 0x00, 0x23, 0x22, 0x91, 0x00, 0x83, 0xc4, 0x17, 0x00,
-  0xef, 0xe0, 0x1f, 0x9d, 0x13, 0x04, 0x04, 0x25, 0x93, 0xf4, 0xf4, 0x0f,
-  0x63, 0xf8, 0xa4, 0x12, 0x03, 0x45, 0x14, 0x00, 0xef, 0xe0, 0x5f, 0xa3,
-  0x83, 0x44, 0x24, 0x00, 0xef, 0xe0, 0x1f, 0x9c, 0x93, 0xf4, 0xf4, 0x0f,
-  0x93, 0xf4, 0x74, 0x00, 0x63, 0xfe, 0xa4, 0x10, 0x03, 0x45, 0x24, 0x00,
-  0x13, 0x75, 0x75, 0x00, 0xef, 0xe0, 0x5f, 0xa2, 0x37, 0x84, 0x00, 0x00,
-  0xef, 0xe0, 0x5f, 0xb9, 0x63, 0x12, 0x05, 0x0c, 0xb7, 0x84, 0x00, 0x00,
-  0x93, 0x87, 0x04, 0x0e, 0x13, 0x07, 0x80, 0x00, 0x23, 0xa0, 0xe7, 0x00,
-  0x13, 0x07, 0x00, 0x10, 0x23, 0xa4, 0xe7, 0x00, 0x23, 0x86, 0x07, 0x00,
-  0x03, 0xc7, 0xc7, 0x00, 0x93, 0x76, 0xf7, 0x0f, 0x13, 0x07, 0x17, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x86, 0xe7, 0x00, 0x23, 0x20, 0xd1, 0x00,
-  0xef, 0xe0, 0x1f, 0x99, 0x83, 0x26, 0x01, 0x00, 0x93, 0x87, 0x04, 0x0e,
-  0xb3, 0x87, 0xd7, 0x00, 0xa3, 0x86, 0xa7, 0x00, 0xef, 0xe0, 0xdf, 0x98,
-  0x23, 0x20, 0xa1, 0x00, 0xef, 0xe0, 0xcf, 0xdf, 0x03, 0x27, 0x01, 0x00,
-  0x93, 0x87, 0x04, 0x0e, 0x63, 0x06, 0x05, 0x00, 0x13, 0x67, 0x07, 0xf8,
-  0x13, 0x77, 0xf7, 0x0f, 0x03, 0xc6, 0xc7, 0x00, 0x93, 0x06, 0x16, 0x00,
-  0x93, 0xf6, 0xf6, 0x0f, 0x23, 0x86, 0xd7, 0x00, 0xb3, 0x87, 0xc7, 0x00,
-  0xa3, 0x86, 0xe7, 0x00, 0xef, 0xe0, 0x8f, 0x90, 0x63, 0x1e, 0x05, 0x02,
-  0x93, 0x07, 0xc4, 0x25, 0xa3, 0x80, 0x07, 0x00, 0x23, 0x81, 0x07, 0x00,
-  0xa3, 0x82, 0x07, 0x00, 0xa3, 0x81, 0x07, 0x00, 0x23, 0x82, 0x07, 0x00,
-  0xef, 0xf0, 0x1f, 0xe6, 0x13, 0x05, 0x10, 0x00, 0xef, 0xe0, 0x9f, 0x9f,
-  0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x10, 0x00, 0xef, 0xf0, 0x4f, 0xfc,
-  0x93, 0x04, 0xc4, 0x25, 0x63, 0x04, 0x05, 0x06, 0x93, 0x04, 0x00, 0x00,
-  0xef, 0xf0, 0x0f, 0xf4, 0x13, 0x04, 0x05, 0x00, 0x63, 0x16, 0x05, 0x00,
-  0x13, 0x04, 0x10, 0x00, 0x33, 0x04, 0x94, 0x40, 0x13, 0x05, 0x00, 0x00,
-  0xef, 0xe0, 0x5f, 0x9c, 0x83, 0x20, 0xc1, 0x00, 0x13, 0x05, 0x04, 0x00,
-  0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0xef, 0xe0, 0x5f, 0x89, 0x6f, 0xf0, 0x5f, 0xed,
-  0xef, 0xe0, 0x9f, 0x89, 0x6f, 0xf0, 0xdf, 0xee, 0xef, 0xe0, 0x0f, 0xd3,
-  0x63, 0x1e, 0x05, 0x04, 0xef, 0xe0, 0x0f, 0xd1, 0x93, 0x05, 0x10, 0x00,
-  0x63, 0x08, 0x05, 0x0a, 0x13, 0x05, 0x30, 0x00, 0x6f, 0x00, 0x80, 0x05,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x8f, 0xd6, 0x93, 0x05, 0x05, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xd0, 0x9f, 0x89, 0x13, 0x05, 0x00, 0x00,
-  0xef, 0xf0, 0x5f, 0xa9, 0x23, 0x20, 0xa1, 0x00, 0xef, 0xf0, 0x1f, 0xc1,
-  0x83, 0x27, 0x01, 0x00, 0xe3, 0x8e, 0x07, 0xfa, 0x03, 0xc7, 0x54, 0x00,
-  0x93, 0x07, 0x50, 0x00, 0x63, 0x0c, 0xf7, 0x06, 0xef, 0xf0, 0x5f, 0xda,
-  0xef, 0xf0, 0x9f, 0x99, 0x6f, 0xf0, 0x1f, 0xfc, 0x13, 0x05, 0x20, 0x00,
-  0xef, 0xe0, 0x5f, 0x93, 0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x40, 0x00,
-  0xef, 0xf0, 0x0f, 0xf0, 0x93, 0x04, 0x00, 0x00, 0x13, 0x05, 0x10, 0x00,
-  0xef, 0xe0, 0xcf, 0xd0, 0x93, 0x05, 0x05, 0x00, 0x13, 0x05, 0x00, 0x00,
-  0xef, 0xd0, 0xdf, 0x83, 0x13, 0x05, 0x10, 0x00, 0xef, 0xf0, 0x9f, 0xa3,
-  0x23, 0x20, 0xa1, 0x00, 0xef, 0xf0, 0x5f, 0xbb, 0x83, 0x27, 0x01, 0x00,
-  0x63, 0x8e, 0x07, 0x02, 0x93, 0x07, 0x60, 0x00, 0x63, 0x80, 0xf4, 0x02,
-  0x93, 0x84, 0x14, 0x00, 0x93, 0xf4, 0xf4, 0x0f, 0xef, 0xf0, 0x5f, 0xd4,
-  0xef, 0xf0, 0x9f, 0x93, 0x6f, 0xf0, 0xdf, 0xfb, 0x13, 0x05, 0x20, 0x00,
-  0x6f, 0xf0, 0xdf, 0xfa, 0xef, 0xf0, 0x4f, 0xe3, 0xe3, 0x16, 0x05, 0xee,
-  0xef, 0xe0, 0x1f, 0xac, 0xe3, 0x0e, 0x05, 0xe0, 0x6f, 0xf0, 0x1f, 0xee,
-  0x93, 0x04, 0x10, 0x00, 0x6f, 0xf0, 0xdf, 0xed, 0x13, 0x01, 0x41, 0xff,
-  0x13, 0x05, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00, 0xef, 0xe0, 0x8f, 0xb8,
-  0x63, 0x0a, 0x05, 0x00, 0x13, 0x05, 0x10, 0x00, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x01, 0xc1, 0x00, 0x67, 0x80, 0x00, 0x00, 0xef, 0xe0, 0x8f, 0x8c,
-  0xe3, 0x16, 0x05, 0xfe, 0xef, 0xe0, 0x8f, 0xba, 0xe3, 0x12, 0x05, 0xfe,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xe0, 0xcf, 0xb5, 0xe3, 0x1c, 0x05, 0xfc,
-  0xef, 0xf0, 0x5f, 0xd7, 0x33, 0x35, 0xa0, 0x00, 0x6f, 0xf0, 0x1f, 0xfd,
-  0x13, 0x01, 0x41, 0xff, 0xb7, 0x87, 0x00, 0x00, 0x23, 0x24, 0x11, 0x00,
-  0x93, 0x87, 0xc7, 0x26, 0x23, 0x8b, 0x07, 0x00, 0x13, 0x05, 0x00, 0x01,
-  0x23, 0x87, 0x07, 0x02, 0xef, 0xd0, 0x4f, 0xd0, 0x83, 0x20, 0x81, 0x00,
-  0x13, 0x05, 0x00, 0x01, 0x13, 0x01, 0xc1, 0x00, 0x6f, 0xd0, 0x0f, 0xd1,
-  0x13, 0x01, 0x41, 0xf7, 0x23, 0x22, 0x81, 0x08, 0x23, 0x24, 0x11, 0x08,
-  0x13, 0x04, 0x05, 0x00, 0xef, 0xe0, 0xcf, 0xf5, 0xb7, 0x06, 0x5c, 0x01,
-  0x93, 0x07, 0x40, 0x00, 0x93, 0x86, 0xc6, 0x15, 0x63, 0x1a, 0xf5, 0x1a,
-  0x23, 0x20, 0xd1, 0x00, 0x23, 0x22, 0xd1, 0x00, 0x23, 0x24, 0xd1, 0x00,
-  0x23, 0x26, 0xd1, 0x00, 0x93, 0x07, 0x01, 0x00, 0x13, 0x07, 0x81, 0x01,
-  0x23, 0x98, 0x07, 0x00, 0x93, 0x87, 0x27, 0x00, 0xe3, 0x9c, 0xe7, 0xfe,
-  0x13, 0x17, 0x14, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x33, 0x07, 0x87, 0x00,
-  0x13, 0x17, 0x37, 0x00, 0x93, 0x87, 0xc7, 0x26, 0xb3, 0x87, 0xe7, 0x00,
-  0x03, 0xd7, 0x47, 0x00, 0x93, 0x05, 0xd0, 0x1f, 0x13, 0x06, 0xd0, 0x1f,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x14, 0xe1, 0x02, 0x03, 0xd7, 0x67, 0x00,
-  0x93, 0x06, 0xd0, 0x1f, 0x13, 0x57, 0x87, 0x00, 0x23, 0x15, 0xe1, 0x02,
-  0x03, 0xd7, 0x87, 0x00, 0x23, 0x17, 0x01, 0x02, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x16, 0xe1, 0x02, 0x03, 0xd7, 0x47, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x18, 0xe1, 0x02, 0x03, 0xd7, 0x67, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x19, 0xe1, 0x02, 0x03, 0xd7, 0x87, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x1a, 0xe1, 0x02, 0x13, 0x07, 0x00, 0x08, 0x23, 0x1b, 0xe1, 0x02,
-  0x03, 0xd7, 0xc7, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1c, 0xe1, 0x02,
-  0x03, 0xd7, 0xe7, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1d, 0xe1, 0x02,
-  0x03, 0xd7, 0x07, 0x01, 0x23, 0x1f, 0x01, 0x02, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x1e, 0xe1, 0x02, 0x03, 0xd7, 0xc7, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x10, 0xe1, 0x04, 0x03, 0xd7, 0xe7, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x11, 0xe1, 0x04, 0x03, 0xd7, 0x07, 0x01, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x12, 0xe1, 0x04, 0x03, 0xd7, 0x47, 0x01, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x13, 0xe1, 0x04, 0x03, 0xd7, 0xa7, 0x00, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x14, 0xe1, 0x04, 0x03, 0xd7, 0x27, 0x01, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x15, 0xe1, 0x04, 0x23, 0x16, 0x01, 0x04, 0x03, 0xd7, 0x47, 0x01,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x17, 0xe1, 0x04, 0x03, 0xd7, 0xa7, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x18, 0xe1, 0x04, 0x83, 0xd7, 0x27, 0x01,
-  0x13, 0x07, 0xd0, 0x1f, 0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x1f, 0xe1, 0x04,
-  0x23, 0x19, 0xf1, 0x04, 0x23, 0x2a, 0x01, 0x04, 0x23, 0x1c, 0xb1, 0x04,
-  0x23, 0x1d, 0xc1, 0x04, 0x23, 0x1e, 0xd1, 0x04, 0x13, 0x07, 0x00, 0x03,
-  0xb7, 0x87, 0x00, 0x00, 0x93, 0x87, 0xc7, 0x29, 0x63, 0x16, 0x04, 0x2c,
-  0x93, 0x06, 0x20, 0x01, 0x23, 0x82, 0xd7, 0x00, 0x23, 0xa0, 0x07, 0x00,
-  0xa3, 0x82, 0xe7, 0x00, 0x23, 0xa4, 0x27, 0x00, 0xef, 0xd0, 0xdf, 0x89,
-  0x13, 0x05, 0x30, 0x00, 0xef, 0xe0, 0xcf, 0xe9, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x87, 0xc7, 0x08, 0x23, 0x07, 0x87, 0x00, 0x93, 0x06, 0x10, 0x00,
-  0xa3, 0x07, 0xd7, 0x00, 0x93, 0x87, 0xc7, 0x08, 0x13, 0x07, 0x10, 0x00,
-  0x83, 0xc6, 0xf7, 0x00, 0xe3, 0x8e, 0xe6, 0xfe, 0x83, 0x20, 0x81, 0x08,
-  0x03, 0x24, 0x41, 0x08, 0x13, 0x01, 0xc1, 0x08, 0x67, 0x80, 0x00, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x13, 0x06, 0x20, 0x00, 0x23, 0x20, 0xd1, 0x00,
-  0x93, 0x87, 0xc7, 0x26, 0x13, 0x17, 0x14, 0x00, 0x63, 0x06, 0xc5, 0x12,
-  0x33, 0x07, 0x87, 0x00, 0x13, 0x17, 0x37, 0x00, 0xb3, 0x87, 0xe7, 0x00,
-  0x23, 0x22, 0x01, 0x00, 0x23, 0x14, 0x01, 0x00, 0x03, 0xd7, 0x47, 0x00,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x15, 0xe1, 0x00, 0x03, 0xd7, 0x47, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x16, 0xe1, 0x00, 0x03, 0xd7, 0xc7, 0x00,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x17, 0xe1, 0x00, 0x03, 0xd7, 0xc7, 0x00,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x18, 0xe1, 0x00, 0x03, 0xd7, 0xa7, 0x00,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x19, 0xe1, 0x00, 0x03, 0xd7, 0xa7, 0x00,
-  0x23, 0x1b, 0x01, 0x00, 0x23, 0x2c, 0x01, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x1a, 0xe1, 0x00, 0x03, 0xd7, 0x67, 0x00, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x1e, 0xe1, 0x00, 0x03, 0xd7, 0x67, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x1f, 0xe1, 0x00, 0x03, 0xd7, 0xe7, 0x00, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x10, 0xe1, 0x02, 0x03, 0xd7, 0xe7, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x11, 0xe1, 0x02, 0x03, 0xd7, 0x27, 0x01, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x12, 0xe1, 0x02, 0x03, 0xd7, 0x27, 0x01, 0x23, 0x24, 0x01, 0x02,
-  0x23, 0x16, 0x01, 0x02, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x13, 0xe1, 0x02,
-  0x03, 0xd7, 0x87, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x17, 0xe1, 0x02,
-  0x03, 0xd7, 0x87, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x18, 0xe1, 0x02,
-  0x03, 0xd7, 0x07, 0x01, 0x13, 0x57, 0x87, 0x00, 0x23, 0x19, 0xe1, 0x02,
-  0x03, 0xd7, 0x07, 0x01, 0x23, 0x1b, 0x01, 0x02, 0x23, 0x2c, 0x01, 0x02,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x1a, 0xe1, 0x02, 0x37, 0x07, 0x80, 0x00,
-  0x23, 0x2e, 0x01, 0x02, 0x23, 0x20, 0xe1, 0x04, 0x23, 0x12, 0x01, 0x04,
-  0x03, 0xd7, 0x47, 0x01, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x13, 0xe1, 0x04,
-  0x83, 0xd7, 0x47, 0x01, 0x13, 0x07, 0x70, 0x02, 0x23, 0x15, 0x01, 0x04,
-  0x93, 0xd7, 0x87, 0x00, 0x23, 0x14, 0xf1, 0x04, 0x93, 0x07, 0xd0, 0x1f,
-  0x23, 0x16, 0xf1, 0x04, 0x6f, 0xf0, 0x5f, 0xe6, 0x33, 0x07, 0x87, 0x00,
-  0x13, 0x17, 0x37, 0x00, 0xb3, 0x87, 0xe7, 0x00, 0x23, 0x22, 0xd1, 0x00,
-  0x23, 0x24, 0x01, 0x00, 0x23, 0x26, 0x01, 0x00, 0x23, 0x28, 0x01, 0x00,
-  0x03, 0xd7, 0x47, 0x00, 0x93, 0x05, 0x00, 0x00, 0x13, 0x06, 0x00, 0x00,
-  0x13, 0x57, 0x87, 0x00, 0x23, 0x1a, 0xe1, 0x00, 0x03, 0xd7, 0x67, 0x00,
-  0x93, 0x06, 0x00, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1b, 0xe1, 0x00,
-  0x03, 0xd7, 0x47, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x1c, 0xe1, 0x00,
-  0x03, 0xd7, 0x67, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x1d, 0xe1, 0x00,
-  0x03, 0xd7, 0xc7, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1e, 0xe1, 0x00,
-  0x03, 0xd7, 0xe7, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1f, 0xe1, 0x00,
-  0x03, 0xd7, 0xc7, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x10, 0xe1, 0x02,
-  0x03, 0xd7, 0xe7, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x11, 0xe1, 0x02,
-  0x03, 0xd7, 0xa7, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x12, 0xe1, 0x02,
-  0x03, 0xd7, 0x27, 0x01, 0x13, 0x57, 0x87, 0x00, 0x23, 0x13, 0xe1, 0x02,
-  0x03, 0xd7, 0xa7, 0x00, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x14, 0xe1, 0x02,
-  0x03, 0xd7, 0x27, 0x01, 0x23, 0x26, 0x01, 0x02, 0x23, 0x28, 0x01, 0x02,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x15, 0xe1, 0x02, 0x23, 0x2a, 0x01, 0x02,
-  0x03, 0xd7, 0x87, 0x00, 0x13, 0x57, 0x87, 0x00, 0x23, 0x1c, 0xe1, 0x02,
-  0x23, 0x1d, 0x01, 0x02, 0x03, 0xd7, 0x87, 0x00, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x1e, 0xe1, 0x02, 0x13, 0x07, 0x00, 0x08, 0x23, 0x1f, 0xe1, 0x02,
-  0x03, 0xd7, 0x07, 0x01, 0x23, 0x11, 0x01, 0x04, 0x13, 0x57, 0x87, 0x00,
-  0x23, 0x10, 0xe1, 0x04, 0x03, 0xd7, 0x07, 0x01, 0x13, 0x77, 0xf7, 0x0f,
-  0x23, 0x12, 0xe1, 0x04, 0x03, 0xd7, 0x47, 0x01, 0x23, 0x14, 0x01, 0x04,
-  0x13, 0x77, 0xf7, 0x0f, 0x23, 0x13, 0xe1, 0x04, 0x83, 0xd7, 0x47, 0x01,
-  0x13, 0x07, 0x00, 0x00, 0x23, 0x26, 0x01, 0x04, 0x93, 0xd7, 0x87, 0x00,
-  0x23, 0x15, 0xf1, 0x04, 0x93, 0x07, 0xd0, 0x1f, 0x23, 0x18, 0xf1, 0x04,
-  0x6f, 0xf0, 0x5f, 0xd1, 0x93, 0x06, 0x30, 0x01, 0x23, 0x82, 0xd7, 0x00,
-  0x23, 0xa0, 0x07, 0x00, 0xa3, 0x82, 0xe7, 0x00, 0x23, 0xa4, 0x27, 0x00,
-  0xef, 0xd0, 0x4f, 0xdd, 0x13, 0x05, 0x40, 0x00, 0x6f, 0xf0, 0x9f, 0xd3,
-  0x13, 0x05, 0x00, 0x00, 0x6f, 0xe0, 0xcf, 0xbc, 0x13, 0x01, 0x01, 0xff,
-  0x23, 0x24, 0x81, 0x00, 0x23, 0x26, 0x11, 0x00, 0x23, 0x22, 0x91, 0x00,
-  0x13, 0x04, 0x05, 0x00, 0x63, 0x0c, 0x05, 0x06, 0x93, 0x07, 0x00, 0x08,
-  0x93, 0x04, 0x00, 0x02, 0x13, 0x85, 0x04, 0x00, 0x23, 0x20, 0xf1, 0x00,
-  0xef, 0xd0, 0xcf, 0xa6, 0x83, 0x27, 0x01, 0x00, 0x13, 0x85, 0x07, 0x00,
-  0xef, 0xd0, 0x4f, 0x88, 0x93, 0x05, 0x40, 0x06, 0x13, 0x05, 0x00, 0x00,
-  0xef, 0xd0, 0x0f, 0xb0, 0x93, 0x05, 0x20, 0x00, 0x13, 0x85, 0x04, 0x00,
-  0xef, 0xd0, 0x8f, 0x97, 0x63, 0x04, 0x05, 0x04, 0x13, 0x17, 0x14, 0x00,
-  0xb7, 0x87, 0x00, 0x00, 0x33, 0x07, 0x87, 0x00, 0x13, 0x17, 0x37, 0x00,
-  0x93, 0x87, 0xc7, 0x26, 0xb3, 0x87, 0xe7, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x8b, 0xe7, 0x00, 0x13, 0x05, 0x00, 0x00, 0x83, 0x20, 0xc1, 0x00,
-  0x03, 0x24, 0x81, 0x00, 0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01,
-  0x67, 0x80, 0x00, 0x00, 0x93, 0x07, 0x00, 0x04, 0x93, 0x04, 0x00, 0x01,
-  0x6f, 0xf0, 0xdf, 0xf8, 0xef, 0xd0, 0xcf, 0xb9, 0xe3, 0x04, 0x05, 0xfa,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xe0, 0x4f, 0xb2, 0x13, 0x05, 0x10, 0x00,
-  0x6f, 0xf0, 0xdf, 0xfc, 0x13, 0x01, 0x01, 0xff, 0x23, 0x24, 0x81, 0x00,
-  0x23, 0x22, 0x91, 0x00, 0x13, 0x04, 0x05, 0x00, 0x23, 0x26, 0x11, 0x00,
-  0x93, 0x84, 0x05, 0x00, 0x13, 0x05, 0x00, 0x08, 0x63, 0x14, 0x04, 0x00,
-  0x13, 0x05, 0x00, 0x04, 0x23, 0x20, 0xc1, 0x00, 0xef, 0xc0, 0x1f, 0xff,
-  0x13, 0x17, 0x14, 0x00, 0xb7, 0x87, 0x00, 0x00, 0xb3, 0x05, 0x87, 0x00,
-  0x93, 0x86, 0xc7, 0x26, 0x93, 0x95, 0x35, 0x00, 0xb3, 0x86, 0xb6, 0x00,
-  0x83, 0xc6, 0x66, 0x01, 0x03, 0x26, 0x01, 0x00, 0x93, 0x87, 0xc7, 0x26,
-  0x33, 0xe6, 0xc6, 0x00, 0x63, 0x00, 0x06, 0x02, 0xb7, 0x86, 0x00, 0x00,
-  0x13, 0x86, 0xc6, 0x08, 0x23, 0x07, 0x86, 0x00, 0x23, 0x08, 0x96, 0x00,
-  0x93, 0x86, 0xc6, 0x08, 0x03, 0xc6, 0x06, 0x01, 0xe3, 0x1e, 0x06, 0xfe,
-  0x33, 0x07, 0x87, 0x00, 0x13, 0x17, 0x37, 0x00, 0xb3, 0x87, 0xe7, 0x00,
-  0x23, 0x8b, 0x07, 0x00, 0x83, 0x20, 0xc1, 0x00, 0x03, 0x24, 0x81, 0x00,
-  0x83, 0x24, 0x41, 0x00, 0x13, 0x01, 0x01, 0x01, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x17, 0x15, 0x00, 0x33, 0x07, 0xa7, 0x00, 0xb7, 0x87, 0x00, 0x00,
-  0x13, 0x17, 0x37, 0x00, 0x93, 0x87, 0xc7, 0x26, 0xb3, 0x87, 0xe7, 0x00,
-  0x03, 0xc5, 0x67, 0x01, 0x67, 0x80, 0x00, 0x00, 0x13, 0x17, 0x15, 0x00,
-  0x33, 0x07, 0xa7, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x13, 0x17, 0x37, 0x00,
-  0x93, 0x87, 0xc7, 0x26, 0xb3, 0x87, 0xe7, 0x00, 0x03, 0xd5, 0x47, 0x01,
-  0x13, 0x55, 0x65, 0x00, 0x13, 0x75, 0x15, 0x00, 0x67, 0x80, 0x00, 0x00,
-  0x37, 0x87, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00, 0x93, 0x07, 0x00, 0x00,
-  0x13, 0x07, 0x07, 0x08, 0x13, 0x06, 0x70, 0x00, 0xb3, 0x05, 0xd7, 0x00,
-  0x83, 0xc5, 0x25, 0x00, 0x93, 0x86, 0x16, 0x00, 0xb3, 0xc7, 0xf5, 0x00,
-  0xe3, 0x98, 0xc6, 0xfe, 0x03, 0x47, 0x97, 0x00, 0x13, 0x85, 0x17, 0x00,
-  0x13, 0x75, 0xf5, 0x0f, 0x33, 0x05, 0xe5, 0x40, 0x33, 0x35, 0xa0, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x13, 0x01, 0x41, 0xff, 0x13, 0x05, 0x10, 0x00,
-  0x23, 0x24, 0x11, 0x00, 0xef, 0xc0, 0x1f, 0xf3, 0xb7, 0x87, 0x00, 0x00,
-  0x93, 0x87, 0x07, 0x08, 0x63, 0x0c, 0x05, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x23, 0x80, 0xe7, 0x00, 0x83, 0x20, 0x81, 0x00, 0x13, 0x01, 0xc1, 0x00,
-  0x67, 0x80, 0x00, 0x00, 0x23, 0x80, 0x07, 0x00, 0x6f, 0xf0, 0x1f, 0xff,
-  0xb7, 0xc7, 0x00, 0x00, 0x93, 0x86, 0x07, 0x10, 0x37, 0x87, 0x00, 0x00,
-  0x23, 0x2c, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x20, 0x37, 0x87, 0x00, 0x00,
-  0x23, 0x2a, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x30, 0x37, 0x87, 0x00, 0x00,
-  0x23, 0x28, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x40, 0x37, 0x87, 0x00, 0x00,
-  0x23, 0x26, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x50, 0x37, 0x87, 0x00, 0x00,
-  0x23, 0x24, 0xd7, 0x02, 0x93, 0x86, 0x07, 0x60, 0x37, 0x87, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x22, 0xd7, 0x02, 0x93, 0x87, 0x07, 0x70,
-  0x37, 0x87, 0x00, 0x00, 0x23, 0x22, 0x81, 0x00, 0x23, 0x20, 0xf7, 0x02,
-  0x37, 0x84, 0x00, 0x00, 0xb7, 0xd7, 0x00, 0x00, 0x93, 0x87, 0x07, 0x80,
-  0x23, 0x24, 0x11, 0x00, 0x37, 0x87, 0x00, 0x00, 0x23, 0x20, 0x91, 0x00,
-  0x93, 0x04, 0x04, 0x08, 0x23, 0x2e, 0xf7, 0x00, 0xa3, 0x80, 0x04, 0x00,
-  0xef, 0xc0, 0xdf, 0xd9, 0xef, 0xf0, 0x1f, 0xf4, 0xef, 0xd0, 0x8f, 0x83,
-  0xef, 0xd0, 0xcf, 0xc9, 0xef, 0xd0, 0x0f, 0xb1, 0xef, 0xd0, 0x0f, 0xa3,
-  0xef, 0xd0, 0x9f, 0xe3, 0xef, 0xd0, 0xcf, 0xc2, 0xef, 0xd0, 0x9f, 0xfb,
-  0xef, 0xf0, 0x1f, 0x8b, 0xef, 0xe0, 0x1f, 0xe4, 0xef, 0xe0, 0x4f, 0xc8,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xc0, 0x9f, 0xdf, 0x13, 0x05, 0x20, 0x00,
-  0xef, 0xc0, 0x1f, 0xdf, 0xb7, 0xa5, 0x93, 0xd6, 0x93, 0x85, 0x05, 0x40,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xd0, 0x8f, 0x86, 0x93, 0x07, 0x10, 0x00,
-  0x23, 0x85, 0xf4, 0x00, 0x13, 0x04, 0x04, 0x08, 0xb7, 0x86, 0x00, 0x00,
-  0x93, 0x87, 0xc6, 0x00, 0x03, 0xc7, 0x57, 0x00, 0x93, 0x84, 0xc6, 0x00,
-  0x63, 0x02, 0x07, 0x04, 0x13, 0x05, 0x40, 0x00, 0xa3, 0x82, 0x04, 0x00,
-  0xef, 0xc0, 0x5f, 0xdc, 0x93, 0x05, 0x00, 0x00, 0x13, 0x05, 0x60, 0x00,
-  0xef, 0xe0, 0xcf, 0x85, 0x13, 0x06, 0x00, 0x00, 0x93, 0x05, 0x30, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xf0, 0x1f, 0xd9, 0x13, 0x06, 0x00, 0x00,
-  0x93, 0x05, 0x30, 0x00, 0x13, 0x05, 0x10, 0x00, 0xef, 0xf0, 0x1f, 0xd8,
-  0x23, 0x0c, 0x04, 0x00, 0xa3, 0x0c, 0x04, 0x00, 0x03, 0x47, 0x14, 0x00,
-  0x63, 0x0e, 0x07, 0x04, 0x03, 0xc7, 0x44, 0x00, 0x63, 0x08, 0x07, 0x00,
-  0x13, 0x05, 0x40, 0x00, 0x23, 0x82, 0x04, 0x00, 0xef, 0xc0, 0x5f, 0xd6,
-  0x03, 0xc7, 0x64, 0x00, 0x63, 0x02, 0x07, 0x02, 0x23, 0x83, 0x04, 0x00,
-  0xef, 0xd0, 0x9f, 0x93, 0xef, 0xe0, 0x0f, 0xaa, 0x63, 0x0a, 0x05, 0x00,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xc0, 0x5f, 0xd5, 0x13, 0x05, 0x40, 0x00,
-  0xef, 0xc0, 0xdf, 0xd3, 0x83, 0x47, 0x44, 0x01, 0x63, 0x8c, 0x07, 0x00,
-  0x13, 0x05, 0x40, 0x00, 0x23, 0x0a, 0x04, 0x00, 0xef, 0xc0, 0x9f, 0xd3,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xc0, 0x1f, 0xd2, 0x83, 0x47, 0x04, 0x02,
-  0x63, 0x86, 0x07, 0x04, 0x23, 0x00, 0x04, 0x02, 0x23, 0x01, 0x04, 0x02,
-  0xa3, 0x01, 0x04, 0x02, 0x93, 0x07, 0x80, 0x00, 0x23, 0x20, 0xf4, 0x06,
-  0x83, 0x27, 0x44, 0x02, 0x23, 0x24, 0xf4, 0x06, 0x83, 0x47, 0x84, 0x03,
-  0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x06, 0xf4, 0x06, 0x93, 0x07, 0x00, 0x00,
-  0x03, 0x47, 0xc4, 0x06, 0x63, 0xea, 0xe7, 0x06, 0x23, 0x0c, 0x04, 0x02,
-  0xef, 0xd0, 0x4f, 0xed, 0x93, 0x07, 0x10, 0x00, 0x63, 0x10, 0x05, 0x08,
-  0x23, 0x01, 0xf4, 0x02, 0x83, 0x47, 0x14, 0x02, 0xe3, 0x8c, 0x07, 0xee,
-  0xa3, 0x00, 0x04, 0x02, 0x23, 0x01, 0x04, 0x02, 0xa3, 0x01, 0x04, 0x02,
-  0x93, 0x07, 0x90, 0x00, 0x23, 0x20, 0xf4, 0x06, 0x83, 0x27, 0x44, 0x02,
-  0x23, 0x24, 0xf4, 0x06, 0x83, 0x47, 0x84, 0x03, 0x93, 0xf7, 0xf7, 0x0f,
-  0x23, 0x06, 0xf4, 0x06, 0xef, 0xd0, 0x4f, 0xe9, 0x63, 0x14, 0x05, 0x06,
-  0x83, 0x47, 0xc4, 0x06, 0x93, 0xf7, 0xf7, 0x0f, 0x23, 0x0c, 0xf4, 0x02,
-  0x93, 0x07, 0x00, 0x00, 0x03, 0x47, 0x84, 0x03, 0x63, 0xea, 0xe7, 0x02,
-  0x93, 0x07, 0x10, 0x00, 0x23, 0x01, 0xf4, 0x02, 0x6f, 0xf0, 0x5f, 0xea,
-  0xb3, 0x06, 0xf4, 0x00, 0x03, 0xc7, 0x86, 0x02, 0x93, 0x87, 0x17, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0x13, 0x77, 0xf7, 0x0f, 0xa3, 0x86, 0xe6, 0x06,
-  0x6f, 0xf0, 0x1f, 0xf7, 0xa3, 0x01, 0xf4, 0x02, 0x6f, 0xf0, 0x5f, 0xf8,
-  0xb3, 0x06, 0xf4, 0x00, 0x03, 0xc7, 0xd6, 0x06, 0x93, 0x87, 0x17, 0x00,
-  0x93, 0xf7, 0xf7, 0x0f, 0x13, 0x77, 0xf7, 0x0f, 0x23, 0x84, 0xe6, 0x02,
-  0x6f, 0xf0, 0x1f, 0xfb, 0x93, 0x07, 0x10, 0x00, 0xa3, 0x01, 0xf4, 0x02,
-  0x6f, 0xf0, 0x9f, 0xe5, 0x13, 0x07, 0x20, 0x00, 0x63, 0x0a, 0xe5, 0x00,
-  0x13, 0x07, 0x30, 0x00, 0x63, 0x08, 0xe5, 0x00, 0x13, 0x07, 0x10, 0x00,
-  0x63, 0x18, 0xe5, 0x00, 0x6f, 0xc0, 0xdf, 0xc0, 0x13, 0x05, 0x40, 0x00,
-  0x6f, 0xf0, 0x9f, 0xff, 0x67, 0x80, 0x00, 0x00, 0x13, 0x07, 0x20, 0x00,
-  0x63, 0x0a, 0xe5, 0x00, 0x13, 0x07, 0x30, 0x00, 0x63, 0x08, 0xe5, 0x00,
-  0x13, 0x07, 0x10, 0x00, 0x63, 0x18, 0xe5, 0x00, 0x6f, 0xc0, 0x5f, 0xbf,
-  0x13, 0x05, 0x40, 0x00, 0x6f, 0xf0, 0x9f, 0xff, 0x67, 0x80, 0x00, 0x00,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00, 0x23, 0x22, 0x81, 0x00,
-  0xef, 0xc0, 0x9f, 0xf8, 0x13, 0x05, 0x20, 0x00, 0xef, 0xc0, 0x9f, 0xf9,
-  0x13, 0x05, 0x40, 0x00, 0xef, 0xc0, 0x1f, 0xf9, 0x13, 0x05, 0x00, 0x01,
-  0xef, 0xc0, 0x9f, 0xf8, 0x13, 0x05, 0x00, 0x02, 0xef, 0xc0, 0x1f, 0xf8,
-  0x13, 0x05, 0x00, 0x04, 0x37, 0x84, 0x00, 0x00, 0xef, 0xc0, 0x5f, 0xf7,
-  0x13, 0x04, 0x04, 0x08, 0xef, 0xd0, 0x1f, 0xca, 0xef, 0xc0, 0x1f, 0xf3,
-  0x63, 0x06, 0x05, 0x00, 0x13, 0x05, 0x80, 0x00, 0xef, 0xc0, 0x5f, 0xba,
-  0x13, 0x05, 0x10, 0x00, 0xef, 0xc0, 0x9f, 0xef, 0xe3, 0x02, 0x05, 0xfe,
-  0x83, 0x47, 0xa4, 0x00, 0x63, 0x80, 0x07, 0x02, 0x13, 0x05, 0x40, 0x00,
-  0xa3, 0x00, 0x04, 0x00, 0xef, 0xc0, 0x5f, 0xb7, 0x93, 0x05, 0x10, 0x00,
-  0x13, 0x05, 0x90, 0x00, 0xef, 0xd0, 0xdf, 0xe0, 0x6f, 0xf0, 0x1f, 0xfc,
-  0x83, 0x47, 0xa4, 0x00, 0xb7, 0xa5, 0x93, 0xd6, 0x93, 0x85, 0x05, 0x40,
-  0x93, 0x87, 0x17, 0x00, 0x93, 0xf7, 0xf7, 0x0f, 0x13, 0x05, 0x10, 0x00,
-  0x23, 0x05, 0xf4, 0x00, 0xef, 0xc0, 0xdf, 0xdb, 0x6f, 0xf0, 0xdf, 0xf9,
-  0x13, 0x01, 0x41, 0xff, 0x23, 0x24, 0x11, 0x00, 0xef, 0xe0, 0x0f, 0xa3,
-  0xef, 0xe0, 0x5f, 0x81, 0x6f, 0xf0, 0x9f, 0xff, 0x13, 0x01, 0x01, 0xff,
-  0x23, 0x26, 0x11, 0x00, 0x23, 0x24, 0x81, 0x00, 0x23, 0x22, 0x91, 0x00,
-  0xef, 0xe0, 0x4f, 0x93, 0xb7, 0x86, 0x00, 0x00, 0x93, 0x87, 0x06, 0x08,
-  0x03, 0xc7, 0x87, 0x01, 0x93, 0x84, 0x06, 0x08, 0x63, 0x04, 0x07, 0x04,
-  0x23, 0x8c, 0x04, 0x00, 0x03, 0xc4, 0xa4, 0x01, 0x13, 0x74, 0xf4, 0x0f,
-  0x13, 0x05, 0x04, 0x00, 0xef, 0xf0, 0x1f, 0xb7, 0x63, 0x0e, 0x05, 0x00,
-  0x13, 0x05, 0x04, 0x00, 0xef, 0xf0, 0x5f, 0xa1, 0x13, 0x06, 0x00, 0x00,
-  0x93, 0x05, 0x20, 0x00, 0x13, 0x05, 0x04, 0x00, 0xef, 0xf0, 0xdf, 0xab,
-  0x13, 0x05, 0x04, 0x00, 0xef, 0xf0, 0x5f, 0xa0, 0x63, 0x1c, 0x05, 0x0a,
-  0x13, 0x05, 0x04, 0x00, 0xef, 0xf0, 0x8f, 0xd8, 0x03, 0xc7, 0x94, 0x01,
-  0x63, 0x04, 0x07, 0x02, 0xa3, 0x8c, 0x04, 0x00, 0x03, 0xc5, 0xa4, 0x01,
-  0x13, 0x75, 0xf5, 0x0f, 0x23, 0x20, 0xa1, 0x00, 0xef, 0xf0, 0x5f, 0x9d,
-  0x03, 0x25, 0x01, 0x00, 0x13, 0x06, 0x00, 0x00, 0x93, 0x05, 0x20, 0x00,
-  0xef, 0xf0, 0xdf, 0xa7, 0x03, 0xc7, 0xd4, 0x01, 0x63, 0x08, 0x07, 0x00,
-  0xa3, 0x8e, 0x04, 0x00, 0x13, 0x07, 0x10, 0x00, 0xa3, 0x8f, 0xe4, 0x00,
-  0x03, 0xc7, 0xe4, 0x01, 0x63, 0x04, 0x07, 0x00, 0x23, 0x8f, 0x04, 0x00,
-  0x03, 0xc7, 0x74, 0x01, 0x63, 0x06, 0x07, 0x00, 0xa3, 0x8b, 0x04, 0x00,
-  0xef, 0xf0, 0xcf, 0xa1, 0xef, 0xd0, 0x9f, 0xf4, 0xe3, 0x04, 0x05, 0xf4,
-  0x93, 0x05, 0x30, 0x00, 0x13, 0x05, 0x80, 0x03, 0xef, 0xc0, 0x5f, 0xbb,
-  0xe3, 0x0c, 0x05, 0xf2, 0x13, 0x05, 0x80, 0x00, 0xef, 0xc0, 0x9f, 0xa8,
-  0x63, 0x12, 0x05, 0x04, 0x93, 0x05, 0x00, 0x00, 0x13, 0x05, 0x20, 0x00,
-  0xef, 0xd0, 0x9f, 0xcd, 0x13, 0x06, 0x00, 0x00, 0x93, 0x05, 0x30, 0x00,
-  0x13, 0x05, 0x00, 0x00, 0xef, 0xf0, 0xdf, 0xa0, 0x13, 0x06, 0x00, 0x00,
-  0x93, 0x05, 0x30, 0x00, 0x13, 0x05, 0x10, 0x00, 0x6f, 0x00, 0xc0, 0x02,
-  0x13, 0x06, 0x10, 0x00, 0x93, 0x05, 0x10, 0x00, 0x13, 0x05, 0x04, 0x00,
-  0xef, 0xf0, 0xdf, 0x9e, 0x6f, 0xf0, 0x5f, 0xf4, 0x13, 0x05, 0x00, 0x01,
-  0xef, 0xc0, 0xdf, 0xa3, 0x63, 0x1a, 0x05, 0x00, 0x13, 0x06, 0x00, 0x00,
-  0x93, 0x05, 0x10, 0x00, 0xef, 0xf0, 0x1f, 0x9d, 0x6f, 0xf0, 0x1f, 0xed,
-  0x13, 0x05, 0x00, 0x02, 0xef, 0xc0, 0x1f, 0xa2, 0xe3, 0x12, 0x05, 0xec,
-  0x13, 0x06, 0x00, 0x00, 0x93, 0x05, 0x10, 0x00, 0x6f, 0xf0, 0x5f, 0xfb
+// prt_dptx_pm_rom - packed 32-bit words
+const uint32_t prt_dptx_pm_rom[] = {
+  0x0100006f, 0x0500006f, 0x0940006f, 0x0d80006f, 0x00000093, 0x00009137,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x2c0030ef, 0x0000006f, 0x00000093, 0x00009137, 0xf0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x554030ef, 0x0000006f, 0x00000093, 0x00009137, 0xe0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x5b4030ef, 0x0000006f, 0x00000093, 0x00009137, 0xd0010113,
+  0x00000193, 0x00000213, 0x00000293, 0x00000313, 0x00000393, 0x00000413,
+  0x00000493, 0x00000513, 0x00000593, 0x00000613, 0x00000693, 0x00000713,
+  0x00000793, 0x580030ef, 0x0000006f, 0x000087b7, 0x01478793, 0x0007a023,
+  0x0007a223, 0x000087b7, 0x0387a683, 0x000017b7, 0x23478793, 0x0006a703,
+  0x00100513, 0x01075713, 0x00f71863, 0x00300793, 0x00f6a223, 0x00000513,
+  0x00008067, 0x000087b7, 0x0387a783, 0x0007a503, 0x01051513, 0x01055513,
+  0x00008067, 0x000087b7, 0x0387a783, 0x00251513, 0x0047a703, 0x00e56533,
+  0x00a7a223, 0x00008067, 0x000087b7, 0x0387a783, 0x00a51513, 0x0047a703,
+  0x00e56533, 0x00a7a223, 0x00008067, 0x000087b7, 0x0387a783, 0x00a7ac23,
+  0x00008067, 0x000087b7, 0x0387a783, 0x00a7ae23, 0x00008067, 0x000087b7,
+  0x0387a783, 0x02a7a023, 0x00008067, 0x000087b7, 0x0387a783, 0x02b7a423,
+  0x02a7a223, 0x00008067, 0x000087b7, 0x0387a783, 0x00c7a503, 0x00008067,
+  0x000087b7, 0x0387a783, 0x00c7a783, 0x00a7f533, 0x00a03533, 0x00008067,
+  0x000087b7, 0x0387a783, 0x00a7ac23, 0x00a7ae23, 0x00008067, 0xff410113,
+  0x00912023, 0x000084b7, 0x0384a783, 0x00112423, 0x00812223, 0x0087a783,
+  0x0017f793, 0x04078c63, 0x00050413, 0x58c000ef, 0x0384a703, 0x000087b7,
+  0x01478793, 0x01072603, 0x0007a683, 0x00040513, 0x00412403, 0x00c6e6b3,
+  0x00d7a023, 0x01472603, 0x0047a683, 0x00812083, 0x00012483, 0x00c6e6b3,
+  0x00d7a223, 0x00100793, 0x00f72423, 0x00c10113, 0x56c0006f, 0x00812083,
+  0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0xff010113, 0x00912223,
+  0x000084b7, 0x01448493, 0x0004a783, 0x00812423, 0x00112623, 0x00a7f7b3,
+  0x00050413, 0x00000513, 0x02078663, 0x00058513, 0x00b12023, 0x4f4000ef,
+  0x0004a783, 0x00012503, 0xfff44413, 0x00f47433, 0x0084a023, 0x508000ef,
+  0x00100513, 0x00c12083, 0x00812403, 0x00412483, 0x01010113, 0x00008067,
+  0xff010113, 0x00912223, 0x000084b7, 0x01448493, 0x0044a783, 0x00812423,
+  0x00112623, 0x00a7f7b3, 0x00050413, 0x00000513, 0x02078663, 0x00058513,
+  0x00b12023, 0x48c000ef, 0x0044a783, 0x00012503, 0xfff44413, 0x00f47433,
+  0x0084a223, 0x4a0000ef, 0x00100513, 0x00c12083, 0x00812403, 0x00412483,
+  0x01010113, 0x00008067, 0x000087b7, 0x01478793, 0x0007a703, 0xfff54513,
+  0x00e57533, 0x00a7a023, 0x00008067, 0x000087b7, 0x01478793, 0x0047a703,
+  0xfff54513, 0x00e57533, 0x00a7a223, 0x00008067, 0x000087b7, 0x0347a783,
+  0x00300713, 0x00000513, 0x00e7a023, 0x000087b7, 0x00078423, 0x00878793,
+  0x000780a3, 0x00008067, 0x000087b7, 0x0347a783, 0x02051c63, 0x00b7a623,
+  0x00400713, 0x0007a683, 0x00d76733, 0x00e7a023, 0x000087b7, 0x00878793,
+  0x00a78533, 0x00050023, 0x00054783, 0xfe078ee3, 0x00050023, 0x00008067,
+  0x00b7a823, 0x00800713, 0xfcdff06f, 0x000087b7, 0x0347a783, 0x02051663,
+  0x00b7a623, 0x00400713, 0x0007a683, 0x00d76733, 0x00e7a023, 0x000087b7,
+  0x00878793, 0x00f50533, 0x00050023, 0x00008067, 0x00b7a823, 0x00800713,
+  0xfd9ff06f, 0x02050e63, 0x00400693, 0x00800793, 0x00008737, 0x03472703,
+  0xfff7c793, 0x00072603, 0x00c7f7b3, 0x00f72023, 0x000087b7, 0x00878793,
+  0x00d72223, 0x00f50533, 0x00050023, 0x00008067, 0x00200693, 0x00400793,
+  0xfc9ff06f, 0x000087b7, 0x0347a703, 0x00472783, 0x0107f693, 0x00068e63,
+  0x01000693, 0x00d72223, 0x000086b7, 0x00868693, 0x00100613, 0x00c68123,
+  0x0027f693, 0x00068c63, 0x00200693, 0x00d72223, 0x00100613, 0x000086b7,
+  0x00c68423, 0x0047f793, 0x00078e63, 0x00400793, 0x00f72223, 0x000087b7,
+  0x00878793, 0x00100713, 0x00e780a3, 0x00008067, 0x000087b7, 0x00878793,
+  0x00a787b3, 0x0007c703, 0x0ff77513, 0x00070663, 0x00078023, 0x00100513,
+  0x00008067, 0x000087b7, 0x00878793, 0x0027c703, 0x0ff77513, 0x00070663,
+  0x00078123, 0x00100513, 0x00008067, 0x000087b7, 0x0307a783, 0x00100713,
+  0x00000513, 0x00e7a023, 0x00008067, 0x000087b7, 0x0307a783, 0x00a7a023,
+  0x00008067, 0x000087b7, 0x0307a783, 0x00a7a223, 0x00008067, 0x000087b7,
+  0x0307a783, 0x0087a503, 0x00008067, 0x000087b7, 0x0307a783, 0x00a7a423,
+  0x00008067, 0x000087b7, 0x02c7a783, 0x00f00713, 0x00000513, 0x00e7a223,
+  0x00008067, 0x000087b7, 0x02c7a683, 0x00008737, 0x10000793, 0x00f6a623,
+  0x10470713, 0x00000793, 0x00174603, 0x00c7e863, 0x1ff00793, 0x00f6a623,
+  0x00008067, 0x00f70633, 0x00264603, 0x00178793, 0x0ff7f793, 0x0ff67613,
+  0x00c6a623, 0xfd5ff06f, 0x000087b7, 0x02c7a783, 0x00a7aa23, 0x00008067,
+  0x000087b7, 0x02c7a603, 0x10000693, 0x000087b7, 0x01062703, 0x12878793,
+  0x1ff77713, 0x00d71c63, 0x00078023, 0x000780a3, 0x00100793, 0x00f62423,
+  0x00008067, 0x1ff00693, 0x00d71863, 0x00100713, 0x00e78023, 0xfe5ff06f,
+  0x0017c583, 0x0ff77713, 0x00158693, 0x0ff6f693, 0x00d780a3, 0x00b787b3,
+  0x00e78123, 0xfc5ff06f, 0x000087b7, 0x29c78793, 0x00078623, 0x00000513,
+  0x00008067, 0x000087b7, 0x0207a683, 0x00100793, 0x00f6a023, 0x000087b7,
+  0x29c78613, 0x00564583, 0x00464703, 0x00062603, 0x29c78793, 0x00871713,
+  0x00b76733, 0x00061663, 0x00008637, 0x00c76733, 0x00020637, 0x00c76733,
+  0x00e6a423, 0x00010537, 0x00000713, 0x0057c603, 0x00c76c63, 0x0007a603,
+  0x00100713, 0x08e60263, 0x0006a023, 0x00008067, 0x0007a583, 0x00000613,
+  0x00059a63, 0x0087a603, 0x00171593, 0x00b60633, 0x00065603, 0x0057c583,
+  0xfff58593, 0x00b71463, 0x00a66633, 0x00170713, 0x00c6a423, 0x0ff77713,
+  0xfadff06f, 0x0046a603, 0x00267593, 0x00059663, 0x00467613, 0xfe0618e3,
+  0x00c6a583, 0x0087a603, 0x00171513, 0x00170713, 0x00a60633, 0x00b61023,
+  0x0ff77713, 0x0057c603, 0xfcc766e3, 0xf85ff06f, 0x00000713, 0xff1ff06f,
+  0x000087b7, 0x0207a783, 0x0047a783, 0x0017f793, 0x00078a63, 0x000087b7,
+  0x29c78793, 0x00100713, 0x00e78623, 0x00008067, 0x000087b7, 0x01c7a783,
+  0x00100713, 0x00000513, 0x00e7a023, 0x00008067, 0x00100793, 0x00a79533,
+  0x000087b7, 0x01c7a703, 0x0ff57693, 0x0ff57513, 0x00a72223, 0x00472783,
+  0x00f6f7b3, 0xfe078ae3, 0x00008067, 0x000087b7, 0x01c7a703, 0x00100793,
+  0x00a797b3, 0x0ff7f793, 0x00f72423, 0x00008067, 0x000087b7, 0x0247a783,
+  0x00000513, 0x0007a023, 0x000087b7, 0x0e078793, 0x00078ea3, 0x00008067,
+  0x000087b7, 0x0247a683, 0x0046a783, 0x0017f793, 0x00078c63, 0x00100713,
+  0x000087b7, 0x00e6a223, 0x0e078793, 0x00e78ea3, 0x00008067, 0x000087b7,
+  0x0e078793, 0x01d7c703, 0x0ff77513, 0x00070663, 0x00078ea3, 0x00100513,
+  0x00008067, 0xff410113, 0x00812223, 0x00008437, 0x02442783, 0x00112423,
+  0x00912023, 0x00100713, 0x00e7a023, 0x0007a423, 0x0007a423, 0x0007a423,
+  0x0007a423, 0x10000713, 0x00e7a423, 0x10000513, 0xd59ff0ef, 0x000087b7,
+  0x0e078493, 0x0004a703, 0x0084a503, 0x00471713, 0x01055513, 0x00f57513,
+  0x00e56533, 0x02442703, 0x0ff57513, 0x00a72423, 0xd29ff0ef, 0x0084a503,
+  0x02442703, 0x00855513, 0x0ff57693, 0x00d72423, 0x0ff57513, 0xd0dff0ef,
+  0x0084a503, 0x02442703, 0x0ff57693, 0x00d72423, 0x0ff57513, 0xcf5ff0ef,
+  0x00c4c703, 0x04071a63, 0x02442783, 0x10000713, 0x10100513, 0x00e7a423,
+  0xcd9ff0ef, 0x02442403, 0x00042783, 0x00e7e793, 0x00f42023, 0xf11ff0ef,
+  0xfe050ee3, 0x00442503, 0x00812083, 0x00412403, 0x00155513, 0x00154513,
+  0x00012483, 0x00157513, 0x00c10113, 0x00008067, 0x000087b7, 0x0e078793,
+  0x00c7c503, 0x02442703, 0xfff50513, 0x0ff57513, 0x00a72423, 0xc7dff0ef,
+  0x000087b7, 0x0e078793, 0x0007a683, 0x00800713, 0x04e69263, 0x00000493,
+  0x00c7c703, 0x02442603, 0x000086b7, 0xf6e4f6e3, 0x0ed68713, 0x00e48733,
+  0x00074503, 0x00148493, 0x0ff4f493, 0x0ff57513, 0x00a62423, 0xc35ff0ef,
+  0x000087b7, 0x0e078793, 0xfc9ff06f, 0x0007a703, 0xfa070ee3, 0x0007a683,
+  0x00400713, 0xf2e696e3, 0xfadff06f, 0x000025b7, 0xff010113, 0x71058593,
+  0x00000513, 0x00112623, 0x00812423, 0x00912223, 0x9fdff0ef, 0xe39ff0ef,
+  0x06051263, 0xae5ff0ef, 0xfe050ae3, 0x00100693, 0x1300006f, 0x0067d793,
+  0x0a40006f, 0x02472783, 0x00d12023, 0x00c7a503, 0x0ed60793, 0x00f487b3,
+  0x0ff57513, 0x00a78023, 0xbb1ff0ef, 0x00012683, 0x00148493, 0x0ff4f493,
+  0x00008737, 0x00c44783, 0x00008637, 0xfcf4e4e3, 0x0d80006f, 0x00100693,
+  0x0d00006f, 0x00008737, 0x02472783, 0x0047a783, 0x0087f793, 0xf8078ce3,
+  0x10200513, 0xb6dff0ef, 0x00008737, 0x02472783, 0x00008437, 0x00800693,
+  0x00d7a223, 0x0e040613, 0x00c7a783, 0x00062603, 0x0e040413, 0x0ff7f793,
+  0x00d60863, 0x00042603, 0x00900693, 0xf6d610e3, 0x0047d793, 0x00f42223,
+  0x00442783, 0x0037f793, 0x00f42223, 0x00442503, 0x01051513, 0x01055513,
+  0xb11ff0ef, 0x00442683, 0xf6069ee3, 0x00042603, 0x00900793, 0x00008737,
+  0x00f60e63, 0x00042603, 0x00100793, 0x00f60863, 0x00042603, 0x00500793,
+  0x02f61463, 0x02472783, 0x00000493, 0x0047a783, 0x00a7d793, 0x01f7f793,
+  0x00f40623, 0x00c44603, 0x01000793, 0xf2c7f0e3, 0x10300513, 0x00d12023,
+  0xab1ff0ef, 0x00012683, 0x000087b7, 0x0247a783, 0x00c12083, 0x00812403,
+  0x0007a023, 0x00412483, 0x00068513, 0x01010113, 0x00008067, 0xff410113,
+  0x00812223, 0x00912023, 0x00112423, 0x00000413, 0x000084b7, 0xcd9ff0ef,
+  0x02051263, 0xe59ff0ef, 0x02051e63, 0x0e048793, 0x0047a503, 0x00050e63,
+  0x0047a703, 0x00200793, 0x00f71663, 0x00800793, 0x02f41463, 0x00100513,
+  0x00812083, 0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0x00200793,
+  0xfcf51ee3, 0xfe1ff06f, 0x00140413, 0x0ff47413, 0xfa5ff06f, 0x00100713,
+  0x00000793, 0x00e51463, 0x01100793, 0x00008737, 0x02472703, 0x00f72023,
+  0x00008067, 0xff410113, 0x00912023, 0x000084b7, 0x00812223, 0x00112423,
+  0x0e048413, 0x00400793, 0x00f42023, 0x01e44783, 0x0e048493, 0x0ff7f793,
+  0x00f42423, 0x00040623, 0x02045703, 0x00c44783, 0x0ff77713, 0x00178693,
+  0x0ff6f693, 0x00d40623, 0x00f407b3, 0x00e786a3, 0xf15ff0ef, 0x02051263,
+  0x00100793, 0x00f42023, 0x02244783, 0x0ff7f793, 0x00f40623, 0xef9ff0ef,
+  0x00100793, 0x02050263, 0x00100793, 0x00f4a023, 0x01e4c783, 0x0ff7f793,
+  0x00f4a423, 0x00048623, 0xed5ff0ef, 0x00000793, 0x00812083, 0x00412403,
+  0x00100513, 0x00012483, 0x40f50533, 0x00c10113, 0x00008067, 0xff410113,
+  0x00812223, 0x00008437, 0x00112423, 0x0e040413, 0x00900793, 0x00f42023,
+  0x00042423, 0x01000793, 0x00f40623, 0xe89ff0ef, 0x000087b7, 0x25078793,
+  0x04051863, 0x00d44703, 0x0ff77713, 0x00e78023, 0x00e44703, 0x0ff77713,
+  0x00e780a3, 0x00f44703, 0x0ff77713, 0x00e78123, 0x01044703, 0x0ff77713,
+  0x00e781a3, 0x01b44703, 0x0ff77713, 0x00e78223, 0x00812083, 0x00412403,
+  0x00c10113, 0x00008067, 0x00078023, 0x000780a3, 0x00078123, 0x000781a3,
+  0x00078223, 0xfddff06f, 0xff410113, 0x00812223, 0x00008437, 0x00112423,
+  0x0e040413, 0x00900793, 0x00f42023, 0x20000793, 0x00f42423, 0x00500793,
+  0x00f40623, 0xde9ff0ef, 0x000087b7, 0x25078793, 0x04051863, 0x00d44703,
+  0x0ff77713, 0x00e782a3, 0x00e44703, 0x0ff77713, 0x00e78323, 0x00f44703,
+  0x0ff77713, 0x00e783a3, 0x01044703, 0x0ff77713, 0x00e78423, 0x01144703,
+  0x0ff77713, 0x00e784a3, 0x00812083, 0x00412403, 0x00c10113, 0x00008067,
+  0x000782a3, 0x00078323, 0x000783a3, 0x00078423, 0x000784a3, 0xfddff06f,
+  0x000087b7, 0x0e078793, 0x00800713, 0x00e7a023, 0x30000713, 0x00e7a423,
+  0x00078623, 0x00c7c703, 0x00170693, 0x0ff6f693, 0x00d78623, 0x00e78733,
+  0x01200693, 0x00d706a3, 0x00c7c703, 0x00170693, 0x0ff6f693, 0x00d78623,
+  0x00e78733, 0x03400693, 0x00d706a3, 0x00c7c703, 0x00170693, 0x0ff6f693,
+  0x00d78623, 0x00e78733, 0x05600693, 0x00d706a3, 0x00c7c703, 0x00170693,
+  0x0ff6f693, 0x00d78623, 0x00e78733, 0x04d00693, 0x00d706a3, 0x00c7c703,
+  0x00170693, 0x0ff6f693, 0x00d78623, 0x00e78733, 0x04100693, 0x00d706a3,
+  0x00c7c703, 0x00170693, 0x0ff6f693, 0x00d78623, 0x00e78733, 0x05200693,
+  0x00d706a3, 0x00c7c703, 0x00170693, 0x0ff6f693, 0x00d78623, 0x00e78733,
+  0x04300693, 0x00d706a3, 0x00c7c703, 0x00170693, 0x0ff6f693, 0x00d78623,
+  0x00e78733, 0x04f00693, 0x00d706a3, 0x00c7c703, 0x00170693, 0x0ff6f693,
+  0x00d78623, 0x00e78733, 0x04700693, 0x00d706a3, 0x00c7c703, 0x00170693,
+  0x0ff6f693, 0x00d78623, 0x00e78733, 0x01000693, 0x00d706a3, 0x00c7c703,
+  0x00170693, 0x0ff6f693, 0x00d78623, 0x00e78733, 0x00100693, 0x00d706a3,
+  0x00c7c683, 0x00168713, 0x0ff77713, 0x00e78623, 0x00d787b3, 0x000786a3,
+  0xc0dff06f, 0x000087b7, 0x0e078793, 0x00800713, 0x00e7a023, 0x60000713,
+  0x00e7a423, 0x00078623, 0x00c7c683, 0x00153513, 0x00150513, 0x00168713,
+  0x0ff77713, 0x00e78623, 0x00d787b3, 0x00a786a3, 0xbcdff06f, 0x000087b7,
+  0x0e078793, 0x00800713, 0x00e7a023, 0x10700713, 0x00e7a423, 0x00078623,
+  0x00c7c683, 0x00168713, 0x0ff77713, 0x00e78623, 0x00d787b3, 0x000786a3,
+  0xb95ff06f, 0x000087b7, 0x2507c503, 0xfee50513, 0x00153513, 0x00008067,
+  0x000087b7, 0x2507c503, 0xfec50513, 0x00153513, 0x00008067, 0x000087b7,
+  0x25078793, 0x0027c503, 0x00655513, 0x00157513, 0x00008067, 0x000087b7,
+  0x25078793, 0x0037c503, 0x00755513, 0x00008067, 0x000087b7, 0x25078793,
+  0x0027c503, 0x00755513, 0x00008067, 0x000087b7, 0x25078793, 0x0037c503,
+  0x00655513, 0x00157513, 0x00008067, 0x000087b7, 0x25078793, 0x0067c503,
+  0x00455513, 0x00157513, 0x00008067, 0x000087b7, 0x25078793, 0x000086b7,
+  0x0047c783, 0x0806c683, 0x00050713, 0x0ff7f793, 0x02069e63, 0x06400513,
+  0x02070c63, 0x07f7f793, 0xfff78713, 0x0ff77713, 0x00300693, 0x19000513,
+  0x02e6e063, 0x00579513, 0x40f50533, 0x00251513, 0x00f50533, 0x00551513,
+  0x00008067, 0x00a00513, 0x00008067, 0x000087b7, 0x14c78793, 0x10078023,
+  0x00008067, 0xff410113, 0x00912023, 0x000084b7, 0x00812223, 0x00112423,
+  0x14c48793, 0x00008437, 0x10078023, 0x05000713, 0x0e040793, 0x00e78f23,
+  0x02079023, 0x01000713, 0x02e78123, 0x14c48493, 0x0e040413, 0xae1ff0ef,
+  0x06050463, 0x00812083, 0x00412403, 0x00012483, 0x00c10113, 0x00008067,
+  0x02045703, 0x00170693, 0x01069693, 0x0106d693, 0x02d41023, 0x00f406b3,
+  0x00d6c683, 0x00e48733, 0x00178793, 0x0ff6f693, 0x00d70023, 0x0ff7f793,
+  0x02244703, 0xfce7e6e3, 0x02045703, 0x0ff00793, 0xfae7f2e3, 0x00100793,
+  0x10f48023, 0xfa1ff06f, 0x00000793, 0xfddff06f, 0x000087b7, 0x00c78793,
+  0x0007a023, 0x000782a3, 0x00078223, 0x00078323, 0x000087b7, 0x0287a783,
+  0x00300713, 0x00000513, 0x00e7a023, 0x00008067, 0x000087b7, 0x0287a703,
+  0x00072783, 0x0047e793, 0x00f72023, 0x00008067, 0x000087b7, 0x0287a683,
+  0x0046a783, 0x0017f793, 0x06078c63, 0x00100793, 0x00f6a223, 0x0046a583,
+  0x00008737, 0x00008637, 0x0105f593, 0x00c70713, 0x08c60613, 0x00058e63,
+  0x01000593, 0x00b6a223, 0x00f72023, 0x00f70323, 0x00060123, 0x00008067,
+  0x0046a583, 0x0085f593, 0x00058e63, 0x00800593, 0x00b6a223, 0x00f72023,
+  0x00f70223, 0x00f600a3, 0x00008067, 0x00400593, 0x00b6a223, 0x00072023,
+  0x00f702a3, 0x00f60023, 0x00008067, 0x000087b7, 0x00c7a503, 0xfff50513,
+  0x00153513, 0x00008067, 0xff410113, 0x00112423, 0x00812223, 0xae0ff0ef,
+  0x00157793, 0x06078e63, 0x00257793, 0x00050413, 0x00078a63, 0x00100513,
+  0xf4dfe0ef, 0x00200513, 0xaccff0ef, 0x00447793, 0x00078863, 0x9c8ff0ef,
+  0x00400513, 0xab8ff0ef, 0x01047793, 0x00078863, 0xf11ff0ef, 0x01000513,
+  0xaa4ff0ef, 0x02047793, 0x00078863, 0xd2cff0ef, 0x02000513, 0xa90ff0ef,
+  0x04047413, 0x00040e63, 0xb08ff0ef, 0x00412403, 0x00812083, 0x04000513,
+  0x00c10113, 0xa70ff06f, 0x00812083, 0x00412403, 0x00c10113, 0x00008067,
+  0xff410113, 0x000087b7, 0x00112423, 0x00078793, 0x01400713, 0x00e78023,
+  0x00400713, 0x00e780a3, 0x00078123, 0x000781a3, 0x00300713, 0x00e78223,
+  0x00e782a3, 0x00800513, 0x00078323, 0xde1fe0ef, 0x00812083, 0x00800513,
+  0x00c10113, 0xdedfe06f, 0x000087b7, 0x0007c503, 0x00008067, 0x000087b7,
+  0x00078793, 0x0017c503, 0x00008067, 0x000087b7, 0x00a78023, 0x00008067,
+  0x000087b7, 0x00078793, 0x00a780a3, 0x00008067, 0x000087b7, 0x00078793,
+  0x0027c503, 0x00008067, 0x000087b7, 0x00078793, 0x0037c503, 0x00008067,
+  0x000087b7, 0x00078793, 0x0047c503, 0x00008067, 0x000087b7, 0x00078793,
+  0x0057c503, 0x00008067, 0x000087b7, 0x00078793, 0x00a78123, 0x00008067,
+  0x000087b7, 0x00078793, 0x00a781a3, 0x00008067, 0x000087b7, 0x00100713,
+  0x00078793, 0x00e78323, 0x000087b7, 0x08c78793, 0x00e78223, 0x00008067,
+  0xff410113, 0x00812223, 0x00050413, 0x02000513, 0x00912023, 0x00112423,
+  0x00058493, 0xd41fe0ef, 0x000087b7, 0x00078713, 0x00674703, 0x00078793,
+  0x009765b3, 0x00058863, 0x00008737, 0x08c70713, 0x008701a3, 0x00078323,
+  0x00812083, 0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0xff010113,
+  0x00008737, 0x00112623, 0x00070713, 0x00374603, 0x78700793, 0x00f11023,
+  0x00400693, 0x00300793, 0x00d60c63, 0x00374683, 0x00200713, 0x00200793,
+  0x00e68463, 0x00100793, 0x00100713, 0x02e51e63, 0x0047e793, 0x00f11123,
+  0x000087b7, 0x29c78793, 0x01000713, 0x00e78223, 0x0007a023, 0x00200713,
+  0x00e782a3, 0x0027a423, 0x98cff0ef, 0x00c12083, 0x01010113, 0x00008067,
+  0x00200713, 0x00e51663, 0x1007e793, 0xfc1ff06f, 0x00300713, 0x02e51663,
+  0x78f00713, 0x0887e793, 0x00e11023, 0x00f11123, 0x00000513, 0x4f9010ef,
+  0xfa0500e3, 0x00215783, 0x2007e793, 0xf91ff06f, 0x00400713, 0x00e51e63,
+  0x79700713, 0x0907e793, 0x00e11023, 0x00f11123, 0x00100513, 0xfd1ff06f,
+  0x79f00713, 0x00e11023, 0x0807e793, 0xf61ff06f, 0xff410113, 0x02000513,
+  0x00812223, 0x00912023, 0x00008437, 0x00112423, 0xbfdfe0ef, 0x08c40793,
+  0x000782a3, 0x00000493, 0x08c40413, 0x00800513, 0xdb1fe0ef, 0x00100793,
+  0x000403a3, 0x00f402a3, 0x000087b7, 0x08078793, 0x0007c783, 0x3e800593,
+  0x00079663, 0x000185b7, 0x6a058593, 0x00000513, 0xe2dfe0ef, 0x00744783,
+  0x02079863, 0x00000513, 0xf11fe0ef, 0xfe0508e3, 0x00100593, 0x00100513,
+  0xe39ff0ef, 0x00800793, 0x06f48663, 0x00148493, 0x0ff4f493, 0xf99ff06f,
+  0x02000513, 0xb69fe0ef, 0x3e800593, 0x00000513, 0xde5fe0ef, 0x00300593,
+  0x00800513, 0xc5dfe0ef, 0x02051263, 0xec5fe0ef, 0xfe0506e3, 0x00100593,
+  0x00200513, 0xdedff0ef, 0x02000513, 0xb41fe0ef, 0xfadff06f, 0x00000513,
+  0x00812083, 0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0x00100513,
+  0xfe9ff06f, 0x000087b7, 0x00078793, 0x0067c503, 0x00008067, 0x000087b7,
+  0x00078793, 0x0027c603, 0x01400713, 0x0ff67693, 0x02e60463, 0x01e00613,
+  0x00c68a63, 0x00a00713, 0x00100513, 0x00e69e63, 0x00600713, 0x00e78123,
+  0x00000513, 0x00008067, 0x00a00713, 0xff1ff06f, 0x00008067, 0x000087b7,
+  0x00078793, 0x0037c683, 0x000087b7, 0x25078793, 0x0097c703, 0x0ff6f693,
+  0x00100513, 0x00177713, 0x02070663, 0x0077c703, 0x00700613, 0x00777713,
+  0x00c71e63, 0x00200613, 0x00c69c63, 0x0077c503, 0x07057513, 0xf9050513,
+  0x00a03533, 0x00008067, 0x00400613, 0x00000513, 0xfec69ae3, 0x0077c683,
+  0x07000613, 0x00100513, 0x0706f693, 0xfec690e3, 0x0087c683, 0x0076f693,
+  0xfce69ae3, 0x0087c503, 0xfc1ff06f, 0xff410113, 0x000087b7, 0x00112423,
+  0x00078793, 0x0017c703, 0x02000513, 0x0ff77713, 0x00e781a3, 0x0007c703,
+  0x0ff77713, 0x00e78123, 0x000087b7, 0x25078793, 0xf8000713, 0x00e78123,
+  0x9edfe0ef, 0x00000513, 0xcf5ff0ef, 0x00812083, 0x00c10113, 0xc6dff06f,
+  0xff410113, 0x00812223, 0x00008437, 0x00112423, 0x08c40413, 0x000404a3,
+  0x00040523, 0x414010ef, 0x00100793, 0x02051063, 0x00f404a3, 0xc3dff0ef,
+  0x00412403, 0x00812083, 0xfff00513, 0x00c10113, 0xb8dfe06f, 0x00100593,
+  0x00500513, 0x00f40523, 0xc39ff0ef, 0xfddff06f, 0x000087b7, 0x08c78793,
+  0x00078023, 0x000780a3, 0x00078123, 0x000781a3, 0x00078223, 0x000782a3,
+  0x00078323, 0x000783a3, 0x00078423, 0x000784a3, 0x00078523, 0x000785a3,
+  0x00078623, 0x000786a3, 0x00078723, 0x000787a3, 0x00078823, 0x000788a3,
+  0x00078923, 0x000789a3, 0x00078a23, 0x00078aa3, 0x00078b23, 0x00078ba3,
+  0x020786a3, 0x040787a3, 0x04078823, 0x000087b7, 0x12078423, 0x000087b7,
+  0x10078223, 0x00008067, 0xff410113, 0x00008737, 0x00812223, 0x00112423,
+  0x00912023, 0x12870413, 0x00044783, 0x4a078063, 0x12870713, 0x00070023,
+  0x00274603, 0x04200693, 0x0ff67793, 0x2cd60463, 0x06f6e663, 0x000084b7,
+  0x01300693, 0x10448493, 0x02f6ea63, 0x00200693, 0x04f6f263, 0xffd78793,
+  0x0ff7f793, 0x01000693, 0x02f6ea63, 0x000086b7, 0x00279793, 0x03c68693,
+  0x00d787b3, 0x0007a783, 0x00078067, 0x02200713, 0x30e78463, 0x03000713,
+  0x28e78a63, 0x02100713, 0x2ae78863, 0x000087b7, 0x10478793, 0x00078123,
+  0x15c0006f, 0x07100693, 0x46d78063, 0x0af6ea63, 0x06600693, 0x30d78c63,
+  0x04f6e663, 0x000084b7, 0x06000693, 0x10448493, 0x2cd78e63, 0x06100693,
+  0xfcd792e3, 0xd19ff0ef, 0x14050663, 0x000087b7, 0x12878713, 0x00374703,
+  0x000087b7, 0x08c78793, 0x0ff77713, 0x00e78723, 0x00100713, 0x00e786a3,
+  0x1e40006f, 0x07000693, 0xf8d796e3, 0x00374683, 0x00474783, 0x00869693,
+  0x00d7e7b3, 0x00574683, 0x00879793, 0x00f6e7b3, 0x000086b7, 0x08c68613,
+  0x00f62c23, 0x00674783, 0x08c68693, 0x0ff7f793, 0x02f60623, 0x00000613,
+  0x0ff67593, 0x38f5ee63, 0x00100713, 0x00e68a23, 0x36078263, 0x1580006f,
+  0x09000713, 0x34e78463, 0x00008737, 0x09100693, 0x10470713, 0x34d78e63,
+  0x08000693, 0xf0d79ce3, 0x00344683, 0x000087b7, 0x08c78793, 0x0ff6f693,
+  0x02d78723, 0x000086b7, 0x14c68693, 0x1006c683, 0x3a068463, 0x00100693,
+  0x00d70123, 0x02d786a3, 0x04c0006f, 0x00100793, 0x000085b7, 0x00f48123,
+  0x08058593, 0x00000793, 0x00800513, 0x00078693, 0x00178793, 0x00f70633,
+  0x00264603, 0x00d586b3, 0x0ff67613, 0x00c68123, 0xfea792e3, 0x7e0010ef,
+  0x00051663, 0x00100513, 0x9c5fe0ef, 0x00100793, 0x0b40006f, 0x00374683,
+  0x00474503, 0x00100793, 0x00f48123, 0x0ff6f613, 0x0ff57513, 0x00068863,
+  0x00f60a63, 0x00048123, 0xfd5ff06f, 0x8e1ff0ef, 0xfcdff06f, 0x8e5ff0ef,
+  0xfc5ff06f, 0x00500793, 0x00f48123, 0xe60fe0ef, 0x00855793, 0x0ff7f793,
+  0x00f481a3, 0x0ff57513, 0x00200793, 0x00a48223, 0x00f482a3, 0x00048323,
+  0x000483a3, 0xeccfe0ef, 0x0ff57513, 0x00a48423, 0xf74ff0ef, 0x00a484a3,
+  0xb6dff0ef, 0x00a48523, 0x8b1ff0ef, 0x00a485a3, 0x899ff0ef, 0x00a48623,
+  0x00000513, 0x6e8010ef, 0x00a486a3, 0x00100513, 0x6dc010ef, 0x00a48723,
+  0x00d00793, 0x00008737, 0x10470713, 0x00f700a3, 0x00412403, 0x00812083,
+  0x00012483, 0x00c10113, 0xa55fe06f, 0x000087b7, 0x00100713, 0x08078793,
+  0x00e780a3, 0x00e48123, 0xf15ff06f, 0xe5cff0ef, 0x00100793, 0x00f48123,
+  0xf05ff06f, 0x000087b7, 0x08c78793, 0x00100713, 0x00e783a3, 0x000087b7,
+  0x10478793, 0x00e78123, 0xee5ff06f, 0xed0ff0ef, 0xf00502e3, 0x00344503,
+  0xfe4ff0ef, 0x000087b7, 0x00100713, 0x08c78793, 0x00e78423, 0xfa9ff06f,
+  0x00344703, 0x000087b7, 0x25c78793, 0x0ff77713, 0x00e78023, 0x00444703,
+  0x0ff77713, 0x00e780a3, 0x00544703, 0x0ff77713, 0x00e78123, 0xe80ff0ef,
+  0xea050ae3, 0x000087b7, 0x00100713, 0x08c78793, 0x00e785a3, 0xf61ff06f,
+  0x00344703, 0x00100793, 0x00100513, 0x00f70463, 0x00000513, 0xfc9fe0ef,
+  0xf51ff06f, 0xa49ff0ef, 0xe6050ee3, 0x00344703, 0x000087b7, 0x08c78793,
+  0x0ff77713, 0x00e78723, 0x00100713, 0x00e78623, 0xf1dff06f, 0x00344603,
+  0x00444783, 0x00544683, 0x00161713, 0x00879793, 0x00f6e6b3, 0x00c70733,
+  0x000087b7, 0x00371713, 0x26c78793, 0x00e787b3, 0x00d79223, 0x00644683,
+  0x00744703, 0x00869693, 0x00d76733, 0x00e79323, 0x00844683, 0x00944703,
+  0x00869693, 0x00d76733, 0x00e79423, 0x00a44683, 0x00b44703, 0x00869693,
+  0x00d76733, 0x00e79523, 0x00c44683, 0x00d44703, 0x00869693, 0x00d76733,
+  0x00e79623, 0x00e44683, 0x00f44703, 0x00869693, 0x00d76733, 0x00e79723,
+  0x01044683, 0x01144703, 0x00869693, 0x00d76733, 0x00e79823, 0x01244683,
+  0x01344703, 0x00869693, 0x00d76733, 0x00e79923, 0x01444683, 0x01544703,
+  0x00871713, 0x00d76733, 0x00e79a23, 0x000087b7, 0x10478793, 0x00100713,
+  0xe6dff06f, 0x000087b7, 0x08c78793, 0x00100713, 0x00e788a3, 0x00812083,
+  0x00412403, 0x00012483, 0x00c10113, 0x00008067, 0x000087b7, 0x00100693,
+  0x08c78793, 0x00d78923, 0x00d70123, 0xd19ff06f, 0x00560593, 0x00b705b3,
+  0x0025c583, 0x00c68533, 0x00160613, 0x0ff5f593, 0x00b50e23, 0xc45ff06f,
+  0x00344703, 0x00444783, 0x00100693, 0x00871713, 0x00e7e7b3, 0x00544703,
+  0x00879793, 0x00f767b3, 0x00008737, 0x08c70713, 0x00f72c23, 0x00644783,
+  0x0ff7f793, 0x02f70623, 0x00d70aa3, 0xc15ff06f, 0x00070123, 0xcb1ff06f,
+  0x000087b7, 0x08c78793, 0x04f7c703, 0x00e78733, 0x02a707a3, 0x04f7c683,
+  0x01f00713, 0x00d77663, 0x040787a3, 0x00008067, 0x04f7c703, 0x00170713,
+  0x0ff77713, 0x04e787a3, 0x00008067, 0x000087b7, 0x08c78793, 0x0507c703,
+  0x00e78733, 0x02f74503, 0x0507c683, 0x01f00713, 0x0ff57513, 0x00d77663,
+  0x04078823, 0x00008067, 0x0507c703, 0x00170713, 0x0ff77713, 0x04e78823,
+  0x00008067, 0x000087b7, 0x08c78793, 0x0507c503, 0x04f7c783, 0x40f50533,
+  0x00a03533, 0x00008067, 0xff410113, 0x00112423, 0x00812223, 0xfd9ff0ef,
+  0x02050263, 0x00008437, 0x10440413, 0x00200793, 0x00f40123, 0xf81ff0ef,
+  0x00a401a3, 0x00200713, 0x1100006f, 0x000087b7, 0x08c78713, 0x00074683,
+  0x08c78793, 0x02068063, 0x000087b7, 0x00070023, 0x10478793, 0x01000713,
+  0x00e78123, 0x00100713, 0x0e00006f, 0x00174683, 0x00068c63, 0x000087b7,
+  0x000700a3, 0x10478793, 0x01100713, 0xfddff06f, 0x00274683, 0x00068c63,
+  0x000087b7, 0x00070123, 0x10478793, 0x01200713, 0xfc1ff06f, 0x00974683,
+  0x00068c63, 0x000087b7, 0x000704a3, 0x10478793, 0x03100713, 0xfa5ff06f,
+  0x00a74683, 0x00068c63, 0x000087b7, 0x00070523, 0x10478793, 0x03200713,
+  0xf89ff06f, 0x00574683, 0x02068263, 0x000702a3, 0x00008437, 0x000703a3,
+  0x10440413, 0x04000793, 0x00f40123, 0xc4cff0ef, 0xf31ff06f, 0x00674683,
+  0x04068e63, 0x00070323, 0x000087b7, 0x000703a3, 0x10478793, 0x04100713,
+  0x00e78123, 0x00008737, 0x25c70713, 0x00174683, 0x0ff6f693, 0x00d781a3,
+  0x00274703, 0x0ff77713, 0x00e78223, 0x00300713, 0x000087b7, 0x10478793,
+  0x00e780a3, 0x00412403, 0x00812083, 0x00c10113, 0xde4fe06f, 0x00374683,
+  0x02068463, 0x000087b7, 0x10478793, 0x04500693, 0x00d78123, 0x00374683,
+  0x0ff6f693, 0x00d781a3, 0x000701a3, 0xea9ff06f, 0x0047c703, 0x02070663,
+  0x00008437, 0x00078223, 0x10440413, 0x04400793, 0x00f40123, 0xbacff0ef,
+  0x00a401a3, 0xb94ff0ef, 0x00a40223, 0xf89ff06f, 0x00f7c703, 0x02070463,
+  0x00008737, 0x10470713, 0x06200693, 0x00d70123, 0x00e7c683, 0x0ff6f693,
+  0x00d701a3, 0x000787a3, 0xe4dff06f, 0x0107c703, 0x02070a63, 0x00008737,
+  0x10470713, 0x06300693, 0x00d70123, 0x00e7c683, 0x0ff6f693, 0x00d701a3,
+  0x0107c683, 0x0ff6f693, 0x00d70223, 0x00078823, 0xf25ff06f, 0x0137c703,
+  0x0ff77693, 0x02070263, 0x000789a3, 0x000087b7, 0x10478793, 0x00100713,
+  0x00e78123, 0x00300713, 0x00e781a3, 0xde9ff06f, 0x0167c703, 0x06070a63,
+  0x00008637, 0x10460713, 0x00078b23, 0x00100593, 0x00b70123, 0x02c7c703,
+  0x10460613, 0xde0708e3, 0x02c7c703, 0x0ff77713, 0x00e601a3, 0x02c7c583,
+  0x00268713, 0x0ff77713, 0x00b6ec63, 0xea071ae3, 0x00812083, 0x00412403,
+  0x00c10113, 0x00008067, 0x00d785b3, 0x01c5c583, 0x00e60733, 0x00168693,
+  0x0ff5f593, 0x00b70123, 0x0ff6f693, 0xfc1ff06f, 0x0177c703, 0x00070c63,
+  0x00078ba3, 0x000087b7, 0x10478793, 0x00078123, 0xd85ff06f, 0x02d7c703,
+  0xfa0708e3, 0x02e7c703, 0x00008637, 0x020786a3, 0xf8100693, 0x10460793,
+  0x00471713, 0x00d78123, 0x000085b7, 0xfff70793, 0x00100693, 0x10460613,
+  0x0ff7f793, 0x14c58593, 0x01100513, 0x00d78733, 0x0ff77713, 0x00e58733,
+  0x00074703, 0x00d60333, 0x00168693, 0x0ff77713, 0x00e30123, 0xfea690e3,
+  0x01100713, 0xdfdff06f, 0x000087b7, 0x0007a737, 0x25c78793, 0x12070713,
+  0x00e7a423, 0x00078023, 0x00300713, 0x00e780a3, 0x00e78123, 0x000781a3,
+  0x00078223, 0x000782a3, 0x00078623, 0x00008067, 0x000087b7, 0x0e078793,
+  0x00800713, 0x00e7a023, 0x10200713, 0x00e7a423, 0x00078623, 0x00c7c683,
+  0x00168713, 0x0ff77713, 0x00e78623, 0x00d787b3, 0x000786a3, 0x951fe06f,
+  0x000087b7, 0x25c78713, 0x00174503, 0x00274683, 0x00374703, 0x25c78793,
+  0x00369693, 0x00d56533, 0x0ff57513, 0x00070463, 0x00456513, 0x0047c783,
+  0x00078463, 0x02056513, 0x00008067, 0xeec10113, 0x10812623, 0x00050413,
+  0x00200513, 0x10112823, 0x10912423, 0x00b12223, 0xf51fd0ef, 0x00100793,
+  0x00011423, 0x10f41c63, 0x004a07b7, 0x04a00713, 0x04a78793, 0x00e11523,
+  0x00f12623, 0x00e11823, 0x00500693, 0x000087b7, 0x29c78793, 0x01100713,
+  0x00e78223, 0x0007a023, 0x00d782a3, 0x00810713, 0x00e7a423, 0xbb8fe0ef,
+  0x00412783, 0x0a078c63, 0x000084b7, 0x0e048793, 0x00800713, 0x00e7a023,
+  0x10200713, 0x00e7a423, 0x00078623, 0x00400793, 0x0e048493, 0x00700693,
+  0x00f40463, 0x02046693, 0x00c4c783, 0x00178713, 0x0ff77713, 0x00e48623,
+  0x00f487b3, 0x00d786a3, 0xf09ff0ef, 0x00c4c783, 0x00178713, 0x0ff77713,
+  0x00e48623, 0x00f487b3, 0x00a786a3, 0x00c4c783, 0x00178713, 0x0ff77713,
+  0x00e48623, 0x00f487b3, 0x00a786a3, 0x00c4c783, 0x00178713, 0x0ff77713,
+  0x00e48623, 0x00f487b3, 0x00a786a3, 0x00c4c703, 0x00170793, 0x0ff7f793,
+  0x00f48623, 0x00e484b3, 0x00a486a3, 0xff0fe0ef, 0x00a12023, 0x11012083,
+  0x10c12403, 0x00012503, 0x10812483, 0x11410113, 0x00008067, 0x00a03533,
+  0x00200493, 0x00150513, 0x06941063, 0x004a07b7, 0x07bc0737, 0x0cb78593,
+  0x5bc00313, 0x04a78793, 0x0cb70713, 0x04a00613, 0x00611523, 0x00e12623,
+  0x00b12823, 0x00f12a23, 0x00f12c23, 0x00c11e23, 0x00b00693, 0xec8510e3,
+  0x00611f23, 0x02e12023, 0x02b12223, 0x02f12423, 0x02f12623, 0x02c11823,
+  0x01500693, 0xea1ff06f, 0x00300793, 0xeaf41ee3, 0x05bc0637, 0x044a0737,
+  0x047e07b7, 0x7bc60393, 0x7bc70293, 0x7bc78313, 0x44a70713, 0x67e78793,
+  0x5bc00093, 0x44a60613, 0x67e00593, 0x00111523, 0x00712623, 0x00512823,
+  0x00e12a23, 0x00e12c23, 0x00e12e23, 0x02c12023, 0x02612223, 0x02f12423,
+  0x02f12623, 0x02f12823, 0x02f12a23, 0x02f12c23, 0x02f12e23, 0x04f12023,
+  0x04f12223, 0x04f12423, 0x04b11623, 0x02300693, 0xe0951ee3, 0x04111723,
+  0x04712823, 0x04512a23, 0x04e12c23, 0x04e12e23, 0x06e12023, 0x06c12223,
+  0x06612423, 0x06f12623, 0x06f12823, 0x06f12a23, 0x06f12c23, 0x06f12e23,
+  0x08f12023, 0x08f12223, 0x08f12423, 0x08f12623, 0x08b11823, 0x04500693,
+  0xdcdff06f, 0xff410113, 0x00112423, 0x00812223, 0x00912023, 0x00008437,
+  0xec9fe0ef, 0x0e040413, 0x00800793, 0x00f42023, 0x10300793, 0x00f42423,
+  0x00050493, 0x00040623, 0xd11ff0ef, 0x00c44703, 0x00170693, 0x0ff6f693,
+  0x00e40733, 0x00d40623, 0x00a706a3, 0x00200713, 0x02e49863, 0x00c44703,
+  0x00170693, 0x0ff6f693, 0x00d40623, 0x00e40733, 0x00a706a3, 0x00412403,
+  0x00812083, 0x00012483, 0x00c10113, 0xe10fe06f, 0x00400713, 0xfee494e3,
+  0x00c44703, 0x00170693, 0x0ff6f693, 0x00d40623, 0x00e40733, 0x00a706a3,
+  0x00c44703, 0x00170693, 0x0ff6f693, 0x00d40623, 0x00e40733, 0x00a706a3,
+  0x00c44683, 0x00168713, 0x0ff77713, 0x00e40623, 0x00d40433, 0x00a406a3,
+  0xf9dff06f, 0xff010113, 0x00812423, 0x00912223, 0x00112623, 0x00050493,
+  0x00008437, 0xdedfe0ef, 0x0e040793, 0x00900713, 0x00e7a023, 0x20200713,
+  0x00e7a423, 0x00200613, 0x00a12023, 0x00c78623, 0xd7cfe0ef, 0x12051263,
+  0x0e040413, 0x00d44783, 0x00903333, 0x00008737, 0x0017f793, 0x00012683,
+  0x00130313, 0x25c70713, 0x00200613, 0x04078063, 0x04c68463, 0x00400613,
+  0x04c69e63, 0x00000613, 0x00d44283, 0x00479593, 0x00b2f2b3, 0x00559e63,
+  0x00e44283, 0x00f2f2b3, 0x00f29863, 0x00e44783, 0x00b7f7b3, 0x0240006f,
+  0x0c061a63, 0x00070623, 0x00100513, 0x0280006f, 0x00000613, 0x00d44583,
+  0x00479793, 0x00f5f5b3, 0xfeb790e3, 0x04061463, 0xfc051ee3, 0x00100793,
+  0x00f70623, 0x00100793, 0x04f30063, 0x00d44783, 0x00600613, 0x0067f793,
+  0x08c79663, 0x00200613, 0x00c68a63, 0x00400613, 0x00c69a63, 0x00100613,
+  0xf79ff06f, 0x00100613, 0xfadff06f, 0x06051463, 0x00100793, 0x00f706a3,
+  0x00d74783, 0xfff48493, 0x0014b493, 0x00f4f4b3, 0x02048c63, 0x00900793,
+  0x00f42023, 0x20400793, 0x00f42423, 0x00100793, 0x00f40623, 0xc70fe0ef,
+  0x00d44783, 0x0ff7f793, 0x00051863, 0x0017f793, 0x00079463, 0x00100513,
+  0x00c12083, 0x00812403, 0x00412483, 0x01010113, 0x00008067, 0x000706a3,
+  0x00100513, 0xf9dff06f, 0xfec10113, 0x00112823, 0x00812623, 0x00912423,
+  0xc71fe0ef, 0x00a12223, 0xc79fe0ef, 0x00050493, 0x00008437, 0xc7dfe0ef,
+  0x0e040413, 0x00900713, 0x00e42023, 0x20600713, 0x00e42423, 0x00200693,
+  0x00a12023, 0x00d40623, 0xbecfe0ef, 0x10051e63, 0x00d44383, 0x00d44703,
+  0x00412783, 0x00200693, 0x00275713, 0x0033f393, 0x00377293, 0x02d79663,
+  0x00d44703, 0x00d44683, 0x00475713, 0x00377713, 0x0066d693, 0x00000413,
+  0x00000613, 0x00000593, 0x00000313, 0x0480006f, 0x00400713, 0x0ee79063,
+  0x00d44703, 0x00d44683, 0x00e44303, 0x00e44603, 0x00e44583, 0x00e44403,
+  0x00475713, 0x00265613, 0x0045d593, 0x00377713, 0x0066d693, 0x00337313,
+  0x00367613, 0x0035f593, 0x00645413, 0x0ff37793, 0x00b37463, 0x0ff5f793,
+  0x0ff7f593, 0x0075f463, 0x0ff3f793, 0x0ff7f593, 0x00e5f463, 0x0ff77793,
+  0x00008737, 0x25c70713, 0x0897e063, 0x00100793, 0x00f701a3, 0x00174783,
+  0x06979e63, 0x00574783, 0x00178793, 0x0ff7f793, 0x00f702a3, 0x0ff67793,
+  0x00867463, 0x0ff47793, 0x0ff7f613, 0x00567463, 0x0ff2f793, 0x0ff7f613,
+  0x00d67463, 0x0ff6f793, 0x00012683, 0x04d7e663, 0x00100793, 0x00f70223,
+  0x00012783, 0x00f70123, 0x01012083, 0x00c12403, 0x00812483, 0x01410113,
+  0x00008067, 0x00000693, 0x00000713, 0xf01ff06f, 0x000701a3, 0x00078493,
+  0xf85ff06f, 0x000702a3, 0x009700a3, 0xf91ff06f, 0x00070223, 0x00f12023,
+  0xfb9ff06f, 0xff410113, 0x00812223, 0x00008437, 0x08c40793, 0x00112423,
+  0x000783a3, 0x00100713, 0x3e800593, 0x00000513, 0x00e78323, 0x08c40413,
+  0xaedfd0ef, 0x00744783, 0x00000513, 0x00079863, 0xbd1fd0ef, 0xfe0508e3,
+  0x00100513, 0x00812083, 0x00412403, 0x00c10113, 0x00008067, 0xff410113,
+  0x02000513, 0x00112423, 0x82dfd0ef, 0x3e800593, 0x00000513, 0xa5dfd0ef,
+  0x00400513, 0xa9dfe0ef, 0x00100513, 0xb21fe0ef, 0x000087b7, 0x25c7c503,
+  0x00000593, 0x8e9ff0ef, 0x00812083, 0x00c10113, 0xf65ff06f, 0xff010113,
+  0x00812423, 0x00008437, 0x25040793, 0x00112623, 0x00912223, 0x0017c483,
+  0x9d1fe0ef, 0x25040413, 0x0ff4f493, 0x12a4f863, 0x00144503, 0xa35fe0ef,
+  0x00244483, 0x9c1fe0ef, 0x0ff4f493, 0x0074f493, 0x10a4fe63, 0x00244503,
+  0x00757513, 0xa25fe0ef, 0x00008437, 0xb95fe0ef, 0x0c051263, 0x000084b7,
+  0x0e048793, 0x00800713, 0x00e7a023, 0x10000713, 0x00e7a423, 0x00078623,
+  0x00c7c703, 0x0ff77693, 0x00170713, 0x0ff77713, 0x00e78623, 0x00d12023,
+  0x991fe0ef, 0x00012683, 0x0e048793, 0x00d787b3, 0x00a786a3, 0x98dfe0ef,
+  0x00a12023, 0xdfcfe0ef, 0x00012703, 0x0e048793, 0x00050663, 0xf8076713,
+  0x0ff77713, 0x00c7c603, 0x00160693, 0x0ff6f693, 0x00d78623, 0x00c787b3,
+  0x00e786a3, 0x908fe0ef, 0x02051e63, 0x25c40793, 0x000780a3, 0x00078123,
+  0x000782a3, 0x000781a3, 0x00078223, 0xe61ff0ef, 0x00100513, 0x9f9fe0ef,
+  0x00100593, 0x00100513, 0xfc4ff0ef, 0x25c40493, 0x06050463, 0x00000493,
+  0xf40ff0ef, 0x00050413, 0x00051663, 0x00100413, 0x40940433, 0x00000513,
+  0x9c5fe0ef, 0x00c12083, 0x00040513, 0x00812403, 0x00412483, 0x01010113,
+  0x00008067, 0x895fe0ef, 0xed5ff06f, 0x899fe0ef, 0xeedff06f, 0xd30fe0ef,
+  0x04051e63, 0xd10fe0ef, 0x00100593, 0x0a050863, 0x00300513, 0x0580006f,
+  0x00000513, 0xd68fe0ef, 0x00050593, 0x00000513, 0x899fd0ef, 0x00000513,
+  0xa95ff0ef, 0x00a12023, 0xc11ff0ef, 0x00012783, 0xfa078ee3, 0x0054c703,
+  0x00500793, 0x06f70c63, 0xda5ff0ef, 0x999ff0ef, 0xfc1ff06f, 0x00200513,
+  0x935fe0ef, 0x00100593, 0x00400513, 0xf00ff0ef, 0x00000493, 0x00100513,
+  0xd0cfe0ef, 0x00050593, 0x00000513, 0x83dfd0ef, 0x00100513, 0xa39ff0ef,
+  0x00a12023, 0xbb5ff0ef, 0x00012783, 0x02078e63, 0x00600793, 0x02f48063,
+  0x00148493, 0x0ff4f493, 0xd45ff0ef, 0x939ff0ef, 0xfbdff06f, 0x00200513,
+  0xfadff06f, 0xe34ff0ef, 0xee0516e3, 0xac1fe0ef, 0xe0050ee3, 0xee1ff06f,
+  0x00100493, 0xeddff06f, 0xff410113, 0x00000513, 0x00112423, 0xb88fe0ef,
+  0x00050a63, 0x00100513, 0x00812083, 0x00c10113, 0x00008067, 0x8c8fe0ef,
+  0xfe0516e3, 0xba8fe0ef, 0xfe0512e3, 0x00100513, 0xb5cfe0ef, 0xfc051ce3,
+  0xd75ff0ef, 0x00a03533, 0xfd1ff06f, 0xff410113, 0x000087b7, 0x00112423,
+  0x26c78793, 0x00078b23, 0x01000513, 0x02078723, 0xd04fd0ef, 0x00812083,
+  0x01000513, 0x00c10113, 0xd10fd06f, 0xf7410113, 0x08812223, 0x08112423,
+  0x00050413, 0xf5cfe0ef, 0x015c06b7, 0x00400793, 0x15c68693, 0x1af51a63,
+  0x00d12023, 0x00d12223, 0x00d12423, 0x00d12623, 0x00010793, 0x01810713,
+  0x00079823, 0x00278793, 0xfee79ce3, 0x00141713, 0x000087b7, 0x00870733,
+  0x00371713, 0x26c78793, 0x00e787b3, 0x0047d703, 0x1fd00593, 0x1fd00613,
+  0x00875713, 0x02e11423, 0x0067d703, 0x1fd00693, 0x00875713, 0x02e11523,
+  0x0087d703, 0x02011723, 0x00875713, 0x02e11623, 0x0047d703, 0x0ff77713,
+  0x02e11823, 0x0067d703, 0x0ff77713, 0x02e11923, 0x0087d703, 0x0ff77713,
+  0x02e11a23, 0x08000713, 0x02e11b23, 0x00c7d703, 0x00875713, 0x02e11c23,
+  0x00e7d703, 0x00875713, 0x02e11d23, 0x0107d703, 0x02011f23, 0x00875713,
+  0x02e11e23, 0x00c7d703, 0x0ff77713, 0x04e11023, 0x00e7d703, 0x0ff77713,
+  0x04e11123, 0x0107d703, 0x0ff77713, 0x04e11223, 0x0147d703, 0x0ff77713,
+  0x04e11323, 0x00a7d703, 0x00875713, 0x04e11423, 0x0127d703, 0x00875713,
+  0x04e11523, 0x04011623, 0x0147d703, 0x00875713, 0x04e11723, 0x00a7d703,
+  0x0ff77713, 0x04e11823, 0x0127d783, 0x1fd00713, 0x0ff7f793, 0x04e11f23,
+  0x04f11923, 0x04012a23, 0x04b11c23, 0x04c11d23, 0x04d11e23, 0x03000713,
+  0x000087b7, 0x29c78793, 0x2c041663, 0x01200693, 0x00d78223, 0x0007a023,
+  0x00e782a3, 0x0027a423, 0x89dfd0ef, 0x00300513, 0xe9cfe0ef, 0x000087b7,
+  0x08c78713, 0x00870723, 0x00100693, 0x00d707a3, 0x08c78793, 0x00100713,
+  0x00f7c683, 0xfee68ee3, 0x08812083, 0x08412403, 0x08c10113, 0x00008067,
+  0x000087b7, 0x00200613, 0x00d12023, 0x26c78793, 0x00141713, 0x12c50663,
+  0x00870733, 0x00371713, 0x00e787b3, 0x00012223, 0x00011423, 0x0047d703,
+  0x00875713, 0x00e11523, 0x0047d703, 0x0ff77713, 0x00e11623, 0x00c7d703,
+  0x00875713, 0x00e11723, 0x00c7d703, 0x0ff77713, 0x00e11823, 0x00a7d703,
+  0x00875713, 0x00e11923, 0x00a7d703, 0x00011b23, 0x00012c23, 0x0ff77713,
+  0x00e11a23, 0x0067d703, 0x00875713, 0x00e11e23, 0x0067d703, 0x0ff77713,
+  0x00e11f23, 0x00e7d703, 0x00875713, 0x02e11023, 0x00e7d703, 0x0ff77713,
+  0x02e11123, 0x0127d703, 0x00875713, 0x02e11223, 0x0127d703, 0x02012423,
+  0x02011623, 0x0ff77713, 0x02e11323, 0x0087d703, 0x00875713, 0x02e11723,
+  0x0087d703, 0x0ff77713, 0x02e11823, 0x0107d703, 0x00875713, 0x02e11923,
+  0x0107d703, 0x02011b23, 0x02012c23, 0x0ff77713, 0x02e11a23, 0x00800737,
+  0x02012e23, 0x04e12023, 0x04011223, 0x0147d703, 0x0ff77713, 0x04e11323,
+  0x0147d783, 0x02700713, 0x04011523, 0x0087d793, 0x04f11423, 0x1fd00793,
+  0x04f11623, 0xe65ff06f, 0x00870733, 0x00371713, 0x00e787b3, 0x00d12223,
+  0x00012423, 0x00012623, 0x00012823, 0x0047d703, 0x00000593, 0x00000613,
+  0x00875713, 0x00e11a23, 0x0067d703, 0x00000693, 0x00875713, 0x00e11b23,
+  0x0047d703, 0x0ff77713, 0x00e11c23, 0x0067d703, 0x0ff77713, 0x00e11d23,
+  0x00c7d703, 0x00875713, 0x00e11e23, 0x00e7d703, 0x00875713, 0x00e11f23,
+  0x00c7d703, 0x0ff77713, 0x02e11023, 0x00e7d703, 0x0ff77713, 0x02e11123,
+  0x00a7d703, 0x00875713, 0x02e11223, 0x0127d703, 0x00875713, 0x02e11323,
+  0x00a7d703, 0x0ff77713, 0x02e11423, 0x0127d703, 0x02012623, 0x02012823,
+  0x0ff77713, 0x02e11523, 0x02012a23, 0x0087d703, 0x00875713, 0x02e11c23,
+  0x02011d23, 0x0087d703, 0x0ff77713, 0x02e11e23, 0x08000713, 0x02e11f23,
+  0x0107d703, 0x04011123, 0x00875713, 0x04e11023, 0x0107d703, 0x0ff77713,
+  0x04e11223, 0x0147d703, 0x04011423, 0x0ff77713, 0x04e11323, 0x0147d783,
+  0x00000713, 0x04012623, 0x0087d793, 0x04f11523, 0x1fd00793, 0x04f11823,
+  0xd15ff06f, 0x01300693, 0x00d78223, 0x0007a023, 0x00e782a3, 0x0027a423,
+  0xdd4fd0ef, 0x00400513, 0xd39ff06f, 0x00000513, 0xbccfe06f, 0xff010113,
+  0x00812423, 0x00112623, 0x00912223, 0x00050413, 0x06050c63, 0x08000793,
+  0x02000493, 0x00048513, 0x00f12023, 0xa6cfd0ef, 0x00012783, 0x00078513,
+  0x884fd0ef, 0x06400593, 0x00000513, 0xb00fd0ef, 0x00200593, 0x00048513,
+  0x978fd0ef, 0x04050463, 0x00141713, 0x000087b7, 0x00870733, 0x00371713,
+  0x26c78793, 0x00e787b3, 0x00100713, 0x00e78b23, 0x00000513, 0x00c12083,
+  0x00812403, 0x00412483, 0x01010113, 0x00008067, 0x04000793, 0x01000493,
+  0xf8dff06f, 0xb9cfd0ef, 0xfa0504e3, 0x00000513, 0xb24fe0ef, 0x00100513,
+  0xfcdff06f, 0xff010113, 0x00812423, 0x00912223, 0x00050413, 0x00112623,
+  0x00058493, 0x08000513, 0x00041463, 0x04000513, 0x00c12023, 0xff1fc0ef,
+  0x00141713, 0x000087b7, 0x008705b3, 0x26c78693, 0x00359593, 0x00b686b3,
+  0x0166c683, 0x00012603, 0x26c78793, 0x00c6e633, 0x02060063, 0x000086b7,
+  0x08c68613, 0x00860723, 0x00960823, 0x08c68693, 0x0106c603, 0xfe061ee3,
+  0x00870733, 0x00371713, 0x00e787b3, 0x00078b23, 0x00c12083, 0x00812403,
+  0x00412483, 0x01010113, 0x00008067, 0x00151713, 0x00a70733, 0x000087b7,
+  0x00371713, 0x26c78793, 0x00e787b3, 0x0167c503, 0x00008067, 0x00151713,
+  0x00a70733, 0x000087b7, 0x00371713, 0x26c78793, 0x00e787b3, 0x0147d503,
+  0x00655513, 0x00157513, 0x00008067, 0x00008737, 0x00000693, 0x00000793,
+  0x08070713, 0x00700613, 0x00d705b3, 0x0025c583, 0x00168693, 0x00f5c7b3,
+  0xfec698e3, 0x00974703, 0x00178513, 0x0ff57513, 0x40e50533, 0x00a03533,
+  0x00008067, 0xff410113, 0x00100513, 0x00112423, 0xf31fc0ef, 0x000087b7,
+  0x08078793, 0x00050c63, 0x00100713, 0x00e78023, 0x00812083, 0x00c10113,
+  0x00008067, 0x00078023, 0xff1ff06f, 0x0000c7b7, 0x10078693, 0x00008737,
+  0x02d72c23, 0x20078693, 0x00008737, 0x02d72a23, 0x30078693, 0x00008737,
+  0x02d72823, 0x40078693, 0x00008737, 0x02d72623, 0x50078693, 0x00008737,
+  0x02d72423, 0x60078693, 0x00008737, 0xff410113, 0x02d72223, 0x70078793,
+  0x00008737, 0x00812223, 0x02f72023, 0x00008437, 0x0000d7b7, 0x80078793,
+  0x00112423, 0x00008737, 0x00912023, 0x08040493, 0x00f72e23, 0x000480a3,
+  0xd9dfc0ef, 0xf41ff0ef, 0x838fd0ef, 0xc9cfd0ef, 0xb10fd0ef, 0xa30fd0ef,
+  0xe39fd0ef, 0xc2cfd0ef, 0xfb9fd0ef, 0x8b1ff0ef, 0xe41fe0ef, 0xc84fe0ef,
+  0x00100513, 0xdf9fc0ef, 0x00200513, 0xdf1fc0ef, 0xd693a5b7, 0x40058593,
+  0x00100513, 0x868fd0ef, 0x00100793, 0x00f48523, 0x08040413, 0x000086b7,
+  0x00c68793, 0x0057c703, 0x00c68493, 0x04070263, 0x00400513, 0x000482a3,
+  0xdc5fc0ef, 0x00000593, 0x00600513, 0x85cfe0ef, 0x00000613, 0x00300593,
+  0x00000513, 0xd91ff0ef, 0x00000613, 0x00300593, 0x00100513, 0xd81ff0ef,
+  0x00040c23, 0x00040ca3, 0x00144703, 0x04070e63, 0x0044c703, 0x00070863,
+  0x00400513, 0x00048223, 0xd65fc0ef, 0x0064c703, 0x02070263, 0x00048323,
+  0x939fd0ef, 0xaa0fe0ef, 0x00050a63, 0x00400513, 0xd55fc0ef, 0x00400513,
+  0xd3dfc0ef, 0x01444783, 0x00078c63, 0x00400513, 0x00040a23, 0xd39fc0ef,
+  0x00400513, 0xd21fc0ef, 0x02044783, 0x04078663, 0x02040023, 0x02040123,
+  0x020401a3, 0x00800793, 0x06f42023, 0x02442783, 0x06f42423, 0x03844783,
+  0x0ff7f793, 0x06f40623, 0x00000793, 0x06c44703, 0x06e7ea63, 0x02040c23,
+  0xed4fd0ef, 0x00100793, 0x08051063, 0x02f40123, 0x02144783, 0xee078ce3,
+  0x020400a3, 0x02040123, 0x020401a3, 0x00900793, 0x06f42023, 0x02442783,
+  0x06f42423, 0x03844783, 0x0ff7f793, 0x06f40623, 0xe94fd0ef, 0x06051463,
+  0x06c44783, 0x0ff7f793, 0x02f40c23, 0x00000793, 0x03844703, 0x02e7ea63,
+  0x00100793, 0x02f40123, 0xea5ff06f, 0x00f406b3, 0x0286c703, 0x00178793,
+  0x0ff7f793, 0x0ff77713, 0x06e686a3, 0xf71ff06f, 0x02f401a3, 0xf85ff06f,
+  0x00f406b3, 0x06d6c703, 0x00178793, 0x0ff7f793, 0x0ff77713, 0x02e68423,
+  0xfb1ff06f, 0x00100793, 0x02f401a3, 0xe59ff06f, 0x00200713, 0x00e50a63,
+  0x00300713, 0x00e50863, 0x00100713, 0x00e51863, 0xc0dfc06f, 0x00400513,
+  0xff9ff06f, 0x00008067, 0x00200713, 0x00e50a63, 0x00300713, 0x00e50863,
+  0x00100713, 0x00e51863, 0xbf5fc06f, 0x00400513, 0xff9ff06f, 0x00008067,
+  0xff410113, 0x00112423, 0x00812223, 0xf89fc0ef, 0x00200513, 0xf99fc0ef,
+  0x00400513, 0xf91fc0ef, 0x01000513, 0xf89fc0ef, 0x02000513, 0xf81fc0ef,
+  0x04000513, 0x00008437, 0xf75fc0ef, 0x08040413, 0xca1fd0ef, 0xf31fc0ef,
+  0x00050663, 0x00800513, 0xba5fc0ef, 0x00100513, 0xef9fc0ef, 0xfe0502e3,
+  0x00a44783, 0x02078063, 0x00400513, 0x000400a3, 0xb75fc0ef, 0x00100593,
+  0x00900513, 0xe0dfd0ef, 0xfc1ff06f, 0x00a44783, 0xd693a5b7, 0x40058593,
+  0x00178793, 0x0ff7f793, 0x00100513, 0x00f40523, 0xdbdfc0ef, 0xf9dff06f,
+  0xff410113, 0x00112423, 0xa30fe0ef, 0x815fe0ef, 0xff9ff06f, 0xff010113,
+  0x00112623, 0x00812423, 0x00912223, 0x934fe0ef, 0x000086b7, 0x08068793,
+  0x0187c703, 0x08068493, 0x04070463, 0x00048c23, 0x01a4c403, 0x0ff47413,
+  0x00040513, 0xb71ff0ef, 0x00050e63, 0x00040513, 0xa15ff0ef, 0x00000613,
+  0x00200593, 0x00040513, 0xabdff0ef, 0x00040513, 0xa05ff0ef, 0x0a051c63,
+  0x00040513, 0xd88ff0ef, 0x0194c703, 0x02070463, 0x00048ca3, 0x01a4c503,
+  0x0ff57513, 0x00a12023, 0x9d5ff0ef, 0x00012503, 0x00000613, 0x00200593,
+  0xa7dff0ef, 0x01d4c703, 0x00070863, 0x00048ea3, 0x00100713, 0x00e48fa3,
+  0x01e4c703, 0x00070463, 0x00048f23, 0x0174c703, 0x00070663, 0x00048ba3,
+  0xa1cff0ef, 0xf49fd0ef, 0xf40504e3, 0x00300593, 0x03800513, 0xbb5fc0ef,
+  0xf2050ce3, 0x00800513, 0xa89fc0ef, 0x04051263, 0x00000593, 0x00200513,
+  0xcd9fd0ef, 0x00000613, 0x00300593, 0x00000513, 0xa0dff0ef, 0x00000613,
+  0x00300593, 0x00100513, 0x02c0006f, 0x00100613, 0x00100593, 0x00040513,
+  0x9edff0ef, 0xf45ff06f, 0x01000513, 0xa3dfc0ef, 0x00051a63, 0x00000613,
+  0x00100593, 0x9d1ff0ef, 0xed1ff06f, 0x02000513, 0xa21fc0ef, 0xec0512e3,
+  0x00000613, 0x00100593, 0xfb5ff06f
 };
-unsigned int prt_dptx_pm_rom_len = 14340;
+const uint32_t prt_dptx_pm_rom_len = 3585;
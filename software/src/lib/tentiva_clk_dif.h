@@ -0,0 +1,40 @@
+/*
+ * tentiva_clk_dif register differences
+ * for Renesas RC22504A clock synthesizer
+ * Generated by gen_clk_dif.pl from tentiva_phy_clk.h and tentiva_vid_clk.h
+ * (c) 2025 by Parretto B.V.
+ */
+
+#pragma once
+
+// tentiva_phy_clk configuration 0 <-> 1
+#define TENTIVA_PHY_CLK_DIF_0_1_NUM_REGS 20
+const uint16_t tentiva_phy_clk_dif_0_1[TENTIVA_PHY_CLK_DIF_0_1_NUM_REGS] = 
+{
+	0x003, 0x0A0, 0x100, 0x101, 0x102, 0x108, 0x110, 0x122,
+	0x141, 0x150, 0x151, 0x152, 0x154, 0x156, 0x157, 0x158,
+	0x159, 0x15A, 0x15B, 0x190
+};
+
+// tentiva_vid_clk configuration 0 <-> 1
+#define TENTIVA_VID_CLK_DIF_0_1_NUM_REGS 14
+const uint16_t tentiva_vid_clk_dif_0_1[TENTIVA_VID_CLK_DIF_0_1_NUM_REGS] = 
+{
+	0x003, 0x0A0, 0x100, 0x101, 0x102, 0x108, 0x110, 0x122,
+	0x141, 0x150, 0x152, 0x153, 0x154, 0x190
+};
+
+// tentiva_vid_clk configuration 0 <-> 2
+#define TENTIVA_VID_CLK_DIF_0_2_NUM_REGS 15
+const uint16_t tentiva_vid_clk_dif_0_2[TENTIVA_VID_CLK_DIF_0_2_NUM_REGS] = 
+{
+	0x003, 0x0A0, 0x100, 0x101, 0x102, 0x108, 0x110, 0x122,
+	0x141, 0x150, 0x151, 0x152, 0x153, 0x154, 0x190
+};
+
+// tentiva_vid_clk configuration 1 <-> 2
+#define TENTIVA_VID_CLK_DIF_1_2_NUM_REGS 6
+const uint16_t tentiva_vid_clk_dif_1_2[TENTIVA_VID_CLK_DIF_1_2_NUM_REGS] = 
+{
+	0x108, 0x110, 0x150, 0x151, 0x152, 0x153
+};
@@ -12,6 +12,11 @@
     v1.0 - Initial release
     v1.1 - Added video resolution 7680x4320P30
     v1.2 - Added video resolution 5120X2160P60
+    v1.3 - Added CVT timing engine
+    v1.4 - Added preset timing table
+    v1.5 - Added clock recovery tuning
+    v1.6 - Added clock recovery telemetry
+    v1.7 - Added shadow registers and VPS address auto increment
 
     License
     =======
@@ -38,6 +43,27 @@ void prt_vtb_set_base (prt_vtb_ds_struct *vtb, uint32_t base)
 {
 	// Base address
 	vtb->dev = (prt_vtb_dev_struct *) base;
+
+	// The shadow registers are loaded at the first access
+	vtb->og_vld = 0;
+	vtb->vps_vld = 0;
+	vtb->vps_dirty = 0;
+	vtb->vps_ainc = PRT_VTB_VPS_AINC_UNKNOWN;
+}
+
+// Set timer
+// The timer is used by the clock recovery tuning
+void prt_vtb_set_tmr (prt_vtb_ds_struct *vtb, prt_tmr_ds_struct *tmr)
+{
+	vtb->tmr = tmr;
+}
+
+// Set idle callback
+// The clock recovery tuning blocks for up to VTB_CR_TUNE_TIME_MAX.
+// The callback keeps the other drivers running during the waits.
+void prt_vtb_set_idle_cb (prt_vtb_ds_struct *vtb, prt_vtb_idle_cb cb)
+{
+	vtb->idle = cb;
 }
 
 // Set reference clock
@@ -52,131 +78,124 @@ void prt_vtb_set_vidclk (prt_vtb_ds_struct *vtb, uint32_t clk)
 	vtb->vidclk = clk;
 }
 
-// Set preset timing parameters
+// Preset timing table
+// The table is indexed by the preset number minus one
+const prt_vtb_tp_struct prt_vtb_preset_tp[VTB_PRESETS] = {
+	// 1280 x 720p @ 50Hz
+	{
+		.htotal = VTB_1280X720P50_HTOTAL, .hwidth = VTB_1280X720P50_HWIDTH, .hstart = VTB_1280X720P50_HSTART, .hsw = VTB_1280X720P50_HSW,
+		.vtotal = VTB_1280X720P50_VTOTAL, .vheight = VTB_1280X720P50_VHEIGHT, .vstart = VTB_1280X720P50_VSTART, .vsw = VTB_1280X720P50_VSW,
+		.pclk = VTB_1280X720P50_PCLK
+	},
+	// 1280 x 720p @ 60Hz
+	{
+		.htotal = VTB_1280X720P60_HTOTAL, .hwidth = VTB_1280X720P60_HWIDTH, .hstart = VTB_1280X720P60_HSTART, .hsw = VTB_1280X720P60_HSW,
+		.vtotal = VTB_1280X720P60_VTOTAL, .vheight = VTB_1280X720P60_VHEIGHT, .vstart = VTB_1280X720P60_VSTART, .vsw = VTB_1280X720P60_VSW,
+		.pclk = VTB_1280X720P60_PCLK
+	},
+	// 1920 x 1080p @ 50Hz
+	{
+		.htotal = VTB_1920X1080P50_HTOTAL, .hwidth = VTB_1920X1080P50_HWIDTH, .hstart = VTB_1920X1080P50_HSTART, .hsw = VTB_1920X1080P50_HSW,
+		.vtotal = VTB_1920X1080P50_VTOTAL, .vheight = VTB_1920X1080P50_VHEIGHT, .vstart = VTB_1920X1080P50_VSTART, .vsw = VTB_1920X1080P50_VSW,
+		.pclk = VTB_1920X1080P50_PCLK
+	},
+	// 1920 x 1080p @ 60Hz
+	{
+		.htotal = VTB_1920X1080P60_HTOTAL, .hwidth = VTB_1920X1080P60_HWIDTH, .hstart = VTB_1920X1080P60_HSTART, .hsw = VTB_1920X1080P60_HSW,
+		.vtotal = VTB_1920X1080P60_VTOTAL, .vheight = VTB_1920X1080P60_VHEIGHT, .vstart = VTB_1920X1080P60_VSTART, .vsw = VTB_1920X1080P60_VSW,
+		.pclk = VTB_1920X1080P60_PCLK
+	},
+	// 2560 x 1440p @ 50Hz
+	{
+		.htotal = VTB_2560X1440P50_HTOTAL, .hwidth = VTB_2560X1440P50_HWIDTH, .hstart = VTB_2560X1440P50_HSTART, .hsw = VTB_2560X1440P50_HSW,
+		.vtotal = VTB_2560X1440P50_VTOTAL, .vheight = VTB_2560X1440P50_VHEIGHT, .vstart = VTB_2560X1440P50_VSTART, .vsw = VTB_2560X1440P50_VSW,
+		.pclk = VTB_2560X1440P50_PCLK
+	},
+	// 2560 x 1440p @ 60Hz
+	{
+		.htotal = VTB_2560X1440P60_HTOTAL, .hwidth = VTB_2560X1440P60_HWIDTH, .hstart = VTB_2560X1440P60_HSTART, .hsw = VTB_2560X1440P60_HSW,
+		.vtotal = VTB_2560X1440P60_VTOTAL, .vheight = VTB_2560X1440P60_VHEIGHT, .vstart = VTB_2560X1440P60_VSTART, .vsw = VTB_2560X1440P60_VSW,
+		.pclk = VTB_2560X1440P60_PCLK
+	},
+	// 3840 x 2160p @ 50Hz
+	{
+		.htotal = VTB_3840X2160P50_HTOTAL, .hwidth = VTB_3840X2160P50_HWIDTH, .hstart = VTB_3840X2160P50_HSTART, .hsw = VTB_3840X2160P50_HSW,
+		.vtotal = VTB_3840X2160P50_VTOTAL, .vheight = VTB_3840X2160P50_VHEIGHT, .vstart = VTB_3840X2160P50_VSTART, .vsw = VTB_3840X2160P50_VSW,
+		.pclk = VTB_3840X2160P50_PCLK
+	},
+	// 3840 x 2160p @ 60Hz
+	{
+		.htotal = VTB_3840X2160P60_HTOTAL, .hwidth = VTB_3840X2160P60_HWIDTH, .hstart = VTB_3840X2160P60_HSTART, .hsw = VTB_3840X2160P60_HSW,
+		.vtotal = VTB_3840X2160P60_VTOTAL, .vheight = VTB_3840X2160P60_VHEIGHT, .vstart = VTB_3840X2160P60_VSTART, .vsw = VTB_3840X2160P60_VSW,
+		.pclk = VTB_3840X2160P60_PCLK
+	},
+	// 5120 x 2880p @ 60Hz
+	{
+		.htotal = VTB_5120X2880P60_HTOTAL, .hwidth = VTB_5120X2880P60_HWIDTH, .hstart = VTB_5120X2880P60_HSTART, .hsw = VTB_5120X2880P60_HSW,
+		.vtotal = VTB_5120X2880P60_VTOTAL, .vheight = VTB_5120X2880P60_VHEIGHT, .vstart = VTB_5120X2880P60_VSTART, .vsw = VTB_5120X2880P60_VSW,
+		.pclk = VTB_5120X2880P60_PCLK
+	},
+	// 7680 x 4320p @ 30Hz
+	{
+		.htotal = VTB_7680X4320P30_HTOTAL, .hwidth = VTB_7680X4320P30_HWIDTH, .hstart = VTB_7680X4320P30_HSTART, .hsw = VTB_7680X4320P30_HSW,
+		.vtotal = VTB_7680X4320P30_VTOTAL, .vheight = VTB_7680X4320P30_VHEIGHT, .vstart = VTB_7680X4320P30_VSTART, .vsw = VTB_7680X4320P30_VSW,
+		.pclk = VTB_7680X4320P30_PCLK
+	}
+};
+
+// Preset lookup table
+// The keys are sorted in ascending order (htotal first, then vtotal) for the binary search.
+// A new preset must be inserted in order in both arrays.
+const uint32_t prt_vtb_preset_key[VTB_PRESETS] = {
+	VTB_PRESET_KEY (VTB_1280X720P60_HTOTAL, VTB_1280X720P60_VTOTAL),
+	VTB_PRESET_KEY (VTB_1280X720P50_HTOTAL, VTB_1280X720P50_VTOTAL),
+	VTB_PRESET_KEY (VTB_1920X1080P60_HTOTAL, VTB_1920X1080P60_VTOTAL),
+	VTB_PRESET_KEY (VTB_1920X1080P50_HTOTAL, VTB_1920X1080P50_VTOTAL),
+	VTB_PRESET_KEY (VTB_2560X1440P60_HTOTAL, VTB_2560X1440P60_VTOTAL),
+	VTB_PRESET_KEY (VTB_2560X1440P50_HTOTAL, VTB_2560X1440P50_VTOTAL),
+	VTB_PRESET_KEY (VTB_3840X2160P60_HTOTAL, VTB_3840X2160P60_VTOTAL),
+	VTB_PRESET_KEY (VTB_5120X2880P60_HTOTAL, VTB_5120X2880P60_VTOTAL),
+	VTB_PRESET_KEY (VTB_3840X2160P50_HTOTAL, VTB_3840X2160P50_VTOTAL),
+	VTB_PRESET_KEY (VTB_7680X4320P30_HTOTAL, VTB_7680X4320P30_VTOTAL)
+};
+
+const uint8_t prt_vtb_preset_idx[VTB_PRESETS] = {
+	VTB_PRESET_1280X720P60,
+	VTB_PRESET_1280X720P50,
+	VTB_PRESET_1920X1080P60,
+	VTB_PRESET_1920X1080P50,
+	VTB_PRESET_2560X1440P60,
+	VTB_PRESET_2560X1440P50,
+	VTB_PRESET_3840X2160P60,
+	VTB_PRESET_5120X2880P60,
+	VTB_PRESET_3840X2160P50,
+	VTB_PRESET_7680X4320P30
+};
+
+// Set timing parameters
+// A preset takes the timing from the preset table, otherwise the timing parameters are used
 void prt_vtb_set_tp (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset)
 {
-	switch (preset)
-	{
-		case VTB_PRESET_1280X720P50 :
-			vtb->tp.htotal  = VTB_1280X720P50_HTOTAL;
-			vtb->tp.hwidth  = VTB_1280X720P50_HWIDTH;
-			vtb->tp.hstart  = VTB_1280X720P50_HSTART;
-			vtb->tp.hsw     = VTB_1280X720P50_HSW;
-			vtb->tp.vtotal  = VTB_1280X720P50_VTOTAL;
-			vtb->tp.vheight = VTB_1280X720P50_VHEIGHT;
-			vtb->tp.vstart  = VTB_1280X720P50_VSTART;
-			vtb->tp.vsw     = VTB_1280X720P50_VSW;
-			vtb->tp.pclk    = VTB_1280X720P50_PCLK;
-		break;
-
-		case VTB_PRESET_1280X720P60 :
-			vtb->tp.htotal  = VTB_1280X720P60_HTOTAL;
-			vtb->tp.hwidth  = VTB_1280X720P60_HWIDTH;
-			vtb->tp.hstart  = VTB_1280X720P60_HSTART;
-			vtb->tp.hsw     = VTB_1280X720P60_HSW;
-			vtb->tp.vtotal  = VTB_1280X720P60_VTOTAL;
-			vtb->tp.vheight = VTB_1280X720P60_VHEIGHT;
-			vtb->tp.vstart  = VTB_1280X720P60_VSTART;
-			vtb->tp.vsw     = VTB_1280X720P60_VSW;
-			vtb->tp.pclk    = VTB_1280X720P60_PCLK;
-		break;
-
-		case VTB_PRESET_1920X1080P50 :
-			vtb->tp.htotal  = VTB_1920X1080P50_HTOTAL;
-			vtb->tp.hwidth  = VTB_1920X1080P50_HWIDTH;
-			vtb->tp.hstart  = VTB_1920X1080P50_HSTART;
-			vtb->tp.hsw     = VTB_1920X1080P50_HSW;
-			vtb->tp.vtotal  = VTB_1920X1080P50_VTOTAL;
-			vtb->tp.vheight = VTB_1920X1080P50_VHEIGHT;
-			vtb->tp.vstart  = VTB_1920X1080P50_VSTART;
-			vtb->tp.vsw     = VTB_1920X1080P50_VSW;
-			vtb->tp.pclk    = VTB_1920X1080P50_PCLK;
-		break;
-
-		case VTB_PRESET_1920X1080P60 :
-			vtb->tp.htotal  = VTB_1920X1080P60_HTOTAL;
-			vtb->tp.hwidth  = VTB_1920X1080P60_HWIDTH;
-			vtb->tp.hstart  = VTB_1920X1080P60_HSTART;
-			vtb->tp.hsw     = VTB_1920X1080P60_HSW;
-			vtb->tp.vtotal  = VTB_1920X1080P60_VTOTAL;
-			vtb->tp.vheight = VTB_1920X1080P60_VHEIGHT;
-			vtb->tp.vstart  = VTB_1920X1080P60_VSTART;
-			vtb->tp.vsw     = VTB_1920X1080P60_VSW;
-			vtb->tp.pclk    = VTB_1920X1080P60_PCLK;
-		break;
-
-		case VTB_PRESET_2560X1440P50 :
-			vtb->tp.htotal  = VTB_2560X1440P50_HTOTAL;
-			vtb->tp.hwidth  = VTB_2560X1440P50_HWIDTH;
-			vtb->tp.hstart  = VTB_2560X1440P50_HSTART;
-			vtb->tp.hsw     = VTB_2560X1440P50_HSW;
-			vtb->tp.vtotal  = VTB_2560X1440P50_VTOTAL;
-			vtb->tp.vheight = VTB_2560X1440P50_VHEIGHT;
-			vtb->tp.vstart  = VTB_2560X1440P50_VSTART;
-			vtb->tp.vsw     = VTB_2560X1440P50_VSW;
-			vtb->tp.pclk    = VTB_2560X1440P50_PCLK;
-		break;
-
-		case VTB_PRESET_2560X1440P60 :
-			vtb->tp.htotal  = VTB_2560X1440P60_HTOTAL;
-			vtb->tp.hwidth  = VTB_2560X1440P60_HWIDTH;
-			vtb->tp.hstart  = VTB_2560X1440P60_HSTART;
-			vtb->tp.hsw     = VTB_2560X1440P60_HSW;
-			vtb->tp.vtotal  = VTB_2560X1440P60_VTOTAL;
-			vtb->tp.vheight = VTB_2560X1440P60_VHEIGHT;
-			vtb->tp.vstart  = VTB_2560X1440P60_VSTART;
-			vtb->tp.vsw     = VTB_2560X1440P60_VSW;
-			vtb->tp.pclk    = VTB_2560X1440P60_PCLK;
-		break;
-
-		case VTB_PRESET_3840X2160P50 :
-			vtb->tp.htotal  = VTB_3840X2160P50_HTOTAL;
-			vtb->tp.hwidth  = VTB_3840X2160P50_HWIDTH;
-			vtb->tp.hstart  = VTB_3840X2160P50_HSTART;
-			vtb->tp.hsw     = VTB_3840X2160P50_HSW;
-			vtb->tp.vtotal  = VTB_3840X2160P50_VTOTAL;
-			vtb->tp.vheight = VTB_3840X2160P50_VHEIGHT;
-			vtb->tp.vstart  = VTB_3840X2160P50_VSTART;
-			vtb->tp.vsw     = VTB_3840X2160P50_VSW;
-			vtb->tp.pclk    = VTB_3840X2160P50_PCLK;
-		break;
-
-		case VTB_PRESET_3840X2160P60 :
-			vtb->tp.htotal  = VTB_3840X2160P60_HTOTAL;
-			vtb->tp.hwidth  = VTB_3840X2160P60_HWIDTH;
-			vtb->tp.hstart  = VTB_3840X2160P60_HSTART;
-			vtb->tp.hsw     = VTB_3840X2160P60_HSW;
-			vtb->tp.vtotal  = VTB_3840X2160P60_VTOTAL;
-			vtb->tp.vheight = VTB_3840X2160P60_VHEIGHT;
-			vtb->tp.vstart  = VTB_3840X2160P60_VSTART;
-			vtb->tp.vsw     = VTB_3840X2160P60_VSW;
-			vtb->tp.pclk    = VTB_3840X2160P60_PCLK;
-		break;
-
-		case VTB_PRESET_7680X4320P30 :
-			vtb->tp.htotal  = VTB_7680X4320P30_HTOTAL;
-			vtb->tp.hwidth  = VTB_7680X4320P30_HWIDTH;
-			vtb->tp.hstart  = VTB_7680X4320P30_HSTART;
-			vtb->tp.hsw     = VTB_7680X4320P30_HSW;
-			vtb->tp.vtotal  = VTB_7680X4320P30_VTOTAL;
-			vtb->tp.vheight = VTB_7680X4320P30_VHEIGHT;
-			vtb->tp.vstart  = VTB_7680X4320P30_VSTART;
-			vtb->tp.vsw     = VTB_7680X4320P30_VSW;
-			vtb->tp.pclk    = VTB_7680X4320P30_PCLK;
-		break;
+	// Variables
+	const prt_vtb_tp_struct *src;
 
-		default :
-			vtb->tp.htotal = tp->htotal;
-			vtb->tp.hwidth = tp->hwidth;
-			vtb->tp.hstart = tp->hstart;
-			vtb->tp.hsw = tp->hsw;
-			vtb->tp.vtotal = tp->vtotal;	
-			vtb->tp.vheight = tp->vheight;	
-			vtb->tp.vstart = tp->vstart;
-			vtb->tp.vsw = tp->vsw;
-			vtb->tp.pclk = tp->pclk;
-		break;
-	}
+	// Preset
+	if ((preset > 0) && (preset <= VTB_PRESETS))
+		src = &prt_vtb_preset_tp[preset - 1];
+
+	// User
+	else
+		src = tp;
+
+	vtb->tp.htotal = src->htotal;
+	vtb->tp.hwidth = src->hwidth;
+	vtb->tp.hstart = src->hstart;
+	vtb->tp.hsw = src->hsw;
+	vtb->tp.vtotal = src->vtotal;
+	vtb->tp.vheight = src->vheight;
+	vtb->tp.vstart = src->vstart;
+	vtb->tp.vsw = src->vsw;
+	vtb->tp.pclk = src->pclk;
 }
 
 // Test pattern generator
@@ -185,26 +204,6 @@ void prt_vtb_tpg (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset,
 	// Variables
 	uint32_t dat;
 
-	// Stop video
-	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, 0);
-
-	// Set timing parameters
-	prt_vtb_set_tp (vtb, tp, preset);
-
-	// Copy timing parameters to device
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_REFCLK_HI, vtb->refclk >> 16);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_REFCLK_LO, vtb->refclk);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VIDCLK_HI, vtb->vidclk >> 16);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VIDCLK_LO, vtb->vidclk);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HTOTAL, vtb->tp.htotal);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HWIDTH, vtb->tp.hwidth);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HSTART, vtb->tp.hstart);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HSW, vtb->tp.hsw);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VTOTAL, vtb->tp.vtotal);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VHEIGHT, vtb->tp.vheight);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VSTART, vtb->tp.vstart);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VSW, vtb->tp.vsw);
-
 	// PLL timing mode
 	dat = PRT_VTB_OG_CTL_VID_EN | PRT_VTB_OG_CTL_TG_RUN | PRT_VTB_OG_CTL_TPG_RUN;
 
@@ -215,7 +214,7 @@ void prt_vtb_tpg (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset,
 	//dat |= PRT_VTB_OG_CTL_CG_RUN;
 
 	// Start video
-	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, dat);
+	prt_vtb_vid_str (vtb, tp, preset, dat);
 }
 
 // Clock Recovery
@@ -224,26 +223,6 @@ void prt_vtb_cr (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset)
 	// Variables
 	uint32_t dat;
 
-	// Stop video
-	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, 0);
-
-	// Set timing parameters
-	prt_vtb_set_tp (vtb, tp, preset);
-
-	// Copy timing parameters to device
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_REFCLK_HI, vtb->refclk >> 16);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_REFCLK_LO, vtb->refclk);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VIDCLK_HI, vtb->vidclk >> 16);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VIDCLK_LO, vtb->vidclk);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HTOTAL, vtb->tp.htotal);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HWIDTH, vtb->tp.hwidth);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HSTART, vtb->tp.hstart);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_HSW, vtb->tp.hsw);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VTOTAL, vtb->tp.vtotal);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VHEIGHT, vtb->tp.vheight);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VSTART, vtb->tp.vstart);
-	prt_vtb_set_vps (vtb, PRT_VTB_VPS_VSW, vtb->tp.vsw);
-
 	// Enable link and video
 	dat = PRT_VTB_OG_CTL_LNK_EN | PRT_VTB_OG_CTL_VID_EN;
 
@@ -257,28 +236,144 @@ void prt_vtb_cr (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset)
 	dat |= PRT_VTB_OG_CTL_TG_RUN | PRT_VTB_OG_CTL_TG_MODE;
 
 	// Start video
-	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, dat);
+	prt_vtb_vid_str (vtb, tp, preset, dat);
+}
+
+// Start video
+// Stops the video, updates the timing parameters and starts the video with the control word.
+// Only the changed video parameters are written to the device.
+void prt_vtb_vid_str (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint32_t ctl)
+{
+	// Stop video
+	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, 0);
+
+	// Set timing parameters
+	prt_vtb_set_tp (vtb, tp, preset);
+
+	// Copy timing parameters to device
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_REFCLK_HI, vtb->refclk >> 16);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_REFCLK_LO, vtb->refclk);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VIDCLK_HI, vtb->vidclk >> 16);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VIDCLK_LO, vtb->vidclk);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_HTOTAL, vtb->tp.htotal);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_HWIDTH, vtb->tp.hwidth);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_HSTART, vtb->tp.hstart);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_HSW, vtb->tp.hsw);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VTOTAL, vtb->tp.vtotal);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VHEIGHT, vtb->tp.vheight);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VSTART, vtb->tp.vstart);
+	prt_vtb_vps_wr (vtb, PRT_VTB_VPS_VSW, vtb->tp.vsw);
+	prt_vtb_vps_commit (vtb);
+
+	// Start video
+	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, ctl);
 }
 
 // Write video parameter set
+// The parameter is written immediately
 void prt_vtb_set_vps (prt_vtb_ds_struct *vtb, uint8_t vps, uint32_t dat)
 {
 	vtb->dev->ctl = (vps << PRT_VTB_DEV_CTL_VPS_SHIFT);
 	vtb->dev->vps = dat;
+
+	// Update shadow
+	if (vps < PRT_VTB_VPS_REGS)
+	{
+		vtb->vps[vps] = dat;
+		vtb->vps_vld |= (1 << vps);
+		vtb->vps_dirty &= ~(1 << vps);
+	}
+}
+
+// Write video parameter set shadow
+// The parameter is marked dirty when it changes. The commit writes it to the device.
+void prt_vtb_vps_wr (prt_vtb_ds_struct *vtb, uint8_t vps, uint16_t dat)
+{
+	if (!(vtb->vps_vld & (1 << vps)) || (vtb->vps[vps] != dat))
+	{
+		vtb->vps[vps] = dat;
+		vtb->vps_vld |= (1 << vps);
+		vtb->vps_dirty |= (1 << vps);
+	}
+}
+
+// Commit video parameter set
+// Writes the dirty parameters to the device.
+// When the controller increments the address, consecutive dirty parameters are a burst of data writes.
+// The address increment is detected at the first write, older controllers ignore the increment bit.
+void prt_vtb_vps_commit (prt_vtb_ds_struct *vtb)
+{
+	// Variables
+	uint8_t run = PRT_FALSE;
+
+	for (uint8_t i = 0; (i < PRT_VTB_VPS_REGS) && vtb->vps_dirty; i++)
+	{
+		if (vtb->vps_dirty & (1 << i))
+		{
+			// Select the parameter, unless the controller has incremented the address
+			if (!run)
+				vtb->dev->ctl = (i << PRT_VTB_DEV_CTL_VPS_SHIFT) | PRT_VTB_DEV_CTL_VPS_AINC;
+
+			vtb->dev->vps = vtb->vps[i];
+			vtb->vps_dirty &= ~(1 << i);
+
+			// Detect the address increment
+			if (vtb->vps_ainc == PRT_VTB_VPS_AINC_UNKNOWN)
+			{
+				if (((vtb->dev->ctl >> PRT_VTB_DEV_CTL_VPS_SHIFT) & 0xf) == (i + 1))
+					vtb->vps_ainc = PRT_VTB_VPS_AINC_YES;
+				else
+					vtb->vps_ainc = PRT_VTB_VPS_AINC_NO;
+			}
+
+			run = (vtb->vps_ainc == PRT_VTB_VPS_AINC_YES);
+		}
+
+		// The next write needs a select
+		else
+			run = PRT_FALSE;
+	}
 }
 
 // Write outgress
+// The write is skipped when the value is unchanged
 void prt_vtb_set_og (prt_vtb_ds_struct *vtb, uint8_t og, uint32_t dat)
 {
+	if ((og < PRT_VTB_OG_REGS) && (vtb->og_vld & (1 << og)) && (vtb->og[og] == dat))
+		return;
+
 	vtb->dev->ctl = (og << PRT_VTB_DEV_CTL_OG_SHIFT);
 	vtb->dev->og = dat;
+
+	// Update shadow
+	if (og < PRT_VTB_OG_REGS)
+	{
+		vtb->og[og] = dat;
+		vtb->og_vld |= (1 << og);
+	}
 }
 
 // Read outgress
+// The outgress registers are only written by the driver, so the shadow is returned when it is valid
 uint32_t prt_vtb_get_og (prt_vtb_ds_struct *vtb, uint8_t og)
 {
+	// Variables
+	uint32_t dat;
+
+	if ((og < PRT_VTB_OG_REGS) && (vtb->og_vld & (1 << og)))
+		return vtb->og[og];
+
 	vtb->dev->ctl = (og << PRT_VTB_DEV_CTL_OG_SHIFT);
-	return vtb->dev->og;
+	dat = vtb->dev->og;
+
+	// Load shadow
+	if (og < PRT_VTB_OG_REGS)
+	{
+		vtb->og[og] = dat;
+		vtb->og_vld |= (1 << og);
+	}
+
+	return dat;
 }
 
 // Read ingress
@@ -326,6 +421,516 @@ void prt_vtb_cr_set_i_gain (prt_vtb_ds_struct *vtb, prt_u16 gain)
 	prt_vtb_set_og (vtb, PRT_VTB_OG_CR, dat);
 }
 
+// Get P gain
+uint8_t prt_vtb_cr_get_p_gain (prt_vtb_ds_struct *vtb)
+{
+	return (prt_vtb_get_og (vtb, PRT_VTB_OG_CR) >> PRT_VTB_OG_CR_P_GAIN_SHIFT) & 0xff;
+}
+
+// Get I gain
+prt_u16 prt_vtb_cr_get_i_gain (prt_vtb_ds_struct *vtb)
+{
+	return (prt_vtb_get_og (vtb, PRT_VTB_OG_CR) >> PRT_VTB_OG_CR_I_GAIN_SHIFT) & 0xffff;
+}
+
+// Clock recovery tuning
+// Searches the P and I gains with the shortest lock time and the smallest FIFO and error excursion.
+// Every round steps the P gain and then the I gain up and down, starting at the current gains. 
+// The step halves every round. A step is kept when it lowers the cost.
+// The gains are cached per preset. On a hit the clock recovery is started with the cached gains,
+// unless the tuning is forced.
+// The clock recovery is left running with the best gains.
+// The search stops with the best gains so far when the total time exceeds VTB_CR_TUNE_TIME_MAX.
+// This function returns PRT_FALSE when none of the gains locks.
+uint8_t prt_vtb_cr_tune (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint8_t force)
+{
+	// Variables
+	prt_vtb_cr_gain_struct *ent;
+	uint32_t key;
+	uint32_t cost;
+	uint32_t best;
+	uint32_t limit;
+	uint32_t dl;
+	uint32_t rem;
+	uint8_t p_best;
+	prt_u16 i_best;
+	uint8_t p;
+	prt_u16 i;
+
+	// Cache entry
+	if ((preset > 0) && (preset <= VTB_PRESETS))
+	{
+		ent = &vtb->cr_gain[preset];
+		key = VTB_PRESET_KEY (prt_vtb_preset_tp[preset - 1].htotal, prt_vtb_preset_tp[preset - 1].vtotal);
+	}
+
+	else
+	{
+		ent = &vtb->cr_gain[0];
+		key = VTB_PRESET_KEY (tp->htotal, tp->vtotal);
+	}
+
+	// Cache hit
+	if (!force && (ent->key == key))
+	{
+		prt_vtb_cr_set_p_gain (vtb, ent->p_gain);
+		prt_vtb_cr_set_i_gain (vtb, ent->i_gain);
+		prt_vtb_cr (vtb, tp, preset);
+		return PRT_TRUE;
+	}
+
+	// Without timer the lock time can't be measured
+	if (vtb->tmr == 0)
+	{
+		prt_vtb_cr (vtb, tp, preset);
+		return PRT_FALSE;
+	}
+
+	// Start at the current gains
+	// The controller only uses the lower bits of the I gain
+	p_best = prt_vtb_cr_get_p_gain (vtb);
+	i_best = prt_vtb_cr_get_i_gain (vtb) & VTB_CR_I_GAIN_MAX;
+
+	if (p_best == 0)
+		p_best = 1;
+
+	if (i_best == 0)
+		i_best = 1;
+
+	// Deadline
+	dl = prt_tmr_get_ts (vtb->tmr) + VTB_CR_TUNE_TIME_MAX;
+
+	best = prt_vtb_cr_measure (vtb, tp, preset, p_best, i_best, VTB_CR_TUNE_LOCK_TIMEOUT);
+
+	for (uint8_t s = 1; (s <= VTB_CR_TUNE_STEPS) && !prt_tmr_is_exp (vtb->tmr, dl); s++)
+	{
+		for (uint8_t c = 0; c < 4; c++)
+		{
+			// P gain up and down
+			if (c < 2)
+			{
+				p = prt_vtb_cr_step (p_best, s, (c == 0), VTB_CR_P_GAIN_MAX);
+				i = i_best;
+			}
+
+			// I gain up and down
+			else
+			{
+				p = p_best;
+				i = prt_vtb_cr_step (i_best, s, (c == 2), VTB_CR_I_GAIN_MAX);
+			}
+
+			// The gain is at the limit
+			if ((p == p_best) && (i == i_best))
+				continue;
+
+			// A candidate which locks later than the best cost can't win
+			if (best < (VTB_CR_TUNE_LOCK_TIMEOUT >> 10))
+				limit = best << 10;
+			else
+				limit = VTB_CR_TUNE_LOCK_TIMEOUT;
+
+			// Time left
+			// The candidate must lock before the deadline minus the observation window
+			if (prt_tmr_is_exp (vtb->tmr, dl))
+				break;
+
+			rem = dl - prt_tmr_get_ts (vtb->tmr);
+			if (rem <= VTB_CR_TUNE_WINDOW)
+				break;
+
+			if (limit > (rem - VTB_CR_TUNE_WINDOW))
+				limit = rem - VTB_CR_TUNE_WINDOW;
+
+			cost = prt_vtb_cr_measure (vtb, tp, preset, p, i, limit);
+
+			// Keep
+			if (cost < best)
+			{
+				best = cost;
+				p_best = p;
+				i_best = i;
+			}
+		}
+	}
+
+	// Start the clock recovery with the best gains
+	prt_vtb_cr_set_p_gain (vtb, p_best);
+	prt_vtb_cr_set_i_gain (vtb, i_best);
+	prt_vtb_cr (vtb, tp, preset);
+
+	// No lock
+	if (best == VTB_CR_TUNE_COST_MAX)
+		return PRT_FALSE;
+
+	// Cache
+	ent->key = key;
+	ent->p_gain = p_best;
+	ent->i_gain = i_best;
+	ent->cost = best;
+
+	return PRT_TRUE;
+}
+
+// Clock recovery measurement
+// Starts the clock recovery with the gains and observes the lock.
+// The cost is the lock time (in ms, approximately) plus the FIFO excursion (words) and the error span.
+// This function returns VTB_CR_TUNE_COST_MAX when the lock takes longer than the limit (us),
+// when the lock is lost or when the integrator saturates.
+uint32_t prt_vtb_cr_measure (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint8_t p_gain, prt_u16 i_gain, uint32_t limit)
+{
+	// Variables
+	uint32_t ts;
+	uint32_t lock;
+	uint32_t dl;
+	prt_s16 sum;
+	prt_s8 err;
+	prt_s8 err_max;
+	prt_s8 err_min;
+
+	prt_vtb_cr_set_p_gain (vtb, p_gain);
+	prt_vtb_cr_set_i_gain (vtb, i_gain);
+
+	// Restart the clock recovery, this clears the FIFO and error statistics
+	prt_vtb_cr (vtb, tp, preset);
+	ts = prt_tmr_get_ts (vtb->tmr);
+
+	// Wait for lock
+	while (!prt_vtb_get_fifo_lock (vtb))
+	{
+		if ((prt_tmr_get_ts (vtb->tmr) - ts) > limit)
+			return VTB_CR_TUNE_COST_MAX;
+
+		// Idle
+		if (vtb->idle)
+			vtb->idle ();
+	}
+
+	lock = prt_tmr_get_ts (vtb->tmr) - ts;
+
+	// Observe
+	err_max = 0;
+	err_min = 0;
+	dl = prt_tmr_get_ts (vtb->tmr) + VTB_CR_TUNE_WINDOW;
+	while (!prt_tmr_is_exp (vtb->tmr, dl))
+	{
+		// Loss of lock
+		if (!prt_vtb_get_fifo_lock (vtb))
+			return VTB_CR_TUNE_COST_MAX;
+
+		// Integrator saturation
+		sum = prt_vtb_get_cr_sum (vtb);
+		if ((sum > VTB_CR_TUNE_SUM_MAX) || (sum < -VTB_CR_TUNE_SUM_MAX))
+			return VTB_CR_TUNE_COST_MAX;
+
+		// Error
+		err = prt_vtb_get_cr_cur_err (vtb);
+		if (err > err_max)
+			err_max = err;
+		if (err < err_min)
+			err_min = err;
+
+		// Idle
+		if (vtb->idle)
+			vtb->idle ();
+	}
+
+	return (lock >> 10) + (prt_vtb_get_fifo_max_wrds (vtb) - prt_vtb_get_fifo_min_wrds (vtb)) + (err_max - err_min);
+}
+
+// Clock recovery gain step
+// Steps the gain up or down by the gain shifted right by the step. 
+// The gain stays between 1 and the maximum.
+prt_u16 prt_vtb_cr_step (prt_u16 gain, uint8_t step, uint8_t up, prt_u16 max)
+{
+	// Variables
+	uint32_t dif;
+
+	dif = gain >> step;
+	if (dif == 0)
+		dif = 1;
+
+	// Up
+	if (up)
+	{
+		if ((gain + dif) > max)
+			return max;
+		else
+			return gain + dif;
+	}
+
+	// Down
+	else
+	{
+		if (gain > dif)
+			return gain - dif;
+		else
+			return 1;
+	}
+}
+
+// Set telemetry
+void prt_vtb_set_tel (prt_vtb_ds_struct *vtb, prt_vtb_tel_struct *tel)
+{
+	vtb->tel = tel;
+}
+
+// Telemetry start
+// Clears the statistics and starts sampling every period (us).
+// The time to lock is measured from the start.
+void prt_vtb_tel_str (prt_vtb_ds_struct *vtb, uint32_t period)
+{
+	// Variables
+	prt_vtb_tel_struct *tel = vtb->tel;
+
+	if ((tel == 0) || (vtb->tmr == 0))
+		return;
+
+	tel->run = PRT_FALSE;
+	tel->period = period;
+	tel->cnt = 0;
+	tel->wr = 0;
+	tel->lock = PRT_FALSE;
+	tel->lock_time = 0;
+	tel->lock_time_max = 0;
+	tel->lock_loss = 0;
+	tel->max_wrds = 0;
+	tel->min_wrds = 0xffff;
+
+	for (uint8_t i = 0; i < VTB_TEL_SIGS; i++)
+		tel->stat[i].n = 0;
+
+	tel->lock_ts = prt_tmr_get_ts (vtb->tmr);
+	tel->dl = tel->lock_ts + period;
+	tel->run = PRT_TRUE;
+}
+
+// Telemetry stop
+void prt_vtb_tel_stp (prt_vtb_ds_struct *vtb)
+{
+	if (vtb->tel)
+		vtb->tel->run = PRT_FALSE;
+}
+
+// Telemetry poll
+// This is called from the main loop. A sample is taken when the period has expired.
+void prt_vtb_tel_poll (prt_vtb_ds_struct *vtb)
+{
+	// Variables
+	prt_vtb_tel_struct *tel = vtb->tel;
+
+	if ((tel == 0) || !tel->run || !prt_tmr_is_exp (vtb->tmr, tel->dl))
+		return;
+
+	// Next sample
+	tel->dl += tel->period;
+
+	// The main loop was blocked for more than a period
+	if (prt_tmr_is_exp (vtb->tmr, tel->dl))
+		tel->dl = prt_tmr_get_ts (vtb->tmr) + tel->period;
+
+	prt_vtb_tel_smp (vtb);
+}
+
+// Telemetry sample
+void prt_vtb_tel_smp (prt_vtb_ds_struct *vtb)
+{
+	// Variables
+	prt_vtb_tel_struct *tel = vtb->tel;
+	prt_vtb_tel_smp_struct *smp;
+
+	// Capture
+	smp = &tel->smp[tel->wr];
+	smp->ts = prt_tmr_get_ts (vtb->tmr);
+	smp->err = prt_vtb_get_cr_cur_err (vtb);
+	smp->sum = prt_vtb_get_cr_sum (vtb);
+	smp->co = prt_vtb_get_cr_co (vtb);
+	smp->lock = prt_vtb_get_fifo_lock (vtb);
+	smp->max_wrds = prt_vtb_get_fifo_max_wrds (vtb);
+	smp->min_wrds = prt_vtb_get_fifo_min_wrds (vtb);
+
+	tel->wr = (tel->wr + 1) & (VTB_TEL_SMP - 1);
+	tel->cnt++;
+
+	// Lock
+	if (smp->lock && !tel->lock)
+	{
+		tel->lock_time = smp->ts - tel->lock_ts;
+		if (tel->lock_time > tel->lock_time_max)
+			tel->lock_time_max = tel->lock_time;
+	}
+
+	// Loss of lock
+	else if (!smp->lock && tel->lock)
+	{
+		tel->lock_loss++;
+		tel->lock_ts = smp->ts;
+	}
+
+	tel->lock = smp->lock;
+
+	// Statistics
+	if (smp->lock)
+	{
+		if (smp->max_wrds > tel->max_wrds)
+			tel->max_wrds = smp->max_wrds;
+
+		if (smp->min_wrds < tel->min_wrds)
+			tel->min_wrds = smp->min_wrds;
+
+		prt_vtb_tel_acc (&tel->stat[VTB_TEL_SIG_ERR], smp->err);
+		prt_vtb_tel_acc (&tel->stat[VTB_TEL_SIG_SUM], smp->sum);
+		prt_vtb_tel_acc (&tel->stat[VTB_TEL_SIG_CO], smp->co);
+	}
+}
+
+// Telemetry accumulate
+void prt_vtb_tel_acc (prt_vtb_tel_stat_struct *stat, prt_s32 dat)
+{
+	// Variables
+	prt_s32 dev;
+	uint32_t mag;
+
+	// First sample
+	if (stat->n == 0)
+	{
+		stat->ref = dat;
+		stat->min = dat;
+		stat->max = dat;
+		stat->sum = 0;
+		stat->sq = 0;
+	}
+
+	if (dat < stat->min)
+		stat->min = dat;
+
+	if (dat > stat->max)
+		stat->max = dat;
+
+	// Deviation
+	dev = dat - stat->ref;
+
+	if (dev < 0)
+		mag = -dev;
+	else
+		mag = dev;
+
+	stat->sum += dev;
+	stat->sq += prt_vtb_mul64 (mag, mag);
+	stat->n++;
+}
+
+// Telemetry dump
+// Prints the statistics and the ring buffer (oldest sample first) as CSV
+void prt_vtb_tel_dump (prt_vtb_ds_struct *vtb)
+{
+	// Variables
+	prt_vtb_tel_struct *tel = vtb->tel;
+	prt_vtb_tel_smp_struct *smp;
+	uint8_t rd;
+	uint8_t len;
+
+	if (tel == 0)
+		return;
+
+	// Summary
+	prt_printf ("samples,lock,time to lock (us),max time to lock (us),lock loss,fifo max words,fifo min words\n");
+	prt_printf ("%d,%d,%d,%d,%d,%d,%d\n", tel->cnt, tel->lock, tel->lock_time, tel->lock_time_max, tel->lock_loss, 
+		tel->max_wrds, (tel->min_wrds == 0xffff) ? 0 : tel->min_wrds);
+
+	// Statistics
+	prt_printf ("\nsignal,samples,mean,variance,min,max,peak-to-peak\n");
+	prt_vtb_tel_prt_stat ("err", &tel->stat[VTB_TEL_SIG_ERR]);
+	prt_vtb_tel_prt_stat ("sum", &tel->stat[VTB_TEL_SIG_SUM]);
+	prt_vtb_tel_prt_stat ("co", &tel->stat[VTB_TEL_SIG_CO]);
+
+	// Samples
+	prt_printf ("\nts (us),err,sum,co,lock,fifo max words,fifo min words\n");
+
+	if (tel->cnt < VTB_TEL_SMP)
+	{
+		rd = 0;
+		len = tel->cnt;
+	}
+
+	else
+	{
+		rd = tel->wr;
+		len = VTB_TEL_SMP;
+	}
+
+	for (uint8_t i = 0; i < len; i++)
+	{
+		smp = &tel->smp[(rd + i) & (VTB_TEL_SMP - 1)];
+		prt_printf ("%d,", smp->ts);
+		prt_vtb_tel_prt_int (smp->err);
+		prt_printf (",");
+		prt_vtb_tel_prt_int (smp->sum);
+		prt_printf (",");
+		prt_vtb_tel_prt_int (smp->co);
+		prt_printf (",%d,%d,%d\n", smp->lock, smp->max_wrds, smp->min_wrds);
+	}
+}
+
+// Telemetry print statistics
+// The mean is the reference plus the mean deviation.
+// The variance is (sum of squares - sum * mean) / samples, 
+// this is closer than the squared integer mean and it can't underflow.
+void prt_vtb_tel_prt_stat (char *name, prt_vtb_tel_stat_struct *stat)
+{
+	// Variables
+	uint64_t mag;
+	uint32_t mean;
+	uint64_t var;
+
+	prt_printf ("%s,%d,", name, stat->n);
+
+	if (stat->n == 0)
+	{
+		prt_printf ("0,0,0,0,0\n");
+		return;
+	}
+
+	// Mean deviation
+	if (stat->sum < 0)
+		mag = -stat->sum;
+	else
+		mag = stat->sum;
+
+	mean = prt_vtb_div64 (mag, stat->n);
+
+	// Variance
+	// The variance saturates at 32 bits
+	if ((stat->sq >> 32) >= stat->n)
+		var = 0xffffffff;
+
+	else if ((mag >> 32) == 0)
+		var = prt_vtb_div64 (stat->sq - prt_vtb_mul64 (mag, mean), stat->n);
+
+	else
+		var = prt_vtb_div64 (stat->sq, stat->n) - prt_vtb_mul64 (mean, mean);
+
+	if (stat->sum < 0)
+		prt_vtb_tel_prt_int (stat->ref - mean);
+	else
+		prt_vtb_tel_prt_int (stat->ref + mean);
+
+	prt_printf (",%d,", (uint32_t)var);
+	prt_vtb_tel_prt_int (stat->min);
+	prt_printf (",");
+	prt_vtb_tel_prt_int (stat->max);
+	prt_printf (",%d\n", stat->max - stat->min);
+}
+
+// Telemetry print signed integer
+void prt_vtb_tel_prt_int (prt_s32 dat)
+{
+	if (dat < 0)
+		prt_printf ("-%d", -dat);
+	else
+		prt_printf ("%d", dat);
+}
+
 // FIFO lock
 uint8_t prt_vtb_get_fifo_lock (prt_vtb_ds_struct *vtb)
 {
@@ -559,65 +1164,42 @@ uint32_t prt_vtb_get_vid_clk_freq (prt_vtb_ds_struct *vtb)
 }
 
 // Find preset
+// Binary search of the preset lookup table
 uint8_t prt_vtb_find_preset (prt_u16 htotal, prt_u16 vtotal, uint32_t *pclk)
 {
-	uint8_t preset = 0;
-
-	if ( (htotal == VTB_1280X720P50_HTOTAL) && (vtotal == VTB_1280X720P50_VTOTAL))
-	{
-		preset = VTB_PRESET_1280X720P50;
-		*pclk = VTB_1280X720P50_PCLK;
-	}
-
-	else if ( (htotal == VTB_1280X720P60_HTOTAL) && (vtotal == VTB_1280X720P60_VTOTAL))
-	{
-		preset = VTB_PRESET_1280X720P60;
-		*pclk = VTB_1280X720P60_PCLK;
-	}
-
-	else if ( (htotal == VTB_1920X1080P50_HTOTAL) && (vtotal == VTB_1920X1080P50_VTOTAL))
-	{
-		preset = VTB_PRESET_1920X1080P50;
-		*pclk = VTB_1920X1080P50_PCLK;
-	}
-
-	else if ( (htotal == VTB_1920X1080P60_HTOTAL) && (vtotal == VTB_1920X1080P60_VTOTAL))
-	{
-		preset = VTB_PRESET_1920X1080P60;
-		*pclk = VTB_1920X1080P60_PCLK;
-	}
-
-	else if ( (htotal == VTB_2560X1440P50_HTOTAL) && (vtotal == VTB_2560X1440P50_VTOTAL))
-	{
-		preset = VTB_PRESET_2560X1440P50;
-		*pclk = VTB_2560X1440P50_PCLK;
-	}
-
-	else if ( (htotal == VTB_2560X1440P60_HTOTAL) && (vtotal == VTB_2560X1440P60_VTOTAL))
-	{
-		preset = VTB_PRESET_2560X1440P60;
-		*pclk = VTB_2560X1440P60_PCLK;
-	}
-
-	else if ( (htotal == VTB_3840X2160P50_HTOTAL) && (vtotal == VTB_3840X2160P50_VTOTAL))
-	{
-		preset = VTB_PRESET_3840X2160P50;
-		*pclk = VTB_3840X2160P50_PCLK;
-	}
+	// Variables
+	uint32_t key;
+	uint8_t lo;
+	uint8_t hi;
+	uint8_t mid;
+	uint8_t preset;
 
-	else if ( (htotal == VTB_3840X2160P60_HTOTAL) && (vtotal == VTB_3840X2160P60_VTOTAL))
-	{
-		preset = VTB_PRESET_3840X2160P60;
-		*pclk = VTB_3840X2160P60_PCLK;
-	}
+	key = VTB_PRESET_KEY (htotal, vtotal);
+	lo = 0;
+	hi = VTB_PRESETS;
 
-	else if ( (htotal == VTB_7680X4320P30_HTOTAL) && (vtotal == VTB_7680X4320P30_VTOTAL))
+	while (lo < hi)
 	{
-		preset = VTB_PRESET_7680X4320P30;
-		*pclk = VTB_7680X4320P30_PCLK;
+		mid = (lo + hi) >> 1;
+
+		// Match
+		if (prt_vtb_preset_key[mid] == key)
+		{
+			preset = prt_vtb_preset_idx[mid];
+			*pclk = prt_vtb_preset_tp[preset - 1].pclk;
+			return preset;
+		}
+
+		// Upper half
+		else if (prt_vtb_preset_key[mid] < key)
+			lo = mid + 1;
+
+		// Lower half
+		else
+			hi = mid;
 	}
 
-	return preset;
+	return 0;
 }
 
 // Overlay enable / disable
@@ -640,3 +1222,283 @@ void prt_vtb_ovl_en (prt_vtb_ds_struct *vtb, uint8_t en)
 	// Update overlay run flag
 	prt_vtb_set_og (vtb, PRT_VTB_OG_CTL, dat);
 }
+
+// CVT timing
+// Computes the timing parameters with the VESA Coordinated Video Timing formulas (CVT 1.2).
+// The formulas are rearranged to integer arithmetic, the results are exact.
+// Only progressive timings without margins are supported. The refresh rate is in Hz.
+// This function returns PRT_FALSE when the timing can't be computed.
+uint8_t prt_vtb_cvt (prt_vtb_tp_struct *tp, uint16_t width, uint16_t height, uint8_t refresh, uint8_t mode)
+{
+	// Variables
+	uint32_t h;			// Active pixels
+	uint32_t vsync;		// Vertical sync
+	uint32_t per;		// Field period minus the minimum vertical blanking (us), times the refresh rate
+	uint32_t lines;		// Field lines times the refresh rate
+	uint32_t vbi;		// Vertical blanking (lines)
+	uint32_t hblank;	// Horizontal blanking
+	uint32_t n;
+	uint32_t d;
+
+	if ((width == 0) || (height == 0) || (refresh == 0))
+		return PRT_FALSE;
+
+	switch (mode)
+	{
+		case VTB_CVT :
+			h = width & ~(VTB_CVT_CELL_GRAN - 1);
+			vsync = prt_vtb_cvt_vsync (width, height);
+
+			// The horizontal period estimate is (1000000 / refresh - 550) / (height + 3) us.
+			// Both terms are multiplied by the refresh rate, so they stay integer.
+			per = 1000000 - (VTB_CVT_MIN_VSYNC_BP * refresh);
+			lines = prt_dp_mul (refresh, height + VTB_CVT_MIN_V_PORCH);
+
+			// Vertical sync and back porch
+			vbi = prt_vtb_div64 (prt_vtb_mul64 (VTB_CVT_MIN_VSYNC_BP, lines), per) + 1;
+			if (vbi < (vsync + VTB_CVT_MIN_V_BPORCH))
+				vbi = vsync + VTB_CVT_MIN_V_BPORCH;
+
+			tp->vtotal = height + vbi + VTB_CVT_MIN_V_PORCH;
+			tp->vstart = vbi;
+			tp->vsw = vsync;
+
+			// The ideal duty cycle is 30 - 0.3 * horizontal period (us), which is (30 * d - n) / d %
+			n = 3 * per;
+			d = 10 * lines;
+
+			// The minimum duty cycle is 20 %
+			if (n > (10 * d))
+				hblank = (h >> 6) << 4;
+
+			// Blanking is active pixels * duty cycle / (100 - duty cycle), rounded down to two cells
+			else
+				hblank = prt_vtb_div64 (prt_vtb_mul64 (h, (30 * d) - n), (70 * d) + n);
+
+			hblank &= ~((2 * VTB_CVT_CELL_GRAN) - 1);
+
+			tp->htotal = h + hblank;
+
+			// The horizontal sync is 8 % of the total, rounded down to a cell
+			tp->hsw = prt_dp_div (tp->htotal, 100) * VTB_CVT_CELL_GRAN;
+			tp->hstart = tp->hsw + (hblank >> 1);
+
+			// Pixel clock in 250 kHz steps
+			tp->pclk = prt_vtb_div64 (prt_vtb_mul64 (tp->htotal << 2, lines), per) * 250;
+			break;
+
+		case VTB_CVT_RB :
+			h = width & ~(VTB_CVT_CELL_GRAN - 1);
+			vsync = prt_vtb_cvt_vsync (width, height);
+			per = 1000000 - (VTB_CVT_RB_MIN_V_BLANK * refresh);
+			lines = prt_dp_mul (refresh, height);
+
+			// Vertical blanking
+			vbi = prt_vtb_div64 (prt_vtb_mul64 (VTB_CVT_RB_MIN_V_BLANK, lines), per) + 1;
+			if (vbi < (VTB_CVT_RB_V_FPORCH + vsync + VTB_CVT_MIN_V_BPORCH))
+				vbi = VTB_CVT_RB_V_FPORCH + vsync + VTB_CVT_MIN_V_BPORCH;
+
+			tp->vtotal = height + vbi;
+			tp->vstart = vbi - VTB_CVT_RB_V_FPORCH;
+			tp->vsw = vsync;
+
+			// The horizontal blanking is fixed, the back porch is half of the blanking
+			tp->htotal = h + VTB_CVT_RB_H_BLANK;
+			tp->hsw = VTB_CVT_RB_H_SYNC;
+			tp->hstart = VTB_CVT_RB_H_SYNC + (VTB_CVT_RB_H_BLANK >> 1);
+
+			// Pixel clock in 250 kHz steps
+			tp->pclk = prt_vtb_div64 (prt_vtb_mul64 (prt_dp_mul (refresh, tp->vtotal), tp->htotal), 250000) * 250;
+			break;
+
+		case VTB_CVT_RB2 :
+			h = width;
+			per = 1000000 - (VTB_CVT_RB_MIN_V_BLANK * refresh);
+			lines = prt_dp_mul (refresh, height);
+
+			// Vertical blanking
+			vbi = prt_vtb_div64 (prt_vtb_mul64 (VTB_CVT_RB_MIN_V_BLANK, lines), per) + 1;
+			if (vbi < (VTB_CVT_RB2_MIN_V_FPORCH + VTB_CVT_RB2_V_SYNC + VTB_CVT_MIN_V_BPORCH))
+				vbi = VTB_CVT_RB2_MIN_V_FPORCH + VTB_CVT_RB2_V_SYNC + VTB_CVT_MIN_V_BPORCH;
+
+			// The front porch takes the remaining blanking
+			tp->vtotal = height + vbi;
+			tp->vstart = VTB_CVT_RB2_V_SYNC + VTB_CVT_MIN_V_BPORCH;
+			tp->vsw = VTB_CVT_RB2_V_SYNC;
+
+			tp->htotal = h + VTB_CVT_RB2_H_BLANK;
+			tp->hsw = VTB_CVT_RB_H_SYNC;
+			tp->hstart = VTB_CVT_RB_H_SYNC + VTB_CVT_RB2_H_BPORCH;
+
+			// Pixel clock in 1 kHz steps
+			tp->pclk = prt_vtb_div64 (prt_vtb_mul64 (prt_dp_mul (refresh, tp->vtotal), tp->htotal), 1000);
+			break;
+
+		default :
+			return PRT_FALSE;
+	}
+
+	tp->hwidth = h;
+	tp->vheight = height;
+
+	return PRT_TRUE;
+}
+
+// CVT vertical sync
+// The vertical sync width encodes the aspect ratio
+uint8_t prt_vtb_cvt_vsync (uint16_t width, uint16_t height)
+{
+	// Variables
+	uint32_t w = width;
+	uint32_t h = height;
+
+	// 4:3
+	if ((w * 3) == (h * 4))
+		return 4;
+
+	// 16:9
+	else if ((w * 9) == (h * 16))
+		return 5;
+
+	// 16:10
+	else if ((w * 10) == (h * 16))
+		return 6;
+
+	// 5:4 and 15:9
+	else if (((w * 4) == (h * 5)) || ((w * 9) == (h * 15)))
+		return 7;
+
+	// Other
+	else
+		return 10;
+}
+
+// CVT classify
+// Finds the CVT timing of incoming timing parameters, for example the DPRX MSA.
+// The active pixels and lines must match. The totals must match within the tolerance.
+// When the pixel clock is known (non zero), it must also match within the tolerance.
+// The timing of the best match is copied to ref.
+// This function returns the CVT mode of the best match or VTB_CVT_NONE.
+uint8_t prt_vtb_cvt_classify (prt_vtb_tp_struct *tp, prt_vtb_tp_struct *ref)
+{
+	// Variables
+	static const uint8_t rates[] = {24, 25, 30, 48, 50, 60, 72, 75, 85, 100, 120, 144, 165, 240};
+	prt_vtb_tp_struct cvt;
+	uint8_t mode = VTB_CVT_NONE;
+	uint32_t best = 0xffffffff;
+	uint32_t err;
+	uint32_t dif;
+
+	for (uint8_t m = VTB_CVT; m <= VTB_CVT_RB2; m++)
+	{
+		for (uint8_t r = 0; r < sizeof (rates); r++)
+		{
+			if (!prt_vtb_cvt (&cvt, tp->hwidth, tp->vheight, rates[r], m))
+				continue;
+
+			// The active pixels are rounded to the character cell
+			if (cvt.hwidth != tp->hwidth)
+				continue;
+
+			// Horizontal total
+			if (cvt.htotal > tp->htotal)
+				err = cvt.htotal - tp->htotal;
+			else
+				err = tp->htotal - cvt.htotal;
+
+			if (err > VTB_CVT_TOL_H)
+				continue;
+
+			// Vertical total
+			if (cvt.vtotal > tp->vtotal)
+				dif = cvt.vtotal - tp->vtotal;
+			else
+				dif = tp->vtotal - cvt.vtotal;
+
+			if (dif > VTB_CVT_TOL_V)
+				continue;
+
+			err += dif;
+
+			// Pixel clock
+			if (tp->pclk != 0)
+			{
+				if (cvt.pclk > tp->pclk)
+					dif = cvt.pclk - tp->pclk;
+				else
+					dif = tp->pclk - cvt.pclk;
+
+				if (dif > (cvt.pclk >> VTB_CVT_TOL_PCLK_SHIFT))
+					continue;
+
+				err += dif;
+			}
+
+			// Best match
+			if (err < best)
+			{
+				best = err;
+				mode = m;
+				ref->htotal = cvt.htotal;
+				ref->hwidth = cvt.hwidth;
+				ref->hstart = cvt.hstart;
+				ref->hsw = cvt.hsw;
+				ref->vtotal = cvt.vtotal;
+				ref->vheight = cvt.vheight;
+				ref->vstart = cvt.vstart;
+				ref->vsw = cvt.vsw;
+				ref->pclk = cvt.pclk;
+			}
+		}
+	}
+
+	return mode;
+}
+
+// Multiply 64-bits
+// Shift and add, as the processor has no multiplier
+uint64_t prt_vtb_mul64 (uint32_t a, uint32_t b)
+{
+	// Variables
+	uint64_t r = 0;
+	uint64_t x = a;
+
+	while (b)
+	{
+		if (b & 1)
+			r += x;
+		x <<= 1;
+		b >>= 1;
+	}
+
+	return r;
+}
+
+// Divide 64-bits
+// Shift and subtract, as the processor has no divider.
+// The quotient must fit in 32 bits.
+uint32_t prt_vtb_div64 (uint64_t n, uint32_t d)
+{
+	// Variables
+	uint64_t r = 0;
+	uint32_t q = 0;
+
+	if (d == 0)
+		return 0;
+
+	for (uint8_t i = 0; i < 64; i++)
+	{
+		// Next bit of the dividend
+		r = (r << 1) | (n >> 63);
+		n <<= 1;
+		q <<= 1;
+
+		if (r >= d)
+		{
+			r -= d;
+			q |= 1;
+		}
+	}
+
+	return q;
+}
@@ -12,6 +12,11 @@
     v1.0 - Initial release
     v1.1 - Added video resolution 7680X4320P30
     v1.2 - Added video resolution 5120X2160P60
+    v1.3 - Added CVT timing engine
+    v1.4 - Added preset timing table
+    v1.5 - Added clock recovery tuning
+    v1.6 - Added clock recovery telemetry
+    v1.7 - Added shadow registers and VPS address auto increment
 
     License
     =======
@@ -36,6 +41,7 @@
 #define PRT_VTB_DEV_CTL_IG_SHIFT		0
 #define PRT_VTB_DEV_CTL_OG_SHIFT		8
 #define PRT_VTB_DEV_CTL_VPS_SHIFT		16
+#define PRT_VTB_DEV_CTL_VPS_AINC		(1 << 20)
 
 // Ingress
 #define PRT_VTB_IG_TX_LNK_CLK_FREQ		0
@@ -85,6 +91,15 @@
 #define PRT_VTB_VPS_VHEIGHT			    9   
 #define PRT_VTB_VPS_VSTART			    10
 #define PRT_VTB_VPS_VSW				    11
+#define PRT_VTB_VPS_REGS			    12
+
+// Outgress registers
+#define PRT_VTB_OG_REGS				    2
+
+// VPS address auto increment
+#define PRT_VTB_VPS_AINC_UNKNOWN		0
+#define PRT_VTB_VPS_AINC_YES			1
+#define PRT_VTB_VPS_AINC_NO				2
 
 // Video timing
 #define VTB_PRESET_1280X720P50          1
@@ -95,8 +110,12 @@
 #define VTB_PRESET_2560X1440P60         6
 #define VTB_PRESET_3840X2160P50         7
 #define VTB_PRESET_3840X2160P60         8
-#define VTB_PRESET_5120X2160P60         9
+#define VTB_PRESET_5120X2880P60         9
 #define VTB_PRESET_7680X4320P30         10
+#define VTB_PRESETS                     10      // Number of presets
+
+// Preset lookup key
+#define VTB_PRESET_KEY(htotal, vtotal)  (((uint32_t)(htotal) << 16) | (vtotal))
 
 // 1280 x 720p @ 50Hz
 #define VTB_1280X720P50_HTOTAL 		    1980
@@ -186,6 +205,17 @@
 #define VTB_3840X2160P60_VSW 			10
 #define VTB_3840X2160P60_PCLK           594000
 
+// 5120 x 2880p @ 60Hz (RB2)
+#define VTB_5120X2880P60_HTOTAL 		5200
+#define VTB_5120X2880P60_HWIDTH 		5120
+#define VTB_5120X2880P60_HSTART 		72
+#define VTB_5120X2880P60_HSW 			32
+#define VTB_5120X2880P60_VTOTAL 		2962
+#define VTB_5120X2880P60_VHEIGHT 		2880
+#define VTB_5120X2880P60_VSTART 		14
+#define VTB_5120X2880P60_VSW 			8
+#define VTB_5120X2880P60_PCLK 			924144
+
 // 7680 x 4320p @ 30Hz (RB2)
 #define VTB_7680X4320P30_HTOTAL 		7760
 #define VTB_7680X4320P30_HWIDTH 		7680
@@ -197,6 +227,48 @@
 #define VTB_7680X4320P30_VSW 			8
 #define VTB_7680X4320P30_PCLK 			1019896
 
+// CVT
+#define VTB_CVT_NONE                    0
+#define VTB_CVT                         1       // Normal blanking
+#define VTB_CVT_RB                      2       // Reduced blanking
+#define VTB_CVT_RB2                     3       // Reduced blanking version 2
+
+#define VTB_CVT_CELL_GRAN               8       // Character cell (pixels)
+#define VTB_CVT_MIN_VSYNC_BP            550     // Minimum vertical sync and back porch (us)
+#define VTB_CVT_MIN_V_PORCH             3       // Minimum vertical front porch (lines)
+#define VTB_CVT_MIN_V_BPORCH            6       // Minimum vertical back porch (lines)
+#define VTB_CVT_RB_MIN_V_BLANK          460     // Reduced blanking minimum vertical blanking (us)
+#define VTB_CVT_RB_H_BLANK              160     // Reduced blanking horizontal blanking (pixels)
+#define VTB_CVT_RB_H_SYNC               32      // Reduced blanking horizontal sync (pixels)
+#define VTB_CVT_RB_V_FPORCH             3       // Reduced blanking vertical front porch (lines)
+#define VTB_CVT_RB2_H_BLANK             80      // Reduced blanking v2 horizontal blanking (pixels)
+#define VTB_CVT_RB2_H_BPORCH            40      // Reduced blanking v2 horizontal back porch (pixels)
+#define VTB_CVT_RB2_V_SYNC              8       // Reduced blanking v2 vertical sync (lines)
+#define VTB_CVT_RB2_MIN_V_FPORCH        1       // Reduced blanking v2 minimum vertical front porch (lines)
+
+// CVT classification tolerance
+#define VTB_CVT_TOL_H                   8       // Horizontal total (pixels)
+#define VTB_CVT_TOL_V                   2       // Vertical total (lines)
+#define VTB_CVT_TOL_PCLK_SHIFT          7       // Pixel clock (1/128)
+
+// Clock recovery tuning
+#define VTB_CR_P_GAIN_MAX               0xff        // The controller uses 8 bits
+#define VTB_CR_I_GAIN_MAX               0x1fff      // The controller uses 13 bits
+#define VTB_CR_TUNE_STEPS               3           // Rounds, the gain step halves every round
+#define VTB_CR_TUNE_LOCK_TIMEOUT        1000000     // Lock timeout (us)
+#define VTB_CR_TUNE_WINDOW              100000      // Observation window after lock (us)
+#define VTB_CR_TUNE_SUM_MAX             16000       // Integrator saturation
+#define VTB_CR_TUNE_COST_MAX            0xffffffff  // No lock
+#define VTB_CR_TUNE_TIME_MAX            2000000     // Total tuning time (us)
+
+// Telemetry
+#define VTB_TEL_SMP                     64          // Ring buffer samples. Must be a power of two.
+#define VTB_TEL_PERIOD                  10000       // Default sample period (us)
+#define VTB_TEL_SIG_ERR                 0           // Error
+#define VTB_TEL_SIG_SUM                 1           // Integrator sum
+#define VTB_TEL_SIG_CO                  2           // Controller output
+#define VTB_TEL_SIGS                    3
+
 // TPG format
 #define VTB_TPG_FMT_FULL                0
 #define VTB_TPG_FMT_RED                 1
@@ -229,16 +301,81 @@ typedef struct {
     uint32_t pclk;
 } prt_vtb_tp_struct;
 
+// Clock recovery gains
+typedef struct {
+	uint32_t key;		// Timing key, zero when empty
+	uint8_t p_gain;
+	uint16_t i_gain;
+	uint32_t cost;		// Lock time (ms) plus FIFO and error excursion
+} prt_vtb_cr_gain_struct;
+
+// Telemetry sample
+typedef struct {
+	uint32_t ts;		// Timestamp (us)
+	prt_s32 co;			// Controller output
+	prt_s16 sum;		// Integrator sum
+	prt_s8 err;			// Error
+	uint8_t lock;		// FIFO lock
+	uint16_t max_wrds;	// FIFO maximum words
+	uint16_t min_wrds;	// FIFO minimum words
+} prt_vtb_tel_smp_struct;
+
+// Telemetry statistics
+// The sums are taken relative to the first sample, which keeps the squares small
+typedef struct {
+	uint32_t n;			// Samples
+	prt_s32 ref;		// Reference
+	prt_s32 min;		// Minimum
+	prt_s32 max;		// Maximum
+	int64_t sum;		// Sum of the deviations
+	uint64_t sq;		// Sum of the squared deviations
+} prt_vtb_tel_stat_struct;
+
+// Telemetry
+// The statistics are collected while the FIFO is locked
+typedef struct {
+	uint8_t run;							// Run
+	uint32_t period;						// Sample period (us)
+	uint32_t dl;							// Next sample
+	uint32_t cnt;							// Samples
+	uint8_t wr;								// Ring buffer write index
+	uint8_t lock;							// Lock state of the last sample
+	uint32_t lock_ts;						// Timestamp of the start or the last loss of lock
+	uint32_t lock_time;						// Last time to lock (us)
+	uint32_t lock_time_max;					// Maximum time to lock (us)
+	uint32_t lock_loss;						// Loss of lock events
+	uint16_t max_wrds;						// FIFO maximum words
+	uint16_t min_wrds;						// FIFO minimum words
+	prt_vtb_tel_stat_struct stat[VTB_TEL_SIGS];	// Statistics
+	prt_vtb_tel_smp_struct smp[VTB_TEL_SMP];	// Ring buffer
+} prt_vtb_tel_struct;
+
+// Idle callback
+// Runs while the clock recovery tuning waits
+typedef void (*prt_vtb_idle_cb)(void);
+
 // Data structure
 typedef struct {
 	volatile prt_vtb_dev_struct 	*dev;	// Device
+	prt_tmr_ds_struct 			    *tmr;	// Timer
 	uint32_t 					    refclk;	// Reference clock
 	uint32_t 					    vidclk;	// Video clock
 	prt_vtb_tp_struct 			    tp;		// Timing parameters
+	prt_vtb_cr_gain_struct		    cr_gain[VTB_PRESETS + 1];	// Tuned gains per preset, entry 0 is for other timings
+	prt_vtb_tel_struct			    *tel;	// Telemetry
+	prt_vtb_idle_cb				    idle;	// Idle callback
+	uint32_t					    og[PRT_VTB_OG_REGS];	// Outgress shadow
+	uint8_t						    og_vld;					// Outgress shadow valid
+	uint16_t					    vps[PRT_VTB_VPS_REGS];	// Video parameter set shadow
+	uint16_t					    vps_vld;				// Video parameter set shadow valid
+	uint16_t					    vps_dirty;				// Video parameter set dirty
+	uint8_t						    vps_ainc;				// Video parameter set address auto increment
 } prt_vtb_ds_struct;
 
 // Prototypes
 void prt_vtb_set_base (prt_vtb_ds_struct *vtb, uint32_t base);
+void prt_vtb_set_tmr (prt_vtb_ds_struct *vtb, prt_tmr_ds_struct *tmr);
+void prt_vtb_set_idle_cb (prt_vtb_ds_struct *vtb, prt_vtb_idle_cb cb);
 void prt_vtb_set_refclk (prt_vtb_ds_struct *vtb, uint32_t clk);
 void prt_vtb_set_vidclk (prt_vtb_ds_struct *vtb, uint32_t clk);
 void prt_vtb_set_tp (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset);
@@ -246,6 +383,9 @@ uint32_t prt_vtb_get_ig (prt_vtb_ds_struct *vtb, uint8_t ig);
 void prt_vtb_set_og (prt_vtb_ds_struct *vtb, uint8_t og, uint32_t dat);
 uint32_t prt_vtb_get_og (prt_vtb_ds_struct *vtb, uint8_t og);
 void prt_vtb_set_vps (prt_vtb_ds_struct *vtb, uint8_t vps, uint32_t dat);
+void prt_vtb_vps_wr (prt_vtb_ds_struct *vtb, uint8_t vps, uint16_t dat);
+void prt_vtb_vps_commit (prt_vtb_ds_struct *vtb);
+void prt_vtb_vid_str (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint32_t ctl);
 prt_vtb_tp_struct prt_vtb_get_tp (prt_vtb_ds_struct *vtb);
 void prt_vtb_tpg (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint8_t fmt);
 uint8_t prt_vtb_find_preset (uint16_t htotal, uint16_t vtotal, uint32_t *pclk);
@@ -264,6 +404,22 @@ prt_s8 prt_vtb_get_cr_max_err (prt_vtb_ds_struct *vtb);
 prt_s8 prt_vtb_get_cr_min_err (prt_vtb_ds_struct *vtb);
 prt_s16 prt_vtb_get_cr_sum (prt_vtb_ds_struct *vtb);
 prt_s32 prt_vtb_get_cr_co (prt_vtb_ds_struct *vtb);
+uint8_t prt_vtb_cr_get_p_gain (prt_vtb_ds_struct *vtb);
+uint16_t prt_vtb_cr_get_i_gain (prt_vtb_ds_struct *vtb);
+uint8_t prt_vtb_cr_tune (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint8_t force);
+uint32_t prt_vtb_cr_measure (prt_vtb_ds_struct *vtb, prt_vtb_tp_struct *tp, uint8_t preset, uint8_t p_gain, uint16_t i_gain, uint32_t limit);
+uint16_t prt_vtb_cr_step (uint16_t gain, uint8_t step, uint8_t up, uint16_t max);
+
+// Telemetry
+void prt_vtb_set_tel (prt_vtb_ds_struct *vtb, prt_vtb_tel_struct *tel);
+void prt_vtb_tel_str (prt_vtb_ds_struct *vtb, uint32_t period);
+void prt_vtb_tel_stp (prt_vtb_ds_struct *vtb);
+void prt_vtb_tel_poll (prt_vtb_ds_struct *vtb);
+void prt_vtb_tel_smp (prt_vtb_ds_struct *vtb);
+void prt_vtb_tel_acc (prt_vtb_tel_stat_struct *stat, prt_s32 dat);
+void prt_vtb_tel_dump (prt_vtb_ds_struct *vtb);
+void prt_vtb_tel_prt_stat (char *name, prt_vtb_tel_stat_struct *stat);
+void prt_vtb_tel_prt_int (prt_s32 dat);
 
 // Frequency
 uint32_t prt_vtb_get_tx_lnk_clk_freq (prt_vtb_ds_struct *vtb);
@@ -273,3 +429,10 @@ uint32_t prt_vtb_get_vid_clk_freq (prt_vtb_ds_struct *vtb);
 
 // Overlay
 void prt_vtb_ovl_en (prt_vtb_ds_struct *vtb, uint8_t en);
+
+// CVT
+uint8_t prt_vtb_cvt (prt_vtb_tp_struct *tp, uint16_t width, uint16_t height, uint8_t refresh, uint8_t mode);
+uint8_t prt_vtb_cvt_classify (prt_vtb_tp_struct *tp, prt_vtb_tp_struct *ref);
+uint8_t prt_vtb_cvt_vsync (uint16_t width, uint16_t height);
+uint64_t prt_vtb_mul64 (uint32_t a, uint32_t b);
+uint32_t prt_vtb_div64 (uint64_t n, uint32_t d);